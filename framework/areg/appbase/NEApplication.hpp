@@ -123,6 +123,20 @@ namespace NEApplication
      **/
     constexpr unsigned short    DEFAULT_LOGGER_PORT         { 8282 };
 
+    /**
+     * \brief   NEApplication::DEFAULT_SEND_QUEUE_SIZE
+     *          The default limit in bytes of data queued to send to a single client of the remote service.
+     *          Zero means there is no limit.
+     **/
+    constexpr uint32_t          DEFAULT_SEND_QUEUE_SIZE     { 16 * 1024 * 1024 };
+
+    /**
+     * \brief   NEApplication::DEFAULT_SERVICE_WORKERS
+     *          The default number of threads to send and receive messages of the remote service clients.
+     *          Zero means the number of processor cores.
+     **/
+    constexpr uint32_t          DEFAULT_SERVICE_WORKERS     { 1 };
+
     /**
      * \brief   NEApplication::DEFAULT_SERVICE_HOST
      *          Default IP-Address of any remote service.
@@ -162,12 +176,24 @@ namespace NEApplication
       **/
     constexpr std::string_view  DEFAULT_LOG_FILE            { "./logs/trace_%time%.log" };
 
+    /**
+     * \brief  NEApplication::DEFAULT_LOG_FILE_SYNC
+     *         The default policy to synchronize the log file with the storage device.
+     **/
+    constexpr std::string_view  DEFAULT_LOG_FILE_SYNC       { "batch" };
+
     /**
      * \brief  NEApplication::DEFAULT_LOG_QUEUE_SIZE
      *         The default size to queue logs in the stack, used for remote logging.
      **/
     constexpr uint32_t          DEFAULT_LOG_QUEUE_SIZE      { 100 };
 
+    /**
+     * \brief  NEApplication::DEFAULT_LOG_BATCH_SIZE
+     *         The default size in bytes of the log records sent in one message, used for remote logging.
+     **/
+    constexpr uint32_t          DEFAULT_LOG_BATCH_SIZE      { 16384 };
+
      /**
       * \brief  NEApplication::DEFAULT_LOG_FILE
       *         The default layout to display enter scope on console in the plain text file
@@ -221,7 +247,9 @@ namespace NEApplication
             , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectTcpip)      , {"tcpip"  }, true  }
             , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUdp)        , {"udp"    }, false }
             , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectWeb)        , {"web"    }, false }
-            , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectSM)         , {"sm"     }, false }
+            , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectSM)         , {"sm"     }, true  }
+            , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUds)        , {"uds"    }, true  }
+            , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectDirect)     , {"direct" }, true  }
         };
 
     /**
@@ -253,8 +281,10 @@ namespace NEApplication
             , { {"log"      , "*"   , "enable"  , "db"      }, "false"                          }   //!< The logging in database enabled / disabled flag.
             , { {"log"      , "*"   , "file"    , "location"}, DEFAULT_LOG_FILE                 }   //!< The log file location and file name mask.
             , { {"log"      , "*"   , "file"    , "append"  }, "false"                          }   //!< The flag to append logs into the file.
+            , { {"log"      , "*"   , "file"    , "sync"    }, DEFAULT_LOG_FILE_SYNC            }   //!< The policy to synchronize the log file with the storage.
             , { {"log"      , "*"   , "remote"  , "queue"   }, "100"                            }   //!< The queue size of remote logging.
             , { {"log"      , "*"   , "remote"  , "service" }, "logger"                         }   //!< The service name of the remote logging.
+            , { {"log"      , "*"   , "remote"  , "batch"   }, "16384"                          }   //!< The size in bytes of the batch of log records in remote logging.
             , { {"log"      , "*"   , "layout"  , "enter"   }, DEFAULT_LAYOUT_SCOPE_EXIT        }   //!< The layout of enter scope message.
             , { {"log"      , "*"   , "layout"  , "message" }, DEFAULT_LAYOUT_LOG_MESSAGE       }   //!< The layout of log message.
             , { {"log"      , "*"   , "layout"  , "exit"    }, DEFAULT_LAYOUT_SCOPE_EXIT        }   //!< The layout of exit scope message.
@@ -35,6 +35,8 @@ AREG_API_IMPL const std::vector<Identifier>   NEApplication::ConnectionIdentifie
     , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUdp)        , NEApplication::DefaultConnections[2].ltIdName     }
     , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectWeb)        , NEApplication::DefaultConnections[3].ltIdName     }
     , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectSM)         , NEApplication::DefaultConnections[4].ltIdName     }
+    , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUds)        , NEApplication::DefaultConnections[5].ltIdName     }
+    , { static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectDirect)     , NEApplication::DefaultConnections[6].ltIdName     }
 };
 
 //! Remote service identifiers
@@ -47,6 +47,11 @@ protected:
      **/
     using ByteBufferDeleter     = NEMemory::BufferDeleter<NEMemory::sByteBuffer>;
 
+    /**
+     * \brief   Shared pointer deleter of buffers allocated by caller in the heap.
+     **/
+    using HeapByteBufferDeleter = NEMemory::HeapBufferDeleter<NEMemory::sByteBuffer>;
+
     /**
      * \brief   IEByteBuffer::MAX_BUF_LENGTH
      *          Maximum length of byte buffer. It is defined as 64 Mb.
@@ -63,7 +68,10 @@ protected:
     IEByteBuffer( void );
 
     /**
-     * \brief   Initializes byte-buffer from given source
+     * \brief   Initializes byte-buffer from given source. The source buffer should be
+     *          allocated in the heap as an array of bytes, it is deleted when it is not
+     *          used anymore. Only the buffers allocated by reserve() are released to
+     *          the memory pool.
      **/
     IEByteBuffer( NEMemory::sByteBuffer & byteBuffer );
 
@@ -0,0 +1,113 @@
+#ifndef AREG_BASE_MEMORYPOOL_HPP
+#define AREG_BASE_MEMORYPOOL_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/MemoryPool.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pool of small memory blocks used by
+ *              events and byte buffers.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The pool of small memory blocks. The blocks are grouped in size
+ *          classes and carved from slabs allocated in the heap. Every thread
+ *          keeps a cache of free blocks per size class, so that allocating and
+ *          releasing a block does not require any lock. If a thread releases
+ *          more blocks than it allocates (for example, a dispatcher thread
+ *          destroying events created by other threads), the free blocks are
+ *          moved in batches to the shared depot, where other threads take them.
+ *          The blocks bigger than the largest size class are allocated in the heap.
+ *
+ *          The slabs are never returned to the heap. In the steady state the
+ *          pool does not allocate memory, which can be verified by the
+ *          statistics returned by getStatistics().
+ **/
+class AREG_API MemoryPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   MemoryPool::sPoolStatistics
+     *          The counters of the memory pool.
+     **/
+    struct sPoolStatistics
+    {
+        //!< The number of slabs allocated in the heap.
+        uint64_t    psSlabCount;
+        //!< The number of bytes allocated by slabs.
+        uint64_t    psSlabBytes;
+        //!< The number of blocks bigger than the largest size class, allocated in the heap.
+        uint64_t    psLargeAllocs;
+        //!< The number of blocks bigger than the largest size class, released to the heap.
+        uint64_t    psLargeReleases;
+        //!< The number of batches of free blocks moved from thread caches to the depot.
+        uint64_t    psBatchReleased;
+        //!< The number of batches of free blocks moved from the depot to thread caches.
+        uint64_t    psBatchAcquired;
+    };
+
+    /**
+     * \brief   MemoryPool::MAXIMUM_BLOCK_SIZE
+     *          The biggest size of memory, which is allocated in the pool.
+     **/
+    static constexpr uint32_t   MAXIMUM_BLOCK_SIZE  { 4096u - 16u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory block of specified size. The block is
+     *          aligned to 16 bytes. If the size is bigger than MAXIMUM_BLOCK_SIZE,
+     *          the block is allocated in the heap.
+     * \param   size    The size in bytes of memory to allocate.
+     * \return  Returns the pointer to allocated memory.
+     *          Throws std::bad_alloc if failed to allocate memory.
+     **/
+    static void * allocate( size_t size );
+
+    /**
+     * \brief   Releases the memory block allocated by allocate() method.
+     *          The block can be released in any thread.
+     * \param   block   The memory block to release. Ignored if nullptr.
+     **/
+    static void release( void * block );
+
+    /**
+     * \brief   Moves all free blocks of the cache of current thread to the depot.
+     *          Called automatically when the thread exits.
+     **/
+    static void releaseThreadCache( void );
+
+    /**
+     * \brief   Returns the statistics of the memory pool.
+     **/
+    static MemoryPool::sPoolStatistics getStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    MemoryPool( void ) = delete;
+    ~MemoryPool( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( MemoryPool );
+};
+
+#endif  // AREG_BASE_MEMORYPOOL_HPP
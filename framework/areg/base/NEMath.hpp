@@ -100,6 +100,12 @@ namespace NEMath
      **/
     constexpr unsigned int  CHECKSUM_IGNORE     { 0u };
 
+    /**
+     * \brief   NEMath::CRC32_POLYNOMIAL
+     *          The reversed polynomial of the standard IEEE 802.3 32-bit CRC.
+     **/
+    constexpr unsigned int  CRC32_POLYNOMIAL    { 0xEDB88320u };
+
 /************************************************************************/
 // NEMath namespace structures
 /************************************************************************/
@@ -377,6 +383,18 @@ namespace NEMath
      **/
     AREG_API unsigned int crc32Calculate( const wchar_t * strData );
 
+    /**
+     * \brief	Cyclic Redundancy Check (CRC) calculation function on
+     *          standard IEEE 802.3, which can be evaluated at compile time.
+     *          Calculates and returns 32-bit CRC value of a null-terminated string.
+     *          The result is equal to the result of crc32Calculate( const char * ).
+     *          The function calculates bit by bit and it should be used to calculate
+     *          CRC of the string literals at compile time.
+     * \param	strData Pointer to null-terminated string to calculate CRC
+     * \return	32-bit value of Cyclic Redundancy Check (CRC)
+     **/
+    inline constexpr unsigned int crc32Constexpr( const char * strData );
+
     /**
      * \brief	Return initial 32-bit value of Cyclic Redundancy Check (CRC)
      **/
@@ -476,6 +494,21 @@ namespace NEMath
 // NEMath namespace inline function implementation
 //////////////////////////////////////////////////////////////////////////
 
+inline constexpr unsigned int NEMath::crc32Constexpr( const char * strData )
+{
+    unsigned int result = static_cast<unsigned int>(~0);   // initialize
+    for ( ; (strData != nullptr) && (*strData != static_cast<char>('\0')); ++ strData )
+    {
+        result ^= static_cast<unsigned char>(*strData);
+        for ( int bit = 0; bit < 8; ++ bit )
+        {
+            result = (result >> 1) ^ (NEMath::CRC32_POLYNOMIAL & (0u - (result & 1u)));
+        }
+    }
+
+    return (~result);   // return result
+}
+
 template <typename Type>
 inline Type & NEMath::getMin( const Type & a, const Type & b )
 {
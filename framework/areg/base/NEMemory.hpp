@@ -21,6 +21,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/base/IEIOStream.hpp"
+#include "areg/base/MemoryPool.hpp"
 #include "areg/base/NEMath.hpp"
 
 #include <new>
@@ -648,7 +649,7 @@ namespace NEMemory
     inline bool memEqual( const void * memLeft, const void * memRight, uint32_t count);
 
     /**
-     * \brief   The custom buffer allocator.
+     * \brief   The custom buffer allocator. The buffers are allocated in the memory pool.
      **/
     template<typename BufType>
     struct BufferAllocator
@@ -660,7 +661,7 @@ namespace NEMemory
     };
 
     /**
-     * \brief   The custom buffer deleter.
+     * \brief   The custom buffer deleter. The buffers are released to the memory pool.
      **/
     template<typename BufType>
     struct BufferDeleter
@@ -670,6 +671,18 @@ namespace NEMemory
          **/
         void operator ( ) (void * buffer);
     };
+
+    /**
+     * \brief   The custom deleter of buffers allocated in the heap as an array of bytes.
+     **/
+    template<typename BufType>
+    struct HeapBufferDeleter
+    {
+        /**
+         * \brief   The operator is called when buffer object should be deleted.
+         **/
+        void operator ( ) (void * buffer);
+    };
 }
 
 /************************************************************************
@@ -970,12 +983,21 @@ inline void NEMemory::zeroElements( ELEM * elemList, uint32_t elemCount )
 template<typename BufType>
 BufType* NEMemory::BufferAllocator<BufType>::operator ( ) (uint32_t space)
 {
-    unsigned char* result = DEBUG_NEW unsigned char[space];
+    void * result = MemoryPool::allocate(space);
     return ::new(result) BufType;
 }
 
 template<typename BufType>
 void NEMemory::BufferDeleter<BufType>::operator ( ) (void * buffer)
+{
+    if ( buffer != nullptr )
+    {
+        MemoryPool::release(buffer);
+    }
+}
+
+template<typename BufType>
+void NEMemory::HeapBufferDeleter<BufType>::operator ( ) (void * buffer)
 {
     if ( buffer != nullptr )
     {
@@ -39,8 +39,9 @@ struct sockaddr_in;
  *          to resolve names and get connected peer address.
  *
  * \note    Currently the existing socket functionalities support only TCP/IP
- *          connection for IP4 addresses. All other connection types
- *          are ignored and out of scope of this namespace
+ *          connection for IP4 addresses and the local (Unix domain) stream
+ *          sockets. All other connection types are ignored and out of scope
+ *          of this namespace
  **/
 namespace NESocket
 {
@@ -158,6 +159,14 @@ namespace NESocket
          **/
         bool resolveSocket( SOCKETHANDLE hSocket );
 
+        /**
+         * \brief   Resolves and retrieves the local address to which a socket is bound.
+         *          The function can be used on a connected or bound socket.
+         * \param   hSocket     The socket descriptor of connected or bound socket.
+         * \return  Returns true if succeeded to resolve the local address of the socket.
+         **/
+        bool resolveLocalSocket( SOCKETHANDLE hSocket );
+
         /**
          * \brief   Returns IP address of host as readable string.
          **/
@@ -349,6 +358,42 @@ namespace NESocket
      **/
     extern AREG_API const int           MAXIMUM_LISTEN_QUEUE_SIZE   /*= SOMAXCONN*/;
 
+    /**
+     * \brief   NESocket::MAXIMUM_SEND_BUFFERS
+     *          The maximum number of buffers sent at once by a single gather send call.
+     **/
+    constexpr int                       MAXIMUM_SEND_BUFFERS        { 64 };
+
+    /**
+     * \brief   NESocket::sSendBuffer
+     *          Describes a single data buffer of the gather send call.
+     **/
+    typedef struct S_SendBuffer
+    {
+        const unsigned char *   sbData;     //!< The pointer to the data to send.
+        unsigned int            sbLength;   //!< The length of data in bytes.
+    } sSendBuffer;
+
+    /**
+     * \brief   NESocket::sSocketProfile
+     *          The options applied to the connected and accepted TCP/IP sockets.
+     *          The profile is applied once when the connection is established.
+     **/
+    typedef struct S_SocketProfile
+    {
+        bool            spNoDelay;      //!< If true, disables Nagle algorithm (TCP_NODELAY) and small messages are sent without delay.
+        bool            spKeepAlive;    //!< If true, enables keep-alive probes (SO_KEEPALIVE) to detect the lost connections.
+        unsigned int    spBufferSize;   //!< The size in bytes of socket send and receive buffers. Zero keeps the system default.
+        unsigned int    spBusyPoll;     //!< The time in microseconds to busy poll when receiving (SO_BUSY_POLL, Linux only). Zero disables it.
+    } sSocketProfile;
+
+    /**
+     * \brief   NESocket::DefaultSocketProfile
+     *          The default profile of TCP/IP sockets: no delay, keep-alive,
+     *          system default buffer sizes and no busy polling.
+     **/
+    constexpr sSocketProfile            DefaultSocketProfile        { true, true, 0u, 0u };
+
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace functions
 //////////////////////////////////////////////////////////////////////////
@@ -474,6 +519,53 @@ namespace NESocket
      **/
     AREG_API SOCKETHANDLE serverAcceptConnection( SOCKETHANDLE serverSocket, const SOCKETHANDLE * masterList, int entriesCount, NESocket::SocketAddress * out_socketAddr = nullptr );
 
+    /**
+     * \brief   NESocket::serverAccept
+     *          Accepts single pending connection on the listening server socket.
+     *          Unlike serverAcceptConnection(), it does not wait for the events
+     *          of other sockets. It is called when the socket poller reports
+     *          that the listening socket has pending connection.
+     * \param   serverSocket    The valid socket descriptor of server in listening mode.
+     * \param   out_socketAddr  If not nullptr, on output it contains the address of accepted client.
+     * \return  Returns the socket handle of accepted client or NESocket::InvalidSocketHandle if failed.
+     **/
+    AREG_API SOCKETHANDLE serverAccept( SOCKETHANDLE serverSocket, NESocket::SocketAddress * out_socketAddr = nullptr );
+
+    /**
+     * \brief   NESocket::isLocalSocketSupported
+     *          Returns true if the local (Unix domain) stream sockets are supported by the system.
+     **/
+    AREG_API bool isLocalSocketSupported( void );
+
+    /**
+     * \brief   NESocket::clientLocalSocketConnect
+     *          Creates client local (Unix domain) stream socket and connects to the server
+     *          listening on specified socket path. The local sockets connect only
+     *          the processes running on the same host.
+     * \param   socketPath  The file system path of the server socket to connect.
+     * \return  Returns valid socket descriptor, if could create socket and connect to the server.
+     *          Otherwise, it returns NESocket::InvalidSocketHandle value.
+     **/
+    AREG_API SOCKETHANDLE clientLocalSocketConnect( const String & socketPath );
+
+    /**
+     * \brief   NESocket::serverLocalSocketConnect
+     *          Creates server local (Unix domain) stream socket and binds to specified path.
+     *          The file of previous server instance on the same path is removed.
+     *          Before accepting any connection, the socket should be set for listening.
+     * \param   socketPath  The file system path of the server socket to bind.
+     * \return  Returns valid socket descriptor, if could create socket and bind to specified path.
+     *          Otherwise, it returns NESocket::InvalidSocketHandle value.
+     **/
+    AREG_API SOCKETHANDLE serverLocalSocketConnect( const String & socketPath );
+
+    /**
+     * \brief   NESocket::deleteLocalSocket
+     *          Removes the file of the local server socket. Should be called when the server socket is closed.
+     * \param   socketPath  The file system path of the server socket.
+     **/
+    AREG_API void deleteLocalSocket( const String & socketPath );
+
     /**
      * \brief   NESocket::getMaxSendSize
      *          Returns the socket buffer size in bytes to send the packet at once.
@@ -543,6 +635,57 @@ namespace NESocket
      **/
     AREG_API int receiveData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength, int blockMaxSize );
 
+    /**
+     * \brief   NESocket::receiveAvailable
+     *          Receives data, which is already available in the socket buffer, without blocking.
+     *          The call makes a single receive and may fill only part of the buffer.
+     * \param   hSocket         The valid socket descriptor to receive data.
+     * \param   dataBuffer      The pointer to data buffer, which should be filled.
+     * \param   dataLength      The length of buffer in bytes.
+     * \return  Returns number of bytes received. Returns zero if there is no data available.
+     *          Returns negative number if failed or the opposite side closed connection.
+     *          In case of failure, the specified socket should be closed.
+     **/
+    AREG_API int receiveAvailable( SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength );
+
+    /**
+     * \brief   NESocket::sendAvailable
+     *          Sends the list of buffers by a single gather send call without blocking.
+     *          The call sends as much data as fits the socket send buffer, i.e. it may
+     *          send only part of the data.
+     * \param   hSocket     The valid socket descriptor to send data.
+     * \param   buffers     The list of buffers to send. The data is sent in the order of entries.
+     * \param   count       The number of entries in the list. Maximum NESocket::MAXIMUM_SEND_BUFFERS
+     *                      entries are sent at once, the rest is ignored.
+     * \return  Returns number of bytes sent. Returns zero if the socket cannot send data at the moment.
+     *          Returns negative number if failed. In case of failure, the specified socket should be closed.
+     **/
+    AREG_API int sendAvailable( SOCKETHANDLE hSocket, const NESocket::sSendBuffer * buffers, int count );
+
+    /**
+     * \brief   NESocket::sendBuffers
+     *          Sends the list of buffers by gather send calls. The call is blocking and
+     *          does not return until all data is sent or sending fails. Normally, the
+     *          whole list is sent by a single system call.
+     * \param   hSocket     The valid socket descriptor to send data.
+     * \param   buffers     The list of buffers to send. The data is sent in the order of entries.
+     * \param   count       The number of entries in the list. Maximum NESocket::MAXIMUM_SEND_BUFFERS
+     *                      entries are sent, the rest is ignored.
+     * \return  Returns number of bytes sent. Returns zero if there is nothing to send.
+     *          Returns negative number if failed. In case of failure, the specified socket should be closed.
+     **/
+    AREG_API int sendBuffers( SOCKETHANDLE hSocket, const NESocket::sSendBuffer * buffers, int count );
+
+    /**
+     * \brief   NESocket::applySocketProfile
+     *          Applies the options of the profile to the connected or accepted TCP/IP socket.
+     *          The options, which are not supported by the system, are ignored.
+     * \param   hSocket     The valid socket descriptor to set options.
+     * \param   profile     The profile of the socket options to apply.
+     * \return  Returns true if all options are applied.
+     **/
+    AREG_API bool applySocketProfile( SOCKETHANDLE hSocket, const NESocket::sSocketProfile & profile );
+
     /**
      * \brief   NESocket::disableSend
      *          Sets socket read-only, i.e. it will not be possible to send messages anymore.
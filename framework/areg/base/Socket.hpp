@@ -171,6 +171,50 @@ public:
      **/
     virtual int receiveData( unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, receives data, which is already available in the
+     *          socket buffer, and returns number of received bytes. The call is not blocking
+     *          and the number of received bytes can be less than specified length.
+     * \param   buffer  The buffer to fill received data from remote target.
+     * \param   length  The length in bytes of allocated space in buffer.
+     * \return  Returns number of bytes received from remote target. Returns zero if there is
+     *          no data available. Returns negative number if socket is not valid,
+     *          the remote side closed connection or failed to receive data.
+     **/
+    int receiveAvailable( unsigned char * buffer, int length ) const;
+
+    /**
+     * \brief   If socket is valid, sends the list of buffers by a single call without blocking
+     *          and returns number of sent bytes. The number of sent bytes can be less than
+     *          the total length of buffers, if the socket send buffer is full.
+     * \param   buffers The list of buffers to send.
+     * \param   count   The number of entries in the list.
+     * \return  Returns number of bytes sent to remote target. Returns zero if the socket
+     *          cannot send data at the moment. Returns negative number if socket is not valid
+     *          or failed to send data.
+     **/
+    int sendAvailable( const NESocket::sSendBuffer * buffers, int count ) const;
+
+    /**
+     * \brief   If socket is valid, sends the list of buffers by gather send calls and returns
+     *          number of sent bytes, which is equal to the total length of buffers.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   buffers The list of buffers to send.
+     * \param   count   The number of entries in the list.
+     * \return  Returns number of bytes sent to remote target.
+     *          Returns negative number if socket is not valid or failed to send.
+     **/
+    int sendBuffers( const NESocket::sSendBuffer * buffers, int count ) const;
+
+    /**
+     * \brief   If socket is valid, applies the options of the profile and updates
+     *          the cached sizes of packets to send and receive data.
+     * \param   profile     The profile of the socket options to apply.
+     * \return  Returns true if all options are applied.
+     **/
+    bool applyProfile( const NESocket::sSocketProfile & profile ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
 //////////////////////////////////////////////////////////////////////////
@@ -363,7 +407,7 @@ inline bool Socket::isAlive(void) const
 
 inline int Socket::pendingRead(void) const
 {
-    return (mSocket.get() != nullptr) && NESocket::pendingRead(*mSocket);
+    return (mSocket.get() != nullptr ? static_cast<int>(NESocket::pendingRead(*mSocket)) : -1);
 }
 
 inline bool Socket::disableSend( void ) const
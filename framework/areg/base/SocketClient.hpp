@@ -29,8 +29,9 @@
  *          send and receive data. Before sending or receiving any data,
  *          the socket should be created and as soon as connection is not needed,
  *          it should be closed.
- *          Client socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          Client socket is using TCP/IP connection or the local (Unix domain)
+ *          stream socket to connect to the server on the same host. All other
+ *          types and protocols are out of scope of this class and are not considered.
  **/
 class AREG_API SocketClient   : public    Socket
 {
@@ -100,6 +101,19 @@ public:
      **/
     virtual bool createSocket( void ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+
+    /**
+     * \brief   Creates new local (Unix domain) socket descriptor and connects
+     *          to the server on the same host listening on specified path.
+     *          The socket address remains unchanged.
+     * \param   socketPath  The file system path of the server socket.
+     * \return  Returns true if operation succeeded.
+     **/
+    bool createLocalSocket( const String & socketPath );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
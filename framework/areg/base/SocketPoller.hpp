@@ -0,0 +1,281 @@
+#ifndef AREG_BASE_SOCKETPOLLER_HPP
+#define AREG_BASE_SOCKETPOLLER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/SocketPoller.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the socket readiness poller (I/O reactor).
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/NECommon.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+/**
+ * \brief   AREG_SOCKET_EPOLL is set if the poller is implemented by the Linux epoll API.
+ *          In all other cases the poller falls back to the portable select() implementation,
+ *          which is limited by FD_SETSIZE number of sockets.
+ **/
+#if defined(__linux__)
+    #define AREG_SOCKET_EPOLL   1
+#else   // !defined(__linux__)
+    #define AREG_SOCKET_EPOLL   0
+#endif  // defined(__linux__)
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The socket poller waits for the readiness of multiple sockets
+ *          and reports all sockets that are ready on every wake up.
+ *          On Linux the poller uses the edge-triggered epoll, so that there
+ *          is no limit of registered sockets and no per wait registration.
+ *          On other platforms it uses select() as a fallback.
+ *          The sockets registered as edge-triggered should be drained
+ *          by the caller, i.e. the caller should read all pending data,
+ *          because the poller reports the socket again only when new data arrives.
+ *          The add, modify and remove methods are thread safe and can be
+ *          called while other thread waits for the events.
+ **/
+class AREG_API SocketPoller
+{
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SocketPoller::ePollEvent
+     *          The bitwise flags of socket events to listen and to report.
+     **/
+    typedef enum class E_PollEvent : uint32_t
+    {
+          PollNone      = 0x00  //!< No event.
+        , PollRead      = 0x01  //!< The socket has data to read or, for listening socket, a pending connection.
+        , PollWrite     = 0x02  //!< The socket can send data.
+        , PollClosed    = 0x04  //!< The remote side closed the connection.
+        , PollError     = 0x08  //!< The socket has an error.
+    } ePollEvent;
+
+    /**
+     * \brief   SocketPoller::sPollEvent
+     *          The structure of socket event, reported by the poller.
+     **/
+    typedef struct S_PollEvent
+    {
+        SOCKETHANDLE    peSocket;   //!< The socket handle of the event.
+        uint32_t        peEvents;   //!< The bitwise combination of ePollEvent flags.
+    } sPollEvent;
+
+    /**
+     * \brief   The maximum number of events reported at once by a single wait.
+     **/
+    static constexpr int    MAX_POLL_EVENTS     { 64 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates invalid poller object. Call create() before use.
+     **/
+    SocketPoller( void );
+
+    /**
+     * \brief   Releases OS resources.
+     **/
+    ~SocketPoller( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Returns true if the poller is created and can be used.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Returns true if the poller uses epoll and is not limited by FD_SETSIZE.
+     **/
+    static constexpr bool isEpoll( void );
+
+    /**
+     * \brief   Creates the poller. If the poller is already created, it does nothing.
+     * \return  Returns true if the poller is valid.
+     **/
+    bool create( void );
+
+    /**
+     * \brief   Releases the poller resources. All registered sockets are removed.
+     *          Should not be called while any thread waits for events.
+     **/
+    void release( void );
+
+    /**
+     * \brief   Registers the socket to wait for events.
+     * \param   hSocket         The valid socket handle to register.
+     * \param   events          The bitwise combination of ePollEvent flags to listen.
+     *                          The close and error events are always reported.
+     * \param   edgeTriggered   If true, the socket event is reported only when its state
+     *                          changes, i.e. the caller should drain the socket buffer.
+     *                          This flag is ignored by the select() fallback.
+     * \return  Returns true if succeeded to register the socket.
+     **/
+    bool addSocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered );
+
+    /**
+     * \brief   Changes the list of events to listen of registered socket.
+     * \param   hSocket         The valid socket handle registered in the poller.
+     * \param   events          The bitwise combination of ePollEvent flags to listen.
+     * \param   edgeTriggered   Flag, indicating whether the event is edge-triggered.
+     * \return  Returns true if succeeded to change the events.
+     **/
+    bool modifySocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered );
+
+    /**
+     * \brief   Unregisters the socket. No event is reported for the socket anymore.
+     * \param   hSocket     The socket handle to remove.
+     **/
+    void removeSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Waits for the socket events and on output fills the list of events.
+     * \param   out_events  The list of events to fill on output.
+     * \param   maxEvents   The maximum number of entries in the list.
+     * \param   msTimeout   The timeout in milliseconds to wait. By default, waits infinite.
+     * \return  Returns the number of events in the list.
+     *          Returns zero if timeout expired or the wait was interrupted.
+     *          Returns negative value if failed to wait.
+     **/
+    int waitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout = NECommon::WAIT_INFINITE );
+
+    /**
+     * \brief   Interrupts the waiting thread. The waitEvents() call returns zero.
+     *          If no thread waits, the next waitEvents() call returns immediately.
+     **/
+    void interrupt( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   OS specific implementation of creating poller.
+     **/
+    bool _osCreatePoller( void );
+
+    /**
+     * \brief   OS specific implementation of releasing poller.
+     **/
+    void _osReleasePoller( void );
+
+    /**
+     * \brief   OS specific implementation of registering, changing or removing the socket.
+     **/
+    bool _osControlSocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered, bool isNew );
+    void _osRemoveSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   OS specific implementation of waiting for events.
+     **/
+    int _osWaitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout );
+
+    /**
+     * \brief   OS specific implementation to interrupt the wait.
+     **/
+    void _osInterrupt( void );
+
+    /**
+     * \brief   The portable select() based implementation of waiting for readiness.
+     *          Used as a fallback if there is no OS specific implementation.
+     *          The wake-up socket is always in the set, so that the call blocks
+     *          even if there are no registered sockets.
+     **/
+    int _selectEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout );
+
+    /**
+     * \brief   Creates the wake-up socket of select() fallback. It is a loopback UDP socket
+     *          connected to itself, so that sending a datagram makes it readable.
+     * \return  Returns true if succeeded to create the wake-up socket.
+     **/
+    bool _createSelectWakeup( void );
+
+    /**
+     * \brief   Closes the wake-up socket of select() fallback.
+     **/
+    void _releaseSelectWakeup( void );
+
+    /**
+     * \brief   Sends a datagram to the wake-up socket to interrupt select().
+     **/
+    void _signalSelectWakeup( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The OS specific poller handle. For epoll, it is the epoll file descriptor.
+     **/
+    int                 mPoller;
+    /**
+     * \brief   The OS specific handle to interrupt the wait. For epoll, it is the eventfd descriptor.
+     **/
+    int                 mWakeup;
+    /**
+     * \brief   The wake-up socket to interrupt the select() fallback. Not used by epoll.
+     **/
+    SOCKETHANDLE        mSelectWakeup;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The registered sockets and the events to listen, used by select() fallback.
+     **/
+    TEMap<SOCKETHANDLE, uint32_t>   mSockets;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   Synchronization object to access the list of sockets.
+     **/
+    mutable ResourceLock            mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SocketPoller );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SocketPoller::isValid( void ) const
+{
+    return (mPoller != -1);
+}
+
+constexpr bool SocketPoller::isEpoll( void )
+{
+    return (AREG_SOCKET_EPOLL != 0);
+}
+
+#endif  // AREG_BASE_SOCKETPOLLER_HPP
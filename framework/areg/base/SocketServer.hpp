@@ -40,8 +40,9 @@ class SocketAccepted;
  *          Connection accepting, sending and receiving data are running
  *          in blocking mode. For this reason, it makes sens to run all these
  *          functionalities in separate threads.
- *          Server socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          Server socket is using TCP/IP connection or the local (Unix domain)
+ *          stream socket to accept connections of the clients on the same host.
+ *          All other types and protocols are out of scope of this class and are not considered.
  **/
 class AREG_API SocketServer   : public    Socket
 {
@@ -52,7 +53,7 @@ public:
      *          or receiving data, the socket should be created
      *          and bound to socket address.
      **/
-    SocketServer( void ) = default;
+    SocketServer( void );
 
     /**
      * \brief   Initialization constructor. Creates instance of object
@@ -111,6 +112,11 @@ public:
      **/
     virtual bool createSocket( void ) override;
 
+    /**
+     * \brief   Closes the socket. If this is the local socket, removes the socket file.
+     **/
+    virtual void closeSocket( void ) override;
+
     /**
      * \brief   Call to place server socket in a state in which it is listening for an incoming connection.
      *          To accept connections on server side, firs socket should be created, which is bound to a 
@@ -142,6 +148,40 @@ public:
      **/
     virtual SOCKETHANDLE waitConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted, const SOCKETHANDLE * masterList, int entriesCount);
 
+    /**
+     * \brief   Accepts single pending client connection. Should be called when
+     *          the socket poller reports the read event on listening server socket.
+     * \param   out_addrAccepted    On output, contains the address of accepted client.
+     * \return  Returns valid socket handle of accepted client or invalid handle if failed.
+     **/
+    SOCKETHANDLE acceptConnection( NESocket::SocketAddress & out_addrAccepted );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+
+    /**
+     * \brief   Creates new local (Unix domain) socket descriptor and binds it to specified path.
+     *          The local socket accepts connections of the clients on the same host.
+     *          The socket address remains unchanged.
+     * \param   socketPath  The file system path of the server socket.
+     * \return  Returns true if operation succeeded.
+     **/
+    bool createLocalSocket( const String & socketPath );
+
+    /**
+     * \brief   Returns the file system path of the local socket.
+     *          Returns empty string if the socket is not local.
+     **/
+    inline const String & getLocalPath( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The file system path of the local socket. Empty if the socket is TCP/IP.
+    String  mLocalPath;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -149,4 +189,13 @@ private:
     DECLARE_NOCOPY_NOMOVE( SocketServer );
 };
 
+//////////////////////////////////////////////////////////////////////////
+// SocketServer class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline const String & SocketServer::getLocalPath( void ) const
+{
+    return mLocalPath;
+}
+
 #endif  // AREG_BASE_SOCKETSERVER_HPP
@@ -348,8 +348,19 @@ public:
     /**
      * \brief   Returns the thread object of current thread.
      *          The current thread must be registered in the resource map.
+     *          The Thread object of the running thread is read from the
+     *          thread local storage slot without searching in the map.
      **/
-    inline static Thread * getCurrentThread( void );
+    static Thread * getCurrentThread( void );
+
+    /**
+     * \brief   Returns the thread object if the current thread is started by
+     *          the Thread object and runs the job. Otherwise, returns nullptr,
+     *          for example, in the main thread or in the threads created by
+     *          other libraries. The values cached in the storage slots of such
+     *          threads are valid until the job completes.
+     **/
+    static Thread * getCurrentRunningThread( void );
 
     /**
      * \brief   Returns the name of current thread.
@@ -753,19 +764,16 @@ inline void Thread::_setRunning( bool isRunning )
     mIsRunning  = isRunning;
 }
 
-inline Thread * Thread::getCurrentThread( void )
-{
-    return Thread::findThreadById(Thread::_osGetCurrentThreadId());
-}
-
 inline const String & Thread::getCurrentThreadName( void )
 {
-    return Thread::getThreadName( Thread::_osGetCurrentThreadId() );
+    Thread * threadObj = Thread::getCurrentThread( );
+    return (threadObj != nullptr ? threadObj->getName( ) : String::getEmptyString( ));
 }
 
 inline const ThreadAddress & Thread::getCurrentThreadAddress( void )
 {
-    return Thread::getThreadAddress( Thread::_osGetCurrentThreadId() );
+    Thread * threadObj = Thread::getCurrentThread( );
+    return (threadObj != nullptr ? threadObj->getAddress( ) : ThreadAddress::getInvalidThreadAddress( ));
 }
 
 inline Thread::eThreadPriority Thread::getPriority( void ) const
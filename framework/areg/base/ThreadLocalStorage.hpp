@@ -40,6 +40,17 @@ class Thread;
  *          accessed by unique name. By default, every local storage of a Thread
  *          contains the entry of the thread consumer. The entries of the 
  *          local storage are access by name.
+ *
+ *          The frequently accessed entries should be registered as slots.
+ *          The key of a slot is registered once and the returned slot index
+ *          is used to read and write value in the slot of the current thread
+ *          without searching by name. The slots are the same for all threads,
+ *          and every thread has own values of slots.
+ *
+ *          Usage:
+ *              static const int _slot{ ThreadLocalStorage::registerStorageSlot("MyKey") };
+ *              ThreadLocalStorage::setSlotItem(_slot, &myObject);
+ *              MyObject * obj = reinterpret_cast<MyObject *>(ThreadLocalStorage::getSlotItem(_slot).alignPtr.mElement);
  * \see     Thread
  **/
 class AREG_API ThreadLocalStorage
@@ -62,6 +73,22 @@ private:
     //!< Definition of storage list object to store items.
     using StorageList       = TELinkedList<ThreadLocalStorage::StorageItem>;
 
+//////////////////////////////////////////////////////////////////////////
+// Constants and types
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS
+     *          The maximum number of slots, which can be registered.
+     **/
+    static constexpr int    MAXIMUM_STORAGE_SLOTS   { 32 };
+
+    /**
+     * \brief   ThreadLocalStorage::INVALID_STORAGE_SLOT
+     *          The index of invalid slot.
+     **/
+    static constexpr int    INVALID_STORAGE_SLOT    { -1 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -196,6 +223,51 @@ public:
      **/
     inline void clear( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Storage slots
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Registers the key of the storage slot and returns the index of slot.
+     *          If the key is already registered, returns the index of existing slot.
+     *          The registered slots are never released.
+     * \param   Key     The unique name of the storage slot.
+     * \return  Returns the index of storage slot. Returns INVALID_STORAGE_SLOT
+     *          if the maximum number of slots is reached.
+     **/
+    static int registerStorageSlot( const String & Key );
+
+    /**
+     * \brief   Returns the value of the storage slot of current thread.
+     *          If the value of slot was not set, returns zero value.
+     * \param   slot    The valid index of the storage slot returned by registerStorageSlot().
+     **/
+    static NEMemory::uAlign getSlotItem( int slot );
+
+    /**
+     * \brief   Sets the value of the storage slot of current thread.
+     * \param   slot    The valid index of the storage slot returned by registerStorageSlot().
+     * \param   Value   The value to set in the slot.
+     **/
+    static void setSlotItem( int slot, NEMemory::uAlign Value );
+
+    /**
+     * \brief   Sets the pointer value of the storage slot of current thread.
+     * \param   slot    The valid index of the storage slot returned by registerStorageSlot().
+     * \param   Value   The pointer to set in the slot.
+     **/
+    static void setSlotItem( int slot, const void * Value );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Resets the values of all storage slots of current thread.
+     *          Called when the thread exits.
+     **/
+    static void _clearSlots( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
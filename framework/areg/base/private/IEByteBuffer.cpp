@@ -14,6 +14,7 @@
  *
  ************************************************************************/
 #include "areg/base/IEByteBuffer.hpp"
+#include "areg/base/MemoryPool.hpp"
 
 #include <utility>
 #include <string.h>
@@ -32,7 +33,7 @@ IEByteBuffer::IEByteBuffer( void )
 }
 
 IEByteBuffer::IEByteBuffer( NEMemory::sByteBuffer & byteBuffer )
-    : mByteBuffer( &byteBuffer, ByteBufferDeleter( ) )
+    : mByteBuffer( &byteBuffer, HeapByteBufferDeleter( ) )
 {
 }
 
@@ -65,7 +66,7 @@ unsigned int IEByteBuffer::reserve(unsigned int size, bool copy)
                 unsigned int sizeBuffer{ getHeaderSize() + size };
 
                 sizeBuffer = MACRO_ALIGN_SIZE(sizeBuffer, sizeAlign);
-                unsigned char* buffer = DEBUG_NEW unsigned char[sizeBuffer];
+                unsigned char* buffer = reinterpret_cast<unsigned char *>(MemoryPool::allocate(sizeBuffer));
                 int copied = static_cast<int>(initBuffer(buffer, sizeBuffer, copy));
                 if (static_cast<unsigned int>(copied) != IECursorPosition::INVALID_CURSOR_POSITION)
                 {
@@ -74,7 +75,7 @@ unsigned int IEByteBuffer::reserve(unsigned int size, bool copy)
                 }
                 else
                 {
-                    delete[] buffer;
+                    MemoryPool::release(buffer);
                 }
             }
         }
@@ -0,0 +1,352 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/MemoryPool.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pool of small memory blocks used by
+ *              events and byte buffers.
+ ************************************************************************/
+#include "areg/base/MemoryPool.hpp"
+
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <new>
+
+namespace
+{
+    /**
+     * \brief   The header of every memory block. The header is placed before
+     *          the memory returned to the caller.
+     **/
+    struct sBlockHeader
+    {
+        //!< The next free block in the list. Valid only if block is free.
+        sBlockHeader *  bhNext;
+        //!< The size class of the block.
+        uint32_t        bhSizeClass;
+        //!< Reserved. Keeps the size of header aligned.
+        uint32_t        bhReserved;
+    };
+
+    /**
+     * \brief   The link of the batches of free blocks in the depot.
+     *          It is placed in the memory of the first free block of the batch.
+     **/
+    struct sBatchLink
+    {
+        //!< The next batch in the depot.
+        sBlockHeader *  blNext;
+        //!< The number of blocks in the batch.
+        uint32_t        blCount;
+    };
+
+    /**
+     * \brief   The size of block header. The returned memory is aligned to 16 bytes.
+     **/
+    constexpr uint32_t  BLOCK_HEADER_SIZE   { 16u };
+
+    /**
+     * \brief   The number of size classes. The size of blocks starts with 64 bytes and doubles in next class.
+     **/
+    constexpr uint32_t  SIZE_CLASS_COUNT    { 7u };
+
+    /**
+     * \brief   The size class of blocks allocated in the heap.
+     **/
+    constexpr uint32_t  SIZE_CLASS_LARGE    { 0xFFFFFFFFu };
+
+    /**
+     * \brief   The size in bytes of the smallest block, including header.
+     **/
+    constexpr uint32_t  MINIMUM_BLOCK       { 64u };
+
+    /**
+     * \brief   The number of free blocks moved between thread cache and depot at once.
+     **/
+    constexpr uint32_t  BATCH_SIZE          { 32u };
+
+    /**
+     * \brief   The maximum number of free blocks per size class in the thread cache.
+     **/
+    constexpr uint32_t  CACHE_LIMIT         { BATCH_SIZE * 2u };
+
+    /**
+     * \brief   The minimum size in bytes of slab.
+     **/
+    constexpr uint32_t  MINIMUM_SLAB        { 16u * 1024u };
+
+    static_assert(sizeof(sBlockHeader) <= BLOCK_HEADER_SIZE, "The size of block header is too big");
+    static_assert(sizeof(sBatchLink) <= MINIMUM_BLOCK - BLOCK_HEADER_SIZE, "The size of batch link is too big");
+    static_assert(MemoryPool::MAXIMUM_BLOCK_SIZE + BLOCK_HEADER_SIZE == (MINIMUM_BLOCK << (SIZE_CLASS_COUNT - 1)), "Invalid size classes");
+
+    /**
+     * \brief   The cache of free blocks of the thread.
+     **/
+    struct sThreadCache
+    {
+        //!< The lists of free blocks per size class.
+        sBlockHeader *  tcFree[SIZE_CLASS_COUNT];
+        //!< The number of free blocks per size class.
+        uint32_t        tcCount[SIZE_CLASS_COUNT];
+    };
+
+    /**
+     * \brief   The depot of batches of free blocks shared between threads.
+     **/
+    struct sPoolDepot
+    {
+        //!< The synchronization object of the depot.
+        SpinLock                pdLock;
+        //!< The batches of free blocks per size class.
+        sBlockHeader *          pdBatches[SIZE_CLASS_COUNT] { };
+        //!< The counter of allocated slabs.
+        std::atomic<uint64_t>   pdSlabCount     { 0u };
+        //!< The counter of bytes allocated by slabs.
+        std::atomic<uint64_t>   pdSlabBytes     { 0u };
+        //!< The counter of blocks allocated in the heap.
+        std::atomic<uint64_t>   pdLargeAllocs   { 0u };
+        //!< The counter of blocks released to the heap.
+        std::atomic<uint64_t>   pdLargeReleases { 0u };
+        //!< The counter of batches moved to the depot.
+        std::atomic<uint64_t>   pdBatchReleased { 0u };
+        //!< The counter of batches moved from the depot.
+        std::atomic<uint64_t>   pdBatchAcquired { 0u };
+    };
+
+    /**
+     * \brief   The free blocks of the current thread.
+     **/
+    __THREAD_LOCAL sThreadCache _threadCache;
+
+    /**
+     * \brief   Moves the free blocks of the thread cache to the depot when the thread exits.
+     *          The guard is instantiated when the first block is put in the thread cache,
+     *          either by filling the cache or by releasing a block.
+     **/
+    struct sThreadCacheGuard
+    {
+        ~sThreadCacheGuard( void )
+        {
+            MemoryPool::releaseThreadCache( );
+        }
+    };
+
+    /**
+     * \brief   Returns the free blocks of the current thread and makes sure that
+     *          they are moved to the depot when the thread exits.
+     **/
+    inline sThreadCache & _getThreadCache( void )
+    {
+        static thread_local sThreadCacheGuard _guard;
+        static_cast<void>(_guard);
+        return _threadCache;
+    }
+
+    /**
+     * \brief   Returns the instance of the depot.
+     **/
+    inline sPoolDepot & _getDepot( void )
+    {
+        static sPoolDepot _depot;
+        return _depot;
+    }
+
+    /**
+     * \brief   Returns the size class of the memory of specified size.
+     **/
+    inline uint32_t _getSizeClass( size_t size )
+    {
+        uint32_t result{ 0u };
+        for ( size_t block = MINIMUM_BLOCK; block < size + BLOCK_HEADER_SIZE; block <<= 1 )
+        {
+            ++ result;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Returns the size in bytes of blocks of specified size class, including header.
+     **/
+    constexpr inline uint32_t _getBlockSize( uint32_t sizeClass )
+    {
+        return (MINIMUM_BLOCK << sizeClass);
+    }
+
+    /**
+     * \brief   Returns the batch link of the free block.
+     **/
+    inline sBatchLink & _getBatchLink( sBlockHeader * block )
+    {
+        return *reinterpret_cast<sBatchLink *>(reinterpret_cast<unsigned char *>(block) + BLOCK_HEADER_SIZE);
+    }
+
+    /**
+     * \brief   Moves the list of free blocks to the depot as one batch.
+     **/
+    void _releaseBatch( uint32_t sizeClass, sBlockHeader * first, uint32_t count )
+    {
+        sPoolDepot & depot{ _getDepot( ) };
+        sBatchLink & link{ _getBatchLink( first ) };
+        link.blCount = count;
+
+        depot.pdLock.lock( );
+        link.blNext = depot.pdBatches[sizeClass];
+        depot.pdBatches[sizeClass] = first;
+        depot.pdLock.unlock( );
+
+        depot.pdBatchReleased.fetch_add( 1u, std::memory_order_relaxed );
+    }
+
+    /**
+     * \brief   Fills the empty thread cache of the size class either by the batch
+     *          from the depot or by the blocks of new allocated slab.
+     **/
+    void _fillCache( sThreadCache & cache, uint32_t sizeClass )
+    {
+        ASSERT( cache.tcFree[sizeClass] == nullptr );
+
+        sPoolDepot & depot{ _getDepot( ) };
+
+        depot.pdLock.lock( );
+        sBlockHeader * batch = depot.pdBatches[sizeClass];
+        if ( batch != nullptr )
+        {
+            depot.pdBatches[sizeClass] = _getBatchLink( batch ).blNext;
+        }
+
+        depot.pdLock.unlock( );
+
+        if ( batch != nullptr )
+        {
+            cache.tcFree[sizeClass]     = batch;
+            cache.tcCount[sizeClass]    = _getBatchLink( batch ).blCount;
+            depot.pdBatchAcquired.fetch_add( 1u, std::memory_order_relaxed );
+        }
+        else
+        {
+            const uint32_t blockSize    = _getBlockSize( sizeClass );
+            const uint32_t slabSize     = MACRO_MAX( MINIMUM_SLAB, blockSize * BATCH_SIZE );
+            const uint32_t count        = slabSize / blockSize;
+            unsigned char * slab        = reinterpret_cast<unsigned char *>(::operator new( slabSize ));
+
+            sBlockHeader * head = nullptr;
+            for ( uint32_t i = count; i > 0; -- i )
+            {
+                sBlockHeader * block = reinterpret_cast<sBlockHeader *>(slab + (i - 1) * blockSize);
+                block->bhNext       = head;
+                block->bhSizeClass  = sizeClass;
+                block->bhReserved   = 0u;
+                head = block;
+            }
+
+            cache.tcFree[sizeClass]     = head;
+            cache.tcCount[sizeClass]    = count;
+            depot.pdSlabCount.fetch_add( 1u, std::memory_order_relaxed );
+            depot.pdSlabBytes.fetch_add( slabSize, std::memory_order_relaxed );
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void * MemoryPool::allocate( size_t size )
+{
+    sBlockHeader * block{ nullptr };
+    if ( size > static_cast<size_t>(MemoryPool::MAXIMUM_BLOCK_SIZE) )
+    {
+        block = reinterpret_cast<sBlockHeader *>(::operator new( size + BLOCK_HEADER_SIZE ));
+        block->bhSizeClass = SIZE_CLASS_LARGE;
+        _getDepot( ).pdLargeAllocs.fetch_add( 1u, std::memory_order_relaxed );
+    }
+    else
+    {
+        const uint32_t sizeClass = _getSizeClass( size );
+        sThreadCache & cache{ _getThreadCache( ) };
+        if ( cache.tcFree[sizeClass] == nullptr )
+        {
+            _fillCache( cache, sizeClass );
+        }
+
+        block = cache.tcFree[sizeClass];
+        cache.tcFree[sizeClass] = block->bhNext;
+        -- cache.tcCount[sizeClass];
+        ASSERT( block->bhSizeClass == sizeClass );
+    }
+
+    block->bhNext = nullptr;
+    return reinterpret_cast<unsigned char *>(block) + BLOCK_HEADER_SIZE;
+}
+
+void MemoryPool::release( void * block )
+{
+    if ( block != nullptr )
+    {
+        sBlockHeader * header = reinterpret_cast<sBlockHeader *>(reinterpret_cast<unsigned char *>(block) - BLOCK_HEADER_SIZE);
+        const uint32_t sizeClass = header->bhSizeClass;
+        if ( sizeClass == SIZE_CLASS_LARGE )
+        {
+            ::operator delete( header );
+            _getDepot( ).pdLargeReleases.fetch_add( 1u, std::memory_order_relaxed );
+        }
+        else
+        {
+            ASSERT( sizeClass < SIZE_CLASS_COUNT );
+            sThreadCache & cache{ _getThreadCache( ) };
+            header->bhNext = cache.tcFree[sizeClass];
+            cache.tcFree[sizeClass] = header;
+            if ( ++ cache.tcCount[sizeClass] > CACHE_LIMIT )
+            {
+                // the thread releases more than allocates, move a batch to the depot.
+                sBlockHeader * first = header;
+                for ( uint32_t i = 1; i < BATCH_SIZE; ++ i )
+                {
+                    header = header->bhNext;
+                }
+
+                cache.tcFree[sizeClass] = header->bhNext;
+                cache.tcCount[sizeClass]-= BATCH_SIZE;
+                header->bhNext = nullptr;
+                _releaseBatch( sizeClass, first, BATCH_SIZE );
+            }
+        }
+    }
+}
+
+void MemoryPool::releaseThreadCache( void )
+{
+    sThreadCache & cache{ _threadCache };
+    for ( uint32_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; ++ sizeClass )
+    {
+        if ( cache.tcFree[sizeClass] != nullptr )
+        {
+            _releaseBatch( sizeClass, cache.tcFree[sizeClass], cache.tcCount[sizeClass] );
+            cache.tcFree[sizeClass]     = nullptr;
+            cache.tcCount[sizeClass]    = 0u;
+        }
+    }
+}
+
+MemoryPool::sPoolStatistics MemoryPool::getStatistics( void )
+{
+    const sPoolDepot & depot{ _getDepot( ) };
+    MemoryPool::sPoolStatistics result;
+    result.psSlabCount      = depot.pdSlabCount.load( std::memory_order_relaxed );
+    result.psSlabBytes      = depot.pdSlabBytes.load( std::memory_order_relaxed );
+    result.psLargeAllocs    = depot.pdLargeAllocs.load( std::memory_order_relaxed );
+    result.psLargeReleases  = depot.pdLargeReleases.load( std::memory_order_relaxed );
+    result.psBatchReleased  = depot.pdBatchReleased.load( std::memory_order_relaxed );
+    result.psBatchAcquired  = depot.pdBatchAcquired.load( std::memory_order_relaxed );
+
+    return result;
+}
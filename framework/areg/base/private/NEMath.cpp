@@ -18,6 +18,10 @@
 #include "areg/base/NEMath.hpp"
 #include <math.h>
 
+#if defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#endif // defined(__ARM_FEATURE_CRC32)
+
 namespace
 {
     /**
@@ -154,14 +158,120 @@ namespace
         0x37, 0xBE, 0x0B, 0xB4, 0xA1, 0x8E, 0x0C, 0xC3,
         0x1B, 0xDF, 0x05, 0x5A, 0x8D, 0xEF, 0x02, 0x2D,
     };
+
+    /**
+     * \brief   The number of lookup tables used by slice-by-8 CRC calculation.
+     **/
+    constexpr unsigned int CRC32_SLICES     { 8u };
+    /**
+     * \brief   The number of entries in a single CRC lookup table.
+     **/
+    constexpr unsigned int CRC32_ENTRIES    { 256u };
+
+    /**
+     * \brief   The slice-by-8 lookup tables of the same CRC polynomial.
+     *          The first table is assembled from the little-endian bytes of '_crc32LookupTable',
+     *          each next table is the CRC of the previous table entry shifted by one byte.
+     *          The input data is read as little-endian words, so that the tables and the result
+     *          do not depend on the byte order of the host.
+     *          This allows to calculate the CRC of 8 bytes with 8 table lookups at once,
+     *          and the result is equal to the result of byte-wise calculation.
+     **/
+    struct sCrc32SliceTable
+    {
+        constexpr sCrc32SliceTable( void )
+            : stTable   { }
+        {
+            for ( unsigned int i = 0; i < CRC32_ENTRIES; ++ i )
+            {
+                const unsigned int pos = i * 4u;
+                stTable[0][i] = static_cast<unsigned int>(_crc32LookupTable[pos + 0])         |
+                                (static_cast<unsigned int>(_crc32LookupTable[pos + 1]) <<  8) |
+                                (static_cast<unsigned int>(_crc32LookupTable[pos + 2]) << 16) |
+                                (static_cast<unsigned int>(_crc32LookupTable[pos + 3]) << 24) ;
+            }
+
+            for ( unsigned int slice = 1; slice < CRC32_SLICES; ++ slice )
+            {
+                for ( unsigned int i = 0; i < CRC32_ENTRIES; ++ i )
+                {
+                    const unsigned int prev = stTable[slice - 1][i];
+                    stTable[slice][i] = (prev >> 8) ^ stTable[0][prev & 0x000000FF];
+                }
+            }
+        }
+
+        unsigned int    stTable[CRC32_SLICES][CRC32_ENTRIES];
+    };
+
+    constexpr sCrc32SliceTable _crc32SliceTable{ };
+
+    /**
+     * \brief   Reads 32-bit little-endian value from the given buffer.
+     **/
+    inline unsigned int _crc32ReadLE( const unsigned char * data )
+    {
+        return  static_cast<unsigned int>(data[0])         |
+               (static_cast<unsigned int>(data[1]) <<  8)  |
+               (static_cast<unsigned int>(data[2]) << 16)  |
+               (static_cast<unsigned int>(data[3]) << 24)  ;
+    }
+
+    /**
+     * \brief   Continues 32-bit CRC calculation of the binary data.
+     *          If the CPU supports CRC32 instructions of the same polynomial (ARMv8),
+     *          uses the instructions. Otherwise, uses slice-by-8 algorithm,
+     *          which processes 8 bytes per iteration and calculates the remaining
+     *          bytes with byte lookup table. The result is equal to byte-wise calculation.
+     * \param   crc     The current, not finalized, CRC value.
+     * \param   data    The binary data to calculate CRC. Should not be nullptr.
+     * \param   size    The size in bytes of the binary data.
+     * \return  Returns not finalized CRC value.
+     **/
+    inline unsigned int _crc32Update( unsigned int crc, const unsigned char * data, unsigned int size )
+    {
+#if defined(__ARM_FEATURE_CRC32)
+
+        for ( ; (size != 0) && ((reinterpret_cast<uintptr_t>(data) & 0x07) != 0); -- size, ++ data )
+            crc = __crc32b( crc, *data );
+
+        for ( ; size >= 8u; size -= 8u, data += 8 )
+            crc = __crc32d( crc, *reinterpret_cast<const uint64_t *>(data) );
+
+        for ( ; size != 0; -- size, ++ data )
+            crc = __crc32b( crc, *data );
+
+#else   // defined(__ARM_FEATURE_CRC32)
+
+        const unsigned int (&table)[CRC32_SLICES][CRC32_ENTRIES] = _crc32SliceTable.stTable;
+        for ( ; size >= 8u; size -= 8u, data += 8 )
+        {
+            const unsigned int one = _crc32ReadLE( data ) ^ crc;
+            const unsigned int two = _crc32ReadLE( data + 4 );
+            crc = table[7][ one        & 0x000000FF] ^
+                  table[6][(one >>  8) & 0x000000FF] ^
+                  table[5][(one >> 16) & 0x000000FF] ^
+                  table[4][ one >> 24              ] ^
+                  table[3][ two        & 0x000000FF] ^
+                  table[2][(two >>  8) & 0x000000FF] ^
+                  table[1][(two >> 16) & 0x000000FF] ^
+                  table[0][ two >> 24              ] ;
+        }
+
+        for ( ; size != 0; -- size, ++ data )
+            crc = (crc >> 8) ^ table[0][*data ^ static_cast<unsigned char>(crc & 0x000000FF)];
+
+#endif  // defined(__ARM_FEATURE_CRC32)
+
+        return crc;
+    }
 }
 
 AREG_API_IMPL unsigned int NEMath::crc32Calculate( const unsigned char* data, int size )
 {
     unsigned int result = static_cast<unsigned int>(~0);   // initialize
-    const unsigned int* crc32Tab = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);   // get converted lookup table
-    for ( int count = size ; count != 0; -- count, ++ data )
-        result = (result >> 8) ^ crc32Tab[*data ^ static_cast<unsigned char>(result & 0x000000FF)];  // calculate
+    if ( (data != nullptr) && (size > 0) )
+        result = ::_crc32Update( result, data, static_cast<unsigned int>(size) );  // calculate
     return (~result);   // return result
 }
 
@@ -212,31 +322,9 @@ AREG_API_IMPL unsigned int NEMath::crc32Start( unsigned int crcInit, const unsig
     unsigned int result = crcInit;
     if ( data != nullptr && size > 0)
     {
-        const unsigned int* crc32Table = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);  // get converted lookup table
-        for ( ; size > 0; -- size, ++ data )
-        {
-            result  = (result >> 8) ^ crc32Table[ *data ^ static_cast<unsigned char>(result & 0x000000FF)];
-            /************************************************************************
-             * This calculation is similar as following algorithm:
-             ************************************************************************/
-            /************************************************************************
-             *  unsigned char tmpCRC32[4];
-             *  unsigned char* crc32 = reinterpret_cast<unsigned char *>(&result);
-             *  for(int i = 0; i < size; i++)
-             *  {
-             *      tmpCRC32[0] = crc32[0];
-             *      tmpCRC32[1] = crc32[1];
-             *      tmpCRC32[2] = crc32[2];
-             *      tmpCRC32[3] = crc32[3];
-             *
-             *      crc32[3]   =               ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 3];
-             *      crc32[2]   = tmpCRC32[3] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 2];
-             *      crc32[1]   = tmpCRC32[2] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 1];
-             *      crc32[0]   = tmpCRC32[1] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 0];
-             *  }
-             ************************************************************************/
-        }
+        result = ::_crc32Update( result, data, static_cast<unsigned int>(size) );
     }
+
     return result;
 }
 
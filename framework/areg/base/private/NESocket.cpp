@@ -28,6 +28,7 @@
     #include <arpa/inet.h>
     #include <ctype.h>      // IEEE Std 1003.1-2001
     #include <netinet/in.h>
+    #include <netinet/tcp.h>
     #include <netdb.h>
     #include <sys/socket.h>
     #include <sys/ioctl.h>
@@ -71,6 +72,41 @@ namespace NESocket
      */
     int _osRecvData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength, int blockMaxSize);
 
+    /**
+     * \brief   OS specific implementation of receiving available data without blocking.
+     *          All checkups and validations should be done before calling the method.
+     * \return  Returns number of bytes received, zero if no data is available
+     *          and negative value if the connection is closed or failed.
+     */
+    int _osRecvAvailable(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength);
+
+    /**
+     * \brief   OS specific implementation of sending list of buffers without blocking.
+     *          All checkups and validations should be done before calling the method.
+     * \return  Returns number of bytes sent, zero if the socket cannot send data at the moment
+     *          and negative value if failed.
+     */
+    int _osSendAvailable(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count);
+
+    /**
+     * \brief   OS specific implementation of blocking send of the list of buffers.
+     *          All checkups and validations should be done before calling the method.
+     * \return  Returns number of bytes sent and negative value if failed.
+     */
+    int _osSendBuffers(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count);
+
+    /**
+     * \brief   OS specific implementation of setting integer socket option.
+     * \return  Returns true if operation succeeded.
+     */
+    bool _osSetOption(SOCKETHANDLE hSocket, int level, int name, int value);
+
+    /**
+     * \brief   OS specific implementation of setting the time in microseconds to busy poll
+     *          when receiving data. Returns false if the option is not supported.
+     */
+    bool _osSetBusyPoll(SOCKETHANDLE hSocket, unsigned int microseconds);
+
     /**
      * \brief   OS specific implementation of socket control call.
      * \return  Returns true if operation succeeded.
@@ -83,11 +119,31 @@ namespace NESocket
      *          which is valid only if function returns true.
      */
     bool _osGetOption(SOCKETHANDLE hSocket, int level, int name, unsigned long & value);
+
+    /**
+     * \brief   OS specific check whether the local (Unix domain) stream sockets are supported.
+     */
+    bool _osIsLocalSocketSupported(void);
+
+    /**
+     * \brief   OS specific implementation of creating local (Unix domain) stream socket.
+     *          The server socket is bound to the path, the client socket is connected to the path.
+     * \return  Returns valid socket descriptor if succeeded. Otherwise, returns NESocket::InvalidSocketHandle.
+     */
+    SOCKETHANDLE _osCreateLocalSocket(const char * socketPath, bool isServer);
+
+    /**
+     * \brief   OS specific implementation of removing the file of local server socket.
+     */
+    void _osDeleteLocalSocket(const char * socketPath);
 }
 
 DEF_TRACE_SCOPE(areg_base_NESocket_clientSocketConnect);
 DEF_TRACE_SCOPE(areg_base_NESocket_serverSocketConnect);
 DEF_TRACE_SCOPE(areg_base_NESocket_serverAcceptConnection);
+DEF_TRACE_SCOPE(areg_base_NESocket_serverAccept);
+DEF_TRACE_SCOPE(areg_base_NESocket_clientLocalSocketConnect);
+DEF_TRACE_SCOPE(areg_base_NESocket_serverLocalSocketConnect);
 
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace members
@@ -228,6 +284,36 @@ bool NESocket::SocketAddress::resolveSocket(SOCKETHANDLE hSocket)
     return result;
 }
 
+bool NESocket::SocketAddress::resolveLocalSocket(SOCKETHANDLE hSocket)
+{
+    bool result = false;
+    mPortNr     = NESocket::InvalidPort;
+    mIpAddr     = "";
+
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        struct sockaddr_in sAddr;
+        NEMemory::memZero(&sAddr, sizeof(sockaddr));
+
+        socklen_t len = sizeof(sockaddr);
+        if ( RETURNED_OK == ::getsockname(hSocket, reinterpret_cast<struct sockaddr *>(&sAddr), &len) )
+        {
+            sockaddr_in & addr_in = reinterpret_cast<sockaddr_in &>(sAddr);
+            if ( addr_in.sin_family == AF_INET )
+            {
+                setAddress(addr_in);
+                result = true;
+            }
+        }
+        else
+        {
+            OUTPUT_WARN("Failed to get local name of socket [ %u ]", static_cast<unsigned int>(hSocket));
+        }
+    }
+
+    return result;
+}
+
 bool NESocket::SocketAddress::resolveAddress( const std::string_view & hostName, unsigned short portNr, bool isServer)
 {
     bool result = false;
@@ -719,6 +805,106 @@ AREG_API_IMPL SOCKETHANDLE NESocket::serverAcceptConnection(SOCKETHANDLE serverS
     return result;
 }
 
+AREG_API_IMPL SOCKETHANDLE NESocket::serverAccept(SOCKETHANDLE serverSocket, NESocket::SocketAddress * out_socketAddr /*= nullptr*/)
+{
+    TRACE_SCOPE(areg_base_NESocket_serverAccept);
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    if (out_socketAddr != nullptr)
+    {
+        out_socketAddr->resetAddress();
+    }
+
+    if ( serverSocket != NESocket::InvalidSocketHandle )
+    {
+        struct sockaddr_storage acceptAddr; // connecting client address information, either IP or local socket
+        NEMemory::memZero(&acceptAddr, sizeof(sockaddr_storage));
+
+        socklen_t len = sizeof(sockaddr_storage);
+        result = ::accept( serverSocket, reinterpret_cast<sockaddr *>(&acceptAddr), &len );
+        if (result != NESocket::InvalidSocketHandle)
+        {
+            TRACE_DBG("Server socket [ %u ] accepted new connection of client socket [ %u ]"
+                        , static_cast<unsigned int>(serverSocket)
+                        , static_cast<unsigned int>(result));
+            if (out_socketAddr == nullptr)
+            {
+                // do nothing
+            }
+            else if (acceptAddr.ss_family == AF_INET)
+            {
+                out_socketAddr->setAddress(reinterpret_cast<const struct sockaddr_in &>(acceptAddr));
+            }
+            else
+            {
+                // The clients of local socket run on the same host and have no port.
+                *out_socketAddr = NESocket::SocketAddress(String(NESocket::LocalAddress), NESocket::InvalidPort);
+            }
+        }
+        else
+        {
+            TRACE_WARN("Server socket [ %u ] failed to accept connection", static_cast<unsigned int>(serverSocket));
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL bool NESocket::isLocalSocketSupported(void)
+{
+    return _osIsLocalSocketSupported();
+}
+
+AREG_API_IMPL SOCKETHANDLE NESocket::clientLocalSocketConnect(const String & socketPath)
+{
+    TRACE_SCOPE(areg_base_NESocket_clientLocalSocketConnect);
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    if ( (socketPath.isEmpty() == false) && _osIsLocalSocketSupported() )
+    {
+        result = _osCreateLocalSocket(socketPath.getString(), false);
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            TRACE_DBG("Client socket [ %u ] succeeded to connect to local socket [ %s ]", static_cast<unsigned int>(result), socketPath.getString());
+        }
+        else
+        {
+            TRACE_WARN("Client failed to connect to local socket [ %s ]", socketPath.getString());
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL SOCKETHANDLE NESocket::serverLocalSocketConnect(const String & socketPath)
+{
+    TRACE_SCOPE(areg_base_NESocket_serverLocalSocketConnect);
+
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    if ( (socketPath.isEmpty() == false) && _osIsLocalSocketSupported() )
+    {
+        result = _osCreateLocalSocket(socketPath.getString(), true);
+        if ( result != NESocket::InvalidSocketHandle )
+        {
+            TRACE_DBG("Server socket [ %u ] succeeded to bind on local socket [ %s ]. Ready to listen.", static_cast<unsigned int>(result), socketPath.getString());
+        }
+        else
+        {
+            TRACE_ERR("Server failed to bind on local socket [ %s ]", socketPath.getString());
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL void NESocket::deleteLocalSocket(const String & socketPath)
+{
+    if ( socketPath.isEmpty() == false )
+    {
+        _osDeleteLocalSocket(socketPath.getString());
+    }
+}
+
 AREG_API_IMPL bool NESocket::isSocketAlive(SOCKETHANDLE hSocket)
 {
     unsigned long error = 0;
@@ -780,6 +966,78 @@ AREG_API_IMPL int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char* dat
     return result;
 }
 
+AREG_API_IMPL int NESocket::receiveAvailable(SOCKETHANDLE hSocket, unsigned char * dataBuffer, int dataLength)
+{
+    int result = -1;
+
+    if (isSocketHandleValid(hSocket))
+    {
+        result = 0;
+        if ((dataBuffer != nullptr) && (dataLength > 0))
+        {
+            result = _osRecvAvailable(hSocket, dataBuffer, dataLength);
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL int NESocket::sendAvailable(SOCKETHANDLE hSocket, const NESocket::sSendBuffer * buffers, int count)
+{
+    int result = -1;
+
+    if (isSocketHandleValid(hSocket))
+    {
+        result = 0;
+        if ((buffers != nullptr) && (count > 0))
+        {
+            result = _osSendAvailable(hSocket, buffers, MACRO_MIN(count, NESocket::MAXIMUM_SEND_BUFFERS));
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL int NESocket::sendBuffers(SOCKETHANDLE hSocket, const NESocket::sSendBuffer * buffers, int count)
+{
+    int result = -1;
+
+    if (isSocketHandleValid(hSocket))
+    {
+        result = 0;
+        if ((buffers != nullptr) && (count > 0))
+        {
+            result = _osSendBuffers(hSocket, buffers, MACRO_MIN(count, NESocket::MAXIMUM_SEND_BUFFERS));
+        }
+    }
+
+    return result;
+}
+
+AREG_API_IMPL bool NESocket::applySocketProfile(SOCKETHANDLE hSocket, const NESocket::sSocketProfile & profile)
+{
+    bool result{ false };
+
+    if (isSocketHandleValid(hSocket))
+    {
+        result = _osSetOption(hSocket, IPPROTO_TCP, TCP_NODELAY, profile.spNoDelay ? 1 : 0);
+        result = _osSetOption(hSocket, SOL_SOCKET, SO_KEEPALIVE, profile.spKeepAlive ? 1 : 0) && result;
+        if (profile.spBufferSize != 0)
+        {
+            const int size{ static_cast<int>(MACRO_MAX(profile.spBufferSize, NESocket::PACKET_MIN_SIZE)) };
+            result = _osSetOption(hSocket, SOL_SOCKET, SO_SNDBUF, size) && result;
+            result = _osSetOption(hSocket, SOL_SOCKET, SO_RCVBUF, size) && result;
+        }
+
+        if (profile.spBusyPoll != 0)
+        {
+            result = _osSetBusyPoll(hSocket, profile.spBusyPoll) && result;
+        }
+    }
+
+    return result;
+}
+
 AREG_API_IMPL bool NESocket::disableSend(SOCKETHANDLE hSocket)
 {
 #ifdef WINDOWS
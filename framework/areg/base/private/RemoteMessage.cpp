@@ -18,6 +18,7 @@
  ************************************************************************/
 #include "areg/base/RemoteMessage.hpp"
 
+#include "areg/base/MemoryPool.hpp"
 #include "areg/base/NEMemory.hpp"
 #include "areg/base/NEMath.hpp"
 #include "areg/trace/GETrace.h"
@@ -144,7 +145,7 @@ unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader
     unsigned int msgSize    = hdrSize + sizeUsed;
     unsigned int sizeBuffer = MACRO_ALIGN_SIZE(msgSize, mBlockSize);
     unsigned int sizeData   = sizeBuffer - hdrSize;
-    unsigned char * result  = DEBUG_NEW unsigned char[sizeBuffer];
+    unsigned char * result  = reinterpret_cast<unsigned char *>(MemoryPool::allocate(sizeBuffer));
     if ( result != nullptr )
     {
         NEMemory::memZero(result, sizeof(NEMemory::sRemoteMessage));
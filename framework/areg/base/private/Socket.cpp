@@ -41,8 +41,11 @@ Socket::Socket(const SOCKETHANDLE hSocket, const NESocket::SocketAddress & sockA
     , mRecvSize ( NESocket::PACKET_DEFAULT_SIZE )
 {
     static_cast<void>(NESocket::socketInitialize( ));
-    mSendSize = getSendPacketSize();
-    mRecvSize = getRecvPacketSize();
+    if ( NESocket::isSocketHandleValid( hSocket ) )
+    {
+        mSendSize = NESocket::getMaxSendSize( hSocket );
+        mRecvSize = NESocket::getMaxReceiveSize( hSocket );
+    }
 }
 
 Socket::Socket( const Socket & source )
@@ -78,7 +81,7 @@ Socket & Socket::operator = ( const Socket & src )
 		this->mSocket 	= src.mSocket;
 		this->mAddress	= src.mAddress;
         this->mSendSize = src.mSendSize;
-        this->mRecvSize = src.mSendSize;
+        this->mRecvSize = src.mRecvSize;
 	}
 
 	return (*this);
@@ -93,7 +96,7 @@ Socket & Socket::operator = ( Socket && src ) noexcept
 		this->mSocket 	= src.mSocket;
 		this->mAddress	= std::move(src.mAddress);
         this->mSendSize = src.mSendSize;
-        this->mRecvSize = src.mSendSize;
+        this->mRecvSize = src.mRecvSize;
     }
 
 	return (*this);
@@ -114,6 +117,34 @@ int Socket::receiveData( unsigned char * buffer, int length ) const
     return (isValid( ) ? NESocket::receiveData( *mSocket, buffer, length, mRecvSize ) : -1);
 }
 
+int Socket::receiveAvailable( unsigned char * buffer, int length ) const
+{
+    return (isValid( ) ? NESocket::receiveAvailable( *mSocket, buffer, length ) : -1);
+}
+
+int Socket::sendAvailable( const NESocket::sSendBuffer * buffers, int count ) const
+{
+    return (isValid( ) ? NESocket::sendAvailable( *mSocket, buffers, count ) : -1);
+}
+
+int Socket::sendBuffers( const NESocket::sSendBuffer * buffers, int count ) const
+{
+    return (isValid( ) ? NESocket::sendBuffers( *mSocket, buffers, count ) : -1);
+}
+
+bool Socket::applyProfile( const NESocket::sSocketProfile & profile ) const
+{
+    bool result{ false };
+    if ( isValid( ) )
+    {
+        result = NESocket::applySocketProfile( *mSocket, profile );
+        mSendSize = NESocket::getMaxSendSize( *mSocket );
+        mRecvSize = NESocket::getMaxReceiveSize( *mSocket );
+    }
+
+    return result;
+}
+
 bool Socket::setAddress(const char * hostName, unsigned short portNr, bool isServer)
 {
     if ( isValid() && (mAddress.getHostAddress() != hostName || mAddress.getHostPort() != portNr) )
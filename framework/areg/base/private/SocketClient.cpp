@@ -48,3 +48,18 @@ bool SocketClient::createSocket( void )
 
     return isValid();
 }
+
+bool SocketClient::createLocalSocket( const String & socketPath )
+{
+    decreaseLock();
+
+    SOCKETHANDLE hSocket = NESocket::clientLocalSocketConnect(socketPath);
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        mSocket = std::make_shared<SOCKETHANDLE>(hSocket);
+        mSendSize = NESocket::getMaxSendSize(hSocket);
+        mRecvSize = NESocket::getMaxReceiveSize(hSocket);
+    }
+
+    return isValid();
+}
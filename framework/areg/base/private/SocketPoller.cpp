@@ -0,0 +1,318 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/SocketPoller.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the socket readiness poller (I/O reactor).
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#include "areg/base/GEMacros.h"
+#include "areg/trace/GETrace.h"
+
+#ifdef   _WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif  // WIN32_LEAN_AND_MEAN
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/select.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <netinet/in.h>
+    #include <fcntl.h>
+#endif
+
+DEF_TRACE_SCOPE(areg_base_SocketPoller_selectEvents);
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class implementation
+//////////////////////////////////////////////////////////////////////////
+
+SocketPoller::SocketPoller( void )
+    : mPoller   ( -1 )
+    , mWakeup   ( -1 )
+    , mSelectWakeup ( NESocket::InvalidSocketHandle )
+    , mSockets  ( )
+    , mLock     ( false )
+{
+}
+
+SocketPoller::~SocketPoller( void )
+{
+    release( );
+}
+
+bool SocketPoller::create( void )
+{
+    Lock lock( mLock );
+    if ( isValid( ) == false )
+    {
+        mSockets.clear( );
+        _osCreatePoller( );
+    }
+
+    return isValid( );
+}
+
+void SocketPoller::release( void )
+{
+    Lock lock( mLock );
+    if ( isValid( ) )
+    {
+        _osReleasePoller( );
+    }
+
+    mSockets.clear( );
+    mPoller = -1;
+    mWakeup = -1;
+}
+
+bool SocketPoller::addSocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered )
+{
+    bool result{ false };
+    Lock lock( mLock );
+    if ( isValid( ) && (hSocket != NESocket::InvalidSocketHandle) && (mSockets.contains( hSocket ) == false) )
+    {
+        if ( _osControlSocket( hSocket, events, edgeTriggered, true ) )
+        {
+            mSockets.setAt( hSocket, events );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+bool SocketPoller::modifySocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered )
+{
+    bool result{ false };
+    Lock lock( mLock );
+    if ( isValid( ) && mSockets.contains( hSocket ) )
+    {
+        if ( _osControlSocket( hSocket, events, edgeTriggered, false ) )
+        {
+            mSockets.setAt( hSocket, events );
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+void SocketPoller::removeSocket( SOCKETHANDLE hSocket )
+{
+    Lock lock( mLock );
+    if ( isValid( ) && mSockets.contains( hSocket ) )
+    {
+        _osRemoveSocket( hSocket );
+        mSockets.removeAt( hSocket );
+    }
+}
+
+int SocketPoller::waitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout /*= NECommon::WAIT_INFINITE*/ )
+{
+    if ( (isValid( ) == false) || (out_events == nullptr) || (maxEvents <= 0) )
+        return -1;
+
+    return _osWaitEvents( out_events, maxEvents, msTimeout );
+}
+
+void SocketPoller::interrupt( void )
+{
+    if ( isValid( ) )
+    {
+        _osInterrupt( );
+    }
+}
+
+int SocketPoller::_selectEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout )
+{
+    TRACE_SCOPE( areg_base_SocketPoller_selectEvents );
+
+    SOCKETHANDLE handles[ FD_SETSIZE ];
+    fd_set readList { };
+    fd_set writeList{ };
+    fd_set errorList{ };
+    FD_ZERO( &readList );
+    FD_ZERO( &writeList );
+    FD_ZERO( &errorList );
+
+    // The wake-up socket takes one entry of the set.
+    constexpr int maxCount{ FD_SETSIZE - 1 };
+    SOCKETHANDLE maxSocket{ 0 };
+    SOCKETHANDLE hWakeup{ NESocket::InvalidSocketHandle };
+    int count{ 0 };
+
+    do
+    {
+        Lock lock( mLock );
+        hWakeup = mSelectWakeup;
+        if ( hWakeup != NESocket::InvalidSocketHandle )
+        {
+            FD_SET( hWakeup, &readList );
+            maxSocket = hWakeup;
+        }
+
+        for ( auto pos = mSockets.firstPosition( ); mSockets.isValidPosition( pos ) && (count < maxCount); pos = mSockets.nextPosition( pos ) )
+        {
+            SOCKETHANDLE hSocket = mSockets.keyAtPosition( pos );
+            uint32_t events = mSockets.valueAtPosition( pos );
+
+#ifndef _WINDOWS
+            if ( static_cast<int>(hSocket) >= FD_SETSIZE )
+            {
+                TRACE_WARN( "The socket [ %u ] exceeds FD_SETSIZE, skipping in select() fallback", static_cast<unsigned int>(hSocket) );
+                continue;
+            }
+#endif  // !_WINDOWS
+
+            handles[ count ++ ] = hSocket;
+            maxSocket = MACRO_MAX( maxSocket, hSocket );
+            if ( (events & static_cast<uint32_t>(ePollEvent::PollRead)) != 0 )
+            {
+                FD_SET( hSocket, &readList );
+            }
+
+            if ( (events & static_cast<uint32_t>(ePollEvent::PollWrite)) != 0 )
+            {
+                FD_SET( hSocket, &writeList );
+            }
+
+            FD_SET( hSocket, &errorList );
+        }
+    } while ( false );
+
+    if ( (count == 0) && (hWakeup == NESocket::InvalidSocketHandle) )
+    {
+        TRACE_WARN( "There are no sockets to wait for events" );
+        return -1;
+    }
+
+    struct timeval timeout { };
+    struct timeval * waitTime{ nullptr };
+    if ( msTimeout != NECommon::WAIT_INFINITE )
+    {
+        timeout.tv_sec  = static_cast<long>(msTimeout / 1000u);
+        timeout.tv_usec = static_cast<long>((msTimeout % 1000u) * 1000u);
+        waitTime        = &timeout;
+    }
+
+    int selected = select( static_cast<int>(maxSocket) + 1 /* param is ignored in Win32*/, &readList, &writeList, &errorList, waitTime );
+    if ( selected <= 0 )
+    {
+        if ( selected < 0 )
+        {
+            TRACE_ERR( "Failed to select socket events, return value [ %d ]", selected );
+        }
+
+        return selected;
+    }
+
+    if ( (hWakeup != NESocket::InvalidSocketHandle) && (FD_ISSET( hWakeup, &readList ) != 0) )
+    {
+        // Drain one wake-up datagram. If there are more, the next select() returns immediately.
+        char wakeup[ 4 ];
+        static_cast<void>(::recv( hWakeup, wakeup, static_cast<int>(sizeof( wakeup )), 0 ));
+    }
+
+    int result{ 0 };
+    for ( int i = 0; (i < count) && (result < maxEvents); ++ i )
+    {
+        SOCKETHANDLE hSocket = handles[ i ];
+        uint32_t events{ static_cast<uint32_t>(ePollEvent::PollNone) };
+        if ( FD_ISSET( hSocket, &readList ) != 0 )
+        {
+            events |= static_cast<uint32_t>(ePollEvent::PollRead);
+        }
+
+        if ( FD_ISSET( hSocket, &writeList ) != 0 )
+        {
+            events |= static_cast<uint32_t>(ePollEvent::PollWrite);
+        }
+
+        if ( FD_ISSET( hSocket, &errorList ) != 0 )
+        {
+            events |= static_cast<uint32_t>(ePollEvent::PollError);
+        }
+
+        if ( events != static_cast<uint32_t>(ePollEvent::PollNone) )
+        {
+            out_events[ result ].peSocket = hSocket;
+            out_events[ result ].peEvents = events;
+            ++ result;
+        }
+    }
+
+    return result;
+}
+
+bool SocketPoller::_createSelectWakeup( void )
+{
+    if ( (mSelectWakeup != NESocket::InvalidSocketHandle) || (NESocket::socketInitialize( ) == false) )
+    {
+        return (mSelectWakeup != NESocket::InvalidSocketHandle);
+    }
+
+    SOCKETHANDLE hSocket = static_cast<SOCKETHANDLE>(::socket( AF_INET, SOCK_DGRAM, 0 ));
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        struct sockaddr_in addr { };
+        addr.sin_family         = AF_INET;
+        addr.sin_addr.s_addr    = htonl( INADDR_LOOPBACK );
+        addr.sin_port           = 0;
+        socklen_t length        = static_cast<socklen_t>(sizeof( addr ));
+
+        // Bind to any free loopback port and connect to itself.
+        if ( (::bind( hSocket, reinterpret_cast<const struct sockaddr *>(&addr), length ) == 0)     &&
+             (::getsockname( hSocket, reinterpret_cast<struct sockaddr *>(&addr), &length ) == 0)  &&
+             (::connect( hSocket, reinterpret_cast<const struct sockaddr *>(&addr), length ) == 0) )
+        {
+#ifdef  _WINDOWS
+            u_long nonBlocking{ 1 };
+            ::ioctlsocket( hSocket, FIONBIO, &nonBlocking );
+#else   // _WINDOWS
+            ::fcntl( hSocket, F_SETFL, ::fcntl( hSocket, F_GETFL, 0 ) | O_NONBLOCK );
+#endif  // _WINDOWS
+            mSelectWakeup = hSocket;
+        }
+        else
+        {
+            NESocket::socketClose( hSocket );
+        }
+    }
+
+    if ( mSelectWakeup == NESocket::InvalidSocketHandle )
+    {
+        NESocket::socketRelease( );
+    }
+
+    return (mSelectWakeup != NESocket::InvalidSocketHandle);
+}
+
+void SocketPoller::_releaseSelectWakeup( void )
+{
+    if ( mSelectWakeup != NESocket::InvalidSocketHandle )
+    {
+        NESocket::socketClose( mSelectWakeup );
+        mSelectWakeup = NESocket::InvalidSocketHandle;
+        NESocket::socketRelease( );
+    }
+}
+
+void SocketPoller::_signalSelectWakeup( void )
+{
+    if ( mSelectWakeup != NESocket::InvalidSocketHandle )
+    {
+        const char wakeup{ 1 };
+        static_cast<void>(::send( mSelectWakeup, &wakeup, 1, 0 ));
+    }
+}
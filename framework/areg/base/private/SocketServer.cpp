@@ -15,14 +15,22 @@
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SocketAccepted.hpp"
 
+SocketServer::SocketServer( void )
+    : Socket      ( )
+    , mLocalPath  ( )
+{
+}
+
 SocketServer::SocketServer( const char * hostName, unsigned short portNr )
-    : Socket  ( )
+    : Socket      ( )
+    , mLocalPath  ( )
 {
     mAddress.resolveAddress(hostName != nullptr ? hostName : NESocket::LocalHost, portNr, true);
 }
 
 SocketServer::SocketServer( const NESocket::SocketAddress & serverAddress )
-    : Socket  ( )
+    : Socket      ( )
+    , mLocalPath  ( )
 {
     mAddress = serverAddress;
 }
@@ -34,7 +42,7 @@ bool SocketServer::createSocket(const char * hostName, unsigned short portNr)
 
 bool SocketServer::createSocket(void)
 {
-    decreaseLock();
+    closeSocket();
     if ( mAddress.isValid() )
     {
     	SOCKETHANDLE hSocket = NESocket::serverSocketConnect(static_cast<const char *>(mAddress.getHostAddress()), mAddress.getHostPort());
@@ -49,6 +57,34 @@ bool SocketServer::createSocket(void)
     return isValid();
 }
 
+void SocketServer::closeSocket(void)
+{
+    const bool isLast{ isValid() && (mSocket.use_count() == 1) };
+    Socket::closeSocket();
+    if ( isLast )
+    {
+        NESocket::deleteLocalSocket(mLocalPath);
+    }
+
+    mLocalPath.clear();
+}
+
+bool SocketServer::createLocalSocket( const String & socketPath )
+{
+    closeSocket();
+
+    SOCKETHANDLE hSocket = NESocket::serverLocalSocketConnect(socketPath);
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        mSocket = std::make_shared<SOCKETHANDLE>( hSocket );
+        mSendSize = NESocket::getMaxSendSize(hSocket);
+        mRecvSize = NESocket::getMaxReceiveSize(hSocket);
+        mLocalPath = socketPath;
+    }
+
+    return isValid();
+}
+
 bool SocketServer::listenConnection(int maxQueueSize)
 {
     return (isValid() ? NESocket::serverListenConnection(*mSocket, maxQueueSize > 0 ? maxQueueSize : NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) : false );
@@ -58,3 +94,8 @@ SOCKETHANDLE SocketServer::waitConnectionEvent(NESocket::SocketAddress & out_add
 {
     return ( isValid() ? NESocket::serverAcceptConnection(*mSocket, masterList, entriesCount, &out_addrAccepted) : NESocket::InvalidSocketHandle );
 }
+
+SOCKETHANDLE SocketServer::acceptConnection( NESocket::SocketAddress & out_addrAccepted )
+{
+    return ( isValid() ? NESocket::serverAccept(*mSocket, &out_addrAccepted) : NESocket::InvalidSocketHandle );
+}
@@ -30,6 +30,29 @@ constexpr std::string_view   DEFAULT_THREAD_PREFIX   { "_AREG_thread_" };
  **/
 constexpr std::string_view   STORAGE_THREAD_CONSUMER { "ThreadConsumer" };
 
+/**
+ * \brief   The name of the storage slot to save pointer of the Thread object.
+ **/
+constexpr std::string_view   STORAGE_THREAD_OBJECT   { "ThreadObject" };
+
+/**
+ * \brief   Returns the index of the storage slot of the current Thread object.
+ **/
+inline int _getSlotThreadObject( void )
+{
+    static const int _slot{ ThreadLocalStorage::registerStorageSlot( STORAGE_THREAD_OBJECT.data( ) ) };
+    return _slot;
+}
+
+/**
+ * \brief   Returns the index of the storage slot of the current Thread Consumer.
+ **/
+inline int _getSlotThreadConsumer( void )
+{
+    static const int _slot{ ThreadLocalStorage::registerStorageSlot( STORAGE_THREAD_CONSUMER.data( ) ) };
+    return _slot;
+}
+
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -282,6 +305,8 @@ int Thread::_threadEntry( void )
     if (Thread::_findThreadByHandle(mThreadHandle) != nullptr )
     {
         Thread::getCurrentThreadStorage().setStorageItem(STORAGE_THREAD_CONSUMER.data(), (void *)&mThreadConsumer);
+        ThreadLocalStorage::setSlotItem(_getSlotThreadObject(), this);
+        ThreadLocalStorage::setSlotItem(_getSlotThreadConsumer(), &mThreadConsumer);
 
         _setRunning(true);
 
@@ -302,6 +327,9 @@ int Thread::_threadEntry( void )
         ; // do nothing
     }
 
+    // the thread completes the job, reset all cached values of storage slots.
+    ThreadLocalStorage::_clearSlots();
+
     _cleanResources();
 
     return static_cast<int>(result);
@@ -365,12 +393,24 @@ void Thread::_unregisterThread( void )
 IEThreadConsumer& Thread::getCurrentThreadConsumer( void )
 {
     ASSERT(getCurrentThread() != nullptr );
-    ThreadLocalStorage& localStorage = Thread::getCurrentThreadStorage();
-    IEThreadConsumer* consumer = reinterpret_cast<IEThreadConsumer *>(localStorage.getStorageItem(STORAGE_THREAD_CONSUMER).alignPtr.mElement);
+    IEThreadConsumer* consumer = reinterpret_cast<IEThreadConsumer *>(ThreadLocalStorage::getSlotItem(_getSlotThreadConsumer()).alignPtr.mElement);
     ASSERT(consumer != nullptr );
     return (*consumer);
 }
 
+Thread * Thread::getCurrentThread( void )
+{
+    // the slot is set only in the context of running Thread object,
+    // other threads are searched in the map of registered threads.
+    Thread * result = Thread::getCurrentRunningThread();
+    return (result != nullptr ? result : Thread::findThreadById(Thread::_osGetCurrentThreadId()));
+}
+
+Thread * Thread::getCurrentRunningThread( void )
+{
+    return reinterpret_cast<Thread *>(ThreadLocalStorage::getSlotItem(_getSlotThreadObject()).alignPtr.mElement);
+}
+
 Thread * Thread::getFirstThread( id_type & OUT threadId )
 {
     return _getMapThreadId().resourceFirstKey( threadId );
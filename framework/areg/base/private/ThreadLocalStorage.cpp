@@ -16,6 +16,38 @@
  ************************************************************************/
 #include "areg/base/ThreadLocalStorage.hpp"
 #include "areg/base/Thread.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+namespace
+{
+    /**
+     * \brief   The registered keys of the storage slots.
+     *          The index of the key in the list is the index of the slot.
+     **/
+    struct sSlotRegistry
+    {
+        //!< The synchronization object to register slots.
+        ResourceLock    srLock;
+        //!< The names of registered slots.
+        String          srKeys[ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS];
+        //!< The number of registered slots.
+        int             srCount { 0 };
+    };
+
+    /**
+     * \brief   Returns the instance of the registry of storage slots.
+     **/
+    inline sSlotRegistry & _getSlotRegistry( void )
+    {
+        static sSlotRegistry _registry;
+        return _registry;
+    }
+
+    /**
+     * \brief   The values of the storage slots of the current thread.
+     **/
+    __THREAD_LOCAL NEMemory::uAlign _storageSlots[ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS];
+}
 
 //////////////////////////////////////////////////////////////////////////
 // ThreadLocalStorage class implementation
@@ -123,3 +155,51 @@ const String & ThreadLocalStorage::getName( void ) const
 {
     return mOwningThread.getName();
 }
+
+//////////////////////////////////////////////////////////////////////////
+// ThreadLocalStorage class storage slots
+//////////////////////////////////////////////////////////////////////////
+int ThreadLocalStorage::registerStorageSlot( const String & Key )
+{
+    sSlotRegistry & registry{ _getSlotRegistry( ) };
+    Lock lock( registry.srLock );
+
+    for ( int i = 0; i < registry.srCount; ++ i )
+    {
+        if ( registry.srKeys[i] == Key )
+            return i;
+    }
+
+    int result{ ThreadLocalStorage::INVALID_STORAGE_SLOT };
+    if ( registry.srCount < ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS )
+    {
+        result = registry.srCount ++;
+        registry.srKeys[result] = Key;
+    }
+
+    ASSERT( result != ThreadLocalStorage::INVALID_STORAGE_SLOT );
+    return result;
+}
+
+NEMemory::uAlign ThreadLocalStorage::getSlotItem( int slot )
+{
+    ASSERT( (slot >= 0) && (slot < ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS) );
+    return _storageSlots[slot];
+}
+
+void ThreadLocalStorage::setSlotItem( int slot, NEMemory::uAlign Value )
+{
+    ASSERT( (slot >= 0) && (slot < ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS) );
+    _storageSlots[slot] = Value;
+}
+
+void ThreadLocalStorage::setSlotItem( int slot, const void * Value )
+{
+    ASSERT( (slot >= 0) && (slot < ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS) );
+    _storageSlots[slot].alignPtr.mElement = const_cast<void *>(Value);
+}
+
+void ThreadLocalStorage::_clearSlots( void )
+{
+    NEMemory::zeroElements<NEMemory::uAlign>( _storageSlots, static_cast<uint32_t>(ThreadLocalStorage::MAXIMUM_STORAGE_SLOTS) );
+}
@@ -28,7 +28,9 @@
 //////////////////////////////////////////////////////////////////////////
 
 IEWaitableBaseIX::IEWaitableBaseIX( NESynchTypesIX::eSynchObject synchType, bool isRecursive, const char* asciiName /* = nullptr */ )
-    : MutexIX     ( synchType, isRecursive, asciiName )
+    : MutexIX           ( synchType, isRecursive, asciiName )
+    , mWaitersLock      ( false )
+    , mLockAndWaitList  ( )
 {
 }
 
@@ -24,8 +24,14 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/base/private/posix/MutexIX.hpp"
+#include "areg/base/TELinkedList.hpp"
 #include <pthread.h>
 
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class SynchLockAndWaitIX;
+
 //////////////////////////////////////////////////////////////////////////
 // SynchWaitable class declaration
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +45,13 @@
  **/
 class IEWaitableBaseIX : public MutexIX
 {
+    friend class SynchLockAndWaitIX;
+
+    /**
+     * \brief   The list of LockAndWait objects waiting for the waitable.
+     **/
+    using ListLockAndWait   = TELinkedList<SynchLockAndWaitIX *>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -96,6 +109,21 @@ public:
      **/
     virtual void freeResources( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The lock of the list of LockAndWait objects. It is not the lock
+     *          of the waitable state, so that the waiting threads are notified
+     *          without blocking the state of the waitable.
+     **/
+    MutexIX             mWaitersLock;
+    /**
+     * \brief   The list of LockAndWait objects waiting for the waitable.
+     **/
+    ListLockAndWait     mLockAndWaitList;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -25,9 +25,14 @@
 #include <sys/socket.h>
 #include <sys/select.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <sys/stat.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <netdb.h>
 #include <errno.h>
+#include <string.h>
 #include <arpa/inet.h>
 #include <ctype.h>      // IEEE Std 1003.1-2001
 #include <atomic>
@@ -125,6 +130,117 @@ namespace NESocket
         return result;
     }
 
+    int _osRecvAvailable(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+        int result = static_cast<int>(::recv(hSocket, dataBuffer, static_cast<size_t>(dataLength), MSG_DONTWAIT));
+        if (result == 0)
+        {
+            result = -1;    // the other side disconnected
+        }
+        else if ((result < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+        {
+            result = 0;     // no data available
+        }
+
+        return result;
+    }
+
+    int _osSendAvailable(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((buffers != nullptr) && (count > 0) && (count <= NESocket::MAXIMUM_SEND_BUFFERS));
+
+        struct iovec vectors[NESocket::MAXIMUM_SEND_BUFFERS];
+        for (int i = 0; i < count; ++ i)
+        {
+            vectors[i].iov_base = const_cast<unsigned char *>(buffers[i].sbData);
+            vectors[i].iov_len  = static_cast<size_t>(buffers[i].sbLength);
+        }
+
+        struct msghdr msg { };
+        msg.msg_iov     = vectors;
+        msg.msg_iovlen  = static_cast<size_t>(count);
+
+        int result = static_cast<int>(::sendmsg(hSocket, &msg, MSG_DONTWAIT));
+        if ((result < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+        {
+            result = 0;     // the send buffer is full
+        }
+
+        return result;
+    }
+
+    int _osSendBuffers(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((buffers != nullptr) && (count > 0) && (count <= NESocket::MAXIMUM_SEND_BUFFERS));
+
+        struct iovec vectors[NESocket::MAXIMUM_SEND_BUFFERS];
+        int result{ 0 };
+        for (int i = 0; i < count; ++ i)
+        {
+            vectors[i].iov_base = const_cast<unsigned char *>(buffers[i].sbData);
+            vectors[i].iov_len  = static_cast<size_t>(buffers[i].sbLength);
+            result += static_cast<int>(buffers[i].sbLength);
+        }
+
+        struct msghdr msg { };
+        msg.msg_iov     = vectors;
+        msg.msg_iovlen  = static_cast<size_t>(count);
+
+        int remain{ result };
+        while (remain > 0)
+        {
+            int written = static_cast<int>(::sendmsg(hSocket, &msg, 0));
+            if (written > 0)
+            {
+                remain -= written;
+                // Skip the sent buffers and move to the position of the partially sent buffer.
+                while ((written > 0) && (static_cast<size_t>(written) >= msg.msg_iov->iov_len))
+                {
+                    written -= static_cast<int>(msg.msg_iov->iov_len);
+                    ++ msg.msg_iov;
+                    -- msg.msg_iovlen;
+                }
+
+                if (written > 0)
+                {
+                    msg.msg_iov->iov_base = reinterpret_cast<unsigned char *>(msg.msg_iov->iov_base) + written;
+                    msg.msg_iov->iov_len -= static_cast<size_t>(written);
+                }
+            }
+            else if ((written < 0) && (errno == EINTR))
+            {
+                continue;   // interrupted, try again
+            }
+            else
+            {
+                remain = 0;     // break loop
+                result = -1;    // notify failure
+            }
+        }
+
+        return result;
+    }
+
+    bool _osSetOption(SOCKETHANDLE hSocket, int level, int name, int value)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        return (RETURNED_OK == ::setsockopt(static_cast<int>(hSocket), level, name, &value, sizeof(int)));
+    }
+
+    bool _osSetBusyPoll(SOCKETHANDLE hSocket, unsigned int microseconds)
+    {
+#ifdef SO_BUSY_POLL
+        return _osSetOption(hSocket, SOL_SOCKET, SO_BUSY_POLL, static_cast<int>(microseconds));
+#else   // SO_BUSY_POLL
+        return false;
+#endif  // SO_BUSY_POLL
+    }
+
     bool _osControl(SOCKETHANDLE hSocket, int cmd, unsigned long& arg)
     {
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
@@ -138,6 +254,61 @@ namespace NESocket
         return (RETURNED_OK == ::getsockopt(static_cast<int>(hSocket), level, name, reinterpret_cast<char*>(&value), &len));
     }
 
+    bool _osIsLocalSocketSupported(void)
+    {
+        return true;
+    }
+
+    void _osDeleteLocalSocket(const char * socketPath)
+    {
+        ASSERT(socketPath != nullptr);
+
+        // Make sure that only the socket file is removed.
+        struct stat info { };
+        if ((::lstat(socketPath, &info) == RETURNED_OK) && S_ISSOCK(info.st_mode))
+        {
+            ::unlink(socketPath);
+        }
+    }
+
+    SOCKETHANDLE _osCreateLocalSocket(const char * socketPath, bool isServer)
+    {
+        ASSERT(socketPath != nullptr);
+
+        SOCKETHANDLE result{ NESocket::InvalidSocketHandle };
+        struct sockaddr_un addr { };
+        const size_t length{ ::strlen(socketPath) };
+        if ((length != 0) && (length < sizeof(addr.sun_path)))
+        {
+            addr.sun_family = AF_UNIX;
+            NEMemory::memCopy(addr.sun_path, static_cast<uint32_t>(sizeof(addr.sun_path)), socketPath, static_cast<uint32_t>(length));
+
+            result = static_cast<SOCKETHANDLE>(::socket(AF_UNIX, SOCK_STREAM, 0));
+            if (result != NESocket::InvalidSocketHandle)
+            {
+                int error{ RETURNED_OK };
+                if (isServer)
+                {
+                    // The file left by the previous instance of the server should be removed before binding.
+                    _osDeleteLocalSocket(socketPath);
+                    error = ::bind(result, reinterpret_cast<struct sockaddr *>(&addr), sizeof(struct sockaddr_un));
+                }
+                else
+                {
+                    error = ::connect(result, reinterpret_cast<struct sockaddr *>(&addr), sizeof(struct sockaddr_un));
+                }
+
+                if (error != RETURNED_OK)
+                {
+                    ::close(result);
+                    result = NESocket::InvalidSocketHandle;
+                }
+            }
+        }
+
+        return result;
+    }
+
 } // namespace NESocket
 
 #endif  // defined(_POSIX) || defined(POSIX)
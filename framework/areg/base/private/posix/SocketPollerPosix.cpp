@@ -0,0 +1,218 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/posix/SocketPollerPosix.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the socket poller POSIX specific implementation.
+ *              On Linux uses edge-triggered epoll, on other POSIX
+ *              systems falls back to select().
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/base/GEMacros.h"
+
+#if AREG_SOCKET_EPOLL
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+    #include <errno.h>
+#endif  // AREG_SOCKET_EPOLL
+
+#if AREG_SOCKET_EPOLL
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class, Linux epoll implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    /**
+     * \brief   Converts the poller events to epoll events.
+     **/
+    inline uint32_t _toEpollEvents( uint32_t events, bool edgeTriggered )
+    {
+        uint32_t result{ EPOLLRDHUP };
+        if ( (events & static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead)) != 0 )
+        {
+            result |= EPOLLIN;
+        }
+
+        if ( (events & static_cast<uint32_t>(SocketPoller::ePollEvent::PollWrite)) != 0 )
+        {
+            result |= EPOLLOUT;
+        }
+
+        if ( edgeTriggered )
+        {
+            result |= EPOLLET;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Converts the epoll events to the poller events.
+     **/
+    inline uint32_t _fromEpollEvents( uint32_t events )
+    {
+        uint32_t result{ static_cast<uint32_t>(SocketPoller::ePollEvent::PollNone) };
+        if ( (events & EPOLLIN) != 0 )
+        {
+            result |= static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead);
+        }
+
+        if ( (events & EPOLLOUT) != 0 )
+        {
+            result |= static_cast<uint32_t>(SocketPoller::ePollEvent::PollWrite);
+        }
+
+        if ( (events & (EPOLLRDHUP | EPOLLHUP)) != 0 )
+        {
+            result |= static_cast<uint32_t>(SocketPoller::ePollEvent::PollClosed);
+        }
+
+        if ( (events & EPOLLERR) != 0 )
+        {
+            result |= static_cast<uint32_t>(SocketPoller::ePollEvent::PollError);
+        }
+
+        return result;
+    }
+}
+
+bool SocketPoller::_osCreatePoller( void )
+{
+    mPoller = ::epoll_create1( EPOLL_CLOEXEC );
+    if ( mPoller != -1 )
+    {
+        mWakeup = ::eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+        struct epoll_event ev { };
+        ev.events   = EPOLLIN;
+        ev.data.fd  = mWakeup;
+        if ( (mWakeup == -1) || (::epoll_ctl( mPoller, EPOLL_CTL_ADD, mWakeup, &ev ) != 0) )
+        {
+            _osReleasePoller( );
+        }
+    }
+
+    return (mPoller != -1);
+}
+
+void SocketPoller::_osReleasePoller( void )
+{
+    if ( mWakeup != -1 )
+    {
+        ::close( mWakeup );
+        mWakeup = -1;
+    }
+
+    if ( mPoller != -1 )
+    {
+        ::close( mPoller );
+        mPoller = -1;
+    }
+}
+
+bool SocketPoller::_osControlSocket( SOCKETHANDLE hSocket, uint32_t events, bool edgeTriggered, bool isNew )
+{
+    struct epoll_event ev { };
+    ev.events   = _toEpollEvents( events, edgeTriggered );
+    ev.data.fd  = hSocket;
+    return (::epoll_ctl( mPoller, isNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, hSocket, &ev ) == 0);
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE hSocket )
+{
+    struct epoll_event ev { };
+    ::epoll_ctl( mPoller, EPOLL_CTL_DEL, hSocket, &ev );
+}
+
+int SocketPoller::_osWaitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout )
+{
+    struct epoll_event events[ SocketPoller::MAX_POLL_EVENTS ];
+    int timeout = msTimeout == NECommon::WAIT_INFINITE ? -1 : static_cast<int>(msTimeout);
+    int count   = ::epoll_wait( mPoller, events, MACRO_MIN( maxEvents, SocketPoller::MAX_POLL_EVENTS ), timeout );
+    if ( count < 0 )
+    {
+        return (errno == EINTR ? 0 : -1);
+    }
+
+    int result{ 0 };
+    for ( int i = 0; i < count; ++ i )
+    {
+        if ( events[ i ].data.fd == mWakeup )
+        {
+            eventfd_t value{ 0 };
+            ::eventfd_read( mWakeup, &value );
+        }
+        else
+        {
+            out_events[ result ].peSocket = static_cast<SOCKETHANDLE>(events[ i ].data.fd);
+            out_events[ result ].peEvents = _fromEpollEvents( events[ i ].events );
+            ++ result;
+        }
+    }
+
+    return result;
+}
+
+void SocketPoller::_osInterrupt( void )
+{
+    if ( mWakeup != -1 )
+    {
+        ::eventfd_write( mWakeup, 1 );
+    }
+}
+
+#else   // !AREG_SOCKET_EPOLL
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class, POSIX select() fallback implementation
+//////////////////////////////////////////////////////////////////////////
+
+bool SocketPoller::_osCreatePoller( void )
+{
+    mPoller = _createSelectWakeup( ) ? 0 : -1;
+    return (mPoller != -1);
+}
+
+void SocketPoller::_osReleasePoller( void )
+{
+    _releaseSelectWakeup( );
+    mPoller = -1;
+}
+
+bool SocketPoller::_osControlSocket( SOCKETHANDLE /*hSocket*/, uint32_t /*events*/, bool /*edgeTriggered*/, bool /*isNew*/ )
+{
+    // The waiting thread should rebuild the set of sockets.
+    _signalSelectWakeup( );
+    return true;
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE /*hSocket*/ )
+{
+    _signalSelectWakeup( );
+}
+
+int SocketPoller::_osWaitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout )
+{
+    return _selectEvents( out_events, maxEvents, msTimeout );
+}
+
+void SocketPoller::_osInterrupt( void )
+{
+    _signalSelectWakeup( );
+}
+
+#endif  // AREG_SOCKET_EPOLL
+
+#endif  // defined(_POSIX) || defined(POSIX)
@@ -21,7 +21,9 @@
 #include "areg/base/private/posix/IEWaitableBaseIX.hpp"
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/Thread.hpp"
+#include <algorithm>
 #include <errno.h>
+#include <functional>
 
 //////////////////////////////////////////////////////////////////////////
 // SynchLockAndWaitIX class implementation
@@ -33,12 +35,6 @@ SynchLockAndWaitIX::MapWaitIDResource & SynchLockAndWaitIX::_mapWaitResourceIds(
     return _mapWaitIdResource;
 }
 
-SynchLockAndWaitIX::SynchResourceMapIX & SynchLockAndWaitIX::_mapSynchResources( void )
-{
-    static SynchLockAndWaitIX::SynchResourceMapIX _theSynchResourceMapIX;
-    return _theSynchResourceMapIX;
-}
-
 int SynchLockAndWaitIX::waitForSingleObject( IEWaitableBaseIX & synchWait, unsigned int msTimeout /* = NECommon::WAIT_INFINITE */ )
 {
     IEWaitableBaseIX * list[] = { &synchWait };
@@ -56,28 +52,25 @@ int SynchLockAndWaitIX::waitForMultipleObjects( IEWaitableBaseIX ** listWaitable
                                         , waitAll ? NESynchTypesIX::eMatchCondition::MatchConditionExact : NESynchTypesIX::eMatchCondition::MatchConditionAny
                                         , msTimeout);
 
-        if ( (lockAndWait._isEmpty() == false) && lockAndWait._lock( ) )
+        // Wait only if no waitable is fired while the LockAndWait object was initialized.
+        if ( (lockAndWait._isEmpty() == false) && lockAndWait._noEventFired( ) && lockAndWait._lock( ) )
         {
             SynchLockAndWaitIX::MapWaitIDResource & mapReousrces { SynchLockAndWaitIX::_mapWaitResourceIds() };
             mapReousrces.registerResourceObject(reinterpret_cast<id_type>(lockAndWait.mContext), &lockAndWait);
 
             int waitResult = ENOLCK;
-            bool makeLoop = true;
-            while ( makeLoop && lockAndWait._noEventFired( ) )
+            while ( lockAndWait._noEventFired( ) )
             {
+                // the fired entry is modified only when the LockAndWait object is locked.
                 waitResult = lockAndWait._waitCondition( );
-                mapReousrces.lock();
-                if ( (RETURNED_OK  != waitResult) && (lockAndWait.mFiredEntry == NESynchTypesIX::SynchObjectInvalid) )
+                if ( (RETURNED_OK  != waitResult) && lockAndWait._noEventFired( ) )
                 {
                     lockAndWait.mFiredEntry = (waitResult == ETIMEDOUT) || (waitResult == EBUSY) ? NESynchTypesIX::SynchObjectTimeout : NESynchTypesIX::SynchWaitInterrupted;
-                    makeLoop = false;
                 }
-                mapReousrces.unlock();
             }
 
-            mapReousrces.unregisterResourceObject(reinterpret_cast<id_type>(lockAndWait.mContext));
-
             lockAndWait._unlock( );
+            mapReousrces.unregisterResourceObject(reinterpret_cast<id_type>(lockAndWait.mContext));
         }
 
         result = static_cast<int>(lockAndWait.mFiredEntry);
@@ -90,165 +83,114 @@ int SynchLockAndWaitIX::eventSignaled( IEWaitableBaseIX & synchWaitable )
 {
     int result = 0;
 
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr)
+    ObjectLockIX lock( synchWaitable.mWaitersLock );
+    IEWaitableBaseIX::ListLockAndWait & waitList = synchWaitable.mLockAndWaitList;
+    if ( waitList.isEmpty( ) == false )
     {
-        ASSERT( waitList->isEmpty( ) == false );
         OUTPUT_DBG("Waitable [ %s ] ID [ %p ] is signaled, there are [ %d ] locks associated with it."
                     , synchWaitable.getName().getString()
                     , &synchWaitable
-                    , waitList->getSize());
+                    , waitList.getSize());
 
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end; )
+        for ( IEWaitableBaseIX::ListLockAndWait::LISTPOS pos = waitList.firstPosition( ); waitList.isValidPosition(pos); pos = waitList.nextPosition( pos ) )
         {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
+            SynchLockAndWaitIX * lockAndWait = waitList.valueAtPosition(pos);
             ASSERT(lockAndWait != nullptr);
 
             if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
                 break;
 
-            pos = waitList->nextPosition( pos );
-            NESynchTypesIX::eSynchObjectFired fired = lockAndWait->_checkEventFired(synchWaitable);
-            if ( fired >= NESynchTypesIX::SynchObject0 && fired <= NESynchTypesIX::SynchObjectAll )
-            {
-                if (lockAndWait->_requestOwnership(fired))
-                {
-                    OUTPUT_DBG(   "The waitable [ %s ] [ %p ] is fired, unlocking thread [ %p ] with fired event reason [ %d ]"
-                                , synchWaitable.getName().getString()
-                                , &synchWaitable
-                                , lockAndWait->mContext
-                                , static_cast<int>(fired));
-
-                    ++ result;
-                    lockAndWait->mFiredEntry = fired;
-                    lockAndWait->_notifyEvent();
-                }
-#ifdef  DEBUG
-                else
-                {
-                    OUTPUT_WARN("The waitable [ %p ] is marked as signaled, but it rejected lock [ %p ], ignoring notifying", &synchWaitable, lockAndWait);
-                }
-#endif // DEBUG
-            }
-#ifdef DEBUG
-            else if (fired > NESynchTypesIX::SynchObjectAll)
+            if (lockAndWait->_fireEvent(synchWaitable))
             {
-                OUTPUT_ERR("Lock and Wait object detected unexpected fired event [ %d ]", static_cast<int>(fired));
-            }
-#endif // DEBUG
+                OUTPUT_DBG(   "The waitable [ %s ] [ %p ] is fired, unlocking thread [ %p ] with fired event reason [ %d ]"
+                            , synchWaitable.getName().getString()
+                            , &synchWaitable
+                            , lockAndWait->mContext
+                            , static_cast<int>(lockAndWait->mFiredEntry));
 
+                ++ result;
+            }
         }
 
         OUTPUT_DBG("Waitable [ %s ] ID [ %p ] released [ %d ] threads.", synchWaitable.getName().getString(), &synchWaitable, result);
         synchWaitable.notifyReleasedThreads(result);
     }
 
-    mapResource.unlock( );
     return result;
 }
 
 void SynchLockAndWaitIX::eventRemove( IEWaitableBaseIX & synchWaitable )
 {
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr )
+    ObjectLockIX lock( synchWaitable.mWaitersLock );
+    IEWaitableBaseIX::ListLockAndWait & waitList = synchWaitable.mLockAndWaitList;
+    if ( waitList.isEmpty( ) == false )
     {
         OUTPUT_ERR("The event [ %p / %s] is cleaning resource, there is still wait list, going to notify error [ %d ] locked threads and clean resources."
                     , &synchWaitable
                     , NESynchTypesIX::getString(synchWaitable.getSynchType())
-                    , waitList->getSize());
-        ASSERT( waitList->isEmpty( ) == false );
+                    , waitList.getSize());
 
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end ; pos = waitList->nextPosition(pos))
+        for ( IEWaitableBaseIX::ListLockAndWait::LISTPOS pos = waitList.firstPosition( ); waitList.isValidPosition(pos); pos = waitList.nextPosition(pos))
         {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
+            SynchLockAndWaitIX * lockAndWait = waitList.valueAtPosition(pos);
             ASSERT(lockAndWait != nullptr);
-            if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
-                break;
 
             int index = lockAndWait->_getWaitableIndex( synchWaitable );
-            lockAndWait->mFiredEntry = index != NECommon::INVALID_INDEX ? static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error) : NESynchTypesIX::eSynchObjectFired::SynchWaitInterrupted;
-            lockAndWait->_notifyEvent();
+            lockAndWait->_fireEntry(index != NECommon::INVALID_INDEX ? static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error) : NESynchTypesIX::eSynchObjectFired::SynchWaitInterrupted);
         }
 
-        mapResource.unregisterResource(&synchWaitable);
+        // The notified threads remove LockAndWait objects from the list when complete waiting.
+        // Wait until the list is empty, since the waitable object is going to be deleted.
+        while ( waitList.isEmpty( ) == false )
+        {
+            lock.unlock( );
+            Thread::switchThread( );
+            lock.lock( );
+        }
     }
-
-    mapResource.unlock( );
 }
 
 void SynchLockAndWaitIX::eventFailed( IEWaitableBaseIX & synchWaitable )
 {
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr )
+    ObjectLockIX lock( synchWaitable.mWaitersLock );
+    IEWaitableBaseIX::ListLockAndWait & waitList = synchWaitable.mLockAndWaitList;
+    if ( waitList.isEmpty( ) == false )
     {
-        OUTPUT_WARN("The event [ %p ] failed, going to notify error [ %d ] locked threads.", &synchWaitable, waitList->getSize());
-        ASSERT( waitList->isEmpty( ) == false );
+        OUTPUT_WARN("The event [ %p ] failed, going to notify error [ %d ] locked threads.", &synchWaitable, waitList.getSize());
 
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end; pos = waitList->nextPosition(pos))
+        for ( IEWaitableBaseIX::ListLockAndWait::LISTPOS pos = waitList.firstPosition( ); waitList.isValidPosition(pos); pos = waitList.nextPosition(pos))
         {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
+            SynchLockAndWaitIX * lockAndWait = waitList.valueAtPosition(pos);
             ASSERT(lockAndWait != nullptr);
             if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
                 break;
 
             int index = lockAndWait->_getWaitableIndex( synchWaitable );
             ASSERT(index != NECommon::INVALID_INDEX);
-            lockAndWait->mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error);
-            lockAndWait->_notifyEvent();
+            lockAndWait->_fireEntry(static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error));
         }
     }
-
-    mapResource.unlock( );
 }
 
 bool SynchLockAndWaitIX::isWaitableRegistered( IEWaitableBaseIX & synchWaitable )
 {
-    bool result = false;
-
-    SynchResourceMapIX & mapResources { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResources.lock();
-
-    result = mapResources.existResource(&synchWaitable);
-
-    mapResources.unlock();
-
-    return result;
+    ObjectLockIX lock( synchWaitable.mWaitersLock );
+    return (synchWaitable.mLockAndWaitList.isEmpty() == false);
 }
 
 bool SynchLockAndWaitIX::notifyAsynchSignal( id_type threadId )
 {
     bool result = false;
 
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-    do 
+    SynchLockAndWaitIX::MapWaitIDResource & mapReousrces { SynchLockAndWaitIX::_mapWaitResourceIds() };
+    mapReousrces.lock();
+    SynchLockAndWaitIX * lockAndWait = mapReousrces.findResourceObject(threadId);
+    if (lockAndWait != nullptr)
     {
-        SynchLockAndWaitIX::MapWaitIDResource & mapReousrces { SynchLockAndWaitIX::_mapWaitResourceIds() };
-        mapReousrces.lock();
-        SynchLockAndWaitIX * lockAndWait = mapReousrces.findResourceObject(threadId);
-        if (lockAndWait != nullptr)
-        {
-            lockAndWait->mFiredEntry = NESynchTypesIX::SynchAsynchSignal;
-            result = lockAndWait->_notifyEvent();
-        }
-
-        mapReousrces.unlock();
-
-    } while (false);
+        result = lockAndWait->_fireEntry(NESynchTypesIX::SynchAsynchSignal);
+    }
 
-    mapResource.unlock();
+    mapReousrces.unlock();
 
     return result;
 }
@@ -274,96 +216,82 @@ SynchLockAndWaitIX::SynchLockAndWaitIX(   IEWaitableBaseIX ** listWaitables
 {
     ASSERT( listWaitables  != nullptr);
 
-    if ( _initPosixSynchObjects() )
+    count = MACRO_MIN(NECommon::MAXIMUM_WAITING_OBJECTS, count);
+    for ( int i = 0; i < count; ++ i )
     {
-        SynchResourceMapIX & mapResources { SynchLockAndWaitIX::_mapSynchResources() };
-        mapResources.lock();
-        count = MACRO_MIN(NECommon::MAXIMUM_WAITING_OBJECTS, count);
-
-        if ( (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny ) || (mDescribe == SynchLockAndWaitIX::eWaitType::WaitSingleObject) )
+        IEWaitableBaseIX * synchWaitable = listWaitables[i];
+        if ( synchWaitable == nullptr )
         {
-            for ( int i = 0; i < count; ++ i, ++ listWaitables )
-            {
-                IEWaitableBaseIX * synchWaitable = *listWaitables;
-                if (synchWaitable != nullptr)
-                {
-                    ASSERT( (static_cast<unsigned int>(synchWaitable->getSynchType()) & static_cast<unsigned int>(NESynchTypesIX::eSynchObject::SoWaitable)) != 0);
-
-                    mapResources.registerResourceObject(synchWaitable, this);
-                    // OUTPUT_DBG("Waitable [ %p ] is [ %s ]", synchWaitable, synchWaitable->IsSignaled() ? "signaled" : "not signaled");
-
-                    if (synchWaitable->checkSignaled(mContext) && synchWaitable->notifyRequestOwnership(mContext))
-                    {
-                        OUTPUT_DBG("Waitable [ %s ] with ID [ %p ] of type [ %s ] is signaled, going unlock thread [ %p ]"
-                                    , synchWaitable->getName().getString()
-                                    , synchWaitable
-                                    , NESynchTypesIX::getString(synchWaitable->getSynchType())
-                                    , reinterpret_cast<id_type>(mContext));
-
-                        mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i);
-                        synchWaitable->notifyReleasedThreads(1);
-                        mWaitingList.resize(i);
-                        break;
-                    }
-
-                    mWaitingList[i] = synchWaitable;
-                }
-                else
-                {
-                    mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
-                    mWaitingList.resize(i);
-                    break;
-                }
-            }
+            mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
+            count = 0;
+            break;
         }
-        else
-        {
-            bool eventFired = true;
 
-            for ( int i = 0; i < count; ++ i, ++ listWaitables )
-            {
-                IEWaitableBaseIX * synchWaitable = *listWaitables;
-                if ( synchWaitable != nullptr )
-                {
-                    mapResources.registerResourceObject(synchWaitable, this);
-                    if ( (eventFired) && (synchWaitable->checkSignaled(mContext) == false) )
-                    {
-                        eventFired = false;
-                    }
+        ASSERT( (static_cast<unsigned int>(synchWaitable->getSynchType()) & static_cast<unsigned int>(NESynchTypesIX::eSynchObject::SoWaitable)) != 0);
+        mWaitingList[i] = synchWaitable;
+    }
 
-                    mWaitingList[i] = synchWaitable;
-                }
-                else
-                {
-                    mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
-                    mWaitingList.resize(i);
-                    break;
-                }
-            }
+    if ( (count == 0) || (_initPosixSynchObjects() == false) )
+    {
+        mWaitingList.resize(0);
+        _releasePosixSynchObjects();
+        return;
+    }
+
+    mWaitingList.resize(count);
+
+    // Register first, then check the signaled state. If a waitable is signaled
+    // after registration, the LockAndWait object is fired by the waitable.
+    for ( uint32_t i = 0; i < mWaitingList.getSize(); ++ i )
+    {
+        IEWaitableBaseIX * synchWaitable = mWaitingList[i];
+        ObjectLockIX lock( synchWaitable->mWaitersLock );
+        synchWaitable->mLockAndWaitList.pushLast(this);
+    }
 
-            if (eventFired && _requestOwnership(NESynchTypesIX::SynchObjectAll))
+    if ( (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny ) || (mDescribe == SynchLockAndWaitIX::eWaitType::WaitSingleObject) )
+    {
+        for ( uint32_t i = 0; i < mWaitingList.getSize(); ++ i )
+        {
+            IEWaitableBaseIX * synchWaitable = mWaitingList[i];
+            if ( _fireEvent(*synchWaitable) )
             {
-                OUTPUT_DBG("Releasing thread [ %p ], all events are fired.", reinterpret_cast<id_type>(mContext));
+                OUTPUT_DBG("Waitable [ %s ] with ID [ %p ] of type [ %s ] is signaled, going unlock thread [ %p ]"
+                            , synchWaitable->getName().getString()
+                            , synchWaitable
+                            , NESynchTypesIX::getString(synchWaitable->getSynchType())
+                            , reinterpret_cast<id_type>(mContext));
 
-                mFiredEntry = NESynchTypesIX::SynchObjectAll;
-                for (uint32_t i = 0; i < mWaitingList.getSize(); ++ i)
-                {
-                    mWaitingList[i]->notifyReleasedThreads(1);
-                }
+                synchWaitable->notifyReleasedThreads(1);
+                break;
+            }
+            else if ( _noEventFired() == false )
+            {
+                break;  // fired by the signaled waitable.
             }
         }
-
-        mapResources.unlock();
     }
-    else
+    else if ( _fireEvent(*mWaitingList[0]) )
     {
-        _releasePosixSynchObjects();
+        OUTPUT_DBG("Releasing thread [ %p ], all events are fired.", reinterpret_cast<id_type>(mContext));
+
+        for (uint32_t i = 0; i < mWaitingList.getSize(); ++ i)
+        {
+            mWaitingList[i]->notifyReleasedThreads(1);
+        }
     }
 }
 
 SynchLockAndWaitIX::~SynchLockAndWaitIX( void )
 {
-	SynchLockAndWaitIX::_mapSynchResources().removeResourceObject(this, true);
+    for ( uint32_t i = 0; i < mWaitingList.getSize(); ++ i )
+    {
+        IEWaitableBaseIX * synchWaitable = mWaitingList[i];
+        ObjectLockIX lock( synchWaitable->mWaitersLock );
+        synchWaitable->mLockAndWaitList.removeEntry(this);
+    }
+
+    _releasePosixSynchObjects();
 }
 
 inline bool SynchLockAndWaitIX::_noEventFired( void ) const
@@ -376,13 +304,65 @@ inline bool SynchLockAndWaitIX::_isEmpty( void ) const
     return mWaitingList.isEmpty();
 }
 
-inline bool SynchLockAndWaitIX::_notifyEvent( void )
+inline bool SynchLockAndWaitIX::_fireEntry( NESynchTypesIX::eSynchObjectFired firedEntry )
 {
     bool result = false;
 
     if (_isValid() && _lock())
     {
-        result = RETURNED_OK == pthread_cond_signal(&mCondVariable);
+        if (_noEventFired())
+        {
+            mFiredEntry = firedEntry;
+            result = RETURNED_OK == pthread_cond_signal(&mCondVariable);
+        }
+
+        _unlock();
+    }
+
+    return result;
+}
+
+bool SynchLockAndWaitIX::_fireEvent( IEWaitableBaseIX & synchObject )
+{
+    bool result = false;
+
+    if (_isValid() && _lock())
+    {
+        // When waits for all, the check and taking ownership of all waitables should be atomic.
+        const bool waitAll{ _isWaitAll( ) };
+        if ( waitAll )
+        {
+            _lockWaitables( );
+        }
+
+        NESynchTypesIX::eSynchObjectFired fired = _checkEventFired(synchObject);
+        if ( (fired >= NESynchTypesIX::SynchObject0) && (fired <= NESynchTypesIX::SynchObjectAll) )
+        {
+            if (_requestOwnership(fired))
+            {
+                mFiredEntry = fired;
+                pthread_cond_signal(&mCondVariable);
+                result = true;
+            }
+#ifdef  DEBUG
+            else
+            {
+                OUTPUT_WARN("The waitable [ %p ] is marked as signaled, but it rejected lock [ %p ], ignoring notifying", &synchObject, this);
+            }
+#endif // DEBUG
+        }
+#ifdef DEBUG
+        else if (fired > NESynchTypesIX::SynchObjectAll)
+        {
+            OUTPUT_ERR("Lock and Wait object detected unexpected fired event [ %d ]", static_cast<int>(fired));
+        }
+#endif // DEBUG
+
+        if ( waitAll )
+        {
+            _unlockWaitables( );
+        }
+
         _unlock();
     }
 
@@ -473,6 +453,35 @@ inline int SynchLockAndWaitIX::_waitCondition( void )
     }
 }
 
+inline bool SynchLockAndWaitIX::_isWaitAll( void ) const
+{
+    return (mDescribe == SynchLockAndWaitIX::eWaitType::WaitMultipleObjects) && (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionExact);
+}
+
+void SynchLockAndWaitIX::_lockWaitables( void )
+{
+    IEWaitableBaseIX * waitables[ NECommon::MAXIMUM_WAITING_OBJECTS ];
+    const uint32_t count{ mWaitingList.getSize( ) };
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        waitables[ i ] = mWaitingList[ i ];
+    }
+
+    std::sort( waitables, waitables + count, std::less<IEWaitableBaseIX *>( ) );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        waitables[ i ]->lock( NECommon::WAIT_INFINITE );
+    }
+}
+
+void SynchLockAndWaitIX::_unlockWaitables( void )
+{
+    for ( uint32_t i = 0; i < mWaitingList.getSize( ); ++ i )
+    {
+        mWaitingList[ i ]->unlock( );
+    }
+}
+
 inline int SynchLockAndWaitIX::_getWaitableIndex( const IEWaitableBaseIX & synchWaitable ) const
 {
     int result = NECommon::INVALID_INDEX;
@@ -27,10 +27,8 @@
 #include "areg/base/private/posix/NESynchTypesIX.hpp"
 #include "areg/base/IESynchObject.hpp"
 #include "areg/base/TEHashMap.hpp"
-#include "areg/base/TELinkedList.hpp"
 #include "areg/base/TEFixedArray.hpp"
 #include "areg/base/TEResourceMap.hpp"
-#include "areg/base/TEResourceListMap.hpp"
 
 #include <pthread.h>
 
@@ -39,7 +37,6 @@
   ************************************************************************/
 class IEWaitableBaseIX;
 class SynchLockAndWaitIX;
-class SynchLockAndWaitIX;
 
 //////////////////////////////////////////////////////////////////////////
 // SynchLockAndWaitIX class declaration
@@ -50,67 +47,15 @@ class SynchLockAndWaitIX;
  *          There is a limitation of waiting objects at once, and the maximum numbers are
  *          equal to NECommon::MAXIMUM_WAITING_OBJECTS.
  *          Use static methods for waiting functionalities. The internal methods are hidden.
+ *
+ *          Every waitable object keeps the list of LockAndWait objects that wait for it,
+ *          and the list is protected by the lock of the waitable. The LockAndWait object
+ *          is notified under own lock, so that the signaled waitable neither uses global lock,
+ *          nor blocks other waitables. The locks are taken in following order:
+ *          the list lock of waitable, the lock of LockAndWait object, the state lock of waitable.
  **/
 class SynchLockAndWaitIX
 {
-    /**
-     * \brief   The list of LockAndWait objects.
-     **/
-    using ListLockAndWait       = TELinkedList<SynchLockAndWaitIX *>;
-    /**
-     * \brief   The hash map container of waitable object and LockAndWait lists.
-     **/
-    using MapLockAndWait        = TEMap<IEWaitableBaseIX *, ListLockAndWait>;
-
-//////////////////////////////////////////////////////////////////////////
-// ImplResourceListMap class declaration
-//////////////////////////////////////////////////////////////////////////
-    /**
-     * \brief   The helper class of resource list map that contains helper functions implementation.
-     **/
-    class ImplResourceListMap : public TEResourceListMapImpl<IEWaitableBaseIX *, SynchLockAndWaitIX, ListLockAndWait>
-    {
-    public:
-        /**
-         * \brief   Called when all resources are removed.
-         *          This function is called from RemoveAllResources() for every single
-         *          resource being unregistered.
-         * \param   Key     The Key value of resource.
-         * \param   List    The list of resource objects.
-         **/
-        inline void implCleanResourceList( IEWaitableBaseIX * & /* Key */, ListLockAndWait & List )
-        {
-        	List.clear();
-        }
-
-        /**
-         * \brief   Called when need to add resource object to the list.
-         * \param   List        The list of resource objects.
-         * \param   Resource    The resource object to add to the list.
-         **/
-        inline void implAddResource( ListLockAndWait & List, SynchLockAndWaitIX * Resource )
-        {
-        	List.pushLast(Resource);
-        }
-
-        /**
-         * \brief   Called when need to remove resource object from the list.
-         * \param   List        The list of resource objects.
-         * \param   Resource    The resource object to remove from the list.
-         **/
-        inline bool implRemoveResource( ListLockAndWait & List, SynchLockAndWaitIX * Resource )
-        {
-        	return List.removeEntry( Resource );
-        }
-    };
-
-    /**
-     * \brief   The resource list map of waitable object where the keys are waitable objects
-     *          and the resource objects are WaitAndLock objects in the list. The WaitAndLock
-     *          objects in the entire map are not unique, but should be unique in the list.
-     **/
-    using SynchResourceMapIX = TELockResourceListMap<IEWaitableBaseIX *, SynchLockAndWaitIX *, ListLockAndWait, MapLockAndWait, ImplResourceListMap>;
-
 //////////////////////////////////////////////////////////////////////////
 // The resource map for timer.
 //////////////////////////////////////////////////////////////////////////
@@ -279,11 +224,6 @@ private:
      **/
     static SynchLockAndWaitIX::MapWaitIDResource& _mapWaitResourceIds(void);
 
-    /**
-     * \brief   Returns the static instance of synchronization resource map.
-     */
-    static SynchResourceMapIX& _mapSynchResources(void);
-
     /**
      * \brief   Returns true if no event in the list is fired.
      **/
@@ -329,12 +269,6 @@ private:
      **/
     inline int _getWaitableIndex( const IEWaitableBaseIX & synchWaitable ) const;
 
-    /**
-     * \brief   Called to notify the event has been fired.
-     * \return  Returns true if succeeded to notify.
-     **/
-    inline bool _notifyEvent( void );
-
     /**
      * \brief   Checks whether the waiting list is empty.
      **/
@@ -347,6 +281,23 @@ private:
      **/
     NESynchTypesIX::eSynchObjectFired _checkEventFired( IEWaitableBaseIX & synchObject );
 
+    /**
+     * \brief   Checks whether the LockAndWait object is fired by the waitable object.
+     *          If fired, takes ownership of waitables, sets fired entry and notifies
+     *          the waiting thread. The LockAndWait object can be fired only once.
+     * \param   synchObject The waitable object that is signaled.
+     * \return  Returns true if the LockAndWait object is fired by this call.
+     **/
+    bool _fireEvent( IEWaitableBaseIX & synchObject );
+
+    /**
+     * \brief   Sets the fired entry and notifies the waiting thread,
+     *          if the LockAndWait object is not fired yet.
+     * \param   firedEntry  The fired entry to set, normally an error code.
+     * \return  Returns true if the LockAndWait object is fired by this call.
+     **/
+    inline bool _fireEntry( NESynchTypesIX::eSynchObjectFired firedEntry );
+
     /**
      * \brief   Called to notify threads to take fired event ownership.
      * \param   firedEvent  The index of fired event in the list that notifies the threads to take ownership.
@@ -354,6 +305,24 @@ private:
      **/
     bool _requestOwnership( const NESynchTypesIX::eSynchObjectFired firedEvent );
 
+    /**
+     * \brief   Returns true if the thread waits for all waitables in the list.
+     **/
+    inline bool _isWaitAll( void ) const;
+
+    /**
+     * \brief   Locks the state of all waitables in the list, sorted by address.
+     *          Used when wait for all waitables, so that no other thread changes
+     *          the state of waitables between the check and taking the ownership.
+     *          The fixed order of locking avoids deadlock with other waiting threads.
+     **/
+    void _lockWaitables( void );
+
+    /**
+     * \brief   Unlocks the state of all waitables in the list.
+     **/
+    void _unlockWaitables( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden member variables.
 //////////////////////////////////////////////////////////////////////////
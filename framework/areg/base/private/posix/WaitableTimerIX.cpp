@@ -42,7 +42,7 @@ void WaitableTimerIX::_posixTimerRoutine(union sigval si)
 
 
 WaitableTimerIX::WaitableTimerIX(bool isAutoReset /*= false*/, const char * name /*= nullptr*/)
-    : IEWaitableBaseIX  ( NESynchTypesIX::eSynchObject::SoWaitTimer, false, name )
+    : IEWaitableBaseIX  ( NESynchTypesIX::eSynchObject::SoWaitTimer, true, name )
 
     , mResetInfo        ( isAutoReset ? NESynchTypesIX::eEventResetInfo::EventResetAutomatic : NESynchTypesIX::eEventResetInfo::EventResetManual )
     , mTimerId          ( static_cast<timer_t>(0) )
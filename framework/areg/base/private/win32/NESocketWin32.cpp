@@ -160,6 +160,128 @@ namespace NESocket
         return result;
     }
 
+    int _osRecvAvailable(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((dataBuffer != nullptr) && (dataLength > 0));
+
+        int result{ -1 };
+        u_long available{ 0 };
+        if (::ioctlsocket(hSocket, FIONREAD, &available) == 0)
+        {
+            if (available != 0)
+            {
+                int remain = static_cast<int>(available) > dataLength ? dataLength : static_cast<int>(available);
+                int read = recv(hSocket, reinterpret_cast<char*>(dataBuffer), remain, 0);
+                result = read > 0 ? read : -1;
+            }
+            else
+            {
+                // If the socket is readable, but there is no data, the other side disconnected.
+                fd_set readList{ };
+                FD_ZERO(&readList);
+                FD_SET(hSocket, &readList);
+                struct timeval noWait { 0, 0 };
+                result = ::select(0, &readList, nullptr, nullptr, &noWait) == 0 ? 0 : -1;
+            }
+        }
+
+        return result;
+    }
+
+    int _osSendAvailable(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((buffers != nullptr) && (count > 0) && (count <= NESocket::MAXIMUM_SEND_BUFFERS));
+
+        WSABUF vectors[NESocket::MAXIMUM_SEND_BUFFERS];
+        for (int i = 0; i < count; ++ i)
+        {
+            vectors[i].buf = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(buffers[i].sbData));
+            vectors[i].len = static_cast<ULONG>(buffers[i].sbLength);
+        }
+
+        // Temporary switch to non-blocking mode, so that the call sends only what fits the send buffer.
+        int result{ -1 };
+        u_long mode{ 1 };
+        if (::ioctlsocket(hSocket, FIONBIO, &mode) == 0)
+        {
+            DWORD written{ 0 };
+            if (::WSASend(hSocket, vectors, static_cast<DWORD>(count), &written, 0, nullptr, nullptr) == 0)
+            {
+                result = static_cast<int>(written);
+            }
+            else if (::WSAGetLastError() == WSAEWOULDBLOCK)
+            {
+                result = 0;     // the send buffer is full
+            }
+
+            mode = 0;
+            ::ioctlsocket(hSocket, FIONBIO, &mode);
+        }
+
+        return result;
+    }
+
+    int _osSendBuffers(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, int count)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((buffers != nullptr) && (count > 0) && (count <= NESocket::MAXIMUM_SEND_BUFFERS));
+
+        WSABUF vectors[NESocket::MAXIMUM_SEND_BUFFERS];
+        int result{ 0 };
+        for (int i = 0; i < count; ++ i)
+        {
+            vectors[i].buf = reinterpret_cast<CHAR *>(const_cast<unsigned char *>(buffers[i].sbData));
+            vectors[i].len = static_cast<ULONG>(buffers[i].sbLength);
+            result += static_cast<int>(buffers[i].sbLength);
+        }
+
+        WSABUF * next{ vectors };
+        DWORD remain{ static_cast<DWORD>(count) };
+        int left{ result };
+        while (left > 0)
+        {
+            DWORD written{ 0 };
+            if ((::WSASend(hSocket, next, remain, &written, 0, nullptr, nullptr) != 0) || (written == 0))
+            {
+                left   = 0;     // break loop
+                result = -1;    // notify failure
+            }
+            else
+            {
+                left -= static_cast<int>(written);
+                // Skip the sent buffers and move to the position of the partially sent buffer.
+                while ((written != 0) && (written >= next->len))
+                {
+                    written -= next->len;
+                    ++ next;
+                    -- remain;
+                }
+
+                if (written != 0)
+                {
+                    next->buf += written;
+                    next->len -= written;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool _osSetOption(SOCKETHANDLE hSocket, int level, int name, int value)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        return (RETURNED_OK == ::setsockopt(static_cast<SOCKET>(hSocket), level, name, reinterpret_cast<const char *>(&value), sizeof(int)));
+    }
+
+    bool _osSetBusyPoll(SOCKETHANDLE /*hSocket*/, unsigned int /*microseconds*/)
+    {
+        // The busy polling of sockets is not supported in Windows.
+        return false;
+    }
+
     bool _osControl(SOCKETHANDLE hSocket, int cmd, unsigned long& arg)
     {
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
@@ -173,6 +295,21 @@ namespace NESocket
         return (RETURNED_OK == ::getsockopt(static_cast<SOCKET>(hSocket), level, name, reinterpret_cast<char *>(&value), &len));
     }
 
+    bool _osIsLocalSocketSupported(void)
+    {
+        // The local sockets are not used in Windows, the clients connect via TCP/IP.
+        return false;
+    }
+
+    SOCKETHANDLE _osCreateLocalSocket(const char * /*socketPath*/, bool /*isServer*/)
+    {
+        return NESocket::InvalidSocketHandle;
+    }
+
+    void _osDeleteLocalSocket(const char * /*socketPath*/)
+    {
+    }
+
 } // namespace NESocket
 
 #endif  // _WINDOWS
@@ -0,0 +1,58 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/win32/SocketPollerWin32.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the socket poller Windows specific implementation.
+ *              Uses select() fallback.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#ifdef  _WINDOWS
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class, Windows select() implementation
+//////////////////////////////////////////////////////////////////////////
+
+bool SocketPoller::_osCreatePoller( void )
+{
+    mPoller = _createSelectWakeup( ) ? 0 : -1;
+    return (mPoller != -1);
+}
+
+void SocketPoller::_osReleasePoller( void )
+{
+    _releaseSelectWakeup( );
+    mPoller = -1;
+}
+
+bool SocketPoller::_osControlSocket( SOCKETHANDLE /*hSocket*/, uint32_t /*events*/, bool /*edgeTriggered*/, bool /*isNew*/ )
+{
+    // The waiting thread should rebuild the set of sockets.
+    _signalSelectWakeup( );
+    return true;
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE /*hSocket*/ )
+{
+    _signalSelectWakeup( );
+}
+
+int SocketPoller::_osWaitEvents( SocketPoller::sPollEvent * out_events, int maxEvents, unsigned int msTimeout )
+{
+    return _selectEvents( out_events, maxEvents, msTimeout );
+}
+
+void SocketPoller::_osInterrupt( void )
+{
+    _signalSelectWakeup( );
+}
+
+#endif  // _WINDOWS
@@ -105,7 +105,7 @@ public:
      *          registered in resource map or it is not a dispatcher thread,
      *          the NullDispatcher will be returned.
      **/
-    static inline DispatcherThread & getCurrentDispatcherThread( void );
+    static DispatcherThread & getCurrentDispatcherThread( void );
 
     /**
      * \brief   Static method to get reference to the current Event Dispatcher
@@ -299,12 +299,6 @@ inline DispatcherThread & DispatcherThread::getDispatcherThread(const ThreadAddr
     return ( dispThread != nullptr ? *dispThread : DispatcherThread::_getNullDispatherThread() );
 }
 
-inline DispatcherThread & DispatcherThread::getCurrentDispatcherThread( void )
-{
-    DispatcherThread* currThread = RUNTIME_CAST(Thread::getCurrentThread(), DispatcherThread);
-    return ( currThread != nullptr ? *currThread : DispatcherThread::_getNullDispatherThread() );
-}
-
 inline EventDispatcher & DispatcherThread::getCurrentDispatcher( void )
 {
     return getCurrentDispatcherThread().getEventDispatcher();
@@ -299,6 +299,43 @@ public:
      **/
     static bool removeListener(const RuntimeClassID & classId, IEEventConsumer & eventConsumer, DispatcherThread & dispThread);
 
+/************************************************************************
+ * new and delete operators. The event objects are allocated in the memory pool.
+ ************************************************************************/
+    using RuntimeObject::operator new;
+    using RuntimeObject::operator delete;
+
+    /**
+     * \brief   Allocates the event object in the memory pool.
+     * \param   size    The size of the memory block to allocate
+     **/
+    void * operator new( size_t size );
+
+    /**
+     * \brief   Allocates the event object in the memory pool. The debugging information is ignored.
+     * \param   size    The size of the memory block to allocate
+     **/
+    void * operator new( size_t size, int /*block*/, const char * /*file*/, int /*line*/ );
+
+    /**
+     * \brief   Releases the event object in the memory pool.
+     * \param   ptr     Pointer to the memory block to delete
+     **/
+    void operator delete( void * ptr );
+
+    /**
+     * \brief   Releases the event object in the memory pool.
+     * \param   ptr     Pointer to the memory block to delete
+     * \param   size    Not used.
+     **/
+    void operator delete( void * ptr, size_t /*size*/ );
+
+    /**
+     * \brief   Releases the event object in the memory pool.
+     * \param   ptr     Pointer to the memory block to delete
+     **/
+    void operator delete( void * ptr, int, const char *, int );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Protected
 //////////////////////////////////////////////////////////////////////////
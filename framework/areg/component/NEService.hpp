@@ -518,6 +518,10 @@ namespace NEService
         , ServiceLogConfigurationSaved
         //!< Sent by logger service or client applications to log the messages.
         , ServiceLogMessage
+        //!< Sent by log observer to set the filter of log messages to receive.
+        , ServiceLogFilter
+        //!< Sent by service provider to announce the endpoint of direct connection, forwarded by Routing Service to service consumers.
+        , SystemServiceDirectEndpoint
         //!< The last ID of service calls.
         , ServiceLastId         = SERVICE_ID_LAST  //!< Servicing call last ID
 
@@ -1647,6 +1651,10 @@ inline const char * NEService::getString( NEService::eFuncIdRange funcId )
         return "NEService::eFuncIdRange::ServiceLogConfigurationSaved";
     case NEService::eFuncIdRange::ServiceLogMessage:
         return "NEService::eFuncIdRange::ServiceLogMessage";
+    case NEService::eFuncIdRange::ServiceLogFilter:
+        return "NEService::eFuncIdRange::ServiceLogFilter";
+    case NEService::eFuncIdRange::SystemServiceDirectEndpoint:
+        return "NEService::eFuncIdRange::SystemServiceDirectEndpoint";
     case NEService::eFuncIdRange::RequestFirstId:
         return "NEService::eFuncIdRange::RequestFirstId";
     case NEService::eFuncIdRange::ResponseFirstId:
@@ -18,6 +18,7 @@
 #include "areg/component/ComponentThread.hpp"
 #include "areg/component/Event.hpp"
 #include "areg/component/private/ExitEvent.hpp"
+#include "areg/base/ThreadLocalStorage.hpp"
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE( areg_component_private_DispatcherThread_destroyThread);
@@ -38,6 +39,11 @@ namespace
      * \brief   Predefined fixed name of invalid Null Dispatcher Thread.
      **/
     static constexpr std::string_view   NullDispatcherName{ "_NullDispatcherThread_" };
+
+    /**
+     * \brief   The name of the storage slot to save pointer of current Dispatcher Thread.
+     **/
+    static constexpr std::string_view   STORAGE_DISPATCHER_THREAD{ "DispatcherThread" };
 }
 
 class AREG_API NullDispatcherThread    : public ComponentThread
@@ -201,6 +207,33 @@ DispatcherThread & DispatcherThread::_getNullDispatherThread( void )
     return static_cast<DispatcherThread &>(NullDispatcherThread::sSelfNullDispatcher);
 }
 
+DispatcherThread & DispatcherThread::getCurrentDispatcherThread( void )
+{
+    static const int _slot{ ThreadLocalStorage::registerStorageSlot( STORAGE_DISPATCHER_THREAD.data( ) ) };
+
+    // the slot is reset when the thread completes the job.
+    DispatcherThread * currThread = reinterpret_cast<DispatcherThread *>(ThreadLocalStorage::getSlotItem( _slot ).alignPtr.mElement);
+    if ( currThread == nullptr )
+    {
+        Thread * running = Thread::getCurrentRunningThread( );
+        if ( running != nullptr )
+        {
+            currThread = RUNTIME_CAST( running, DispatcherThread );
+            if ( currThread != nullptr )
+            {
+                ThreadLocalStorage::setSlotItem( _slot, currThread );
+            }
+        }
+        else
+        {
+            // the slots of foreign threads are never reset, do not cache the dispatcher.
+            currThread = RUNTIME_CAST( Thread::getCurrentThread( ), DispatcherThread );
+        }
+    }
+
+    return ( currThread != nullptr ? *currThread : DispatcherThread::_getNullDispatherThread() );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // DispatcherThread class Constructor / Destructor.
 //////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 
 #include "areg/component/DispatcherThread.hpp"
 #include "areg/component/IEEventConsumer.hpp"
+#include "areg/base/MemoryPool.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // Event class declaration
@@ -36,6 +37,31 @@ IMPLEMENT_RUNTIME_EVENT(Event, RuntimeObject)
  **/
 const Event Event::BAD_EVENT(Event::eEventType::EventUnknown);
 
+void * Event::operator new( size_t size )
+{
+    return MemoryPool::allocate( size );
+}
+
+void * Event::operator new( size_t size, int /*block*/, const char * /*file*/, int /*line*/ )
+{
+    return MemoryPool::allocate( size );
+}
+
+void Event::operator delete( void * ptr )
+{
+    MemoryPool::release( ptr );
+}
+
+void Event::operator delete( void * ptr, size_t /*size*/ )
+{
+    MemoryPool::release( ptr );
+}
+
+void Event::operator delete( void * ptr, int, const char *, int )
+{
+    MemoryPool::release( ptr );
+}
+
 bool Event::addListener( const RuntimeClassID & classId, IEEventConsumer & eventConsumer, const String & whichThread )
 {
     return Event::addListener(classId, eventConsumer, DispatcherThread::getDispatcherThread(whichThread));
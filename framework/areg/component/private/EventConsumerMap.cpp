@@ -39,6 +39,7 @@ bool EventConsumerList::addConsumer( IEEventConsumer& whichConsumer )
     if (EventConsumerListBase::pushLastIfUnique(&whichConsumer))
     {
         result = true;
+        _updateSnapshot();
         whichConsumer.consumerRegistered(true);
     }
     
@@ -51,6 +52,7 @@ bool EventConsumerList::removeConsumer( IEEventConsumer& whichConsumer )
     if ( EventConsumerListBase::removeEntry(&whichConsumer) )
     {
         result = true;
+        _updateSnapshot();
         whichConsumer.consumerRegistered(false);
     }
 
@@ -68,6 +70,26 @@ void EventConsumerList::removeAllConsumers( void )
     }
 
     EventConsumerListBase::clear();
+    mSnapshot.reset();
+}
+
+void EventConsumerList::_updateSnapshot( void )
+{
+    if ( EventConsumerListBase::isEmpty() )
+    {
+        mSnapshot.reset();
+    }
+    else
+    {
+        std::shared_ptr<ConsumerSnapshot> snapshot = std::make_shared<ConsumerSnapshot>( EventConsumerListBase::getSize() );
+        EventConsumerListBase::LISTPOS pos = EventConsumerListBase::firstPosition();
+        for ( ; isValidPosition(pos); pos = nextPosition(pos) )
+        {
+            snapshot->add( valueAtPosition(pos) );
+        }
+
+        mSnapshot = snapshot;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -22,8 +22,11 @@
  ************************************************************************/
 #include "areg/base/TERuntimeResourceMap.hpp"
 #include "areg/base/Containers.hpp"
+#include "areg/base/TEArrayList.hpp"
 #include "areg/base/TEResourceMap.hpp"
 
+#include <memory>
+
 /************************************************************************
  * Declared classes
  ************************************************************************/
@@ -52,10 +55,23 @@ using EventConsumerListBase	= TELinkedList<IEEventConsumer *>;
  *          Event Consumer objects. It is used in Dispatcher, when 
  *          collecting list of Consumers, which are registered 
  *          to dispatch certain Event Object.
+ *          Every change of the list creates new immutable snapshot of
+ *          consumers. The dispatcher shares the snapshot when dispatches event
+ *          and does not copy the list. The shared snapshot remains valid even
+ *          if the list is modified or deleted while the event is dispatched.
  *          For use, see implementation of EventDispatcherBase class
  **/
 class EventConsumerList   : public EventConsumerListBase
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The immutable snapshot of the list of Event Consumers.
+     **/
+    using ConsumerSnapshot  = TEArrayList<IEEventConsumer *>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -130,6 +146,30 @@ public:
      * \return  Returns true, if the specified Event Consumer already exists in the list.
      **/
     inline bool existConsumer( IEEventConsumer & whichConsumer ) const;
+
+    /**
+     * \brief   Returns the shared immutable snapshot of Event Consumers in the list.
+     *          Returns empty pointer if the list is empty.
+     **/
+    inline std::shared_ptr<const ConsumerSnapshot> getSnapshot( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Creates new snapshot of Event Consumers. Called each time when list is modified.
+     **/
+    void _updateSnapshot( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The current snapshot of Event Consumers.
+     **/
+    std::shared_ptr<const ConsumerSnapshot> mSnapshot;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -168,4 +208,9 @@ inline bool EventConsumerList::existConsumer( IEEventConsumer & whichConsumer )
     return EventConsumerListBase::contains( &whichConsumer);
 }
 
+inline std::shared_ptr<const EventConsumerList::ConsumerSnapshot> EventConsumerList::getSnapshot( void ) const
+{
+    return mSnapshot;
+}
+
 #endif  // AREG_COMPONENT_PRIVATE_EVENTCONSUMERMAP_HPP
@@ -353,35 +353,39 @@ void EventDispatcherBase::postDispatchEvent( Event* eventElem )
 
 bool EventDispatcherBase::dispatchEvent( Event& eventElem )
 {
-    EventConsumerList processingList;
+    bool result = false;
     IEEventConsumer* consumer = eventElem.getEventConsumer();
     if ( consumer != nullptr)
     {
-        processingList.pushFirst(consumer);
+        eventElem.dispatchSelf(consumer);
+        result = true;
     }
     else
     {
-        // Lock resource, before get any information
-        mConsumerMap.lock();
+        // Lock resource only to share the snapshot of consumers. The snapshot is immutable
+        // and remains valid if consumers are registered or unregistered while dispatching.
+        std::shared_ptr<const EventConsumerList::ConsumerSnapshot> snapshot;
 
+        mConsumerMap.lock();
         EventConsumerList* listConsumers = mConsumerMap.findResourceObject(eventElem.getRuntimeClassId());
         if (listConsumers != nullptr)
-            processingList = *listConsumers;
+            snapshot = listConsumers->getSnapshot();
 
-        // Unlock resource as soon as possible. Otherwise we may block other threads
-        // on registering / unregistering consumer.
         mConsumerMap.unlock();
-    }
 
-    EventConsumerList::LISTPOS pos = processingList.firstPosition();
-    while (processingList.isValidPosition(pos))
-    {
-        consumer = processingList.getNext(pos);
-        eventElem.dispatchSelf(consumer);
-        consumer = nullptr;
+        if (snapshot != nullptr)
+        {
+            const uint32_t count = snapshot->getSize();
+            for (uint32_t i = 0; i < count; ++ i)
+            {
+                eventElem.dispatchSelf(snapshot->getAt(i));
+            }
+
+            result = count != 0;
+        }
     }
 
-    return (processingList.isEmpty() == false);
+    return result;
 }
 
 bool EventDispatcherBase::hasRegisteredConsumer( const RuntimeClassID& whichClass ) const
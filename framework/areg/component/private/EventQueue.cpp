@@ -40,7 +40,11 @@ EventQueue::EventQueue( IEQueueListener & eventListener, SortedEventStack & even
 //////////////////////////////////////////////////////////////////////////
 void EventQueue::pushEvent( Event& evendElem )
 {
-    mEventListener.signalEvent( mEventQueue.pushEvent(&evendElem) );
+    // signal only if the queue was empty, the listener is already signaled otherwise.
+    if ( mEventQueue.pushEvent(&evendElem) )
+    {
+        mEventListener.signalEvent( 1 );
+    }
 }
 
 Event* EventQueue::popEvent( void )
@@ -49,7 +53,7 @@ Event* EventQueue::popEvent( void )
     uint32_t size = mEventQueue.popEvent(&result);
     if (size == 0)
     {
-        mEventListener.signalEvent(0);
+        _signalCount(0);
     }
 
     return result;
@@ -58,19 +62,29 @@ Event* EventQueue::popEvent( void )
 void EventQueue::removeAllEvents(void)
 {
     mEventQueue.deleteAllEvents();
-    mEventListener.signalEvent(0);
+    _signalCount(0);
 }
 
 void EventQueue::removeEvents( bool keepSpecials /*= false*/ )
 {
     uint32_t remain = mEventQueue.deleteAllLowerPriority(keepSpecials ? Event::eEventPriority::EventPriorityHigh : Event::eEventPriority::EventPriorityCritical);
-    mEventListener.signalEvent(remain);
+    _signalCount(remain);
 }
 
 void EventQueue::removeEvents( const RuntimeClassID & eventClassId )
 {
     uint32_t remain = mEventQueue.deleteAllMatchClass(eventClassId);
-    mEventListener.signalEvent(remain);
+    _signalCount(remain);
+}
+
+inline void EventQueue::_signalCount( uint32_t eventCount )
+{
+    mEventListener.signalEvent(eventCount);
+    if ( (eventCount == 0) && (mEventQueue.isEmpty() == false) )
+    {
+        // the event was pushed while the listener was reset, signal again.
+        mEventListener.signalEvent( mEventQueue.getCount() );
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
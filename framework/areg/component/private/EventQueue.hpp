@@ -87,7 +87,8 @@ public:
 
     /**
      * \brief   Pushes new Event in the Queue and notifies Event Listener
-     *          about new Event element availability.
+     *          about new Event element availability. The Event Listener
+     *          is notified only if the Queue was empty.
      **/
     void pushEvent( Event & evendElem );
 
@@ -129,6 +130,18 @@ public:
      **/
     void removeAllEvents( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Signals the Event Listener about the number of events in the queue.
+     *          Since the events are pushed without locking, if the queue is empty,
+     *          checks again after signaling, whether any event was pushed meanwhile.
+     * \param   eventCount  The number of remaining events in the queue.
+     **/
+    inline void _signalCount( uint32_t eventCount );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -19,223 +19,280 @@
   ************************************************************************/
 #include "areg/component/private/SortedEventStack.hpp"
 
+#include "areg/base/Thread.hpp"
 #include "areg/component/Event.hpp"
 
-SortedEventStack::~SortedEventStack(void)
-{
-    for (auto evt : mValueList)
-    {
-        evt->destroy();
-    }
+//////////////////////////////////////////////////////////////////////////
+// SortedEventStack::EventLane class implementation
+//////////////////////////////////////////////////////////////////////////
 
-    mValueList.clear();
+SortedEventStack::EventLane::EventLane( void )
+    : mEvents   ( )
+    , mHead     ( nullptr )
+    , mTail     ( DEBUG_NEW sEventNode )
+{
+    mTail->enNext.store( nullptr, std::memory_order_relaxed );
+    mTail->enEvent = nullptr;
+    mHead.store( mTail, std::memory_order_release );
 }
 
-void SortedEventStack::deleteAllEvents(void)
+SortedEventStack::EventLane::~EventLane( void )
 {
-    Lock lock( mSynchObject );
-
-    while ( mValueList.empty( ) == false )
+    ASSERT( mEvents.empty( ) );
+    while ( mTail != nullptr )
     {
-        Event * evt = mValueList.back( );
-        ASSERT( evt != nullptr );
-        evt->destroy( );
-        mValueList.pop_back( );
+        sEventNode * next = mTail->enNext.load( std::memory_order_acquire );
+        delete mTail;
+        mTail = next;
     }
 }
 
-uint32_t SortedEventStack::deleteAllLowerPriority(Event::eEventPriority eventPrio)
+void SortedEventStack::EventLane::pushEvent( Event * newEvent )
 {
-    Lock lock(mSynchObject);
+    sEventNode * node = DEBUG_NEW sEventNode;
+    node->enNext.store( nullptr, std::memory_order_relaxed );
+    node->enEvent = newEvent;
 
-    while (mValueList.empty() == false)
+    // Take the place of the last node, then link the previous node to the new one.
+    sEventNode * prev = mHead.exchange( node, std::memory_order_acq_rel );
+    prev->enNext.store( node, std::memory_order_release );
+}
+
+void SortedEventStack::EventLane::receiveEvents( void )
+{
+    sEventNode * next = mTail->enNext.load( std::memory_order_acquire );
+    while ( true )
     {
-        Event* evt = mValueList.back();
-        ASSERT(evt != nullptr);
-        if (evt->getEventPriority() < eventPrio)
+        if ( next != nullptr )
         {
-            evt->destroy();
-            mValueList.pop_back();
+            // The next node becomes the dummy node.
+            mEvents.push_back( next->enEvent );
+            next->enEvent = nullptr;
+            delete mTail;
+            mTail = next;
+            next = mTail->enNext.load( std::memory_order_acquire );
+        }
+        else if ( mHead.load( std::memory_order_acquire ) != mTail )
+        {
+            // A producer has taken the place of the last node, but not linked it yet.
+            Thread::switchThread( );
+            next = mTail->enNext.load( std::memory_order_acquire );
         }
         else
         {
-            // Since the queue is sorted, ignore the rest
             break;
         }
     }
+}
 
-    return static_cast<uint32_t>(mValueList.size());
+inline bool SortedEventStack::EventLane::isEmpty( void )
+{
+    if ( mEvents.empty( ) )
+    {
+        receiveEvents( );
+    }
+
+    return mEvents.empty( );
 }
 
-uint32_t SortedEventStack::deleteAllExceptClass(const RuntimeClassID& eventClassId)
+//////////////////////////////////////////////////////////////////////////
+// SortedEventStack class implementation
+//////////////////////////////////////////////////////////////////////////
+
+SortedEventStack::SortedEventStack( void )
+    : mLanes    ( )
+    , mCount    ( 0 )
+    , mLock     ( )
 {
-    Lock lock(mSynchObject);
+}
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+SortedEventStack::~SortedEventStack(void)
+{
+    for ( EventLane & lane : mLanes )
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId != (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        SortedEventStack::_deleteEvents( lane );
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    mCount.store( 0 );
 }
 
-uint32_t SortedEventStack::deleteAllMatchPriority(Event::eEventPriority eventPrio)
+void SortedEventStack::deleteAllEvents(void)
 {
-    Lock lock(mSynchObject);
+    Lock lock( mLock );
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    int32_t deleted{ 0 };
+    for ( EventLane & lane : mLanes )
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventPrio == (*it)->getEventPriority())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        deleted += SortedEventStack::_deleteEvents( lane );
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    _eventsDeleted( deleted );
 }
 
-uint32_t SortedEventStack::deleteAllMatchClass(const RuntimeClassID& eventClassId)
+uint32_t SortedEventStack::deleteAllLowerPriority(Event::eEventPriority eventPrio)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    int32_t deleted{ 0 };
+    if (Event::eEventPriority::EventPriorityLow < eventPrio)
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId == (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        deleted += SortedEventStack::_deleteEvents(mLanes[static_cast<unsigned int>(ePriorityLane::LaneLow)]);
+    }
+
+    if (Event::eEventPriority::EventPriorityNormal < eventPrio)
+    {
+        deleted += SortedEventStack::_deleteEvents(mLanes[static_cast<unsigned int>(ePriorityLane::LaneNormal)]);
+    }
+
+    if (Event::eEventPriority::EventPriorityHigh < eventPrio)
+    {
+        deleted += SortedEventStack::_deleteEvents(mLanes[static_cast<unsigned int>(ePriorityLane::LaneHigh)]);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    if (Event::eEventPriority::EventPriorityCritical < eventPrio)
+    {
+        deleted += SortedEventStack::_deleteEvents(mLanes[static_cast<unsigned int>(ePriorityLane::LaneCritical)]);
+    }
+
+    return _eventsDeleted(deleted);
 }
 
-uint32_t SortedEventStack::pushEvent(Event * newEvent)
+uint32_t SortedEventStack::deleteAllExceptClass(const RuntimeClassID& eventClassId)
 {
-    ASSERT(newEvent != nullptr);
-    Lock lock(mSynchObject);
-    switch (newEvent->getEventPriority())
+    Lock lock(mLock);
+
+    int32_t deleted{ 0 };
+    for (unsigned int i = static_cast<unsigned int>(ePriorityLane::LaneCritical); i < static_cast<unsigned int>(ePriorityLane::LaneCount); ++ i)
     {
-    case Event::eEventPriority::EventPriorityLow:
-        _insertAtEnd(newEvent);
-        break;
+        deleted += SortedEventStack::_deleteEvents(mLanes[i], eventClassId, false);
+    }
 
-    case Event::eEventPriority::EventPriorityNormal:
-        _insertAfterPrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
+    return _eventsDeleted(deleted);
+}
 
-    case Event::eEventPriority::EventPriorityHigh:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
+uint32_t SortedEventStack::deleteAllMatchPriority(Event::eEventPriority eventPrio)
+{
+    Lock lock(mLock);
 
+    int32_t deleted{ 0 };
+    switch (eventPrio)
+    {
+    case Event::eEventPriority::EventPriorityLow:
+    case Event::eEventPriority::EventPriorityNormal:
+    case Event::eEventPriority::EventPriorityHigh:
     case Event::eEventPriority::EventPriorityCritical:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityHigh);
-        break;
-
-    case Event::eEventPriority::EventPriorityExit:
-        _insertAtBegin(newEvent);
+        deleted = SortedEventStack::_deleteEvents(_getLane(eventPrio));
         break;
 
     default:
-        ASSERT(false);
-        break;
+        break;  // the "Exit" events should be processed.
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return _eventsDeleted(deleted);
 }
 
-uint32_t  SortedEventStack::popEvent(Event** stackEvent)
+uint32_t SortedEventStack::deleteAllMatchClass(const RuntimeClassID& eventClassId)
 {
-    ASSERT(stackEvent != nullptr);
+    Lock lock(mLock);
 
-    Lock lock(mSynchObject);
-    if (mValueList.empty() == false)
+    int32_t deleted{ 0 };
+    for (unsigned int i = static_cast<unsigned int>(ePriorityLane::LaneCritical); i < static_cast<unsigned int>(ePriorityLane::LaneCount); ++ i)
     {
-        *stackEvent = mValueList.front();
-        mValueList.pop_front();
+        deleted += SortedEventStack::_deleteEvents(mLanes[i], eventClassId, true);
     }
-    else
+
+    return _eventsDeleted(deleted);
+}
+
+bool SortedEventStack::pushEvent(Event * newEvent)
+{
+    ASSERT(newEvent != nullptr);
+    _getLane(newEvent->getEventPriority()).pushEvent(newEvent);
+    return (mCount.fetch_add(1) == 0);
+}
+
+uint32_t  SortedEventStack::popEvent(Event** stackEvent)
+{
+    ASSERT(stackEvent != nullptr);
+
+    Lock lock(mLock);
+    *stackEvent = nullptr;
+    for (EventLane & lane : mLanes)
     {
-        *stackEvent = nullptr;
+        if (lane.isEmpty() == false)
+        {
+            *stackEvent = lane.mEvents.front();
+            lane.mEvents.pop_front();
+            break;
+        }
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    int32_t count = (*stackEvent != nullptr) ? mCount.fetch_sub(1) - 1 : mCount.load();
+    return (count > 0 ? static_cast<uint32_t>(count) : 0u);
 }
 
-inline void SortedEventStack::_insertAtEnd(Event* newEvent)
+inline SortedEventStack::EventLane & SortedEventStack::_getLane(Event::eEventPriority eventPrio)
 {
-    mValueList.push_back(newEvent);
+    switch (eventPrio)
+    {
+    case Event::eEventPriority::EventPriorityLow:
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneLow)];
+
+    case Event::eEventPriority::EventPriorityHigh:
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneHigh)];
+
+    case Event::eEventPriority::EventPriorityCritical:
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneCritical)];
+
+    case Event::eEventPriority::EventPriorityExit:
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneExit)];
+
+    case Event::eEventPriority::EventPriorityNormal:
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneNormal)];
+
+    default:
+        ASSERT(false);
+        return mLanes[static_cast<unsigned int>(ePriorityLane::LaneNormal)];
+    }
 }
 
-inline void SortedEventStack::_insertAfterPrio(Event* newEvent, Event::eEventPriority eventPrio)
+int32_t SortedEventStack::_deleteEvents(EventLane & lane, const RuntimeClassID & eventClassId, bool matchClass)
 {
-    auto it = mValueList.end();
-    if (mValueList.empty() == false)
+    int32_t result{ 0 };
+    lane.receiveEvents();
+    for (auto it = lane.mEvents.begin(); it != lane.mEvents.end(); )
     {
-        const auto begin = mValueList.begin();
-        it = std::prev(it);
-        while ( (it != begin) && ((*it)->getEventPriority() < eventPrio) )
+        if ((eventClassId == (*it)->getRuntimeClassId()) == matchClass)
         {
-            it = std::prev(it);
+            (*it)->destroy();
+            it = lane.mEvents.erase(it);
+            ++ result;
         }
-
-        if ((*it)->getEventPriority() >= eventPrio)
+        else
         {
             it = std::next(it);
         }
     }
 
-    mValueList.insert(it, newEvent);
+    return result;
 }
 
-inline void SortedEventStack::_insertBeforePrio(Event* newEvent, Event::eEventPriority eventPrio)
+int32_t SortedEventStack::_deleteEvents(EventLane & lane)
 {
-    auto it = mValueList.begin();
-    if (mValueList.empty() == false)
+    lane.receiveEvents();
+    int32_t result = static_cast<int32_t>(lane.mEvents.size());
+    for (Event * evt : lane.mEvents)
     {
-        const auto end = mValueList.end();
-        while ((it != end) && ((*it)->getEventPriority() > eventPrio))
-        {
-            it = std::next(it);
-        }
+        ASSERT(evt != nullptr);
+        evt->destroy();
     }
 
-    mValueList.insert(it, newEvent);
+    lane.mEvents.clear();
+    return result;
 }
 
-inline void SortedEventStack::_insertAtBegin(Event* newEvent)
+inline uint32_t SortedEventStack::_eventsDeleted(int32_t deleted)
 {
-    mValueList.push_front(newEvent);
+    int32_t count = mCount.fetch_sub(deleted) - deleted;
+    return (count > 0 ? static_cast<uint32_t>(count) : 0u);
 }
@@ -20,9 +20,12 @@
   * Includes
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
-#include "areg/base/TEStack.hpp"
+#include "areg/base/SynchObjects.hpp"
 #include "areg/component/Event.hpp"
 
+#include <atomic>
+#include <deque>
+
 class RuntimeClassID;
 
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
@@ -31,11 +34,10 @@ class RuntimeClassID;
 
 /**
  * \brief   Sorted stack to store events by priority.
- *          Each time when event is pushed, it checks the priority
- *          of the event then inserts in stack, so that the events
- *          are sorted by the priority.
- *          In the stack the priorities are sorted in the following way:
- *          | Critical | High | Normal | Low |
+ *          Each priority has own lane, the events are pushed in the lane
+ *          of the event priority and popped by the priority of lanes, so that
+ *          the events are processed in the following order:
+ *          | Exit | Critical | High | Normal | Low |
  * 
  *              -   The "Critical" priority events are placed at the begin to be processed as soon as possible.
  *                  This priority is reserved for developers.
@@ -47,14 +49,93 @@ class RuntimeClassID;
  *          The "Exit" events have reserved "Exit" priority. This priority is only for internal use and should not be used
  *          by other developers. The "Exit" events should be immediately processed and they are not removed from the 
  *          stack until they are not processed by thread dispatcher.
+ *
+ *          The events are pushed without locking. Every lane has a lock-free multiple producer
+ *          and single consumer inbox, from where the consumer moves the events into the list of lane.
+ *          The events of the same priority are popped in FIFO order. The pop and delete operations
+ *          are synchronized by the lock of the stack.
  **/
-class SortedEventStack  : protected TELockStack<Event *>
+class SortedEventStack
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The indexes of the priority lanes. The lanes with lower index are popped first.
+     **/
+    typedef enum class E_PriorityLane : unsigned int
+    {
+          LaneExit      = 0 //!< The lane of exit events.
+        , LaneCritical      //!< The lane of critical priority events.
+        , LaneHigh          //!< The lane of high priority events.
+        , LaneNormal        //!< The lane of normal priority events.
+        , LaneLow           //!< The lane of low priority events.
+        , LaneCount         //!< The number of lanes.
+    } ePriorityLane;
+
+    /**
+     * \brief   The node of the lock-free inbox.
+     **/
+    typedef struct S_EventNode
+    {
+        std::atomic<struct S_EventNode *>   enNext;     //!< The next node in the inbox.
+        Event *                             enEvent;    //!< The queued event.
+    } sEventNode;
+
+    /**
+     * \brief   The lane of events of the same priority. The events are pushed in the inbox
+     *          by any thread without locking. The consumer moves the events from the inbox
+     *          to the list, where the events can be popped or removed.
+     **/
+    class EventLane
+    {
+    public:
+        EventLane( void );
+        ~EventLane( void );
+
+        /**
+         * \brief   Pushes the event in the inbox. Can be called by any thread.
+         **/
+        void pushEvent( Event * newEvent );
+
+        /**
+         * \brief   Moves all events of the inbox into the list of lane.
+         *          Should be called by the consumer only.
+         **/
+        void receiveEvents( void );
+
+        /**
+         * \brief   Receives events and returns true if the list of lane is empty.
+         *          Should be called by the consumer only.
+         **/
+        inline bool isEmpty( void );
+
+        /**
+         * \brief   The list of received events, which are accessed only by the consumer.
+         **/
+        std::deque<Event *>         mEvents;
+
+    private:
+        /**
+         * \brief   The last pushed node of the inbox. Modified by producers.
+         **/
+        std::atomic<sEventNode *>   mHead;
+        /**
+         * \brief   The dummy node, which next node is the first event in the inbox.
+         *          Modified by the consumer.
+         **/
+        sEventNode *                mTail;
+
+    private:
+        DECLARE_NOCOPY_NOMOVE( EventLane );
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
 public:
-    SortedEventStack( void ) = default;
+    SortedEventStack( void );
 
     ~SortedEventStack(void);
 
@@ -97,15 +178,16 @@ public:
     uint32_t deleteAllMatchClass(const RuntimeClassID& eventClassId);
 
     /**
-     * \brief   Pushes the event in the stack considering the priority, so that the events
-     *          with the higher priority can be processed earlier.
+     * \brief   Pushes the event in the lane of the event priority, so that the events
+     *          with the higher priority can be processed earlier. The method does not lock the stack.
      * \param   newEvent    The pointer to the event with the priority.
-     * \return  Returns the number of elements in the stack.
+     * \return  Returns true if the stack was empty before the event is pushed,
+     *          i.e. the consumer of the stack should be signaled.
      **/
-    uint32_t pushEvent(Event * newEvent);
+    bool pushEvent(Event * newEvent);
 
     /**
-     * \brief   Pops the event from the FIFO stack.
+     * \brief   Pops the event with highest priority from the stack.
      * \param   newEvent    The pointer to the previously allocated event object.
      * \return  Returns the number of elements in the stack.
      **/
@@ -122,7 +204,7 @@ public:
     inline uint32_t getCount(void) const;
 
     /**
-     * \brief   Locks the stack, so that the all other threads cannot access.
+     * \brief   Locks the stack, so that the all other threads cannot pop or delete events.
      * \return  Returns true, if succeeded to lock the stack.
      **/
     inline bool lockStack(void);
@@ -137,36 +219,49 @@ public:
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Inserts the event at the end of the stack. No priority is considered.
-     *          For example, the events with low priority are inserted at the end of the stack.
+     * \brief   Returns the lane of the specified priority.
+     **/
+    inline EventLane & _getLane(Event::eEventPriority eventPrio);
+
+    /**
+     * \brief   Deletes the events in the lane, which match the specified class ID.
+     * \param   lane            The lane to delete events.
+     * \param   eventClassId    The class ID of the events to check.
+     * \param   matchClass      If true, deletes the events of the specified class ID.
+     *                          Otherwise, deletes the events of other class IDs.
+     * \return  Returns the number of deleted events.
      **/
-    inline void _insertAtEnd(Event * newEvent);
+    static int32_t _deleteEvents(EventLane & lane, const RuntimeClassID & eventClassId, bool matchClass);
 
     /**
-     * \brief   Inserts the event object at the end of the event elements list of specified priority.
-     *          The function compares the priority of the events and inserts the element
-     *          at the end of the list with events of the specified priority.
-     *          The search is started at the end.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Deletes all events in the lane.
+     * \return  Returns the number of deleted events.
      **/
-    inline void _insertAfterPrio(Event * newEvent, Event::eEventPriority eventPrio);
+    static int32_t _deleteEvents(EventLane & lane);
 
     /**
-     * \brief   Inserts the event object before the elements of specified are queued.
-     *          The function compares the priority of the events and inserts the element
-     *          at the position before the events of specified priority start.
-     *          The search is started at the begin.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Updates the number of events after deleting events and returns
+     *          the number of elements in the stack.
      **/
-    inline void _insertBeforePrio(Event * newEvent, Event::eEventPriority eventPrio);
+    inline uint32_t _eventsDeleted(int32_t deleted);
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The lanes of events sorted by priority.
+     **/
+    EventLane               mLanes[static_cast<unsigned int>(ePriorityLane::LaneCount)];
+    /**
+     * \brief   The number of events in the stack. The value is increased after the event is
+     *          pushed and can be temporary negative if the event is popped before.
+     **/
+    std::atomic<int32_t>    mCount;
     /**
-     * \brief   Inserts the event element at the very begin of the stack, so that it is
-     *          processed as soon as possible.
+     * \brief   The lock to synchronize pop and delete operations.
      **/
-    inline void _insertAtBegin(Event * newEvent);
+    mutable ResourceLock    mLock;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden methods
@@ -186,23 +281,23 @@ private:
 
 inline bool SortedEventStack::isEmpty(void) const
 {
-    Lock lock(mSynchObject);
-    return mValueList.empty();
+    return (mCount.load() <= 0);
 }
 
 inline uint32_t SortedEventStack::getCount(void) const
 {
-    return static_cast<uint32_t>(mValueList.size());
+    int32_t count = mCount.load();
+    return (count > 0 ? static_cast<uint32_t>(count) : 0u);
 }
 
 inline bool SortedEventStack::lockStack(void)
 {
-    return lock();
+    return mLock.lock(NECommon::WAIT_INFINITE);
 }
 
 inline void SortedEventStack::unlockStack(void)
 {
-    unlock();
+    mLock.unlock();
 }
 
 #endif  // AREG_COMPONENT_PRIVATE_SORTEDEVENTSTACK_HPP
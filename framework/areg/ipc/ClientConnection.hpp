@@ -22,6 +22,7 @@
 #include "areg/ipc/SocketConnectionBase.hpp"
 
 #include "areg/base/SocketClient.hpp"
+#include "areg/ipc/SharedMemoryClient.hpp"
 
 //////////////////////////////////////////////////////////////////////////
 // ClientConnection class declaration
@@ -31,8 +32,11 @@
  *          send and receive data. Before sending or receiving any data,
  *          the socket should be created and as soon as connection is not needed,
  *          it should be closed.
- *          Client socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          Client socket is using TCP/IP connection or, if the remote service
+ *          runs on the same host, the local (Unix domain) socket. If the remote
+ *          service runs on the same host and the shared memory is enabled, the client
+ *          can attach to the shared memory of the service to send and receive
+ *          messages, and the socket remains open to detect the disconnection.
  **/
 class AREG_API ClientConnection : private   SocketConnectionBase
 {
@@ -126,6 +130,13 @@ public:
      **/
     Socket & getSocket( void );
 
+    /**
+     * \brief   Sets the profile of the socket options applied when the TCP/IP connection is created.
+     *          Should be set before the socket is created.
+     * \param   profile     The profile of the socket options.
+     **/
+    inline void setSocketProfile( const NESocket::sSocketProfile & profile );
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -149,12 +160,35 @@ public:
      **/
     bool createSocket( void );
 
+    /**
+     * \brief   Creates new local (Unix domain) socket descriptor and connects to the
+     *          remote service on the same host listening on specified path.
+     *          The remote host address and port number remain unchanged.
+     * \param   socketPath  The file system path of the local socket of remote service.
+     * \return  Returns true if operation succeeded.
+     **/
+    bool createLocalSocket( const String & socketPath );
+
     /**
      * \brief   Closes existing socket.
      *          The call will disconnect from remote server.
      **/
     void closeSocket( void );
 
+    /**
+     * \brief   Attaches the connected client to the shared memory of the remote service.
+     *          Should be called after the socket is created and before the messages
+     *          are sent or received. If fails, the messages are sent and received via socket.
+     * \param   segmentName The name of the shared memory segment of the remote service.
+     * \return  Returns true if attached to the shared memory.
+     **/
+    bool attachSharedMemory( const String & segmentName );
+
+    /**
+     * \brief   Returns true if the messages are sent and received via shared memory.
+     **/
+    inline bool isSharedMemoryAttached( void ) const;
+
 public:
     /**
      * \brief   If socket is valid, sends data using existing socket connection and returns length in bytes
@@ -219,6 +253,16 @@ private:
      **/
     ITEM_ID         mCookie;
 
+    /**
+     * \brief   The profile of socket options applied when the TCP/IP connection is created.
+     **/
+    NESocket::sSocketProfile    mSocketProfile;
+
+    /**
+     * \brief   The shared memory connection with the remote service on the same host.
+     **/
+    mutable SharedMemoryClient  mSharedMemory;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -275,14 +319,26 @@ inline Socket & ClientConnection::getSocket( void )
     return mClientSocket;
 }
 
+inline void ClientConnection::setSocketProfile( const NESocket::sSocketProfile & profile )
+{
+    mSocketProfile = profile;
+}
+
+inline bool ClientConnection::isSharedMemoryAttached( void ) const
+{
+    return mSharedMemory.isAttached();
+}
+
 inline int ClientConnection::sendMessage(const RemoteMessage & in_message) const
 {
-    return SocketConnectionBase::sendMessage(in_message, mClientSocket);
+    return (mSharedMemory.isAttached() ? mSharedMemory.sendMessage(in_message) : SocketConnectionBase::sendMessage(in_message, mClientSocket));
 }
 
 inline int ClientConnection::receiveMessage(RemoteMessage & out_message) const
 {
-    return SocketConnectionBase::receiveMessage(out_message, mClientSocket);
+    // Zero means the message should be received via socket.
+    int result = mSharedMemory.isAttached() ? mSharedMemory.receiveMessage(out_message, mClientSocket) : 0;
+    return (result == 0 ? SocketConnectionBase::receiveMessage(out_message, mClientSocket) : result);
 }
 
 #endif  // AREG_IPC_CLIENTCONNECTION_HPP
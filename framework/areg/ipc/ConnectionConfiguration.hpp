@@ -19,6 +19,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/NESocket.hpp"
 #include "areg/ipc/NERemoteService.hpp"
 
 
@@ -82,6 +83,12 @@ public:
      **/
     bool getConnectionEnableFlag( void ) const;
 
+    /**
+     * \brief   Returns true if the connection type is listed in the connections
+     *          of the remote service and the connection is enabled.
+     **/
+    bool isConnectionTypeEnabled( void ) const;
+
     /**
      * \brief   Set service connection enable flag of the remote service and type.
      **/
@@ -97,6 +104,23 @@ public:
      **/
     void setConnectionPort(unsigned short portNr);
 
+    /**
+     * \brief   Returns the limit in bytes of data queued to send to a single client
+     *          of the remote service and type. Zero means there is no limit.
+     **/
+    uint32_t getConnectionQueue( void ) const;
+
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the clients
+     *          of the remote service and type. Zero means the number of processor cores.
+     **/
+    uint32_t getConnectionWorkers( void ) const;
+
+    /**
+     * \brief   Returns the profile of socket options of the remote service and type.
+     **/
+    NESocket::sSocketProfile getSocketProfile( void ) const;
+
     /**
      * \brief   Returns the connection address of the remote service and type.
      **/
@@ -53,6 +53,8 @@ namespace NERemoteService
         , ConnectUdp        = 2 //!< Service connection via UDP, not implemented at the moment
         , ConnectWeb        = 4 //!< Service connection via Web socket
         , ConnectSM         = 8 //!< Service connection via Shared Memory
+        , ConnectUds        = 16 //!< Service connection via Unix domain socket
+        , ConnectDirect     = 32 //!< Direct connection between service provider and consumer, discovered via service
     };
 
     /**
@@ -118,6 +120,11 @@ namespace NERemoteService
      **/
     AREG_API const NEMemory::sRemoteMessage & getMessageRegisterNotify( void );
 
+    /**
+     * \brief   Returns fixed message to announce the endpoint of direct connection
+     **/
+    AREG_API const NEMemory::sRemoteMessage & getMessageDirectEndpoint( void );
+
     /**
      * \brief   NERemoteService::CreateConnectRequest
      *          Initializes and returns connection request message.
@@ -243,6 +250,26 @@ namespace NERemoteService
      **/
     AREG_API RemoteMessage createServiceClientUnregisteredNotification( const ProxyAddress & proxy, NEService::eDisconnectReason reason, const ITEM_ID & source, const ITEM_ID & target);
 
+    /**
+     * \brief   NERemoteService::createDirectEndpoint
+     *          Initializes and returns the message with the endpoint of direct connection.
+     *          The service provider sends the message to the routing service to announce the
+     *          endpoint. For every pair of service provider and consumer the routing service
+     *          generates the secret and sends it to both processes: the service consumer
+     *          receives the endpoint of the provider, the service provider receives the address
+     *          of the consumer with invalid port number, so that it accepts the connection only
+     *          of the announced consumer. The service consumer sends the message with empty
+     *          endpoint and the secret via established direct connection to introduce itself.
+     *          The source of the message is always the cookie of the process, which owns
+     *          the endpoint, or which is announced or introduced.
+     * \param   address The IP-address of the endpoint or of the announced consumer. Empty if introducing via direct connection.
+     * \param   portNr  The port number of the endpoint. Invalid if announcing the consumer or introducing via direct connection.
+     * \param   secret  The secret of the pair of service provider and consumer. Zero if announcing the endpoint to the routing service.
+     * \param   source  The cookie of the process, which owns the endpoint, or which is announced or introduced.
+     * \param   target  The ID of the target to send the message.
+     **/
+    AREG_API RemoteMessage createDirectEndpoint( const String & address, unsigned short portNr, uint64_t secret, const ITEM_ID & source, const ITEM_ID & target );
+
     /**
      * \brief   NERemoteService::isMessageHelloServer
      *          Checks whether specified message is a connect request.
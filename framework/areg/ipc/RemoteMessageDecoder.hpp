@@ -0,0 +1,254 @@
+#ifndef AREG_IPC_REMOTEMESSAGEDECODER_HPP
+#define AREG_IPC_REMOTEMESSAGEDECODER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/RemoteMessageDecoder.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, incremental decoder of remote messages
+ *              received from the socket connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/RemoteMessage.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class Socket;
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageDecoder class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The incremental decoder of remote messages of a single connection.
+ *          The decoder reads data available in the socket without blocking
+ *          into the connection owned ring buffer and keeps the state of partially
+ *          received message header and data between the read calls. A single read
+ *          may result zero or more complete messages, which are extracted by
+ *          calling nextMessage() until it returns false. In this way, a slow
+ *          peer, which sends only part of the message, does not block the receiver.
+ *
+ *          Usage:
+ *              int read = decoder.readSocket(socket);
+ *              while (decoder.nextMessage(msg))
+ *                  process(msg);
+ *              if (decoder.isFailed() || (read < 0))
+ *                  closeConnection(socket);
+ **/
+class AREG_API RemoteMessageDecoder
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The default size of the ring buffer in bytes.
+     **/
+    static constexpr uint32_t   DEFAULT_BUFFER_SIZE     { 64 * 1024 };
+
+    /**
+     * \brief   The maximum size of the message data accepted by decoder.
+     *          The messages announcing bigger size are treated as invalid.
+     **/
+    static constexpr uint32_t   MAXIMUM_MESSAGE_SIZE    { 256 * 1024 * 1024 };
+
+private:
+    /**
+     * \brief   RemoteMessageDecoder::eDecodeState
+     *          The decoding state of the message.
+     **/
+    typedef enum class E_DecodeState
+    {
+          DecodeHeader  //!< Decoding the message header.
+        , DecodeData    //!< Decoding the message data.
+        , DecodeFailed  //!< Decoding failed, the connection should be closed.
+    } eDecodeState;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the decoder. The ring buffer is allocated on first read.
+     * \param   bufferSize  The size of ring buffer in bytes.
+     **/
+    explicit RemoteMessageDecoder( uint32_t bufferSize = RemoteMessageDecoder::DEFAULT_BUFFER_SIZE );
+
+    /**
+     * \brief   Move constructor.
+     **/
+    RemoteMessageDecoder( RemoteMessageDecoder && src ) noexcept;
+
+    /**
+     * \brief   Releases the ring buffer.
+     **/
+    ~RemoteMessageDecoder( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operators, attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Move operator.
+     **/
+    RemoteMessageDecoder & operator = ( RemoteMessageDecoder && src ) noexcept;
+
+    /**
+     * \brief   Returns true if decoding failed, i.e. the received data is not a valid message.
+     **/
+    inline bool isFailed( void ) const;
+
+    /**
+     * \brief   Returns true if the decoder has partially received message.
+     **/
+    inline bool hasPartialMessage( void ) const;
+
+    /**
+     * \brief   Makes single non-blocking receive of available data in the socket.
+     * \param   socket  The socket to read data.
+     * \return  Returns number of bytes received. Returns zero if there is no data available
+     *          or there is no space in the buffer. Returns negative value if the socket
+     *          is closed or failed.
+     **/
+    int readSocket( const Socket & socket );
+
+    /**
+     * \brief   Copies the data received by other means than socket, for example,
+     *          from the shared memory. The data is copied as much as there is space
+     *          in the buffer. The rest of data should be passed again after extracting
+     *          messages by nextMessage() call.
+     * \param   data    The buffer of received data.
+     * \param   length  The length in bytes of data in the buffer.
+     * \return  Returns number of bytes copied. Returns zero if there is no space
+     *          in the buffer. Returns negative value if decoding failed.
+     **/
+    int writeData( const unsigned char * data, uint32_t length );
+
+    /**
+     * \brief   Decodes received data and extracts next complete message.
+     * \param   out_message On output, contains complete message if the method returns true.
+     * \return  Returns true if there was complete message. Returns false if there is
+     *          not enough data or the decoding failed. Check isFailed() to distinguish.
+     **/
+    bool nextMessage( RemoteMessage & out_message );
+
+    /**
+     * \brief   Resets the decoding state and drops all received data.
+     **/
+    void reset( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Copies and removes data from the ring buffer.
+     * \param   dst     The destination buffer. If nullptr, the data is dropped.
+     * \param   length  The maximum number of bytes to copy.
+     * \return  Returns the number of bytes copied.
+     **/
+    uint32_t _readBuffer( unsigned char * dst, uint32_t length );
+
+    /**
+     * \brief   Validates the received header and prepares the message to receive data.
+     * \return  Returns true if the header is valid.
+     **/
+    bool _decodeHeader( void );
+
+    /**
+     * \brief   Completes the message, validates the checksum and resets the state.
+     * \param   out_message On output, contains complete message if the method returns true.
+     * \return  Returns true if the message is valid.
+     **/
+    bool _completeMessage( RemoteMessage & out_message );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The ring buffer of received bytes.
+     **/
+    unsigned char *                 mBuffer;
+    /**
+     * \brief   The size of ring buffer in bytes.
+     **/
+    uint32_t                        mCapacity;
+    /**
+     * \brief   The position of first received byte in the ring buffer.
+     **/
+    uint32_t                        mHead;
+    /**
+     * \brief   The number of received bytes in the ring buffer.
+     **/
+    uint32_t                        mSize;
+    /**
+     * \brief   The decoding state.
+     **/
+    eDecodeState                    mState;
+    /**
+     * \brief   The header of currently decoding message.
+     **/
+    NEMemory::sRemoteMessageHeader  mHeader;
+    /**
+     * \brief   The number of received bytes of the header.
+     **/
+    uint32_t                        mHeaderRead;
+    /**
+     * \brief   The currently decoding message.
+     **/
+    RemoteMessage                   mMessage;
+    /**
+     * \brief   The data buffer of currently decoding message.
+     **/
+    unsigned char *                 mData;
+    /**
+     * \brief   The length of message data sent by remote side.
+     **/
+    uint32_t                        mDataLength;
+    /**
+     * \brief   The length of message data, which fits the message buffer.
+     *          The rest of data up to mDataLength is dropped.
+     **/
+    uint32_t                        mDataSpace;
+    /**
+     * \brief   The number of received bytes of data.
+     **/
+    uint32_t                        mDataRead;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    RemoteMessageDecoder( const RemoteMessageDecoder & /*src*/ ) = delete;
+    RemoteMessageDecoder & operator = ( const RemoteMessageDecoder & /*src*/ ) = delete;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageDecoder class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool RemoteMessageDecoder::isFailed( void ) const
+{
+    return (mState == eDecodeState::DecodeFailed);
+}
+
+inline bool RemoteMessageDecoder::hasPartialMessage( void ) const
+{
+    return (mHeaderRead != 0) || (mSize != 0);
+}
+
+#endif  // AREG_IPC_REMOTEMESSAGEDECODER_HPP
@@ -0,0 +1,258 @@
+#ifndef AREG_IPC_REMOTEMESSAGEQUEUE_HPP
+#define AREG_IPC_REMOTEMESSAGEQUEUE_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/RemoteMessageQueue.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, outbound queue of remote messages
+ *              to send to the socket connection.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/TELinkedList.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class SharedMemoryServer;
+class Socket;
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageQueue class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The outbound queue of remote messages of a single connection.
+ *          The queued messages are sent without blocking and several messages
+ *          are coalesced into a single gather send call. If the socket cannot
+ *          send all data, the queue keeps the position of partially sent message
+ *          and continues sending when the socket is writable again.
+ *          The queue keeps its own copy of the message header, so that the data
+ *          of the same message can be shared by the queues of several connections.
+ *
+ *          Usage:
+ *              queue.pushMessage(msg);
+ *              if (queue.sendMessages(socket) < 0)
+ *                  closeConnection(socket);
+ *              else if (queue.isEmpty() == false)
+ *                  waitWritable(socket);
+ **/
+class AREG_API RemoteMessageQueue
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   RemoteMessageQueue::sQueuedMessage
+     *          The queued message and the header to send. The header is the copy
+     *          of the message header with the target of the connection.
+     **/
+    struct sQueuedMessage
+    {
+        //!< The message, which data is sent.
+        RemoteMessage                   qmMessage;
+        //!< The header of the message to send.
+        NEMemory::sRemoteMessageHeader  qmHeader;
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes empty queue.
+     **/
+    RemoteMessageQueue( void );
+
+    /**
+     * \brief   Move constructor.
+     **/
+    RemoteMessageQueue( RemoteMessageQueue && src ) noexcept;
+
+    /**
+     * \brief   Destructor.
+     **/
+    ~RemoteMessageQueue( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operators, attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Move operator.
+     **/
+    RemoteMessageQueue & operator = ( RemoteMessageQueue && src ) noexcept;
+
+    /**
+     * \brief   Returns true if there is no message to send.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Returns the number of queued messages, including partially sent message.
+     **/
+    inline uint32_t getSize( void ) const;
+
+    /**
+     * \brief   Returns the number of bytes, which are queued and not sent yet.
+     **/
+    inline uint32_t getQueuedBytes( void ) const;
+
+    /**
+     * \brief   Returns the first message in the queue. The queue should not be empty.
+     **/
+    inline const RemoteMessage & firstMessage( void ) const;
+
+    /**
+     * \brief   Adds the message at the end of the queue. The message is not sent.
+     * \param   message     The valid message to queue.
+     **/
+    void pushMessage( const RemoteMessage & message );
+
+    /**
+     * \brief   Adds the message shared with other queues at the end of the queue.
+     *          The message is sent to the specified target and the message itself is
+     *          not modified. The checksum of the message does not depend on the target,
+     *          so that the message should be completed by calling bufferCompletionFix()
+     *          once before it is pushed in the queues. The message is not sent.
+     * \param   message     The valid and completed message to queue.
+     * \param   target      The cookie of the target to set in the header of message to send.
+     **/
+    void pushShared( const RemoteMessage & message, const ITEM_ID & target );
+
+    /**
+     * \brief   Sends queued messages without blocking. The messages are sent by gather
+     *          send calls until either the queue is empty or the socket cannot send data.
+     * \param   socket  The socket to send messages.
+     * \return  Returns number of bytes sent. Returns zero if the socket cannot send data
+     *          at the moment or the queue is empty. Returns negative value if failed.
+     **/
+    int sendMessages( const Socket & socket );
+
+    /**
+     * \brief   Sends all queued messages and blocks until the data is sent.
+     * \param   socket  The socket to send messages.
+     * \return  Returns number of bytes sent. Returns negative value if failed.
+     **/
+    int flushMessages( const Socket & socket );
+
+    /**
+     * \brief   Writes queued messages in the ring of the bound slot of shared memory
+     *          without blocking. Only the data, which fits the ring, is written and the
+     *          partially written message is continued on next call.
+     * \param   sharedMemory    The shared memory to write messages.
+     * \param   slot            The index of the bound slot.
+     * \return  Returns number of bytes written. Returns zero if the ring is full
+     *          or the queue is empty. Returns negative value if failed.
+     **/
+    int sendShared( SharedMemoryServer & sharedMemory, uint32_t slot );
+
+    /**
+     * \brief   Writes all queued messages in the ring of the bound slot of shared memory
+     *          and blocks until the data is written.
+     * \param   sharedMemory    The shared memory to write messages.
+     * \param   slot            The index of the bound slot.
+     * \return  Returns number of bytes written. Returns negative value if failed.
+     **/
+    int flushShared( SharedMemoryServer & sharedMemory, uint32_t slot );
+
+    /**
+     * \brief   Removes all queued messages.
+     **/
+    void clear( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the number of bytes to send of the message, i.e. the header and aligned data.
+     **/
+    static inline uint32_t _messageLength( const sQueuedMessage & entry );
+
+    /**
+     * \brief   Fills the list of buffers to send, starting from the position of first message.
+     * \param   out_buffers The list of buffers to fill.
+     * \param   maxCount    The maximum number of entries in the list.
+     * \return  Returns the number of filled entries.
+     **/
+    int _fillBuffers( NESocket::sSendBuffer * out_buffers, int maxCount ) const;
+
+    /**
+     * \brief   Removes the sent bytes from the queue.
+     * \param   sentBytes   The number of sent bytes.
+     **/
+    void _removeSent( uint32_t sentBytes );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The queued messages.
+     **/
+    TELinkedList<sQueuedMessage>    mMessages;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The number of bytes of the first message, which are already sent.
+     **/
+    uint32_t                    mSentBytes;
+    /**
+     * \brief   The number of bytes, which are queued and not sent yet.
+     **/
+    uint32_t                    mQueuedBytes;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    RemoteMessageQueue( const RemoteMessageQueue & /*src*/ ) = delete;
+    RemoteMessageQueue & operator = ( const RemoteMessageQueue & /*src*/ ) = delete;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageQueue class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool RemoteMessageQueue::isEmpty( void ) const
+{
+    return mMessages.isEmpty();
+}
+
+inline uint32_t RemoteMessageQueue::getSize( void ) const
+{
+    return mMessages.getSize();
+}
+
+inline uint32_t RemoteMessageQueue::getQueuedBytes( void ) const
+{
+    return mQueuedBytes;
+}
+
+inline const RemoteMessage & RemoteMessageQueue::firstMessage( void ) const
+{
+    return mMessages.firstEntry().qmMessage;
+}
+
+#endif  // AREG_IPC_REMOTEMESSAGEQUEUE_HPP
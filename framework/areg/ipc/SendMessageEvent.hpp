@@ -21,6 +21,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/TEEvent.hpp"
 #include "areg/base/RemoteMessage.hpp"
+#include "areg/base/TEArrayList.hpp"
 
 #include <utility>
 
@@ -43,6 +44,7 @@ private:
     enum eSendMessage
     {
           MessageForward    //!< Forward message to target.
+        , MessageMulticast  //!< Forward the same message to the list of targets.
         , ExitThread        //!< Stop sending message and exit the thread.
     };
 
@@ -64,6 +66,16 @@ public:
      **/
     inline explicit SendMessageEventData( const RemoteMessage & remoteMessage );
 
+    /**
+     * \brief   Sets the remote message buffer with the instruction to forward the same
+     *          message to the list of targets. The data of the message is shared and
+     *          not copied, only the header sent to every target contains its cookie.
+     *          The message should be completed before sending and not modified anymore.
+     * \param   remoteMessage   The remote message object to initialize.
+     * \param   targets         The list of cookies of targets to receive the message.
+     **/
+    inline SendMessageEventData( const RemoteMessage & remoteMessage, const TEArrayList<ITEM_ID> & targets );
+
     /**
      * \brief   Copies remote message data from given source.
      * \param   source  The source, which contains remote message.
@@ -102,6 +114,12 @@ public:
      **/
     inline const RemoteMessage & getRemoteMessage( void ) const;
 
+    /**
+     * \brief   Returns the list of targets to forward the message.
+     *          The list is empty if the message is forwarded to a single target.
+     **/
+    inline const TEArrayList<ITEM_ID> & getTargets( void ) const;
+
     /**
      * \brief   Returns the command instruction to handle messages.
      **/
@@ -112,6 +130,11 @@ public:
      **/
     inline bool isForwardMessage( void ) const;
 
+    /**
+     * \brief   Returns true if message is with instruction to forward the message to the list of targets.
+     **/
+    inline bool isMulticastMessage( void ) const;
+
     /**
      * \brief   Returns true if message is with instruction to quit the thread.
      **/
@@ -126,6 +149,17 @@ private:
      **/
     RemoteMessage   mRemoteMessage;
 
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The list of targets to forward the message.
+     **/
+    TEArrayList<ITEM_ID>    mTargets;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
     /**
      * \brief   The action to perform on the message.
      **/
@@ -144,24 +178,35 @@ DECLARE_EVENT(SendMessageEventData, SendMessageEvent, IESendMessageEventConsumer
 
 inline SendMessageEventData::SendMessageEventData(const RemoteMessage& remoteMessage)
     : mRemoteMessage    (remoteMessage)
+    , mTargets          ( )
     , mCmdSendMessage   ( SendMessageEventData::eSendMessage::MessageForward )
 {
 }
 
+inline SendMessageEventData::SendMessageEventData(const RemoteMessage& remoteMessage, const TEArrayList<ITEM_ID>& targets)
+    : mRemoteMessage    ( remoteMessage )
+    , mTargets          ( targets )
+    , mCmdSendMessage   ( SendMessageEventData::eSendMessage::MessageMulticast )
+{
+}
+
 inline SendMessageEventData::SendMessageEventData(void)
     : mRemoteMessage    ( )
+    , mTargets          ( )
     , mCmdSendMessage   ( SendMessageEventData::eSendMessage::ExitThread )
 {
 }
 
 inline SendMessageEventData::SendMessageEventData( const SendMessageEventData & source )
     : mRemoteMessage    ( source.mRemoteMessage )
+    , mTargets          ( source.mTargets )
     , mCmdSendMessage   ( source.mCmdSendMessage )
 {
 }
 
 inline SendMessageEventData::SendMessageEventData(SendMessageEventData&& source) noexcept
     : mRemoteMessage    ( std::move(source.mRemoteMessage) )
+    , mTargets          ( std::move(source.mTargets) )
     , mCmdSendMessage   ( source.mCmdSendMessage )
 {
 }
@@ -169,6 +214,7 @@ inline SendMessageEventData::SendMessageEventData(SendMessageEventData&& source)
 inline SendMessageEventData& SendMessageEventData::operator = (const SendMessageEventData& source)
 {
     mRemoteMessage  = source.mRemoteMessage;
+    mTargets        = source.mTargets;
     mCmdSendMessage = source.mCmdSendMessage;
     return (*this);
 }
@@ -176,6 +222,7 @@ inline SendMessageEventData& SendMessageEventData::operator = (const SendMessage
 inline SendMessageEventData& SendMessageEventData::operator = (SendMessageEventData&& source) noexcept
 {
     mRemoteMessage  = std::move(source.mRemoteMessage);
+    mTargets        = std::move(source.mTargets);
     mCmdSendMessage = source.mCmdSendMessage;
     return (*this);
 }
@@ -185,6 +232,11 @@ inline const RemoteMessage & SendMessageEventData::getRemoteMessage( void ) cons
     return mRemoteMessage;
 }
 
+inline const TEArrayList<ITEM_ID> & SendMessageEventData::getTargets( void ) const
+{
+    return mTargets;
+}
+
 inline SendMessageEventData::eSendMessage SendMessageEventData::getCommand( void ) const
 {
     return mCmdSendMessage;
@@ -195,6 +247,11 @@ inline bool SendMessageEventData::isForwardMessage( void ) const
     return (mCmdSendMessage == eSendMessage::MessageForward);
 }
 
+inline bool SendMessageEventData::isMulticastMessage( void ) const
+{
+    return (mCmdSendMessage == eSendMessage::MessageMulticast);
+}
+
 inline bool SendMessageEventData::isExitThreadMessage( void ) const
 {
     return (mCmdSendMessage == eSendMessage::ExitThread);
@@ -24,8 +24,12 @@
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketPoller.hpp"
 #include "areg/component/NEService.hpp"
 
+#include <atomic>
+#include <memory>
+
 //////////////////////////////////////////////////////////////////////////
 // ServerConnectionBase class declaration.
 //////////////////////////////////////////////////////////////////////////
@@ -39,15 +43,29 @@
  *          accepted, the server can start to send and receive data.
  *          Connection accepting, sending and receiving data are running
  *          in blocking mode. For this reason, it makes sens to run all these
- *          functionalities in separate threads.
- *          Server socket is using only TCP/IP connection. All other types
- *          and protocols are out of scope of this class and are not considered.
+ *          functionalities in separate threads. The events of server and
+ *          accepted sockets are collected by the socket poller, which reports
+ *          all ready sockets on every wake up.
+ *          Server socket is using TCP/IP connection. Optionally, the server
+ *          listens also on the local (Unix domain) socket to accept connections
+ *          of the clients running on the same host. All other types and
+ *          protocols are out of scope of this class and are not considered.
+ *          The accepted sockets can be distributed between several workers.
+ *          Each worker has own socket poller and waits for the events of the
+ *          clients it owns. The first worker waits also for the events of the
+ *          server sockets. The client is owned by the worker selected by its cookie.
  **/
 class AREG_API ServerConnectionBase
 {
 //////////////////////////////////////////////////////////////////////////
 // ServerConnectionBase class types and constants
 //////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The maximum number of workers to wait for the events of accepted sockets.
+     **/
+    static constexpr uint32_t   MAXIMUM_WORKERS     { 16 };
+
 protected:
     /**
      * \brief   The container of accepted socket objects where the keys are socket handle.
@@ -65,14 +83,17 @@ protected:
     using MapSocketToCookie		= TEMap<SOCKETHANDLE, ITEM_ID>;
 
     /**
-     * \brief   The list of accepted sockets.
+     * \brief   The immutable snapshot of the cookies of accepted connections.
+     *          The snapshot is replaced each time a connection is accepted or closed.
+     *          The workers read the cookies from the snapshot without locking.
      **/
-    using ListSockets			= TEArrayList<SOCKETHANDLE>;
-
-    /**
-     * \brief   The size of master list to listen sockets for incoming messages.
-     **/
-    static constexpr int    MASTER_LIST_SIZE    { 64 };
+    struct sConnectionIds
+    {
+        /**
+         * \brief   The cookie values where the keys are socket handles.
+         **/
+        MapSocketToCookie   ciSocketToCookie;
+    };
 
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
@@ -110,7 +131,7 @@ public:
     /**
      * \brief   Destructor.
      **/
-    virtual ~ServerConnectionBase( void ) = default;
+    virtual ~ServerConnectionBase( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes
@@ -153,11 +174,44 @@ public:
      **/
     inline SOCKETHANDLE getSocketHandle( void ) const;
 
+    /**
+     * \brief   Returns handle of the local socket or invalid handle if the server does not listen on local socket.
+     **/
+    inline SOCKETHANDLE getLocalSocketHandle( void ) const;
+
+    /**
+     * \brief   Sets the profile of the socket options applied to the accepted TCP/IP connections.
+     *          Should be set before the server starts accepting connections.
+     * \param   profile     The profile of the socket options.
+     **/
+    inline void setSocketProfile( const NESocket::sSocketProfile & profile );
+
+    /**
+     * \brief   Returns the number of workers, which wait for the events of accepted sockets.
+     **/
+    inline uint32_t getWorkerCount( void ) const;
+
+    /**
+     * \brief   Sets the number of workers, which wait for the events of accepted sockets.
+     *          The value is ignored if the server socket is already created.
+     * \param   count   The number of workers. The value is truncated to be
+     *                  between 1 and MAXIMUM_WORKERS.
+     * \return  Returns true if the number of workers is set.
+     **/
+    bool setWorkerCount( uint32_t count );
+
+    /**
+     * \brief   Returns the index of the worker, which owns the connection of specified cookie.
+     *          The accepted sockets are evenly distributed between workers.
+     * \param   cookie  The cookie of the client connection.
+     **/
+    inline uint32_t getWorker( const ITEM_ID & cookie ) const;
+
     /**
      * \brief   Returns true if connection with specified socket is accepted.
      * \param   connection      The socket to check connection acceptance.
      **/
-    inline bool isConnectionAccepted( SOCKETHANDLE connection ) const;
+    bool isConnectionAccepted( SOCKETHANDLE connection ) const;
 
     /**
      * \brief   Returns cookie of client connection set by server.
@@ -173,7 +227,7 @@ public:
      *          source or target in Remote Buffer.
      * \param   socketHandle    Socket handle of accepted client connection
      **/
-    inline ITEM_ID getCookie( SOCKETHANDLE socketHandle ) const;
+    ITEM_ID getCookie( SOCKETHANDLE socketHandle ) const;
 
     /**
      * \brief   Returns accepted socket object, which is matching passed cookie.
@@ -219,7 +273,16 @@ public:
     bool createSocket( void );
 
     /**
-     * \brief   Closes existing socket.
+     * \brief   Creates the local (Unix domain) socket bound to specified path, so that the
+     *          server accepts connections of the clients on the same host in addition to
+     *          the TCP/IP connections. Should be called after the server socket is created.
+     * \param   socketPath  The file system path of the local socket.
+     * \return  Returns true if operation succeeded.
+     **/
+    bool createLocalSocket( const String & socketPath );
+
+    /**
+     * \brief   Closes existing server and local sockets.
      *          The call will disconnect all accepted connections.
      **/
     void closeSocket( void );
@@ -234,23 +297,38 @@ public:
     bool serverListen( int maxQueueSize = NESocket::MAXIMUM_LISTEN_QUEUE_SIZE );
 
     /**
-     * \brief   Call to wait for connection event. Function is blocking call until connection
-     *          event is not triggered. Once connection event happens, the function returns
-     *          valid socket handle of connected event. On output out_addrNewAccepted parameter
-     *          changes only if new client connection is accepted. In all other cases, when
-     *          client send data or closes socket, this parameter will not be changed, and
-     *          the method does not distinguish whether client socket is closed or send data.
-     *          The connection event is fired when new client is connected, when client
-     *          is sending data or client closes connection.
-     * \param   out_addrNewAccepted On output, if new connection is accepted, this parameter
-     *                              contain address of new accepted socket. In all other cases,
-     *                              when client sends data or close socket, this parameter
-     *                              remains unchanged.
-     * \return  If function succeeds, the function returns valid socket handle. For new connections,
-     *          out_addrNewAccepted parameter contains address of accepted socket.
-     *          If function fails, returns invalid socket handle.
+     * \brief   Call to wait for connection events. Function is blocking call until either
+     *          new client connects, or any accepted client sends data or closes connection,
+     *          or the server socket is closed. All sockets that are ready are reported at once.
+     *          The event of server socket means pending connection, which should be accepted
+     *          by calling acceptNewConnection(). The accepted client sockets are registered
+     *          as edge-triggered, so that the receiver should read all pending messages.
+     * \param   out_events  The list of events to fill on output.
+     * \param   maxEvents   The maximum number of entries in the list.
+     * \param   worker      The index of the worker, which waits for the events of its sockets.
+     *                      Only the worker with index 0 receives the events of server sockets.
+     * \return  Returns the number of events in the list. Returns zero if the wait was interrupted,
+     *          for example, when server socket is closed. Returns negative value if failed.
+     **/
+    int waitForConnectionEvents( SocketPoller::sPollEvent * out_events, int maxEvents, uint32_t worker = 0 );
+
+    /**
+     * \brief   Accepts pending client connection. Should be called when wait for connection
+     *          events reports event of server socket. The accepted socket is not registered
+     *          before acceptConnection() is called.
+     * \param   out_addrNewAccepted On output, contains the address of new accepted socket.
+     * \return  Returns valid socket handle of accepted connection or invalid socket handle if failed.
      **/
-    SOCKETHANDLE waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted);
+    SOCKETHANDLE acceptNewConnection( NESocket::SocketAddress & out_addrNewAccepted );
+
+    /**
+     * \brief   Accepts pending client connection of the local socket. Should be called when
+     *          wait for connection events reports event of local socket. The accepted socket
+     *          is not registered before acceptConnection() is called.
+     * \param   out_addrNewAccepted On output, contains the local address without port number.
+     * \return  Returns valid socket handle of accepted connection or invalid socket handle if failed.
+     **/
+    SOCKETHANDLE acceptLocalConnection( NESocket::SocketAddress & out_addrNewAccepted );
 
     /**
      * \brief   Call to accept connection. Nothing will happen if connection was already accepted.
@@ -298,6 +376,40 @@ public:
      **/
     inline void disableReceive( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+protected:
+    /**
+     * \brief   Unregisters and removes all accepted connections, resets the cookie generator.
+     *          Should be called when the lock is taken.
+     **/
+    void _removeAllConnections( void );
+
+    /**
+     * \brief   Creates new snapshot of the cookies of accepted connections.
+     *          Should be called when the lock is taken, each time the connections are modified.
+     **/
+    void _publishConnections( void );
+
+    /**
+     * \brief   Returns the snapshot of the cookies of accepted connections cached by the calling thread.
+     *          The lock is taken only if the connections were modified since the last call of the thread.
+     *          The returned object is valid until the next call in the same thread.
+     **/
+    const sConnectionIds & _getConnectionIds( void ) const;
+
+    /**
+     * \brief   Returns the socket poller of the worker, which owns the connection of specified cookie.
+     **/
+    inline SocketPoller & _getWorkerPoller( const ITEM_ID & cookie );
+
+private:
+    /**
+     * \brief   Creates the socket pollers of the workers, if needed, and registers the server socket.
+     **/
+    bool _registerServerSocket( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -306,10 +418,18 @@ protected:
      * \brief   The instance of server socket connection, which accepts connections
      **/
     SocketServer        mServerSocket;
+    /**
+     * \brief   The instance of local socket, which accepts connections of the clients on the same host.
+     **/
+    SocketServer        mLocalSocket;
     /**
      * \brief   The cookie value generator, counter.
      **/
     ITEM_ID             mCookieGenerator;
+    /**
+     * \brief   The profile of socket options applied to the accepted TCP/IP connections.
+     **/
+    NESocket::sSocketProfile    mSocketProfile;
 
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(disable: 4251)
@@ -327,12 +447,29 @@ protected:
      **/
     MapSocketToCookie   mSocketToCookie;
     /**
-     * \brief   The list of accepted sockets.
+     * \brief   The snapshot of cookies of accepted connections, read by workers without lock.
      **/
-    ListSockets         mMasterList;
+    std::shared_ptr<const sConnectionIds>   mConnectionIds;
+    /**
+     * \brief   The version of the snapshot of cookies, increased each time the snapshot is replaced.
+     **/
+    std::atomic_uint    mIdsVersion;
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
+    /**
+     * \brief   The unique ID of the object, used by the threads to cache the snapshot of cookies.
+     **/
+    const uint32_t      mInstanceId;
+    /**
+     * \brief   The number of workers, which wait for the events of accepted sockets.
+     **/
+    uint32_t            mWorkerCount;
+    /**
+     * \brief   The pollers of the workers. The first poller waits for the events of
+     *          the server sockets and accepted sockets, the others only for accepted sockets.
+     **/
+    SocketPoller        mSocketPollers[MAXIMUM_WORKERS];
 
     /**
      * \brief   Synchronization object for data sharing
@@ -379,23 +516,36 @@ inline SOCKETHANDLE ServerConnectionBase::getSocketHandle( void ) const
     return mServerSocket.getHandle();
 }
 
-inline bool ServerConnectionBase::isConnectionAccepted( SOCKETHANDLE connection ) const
+inline SOCKETHANDLE ServerConnectionBase::getLocalSocketHandle( void ) const
 {
     Lock lock(mLock);
-    return mAcceptedConnections.contains(connection);
+    return mLocalSocket.getHandle();
 }
 
-inline ITEM_ID ServerConnectionBase::getCookie(const SocketAccepted & clientSocket) const
+inline void ServerConnectionBase::setSocketProfile( const NESocket::sSocketProfile & profile )
 {
-    return getCookie(clientSocket.getHandle());
+    Lock lock(mLock);
+    mSocketProfile = profile;
 }
 
-inline ITEM_ID ServerConnectionBase::getCookie(SOCKETHANDLE socketHandle) const
+inline uint32_t ServerConnectionBase::getWorkerCount( void ) const
 {
-    Lock lock( mLock );
+    return mWorkerCount;
+}
 
-    MapSocketToCookie::MAPPOS pos = mSocketToCookie.find( socketHandle );
-    return (mSocketToCookie.isValidPosition(pos) ? mSocketToCookie.valueAtPosition(pos) : NEService::COOKIE_UNKNOWN );
+inline uint32_t ServerConnectionBase::getWorker( const ITEM_ID & cookie ) const
+{
+    return static_cast<uint32_t>(cookie % mWorkerCount);
+}
+
+inline SocketPoller & ServerConnectionBase::_getWorkerPoller( const ITEM_ID & cookie )
+{
+    return mSocketPollers[getWorker( cookie )];
+}
+
+inline ITEM_ID ServerConnectionBase::getCookie(const SocketAccepted & clientSocket) const
+{
+    return getCookie(clientSocket.getHandle());
 }
 
 inline SocketAccepted ServerConnectionBase::getClientByCookie(const ITEM_ID & clientCookie) const
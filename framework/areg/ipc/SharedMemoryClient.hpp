@@ -0,0 +1,189 @@
+#ifndef AREG_IPC_SHAREDMEMORYCLIENT_HPP
+#define AREG_IPC_SHAREDMEMORYCLIENT_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/SharedMemoryClient.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the client side of the shared memory
+ *              connection with the remote service on the same host.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+
+#include <atomic>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessage;
+class Socket;
+namespace NESharedMemory
+{
+    struct sSegmentHeader;
+    struct sSlot;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryClient class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The client side of the shared memory connection. The client
+ *          first connects to the remote service via TCP/IP, then opens the
+ *          shared memory segment of the service, claims a free slot and
+ *          waits until the server binds the slot with the accepted socket.
+ *          When attached, the messages are sent and received via the rings
+ *          of the slot. The TCP/IP connection remains open to detect the
+ *          disconnection and the messages are sent and received via socket
+ *          if the client is not attached or the slot is closed.
+ **/
+class AREG_API SharedMemoryClient
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    SharedMemoryClient( void );
+
+    /**
+     * \brief   Detaches and unmaps the shared memory segment.
+     **/
+    ~SharedMemoryClient( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the client is attached to the slot of the shared memory.
+     **/
+    inline bool isAttached( void ) const;
+
+    /**
+     * \brief   Opens the shared memory segment, claims a free slot and waits until the
+     *          server binds the slot with the connected socket.
+     * \param   segmentName The name of the shared memory segment of the remote service.
+     * \param   socket      The socket connected to the remote service. Should be valid.
+     * \return  Returns true if the client is attached. Otherwise, the socket should be used.
+     **/
+    bool attach( const String & segmentName, const Socket & socket );
+
+    /**
+     * \brief   Closes the slot and notifies the server. The segment remains mapped
+     *          until the next attach or until the object is destroyed, so that the
+     *          threads, which still send or receive, do not access unmapped memory.
+     **/
+    void detach( void );
+
+    /**
+     * \brief   Sends the message via the ring of the slot. The call is blocking if there
+     *          is not enough space in the ring.
+     * \param   in_message  The message to send.
+     * \return  Returns the length in bytes of sent data. Returns negative value if not
+     *          attached or failed to send.
+     **/
+    int sendMessage( const RemoteMessage & in_message );
+
+    /**
+     * \brief   Receives the message via the ring of the slot. The call is blocking until
+     *          the message is received or until the data should be received via socket.
+     * \param   out_message On output, contains the received message.
+     * \param   socket      The socket connected to the remote service.
+     * \return  Returns the length in bytes of received data. Returns zero if the message
+     *          should be received via socket, which happens if there is data sent before
+     *          the slot was bound or if the slot is closed. Returns negative value if the
+     *          received data is not a valid message.
+     **/
+    int receiveMessage( RemoteMessage & out_message, const Socket & socket );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Claims a free slot and waits until the server binds it.
+     * \param   address The IPv4 address of the client socket in network byte order.
+     * \param   portNr  The port number of the client socket.
+     * \return  Returns true if the slot is bound.
+     **/
+    bool _claimSlot( uint32_t address, unsigned short portNr );
+
+    /**
+     * \brief   Writes the data in the ring, waits if there is no space in the ring.
+     * \return  Returns true if all data is written.
+     **/
+    bool _writeData( const unsigned char * data, uint32_t length );
+
+    /**
+     * \brief   Returns true if the slot is bound and the server runs.
+     **/
+    bool _isBound( void ) const;
+
+    /**
+     * \brief   Unmaps the shared memory segment.
+     **/
+    void _unmapSegment( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The mapped shared memory segment.
+    NESharedMemory::sSegmentHeader *    mSegment;
+
+    //!< The slot of the client.
+    NESharedMemory::sSlot *             mSlot;
+
+    //!< The index of the slot.
+    uint32_t                            mSlotIndex;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    //!< Flag, indicating whether the client is attached to the slot.
+    std::atomic_bool                    mAttached;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    //!< Flag, indicating whether the data sent via socket before binding the slot is received.
+    bool                                mSocketDrained;
+
+    //!< The decoder of messages received from the ring.
+    RemoteMessageDecoder                mDecoder;
+
+    //!< The lock to synchronize sending messages.
+    ResourceLock                        mSendLock;
+
+    //!< The lock to synchronize receiving messages.
+    ResourceLock                        mReceiveLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SharedMemoryClient );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryClient class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SharedMemoryClient::isAttached( void ) const
+{
+    return mAttached;
+}
+
+#endif  // AREG_IPC_SHAREDMEMORYCLIENT_HPP
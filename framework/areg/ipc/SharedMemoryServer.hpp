@@ -0,0 +1,225 @@
+#ifndef AREG_IPC_SHAREDMEMORYSERVER_HPP
+#define AREG_IPC_SHAREDMEMORYSERVER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/SharedMemoryServer.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the server side of the shared memory
+ *              connections with the clients on the same host.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/String.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessage;
+class RemoteMessageDecoder;
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryServer class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The server side of the shared memory connections. The server
+ *          creates the shared memory segment, which slots are claimed by the
+ *          clients running on the same host. The server binds the claimed
+ *          slot with the accepted socket of the client, which has the same
+ *          address as the slot, and exchanges messages via the rings of the slot.
+ *          The server sleeps on the doorbell of the segment, which is changed
+ *          by the clients on every write or change of the slot state.
+ *
+ *          The object is not thread safe. The slots are read by a single thread,
+ *          the sending and closing the slots should be synchronized by the caller.
+ **/
+class AREG_API SharedMemoryServer
+{
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    SharedMemoryServer( void );
+
+    /**
+     * \brief   Releases the shared memory segment.
+     **/
+    ~SharedMemoryServer( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the shared memory segment is created.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Creates the shared memory segment and marks the server as running.
+     *          The segment with the same name of the previous instance is removed.
+     * \param   segmentName The name of the shared memory segment.
+     * \return  Returns true if succeeded to create the segment.
+     **/
+    bool createSegment( const String & segmentName );
+
+    /**
+     * \brief   Closes all slots, marks the server as stopped, wakes up the clients
+     *          and removes the shared memory segment.
+     **/
+    void releaseSegment( void );
+
+    /**
+     * \brief   Returns the current value of the doorbell. Should be taken before
+     *          checking the slots and passed to waitEvents() call.
+     **/
+    uint32_t getDoorbell( void ) const;
+
+    /**
+     * \brief   Sleeps until a client changes the doorbell or the timeout expires.
+     * \param   doorbell    The value of the doorbell taken before checking the slots.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     **/
+    void waitEvents( uint32_t doorbell, unsigned int msTimeout );
+
+    /**
+     * \brief   Wakes up the thread waiting for events.
+     **/
+    void interrupt( void );
+
+    /**
+     * \brief   Returns the state of the slot.
+     **/
+    NESharedMemory::eSlotState getSlotState( uint32_t slot ) const;
+
+    /**
+     * \brief   Returns true if the process, which claimed the slot, exists.
+     **/
+    bool isSlotProcessAlive( uint32_t slot ) const;
+
+    /**
+     * \brief   Returns the address of the client socket, which claimed the slot.
+     * \param   slot        The index of the slot.
+     * \param   out_address On output, contains the address of the client socket.
+     * \return  Returns true if the slot is claimed and the client set the address.
+     **/
+    bool getClaimedAddress( uint32_t slot, NESocket::SocketAddress & out_address ) const;
+
+    /**
+     * \brief   Binds the claimed slot and wakes up the client.
+     * \return  Returns true if the slot is bound.
+     **/
+    bool bindSlot( uint32_t slot );
+
+    /**
+     * \brief   Closes the claimed or bound slot and wakes up the client.
+     *          The slot is freed when the client acknowledges or the client process exits.
+     **/
+    void closeSlot( uint32_t slot );
+
+    /**
+     * \brief   Frees the slot, so that it can be claimed by other client.
+     **/
+    void freeSlot( uint32_t slot );
+
+    /**
+     * \brief   Moves the data received in the slot into the decoder without blocking.
+     * \param   slot    The index of the bound slot.
+     * \param   decoder The decoder of messages of the slot.
+     * \return  Returns the number of bytes moved. Returns negative value if the decoder failed.
+     **/
+    int readSlot( uint32_t slot, RemoteMessageDecoder & decoder );
+
+    /**
+     * \brief   Sends the message to the client of the bound slot. The call is blocking
+     *          if there is not enough space in the ring.
+     * \param   in_message  The message to send.
+     * \param   target      The target of the message set in the sent header.
+     * \param   slot        The index of the bound slot.
+     * \return  Returns the length in bytes of sent data. Returns negative value if failed.
+     **/
+    int sendMessage( const RemoteMessage & in_message, const ITEM_ID & target, uint32_t slot );
+
+    /**
+     * \brief   Writes the list of buffers in the ring of the bound slot without blocking.
+     *          Only the data, which fits the free space of the ring, is written. If the ring
+     *          is full, the client is requested to ring the doorbell when it reads the data,
+     *          so that the sending is resumed when checkWritable() returns true.
+     * \param   slot    The index of the bound slot.
+     * \param   buffers The list of buffers to write. The data is written in the order of entries.
+     * \param   count   The number of entries in the list.
+     * \return  Returns the number of bytes written. Returns zero if the ring is full.
+     *          Returns negative value if the slot is not bound anymore.
+     **/
+    int writeAvailable( uint32_t slot, const NESocket::sSendBuffer * buffers, int count );
+
+    /**
+     * \brief   Writes the list of buffers in the ring of the bound slot. The call is blocking
+     *          if there is not enough space in the ring.
+     * \param   slot    The index of the bound slot.
+     * \param   buffers The list of buffers to write. The data is written in the order of entries.
+     * \param   count   The number of entries in the list.
+     * \return  Returns the number of bytes written. Returns negative value if failed.
+     **/
+    int writeBuffers( uint32_t slot, const NESocket::sSendBuffer * buffers, int count );
+
+    /**
+     * \brief   Returns true if the sending to the slot waits for free space and the client
+     *          has read data meanwhile. The waiting flag is reset.
+     * \param   slot    The index of the bound slot.
+     **/
+    bool checkWritable( uint32_t slot );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Writes the data in the ring of the slot, waits if there is no space in the ring.
+     * \return  Returns the number of bytes written. It is less than the length if failed.
+     **/
+    uint32_t _writeData( uint32_t slot, const unsigned char * data, uint32_t length );
+
+    /**
+     * \brief   Returns true if the slot is bound and the client process exists.
+     **/
+    bool _isBound( uint32_t slot ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The mapped shared memory segment.
+    NESharedMemory::sSegmentHeader *    mSegment;
+
+    //!< The name of the shared memory segment.
+    String                              mSegmentName;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SharedMemoryServer );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SharedMemoryServer class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SharedMemoryServer::isValid( void ) const
+{
+    return (mSegment != nullptr);
+}
+
+#endif  // AREG_IPC_SHAREDMEMORYSERVER_HPP
@@ -23,6 +23,8 @@ ClientConnection::ClientConnection( void )
     : SocketConnectionBase    ( )
     , mClientSocket ( )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mSocketProfile( NESocket::DefaultSocketProfile )
+    , mSharedMemory ( )
 {
 }
 
@@ -30,6 +32,8 @@ ClientConnection::ClientConnection(const String & hostName, unsigned short portN
     : SocketConnectionBase    ( )
     , mClientSocket ( hostName, portNr )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mSocketProfile( NESocket::DefaultSocketProfile )
+    , mSharedMemory ( )
 {
 }
 
@@ -37,6 +41,8 @@ ClientConnection::ClientConnection(const NESocket::SocketAddress & remoteAddress
     : SocketConnectionBase    ( )
     , mClientSocket ( remoteAddress )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mSocketProfile( NESocket::DefaultSocketProfile )
+    , mSharedMemory ( )
 {
 }
 
@@ -44,17 +50,31 @@ ClientConnection::ClientConnection(const NESocket::SocketAddress & remoteAddress
 bool ClientConnection::createSocket(const String & hostName, unsigned short portNr)
 {
     setCookie( mClientSocket.createSocket(hostName, portNr) ? NEService::COOKIE_LOCAL : NEService::COOKIE_UNKNOWN );
+    static_cast<void>(mClientSocket.applyProfile(mSocketProfile));
     return mClientSocket.isValid();
 }
 
 bool ClientConnection::createSocket(void)
 {
     setCookie( mClientSocket.createSocket() ? NEService::COOKIE_LOCAL : NEService::COOKIE_UNKNOWN );
+    static_cast<void>(mClientSocket.applyProfile(mSocketProfile));
+    return mClientSocket.isValid();
+}
+
+bool ClientConnection::createLocalSocket(const String & socketPath)
+{
+    setCookie( mClientSocket.createLocalSocket(socketPath) ? NEService::COOKIE_LOCAL : NEService::COOKIE_UNKNOWN );
     return mClientSocket.isValid();
 }
 
 void ClientConnection::closeSocket(void)
 {
+    mSharedMemory.detach();
     setCookie(NEService::COOKIE_UNKNOWN);
     mClientSocket.closeSocket();
 }
+
+bool ClientConnection::attachSharedMemory(const String & segmentName)
+{
+    return (mClientSocket.isValid() && mSharedMemory.attach(segmentName, mClientSocket));
+}
@@ -60,6 +60,23 @@ bool ConnectionConfiguration::getConnectionEnableFlag( void ) const
     return Application::getConfigManager().getRemoteServiceEnable(mServiceName, mConnectType);
 }
 
+bool ConnectionConfiguration::isConnectionTypeEnabled( void ) const
+{
+    bool result{ false };
+    ConfigManager & config{ Application::getConfigManager() };
+    const std::vector<Identifier> connections{ config.getRemoteServiceConnections( mServiceName ) };
+    for ( const Identifier & entry : connections )
+    {
+        if ( entry.getName( ) == mConnectType )
+        {
+            result = config.getRemoteServiceEnable( mServiceName, mConnectType );
+            break;
+        }
+    }
+
+    return result;
+}
+
 void ConnectionConfiguration::setConnectionEnableFlag(bool isEnabled)
 {
     Application::getConfigManager().setRemoteServiceEnable(mServiceName, mConnectType, isEnabled);
@@ -75,6 +92,21 @@ void ConnectionConfiguration::setConnectionPort(unsigned short portNr)
     Application::getConfigManager().setRemoteServicePort(mServiceName, mConnectType, portNr);
 }
 
+uint32_t ConnectionConfiguration::getConnectionQueue( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceQueue(mServiceName, mConnectType);
+}
+
+uint32_t ConnectionConfiguration::getConnectionWorkers( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceWorkers(mServiceName, mConnectType);
+}
+
+NESocket::sSocketProfile ConnectionConfiguration::getSocketProfile( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceSocketProfile(mServiceName, mConnectType);
+}
+
 bool ConnectionConfiguration::getConnectionIpAddress( unsigned char & OUT field0
                                                     , unsigned char & OUT field1
                                                     , unsigned char & OUT field2
@@ -0,0 +1,370 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectConnection.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the direct connections between the processes
+ *              of service providers and service consumers.
+ ************************************************************************/
+#include "areg/ipc/private/DirectConnection.hpp"
+
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/private/NEConnection.hpp"
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_createSocket);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_acceptPeer);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_connectPeers);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_bindPeer);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectConnection_closePeer);
+
+DirectConnection::DirectConnection( void )
+    : SocketConnectionBase  ( )
+    , mServerSocket     ( )
+    , mCookie           ( NEService::COOKIE_UNKNOWN )
+    , mPeerSockets      ( )
+    , mCookieToSocket   ( )
+    , mSocketToCookie   ( )
+    , mPendingPeers     ( )
+    , mAnnouncedPeers   ( )
+    , mSocketPoller     ( )
+    , mLock             ( false )
+    , mSendLock         ( false )
+{
+}
+
+DirectConnection::~DirectConnection( void )
+{
+    closeSocket( );
+}
+
+bool DirectConnection::createSocket( const String & hostName, unsigned short portNr )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_createSocket);
+
+    Lock lock( mLock );
+    bool result{ mServerSocket.isValid( ) };
+    for ( unsigned short i = 0; (result == false) && (i < NEConnection::DIRECT_PORT_RANGE) && (portNr != NESocket::InvalidPort); ++ i, ++ portNr )
+    {
+        if ( mServerSocket.createSocket( hostName.getString( ), portNr ) && mServerSocket.listenConnection( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE ) )
+        {
+            // The listening socket is level-triggered, so that every wake up accepts one pending connection.
+            result = mSocketPoller.create( ) && mSocketPoller.addSocket( mServerSocket.getHandle( ), static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), false );
+        }
+
+        if ( result == false )
+        {
+            mServerSocket.closeSocket( );
+        }
+    }
+
+    if ( result )
+    {
+        TRACE_DBG("Listening direct connections on [ %s : %u ]", mServerSocket.getAddress( ).getHostAddress( ).getString( ), static_cast<uint32_t>(mServerSocket.getAddress( ).getHostPort( )));
+    }
+    else
+    {
+        TRACE_WARN("Failed to listen direct connections on [ %s ], the messages are sent via routing service", hostName.getString( ));
+    }
+
+    return result;
+}
+
+void DirectConnection::closeSocket( void )
+{
+    Lock lock( mLock );
+
+    closePeers( );
+    mSocketPoller.removeSocket( mServerSocket.getHandle( ) );
+    mSocketPoller.interrupt( );
+    mServerSocket.closeSocket( );
+    mSocketPoller.release( );
+    mCookie = NEService::COOKIE_UNKNOWN;
+}
+
+void DirectConnection::closePeers( void )
+{
+    Lock lock( mLock );
+
+    for ( MapSocketToObject::MAPPOS pos = mPeerSockets.firstPosition( ); mPeerSockets.isValidPosition( pos ); pos = mPeerSockets.nextPosition( pos ) )
+    {
+        mSocketPoller.removeSocket( mPeerSockets.keyAtPosition( pos ) );
+        mPeerSockets.valueAtPosition( pos ).closeSocket( );
+    }
+
+    mPeerSockets.clear( );
+    mCookieToSocket.clear( );
+    mSocketToCookie.clear( );
+    mPendingPeers.clear( );
+    mAnnouncedPeers.clear( );
+}
+
+int DirectConnection::waitForConnectionEvents( SocketPoller::sPollEvent * out_events, int maxEvents )
+{
+    return mSocketPoller.waitEvents( out_events, maxEvents, NECommon::WAIT_INFINITE );
+}
+
+void DirectConnection::interrupt( void )
+{
+    mSocketPoller.interrupt( );
+}
+
+bool DirectConnection::acceptPeer( void )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_acceptPeer);
+
+    bool result{ false };
+    NESocket::SocketAddress addrAccepted;
+    SOCKETHANDLE hSocket = mServerSocket.acceptConnection( addrAccepted );
+    if ( hSocket != NESocket::InvalidSocketHandle )
+    {
+        SocketAccepted peer( hSocket, addrAccepted );
+        if ( _canAcceptPeer( peer ) )
+        {
+            static_cast<void>(peer.applyProfile( NESocket::DefaultSocketProfile ));
+            result = _registerPeer( peer, NEService::COOKIE_UNKNOWN );
+        }
+        else
+        {
+            TRACE_WARN("Rejecting direct connection of socket [ %u ], host [ %s ] is not announced"
+                        , static_cast<uint32_t>(hSocket)
+                        , addrAccepted.getHostAddress( ).getString( ));
+        }
+
+        if ( result == false )
+        {
+            peer.closeSocket( );
+        }
+    }
+
+    return result;
+}
+
+void DirectConnection::queuePeer( const ITEM_ID & cookie, const NESocket::SocketAddress & endpoint, uint64_t secret )
+{
+    Lock lock( mLock );
+    if ( mServerSocket.isValid( ) && (mCookieToSocket.contains( cookie ) == false) && endpoint.isValid( ) )
+    {
+        mPendingPeers.setAt( cookie, sDirectPeer{ endpoint, secret } );
+        mSocketPoller.interrupt( );
+    }
+}
+
+void DirectConnection::announcePeer( const ITEM_ID & cookie, const String & address, uint64_t secret )
+{
+    Lock lock( mLock );
+    if ( mServerSocket.isValid( ) && (cookie >= NEService::COOKIE_REMOTE_SERVICE) && (cookie != mCookie) && (address.isEmpty( ) == false) && (secret != 0u) )
+    {
+        mAnnouncedPeers.setAt( cookie, sDirectPeer{ NESocket::SocketAddress( address, NESocket::InvalidPort ), secret } );
+    }
+}
+
+void DirectConnection::connectPeers( void )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_connectPeers);
+
+    MapCookieToPeer pending;
+    ITEM_ID cookie{ NEService::COOKIE_UNKNOWN };
+
+    do
+    {
+        Lock lock( mLock );
+        pending = std::move( mPendingPeers );
+        mPendingPeers.clear( );
+        cookie = mCookie;
+    } while ( false );
+
+    // Connecting is blocking, the lock is not held, so that the messages are sent meanwhile.
+    for ( MapCookieToPeer::MAPPOS pos = pending.firstPosition( ); pending.isValidPosition( pos ); pos = pending.nextPosition( pos ) )
+    {
+        const ITEM_ID & peerCookie = pending.keyAtPosition( pos );
+        const NESocket::SocketAddress & endpoint = pending.valueAtPosition( pos ).dpAddress;
+        const uint64_t secret{ pending.valueAtPosition( pos ).dpSecret };
+        if ( isPeerConnected( peerCookie ) || (cookie == NEService::COOKIE_UNKNOWN) )
+        {
+            continue;
+        }
+
+        SOCKETHANDLE hSocket = NESocket::clientSocketConnect( endpoint );
+        SocketAccepted peer( hSocket, endpoint );
+        static_cast<void>(peer.applyProfile( NESocket::DefaultSocketProfile ));
+        if ( peer.isValid( ) &&
+             (SocketConnectionBase::sendMessage( NERemoteService::createDirectEndpoint( String( ), NESocket::InvalidPort, secret, cookie, peerCookie ), peer ) > 0) &&
+             (getCookie( ) == cookie) &&
+             _registerPeer( peer, peerCookie ) )
+        {
+            TRACE_DBG("Established direct connection with peer [ %llu ] at [ %s : %u ]"
+                        , peerCookie
+                        , endpoint.getHostAddress( ).getString( )
+                        , static_cast<uint32_t>(endpoint.getHostPort( )));
+        }
+        else
+        {
+            TRACE_WARN("Failed to establish direct connection with peer [ %llu ] at [ %s : %u ], the messages are sent via routing service"
+                        , peerCookie
+                        , endpoint.getHostAddress( ).getString( )
+                        , static_cast<uint32_t>(endpoint.getHostPort( )));
+            peer.closeSocket( );
+        }
+    }
+}
+
+bool DirectConnection::bindPeer( SOCKETHANDLE hSocket, const RemoteMessage & msgIntroduce )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_bindPeer);
+
+    String address;
+    unsigned short port{ NESocket::InvalidPort };
+    uint64_t secret{ 0u };
+    msgIntroduce >> address;
+    msgIntroduce >> port;
+    msgIntroduce >> secret;
+
+    Lock lock( mLock );
+    const ITEM_ID & source = msgIntroduce.getSource( );
+    MapCookieToPeer::MAPPOS posAnnounced = mAnnouncedPeers.find( source );
+    MapSocketToObject::MAPPOS posSocket  = mPeerSockets.find( hSocket );
+    bool result{ false };
+    if ( (msgIntroduce.getTarget( ) != mCookie) || (mAnnouncedPeers.isValidPosition( posAnnounced ) == false) ||
+         (mPeerSockets.isValidPosition( posSocket ) == false) || mSocketToCookie.contains( hSocket ) )
+    {
+        TRACE_WARN("Rejecting introduction of not announced peer [ %llu ] to target [ %llu ] via socket [ %u ]", source, msgIntroduce.getTarget( ), static_cast<uint32_t>(hSocket));
+    }
+    else if ( (mAnnouncedPeers.valueAtPosition( posAnnounced ).dpSecret != secret) ||
+              (mAnnouncedPeers.valueAtPosition( posAnnounced ).dpAddress.getHostAddress( ) != mPeerSockets.valueAtPosition( posSocket ).getAddress( ).getHostAddress( )) )
+    {
+        TRACE_WARN("Rejecting introduction of peer [ %llu ] via socket [ %u ], the secret or the host does not match", source, static_cast<uint32_t>(hSocket));
+    }
+    else
+    {
+        TRACE_DBG("The peer [ %llu ] introduced via direct connection of socket [ %u ]", source, static_cast<uint32_t>(hSocket));
+        mSocketToCookie.setAt( hSocket, source );
+        if ( mCookieToSocket.contains( source ) == false )
+        {
+            mCookieToSocket.setAt( source, hSocket );
+        }
+
+        result = true;
+    }
+
+    return result;
+}
+
+void DirectConnection::closePeer( SOCKETHANDLE hSocket )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectConnection_closePeer);
+
+    Lock lock( mLock );
+
+    ITEM_ID cookie{ NEService::COOKIE_UNKNOWN };
+    SocketAccepted peer;
+    mSocketToCookie.removeAt( hSocket, cookie );
+    mPeerSockets.removeAt( hSocket, peer );
+    mSocketPoller.removeSocket( hSocket );
+
+    MapCookieToSocket::MAPPOS pos = mCookieToSocket.find( cookie );
+    if ( mCookieToSocket.isValidPosition( pos ) && (mCookieToSocket.valueAtPosition( pos ) == hSocket) )
+    {
+        mCookieToSocket.removePosition( pos );
+
+        // Both peers might have connected to each other, continue with other connection.
+        for ( MapSocketToCookie::MAPPOS posSocket = mSocketToCookie.firstPosition( ); mSocketToCookie.isValidPosition( posSocket ); posSocket = mSocketToCookie.nextPosition( posSocket ) )
+        {
+            if ( mSocketToCookie.valueAtPosition( posSocket ) == cookie )
+            {
+                mCookieToSocket.setAt( cookie, mSocketToCookie.keyAtPosition( posSocket ) );
+                break;
+            }
+        }
+    }
+
+    TRACE_DBG("Closed direct connection of socket [ %u ] with peer [ %llu ]", static_cast<uint32_t>(hSocket), cookie);
+    peer.closeSocket( );
+}
+
+int DirectConnection::sendMessage( const RemoteMessage & in_message )
+{
+    int result{ -1 };
+    if ( NEService::isExecutableId( in_message.getMessageId( ) ) )
+    {
+        SocketAccepted peer;
+        do
+        {
+            Lock lock( mLock );
+            MapCookieToSocket::MAPPOS pos = mCookieToSocket.find( in_message.getTarget( ) );
+            if ( mCookieToSocket.isValidPosition( pos ) )
+            {
+                peer = mPeerSockets.getAt( mCookieToSocket.valueAtPosition( pos ) );
+            }
+        } while ( false );
+
+        if ( peer.isValid( ) )
+        {
+            do
+            {
+                Lock lock( mSendLock );
+                result = SocketConnectionBase::sendMessage( in_message, peer );
+            } while ( false );
+
+            if ( result <= 0 )
+            {
+                closePeer( peer.getHandle( ) );
+                result = -1;
+            }
+        }
+    }
+
+    return result;
+}
+
+bool DirectConnection::_registerPeer( const SocketAccepted & peer, const ITEM_ID & cookie )
+{
+    Lock lock( mLock );
+
+    bool result{ false };
+    const SOCKETHANDLE hSocket = peer.getHandle( );
+    if ( mServerSocket.isValid( ) && peer.isValid( ) && (mPeerSockets.contains( hSocket ) == false) )
+    {
+        // The messages are read one by one, the peer sockets are level-triggered.
+        if ( mSocketPoller.addSocket( hSocket, static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), false ) )
+        {
+            mPeerSockets.setAt( hSocket, peer );
+            if ( cookie != NEService::COOKIE_UNKNOWN )
+            {
+                mSocketToCookie.setAt( hSocket, cookie );
+                if ( mCookieToSocket.contains( cookie ) == false )
+                {
+                    mCookieToSocket.setAt( cookie, hSocket );
+                }
+            }
+
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+bool DirectConnection::_canAcceptPeer( const SocketAccepted & peer ) const
+{
+    bool result{ false };
+    if ( peer.isValid( ) && peer.isAlive( ) )
+    {
+        Lock lock( mLock );
+        const String & address = peer.getAddress( ).getHostAddress( );
+        for ( MapCookieToPeer::MAPPOS pos = mAnnouncedPeers.firstPosition( ); (result == false) && mAnnouncedPeers.isValidPosition( pos ); pos = mAnnouncedPeers.nextPosition( pos ) )
+        {
+            result = mAnnouncedPeers.valueAtPosition( pos ).dpAddress.getHostAddress( ) == address;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,395 @@
+#ifndef AREG_IPC_PRIVATE_DIRECTCONNECTION_HPP
+#define AREG_IPC_PRIVATE_DIRECTCONNECTION_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectConnection.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the direct connections between the processes
+ *              of service providers and service consumers.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketPoller.hpp"
+#include "areg/base/SocketServer.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/component/NEService.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// DirectConnection class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The direct connections of the process with the processes of
+ *          other service providers and service consumers. The routing service
+ *          discovers the services and forwards to the service consumers the
+ *          endpoint announced by the process of the service provider.
+ *          The consumer connects to the endpoint and introduces itself by cookie,
+ *          so that both processes can exchange the service messages without
+ *          passing them through the routing service. The connections are
+ *          identified by the cookies assigned by the routing service.
+ *
+ *          For every pair of processes the routing service generates the secret
+ *          and announces the consumer to the provider. The provider accepts the
+ *          connections only from the hosts of announced peers and binds the
+ *          connection only with the announced cookie introduced with the same
+ *          secret. The introduction of not announced peers is rejected.
+ *
+ *          The messages to the processes without direct connection, as well as
+ *          the messages, which failed to send via direct connection, should be
+ *          sent via routing service. The direct connections are closed when
+ *          the connection with the routing service is lost, because the cookies
+ *          are not valid anymore.
+ **/
+class AREG_API DirectConnection  : private   SocketConnectionBase
+{
+//////////////////////////////////////////////////////////////////////////
+// DirectConnection class types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   DirectConnection::sDirectPeer
+     *          The peer announced by the routing service.
+     **/
+    struct sDirectPeer
+    {
+        //!< The endpoint to connect, or the address of the peer to accept the connection.
+        NESocket::SocketAddress dpAddress;
+        //!< The secret of the pair of processes generated by the routing service.
+        uint64_t                dpSecret;
+    };
+
+    /**
+     * \brief   The container of peer sockets where the keys are socket handles.
+     **/
+    using MapSocketToObject     = TEMap<SOCKETHANDLE, SocketAccepted>;
+    /**
+     * \brief   The container of socket handles to send messages where the keys are cookie values.
+     **/
+    using MapCookieToSocket     = TEMap<ITEM_ID, SOCKETHANDLE>;
+    /**
+     * \brief   The container of cookie values where the keys are socket handles.
+     **/
+    using MapSocketToCookie     = TEMap<SOCKETHANDLE, ITEM_ID>;
+    /**
+     * \brief   The container of peers announced by the routing service where the keys are cookie values.
+     **/
+    using MapCookieToPeer       = TEMap<ITEM_ID, sDirectPeer>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    DirectConnection( void );
+
+    /**
+     * \brief   Closes the listening socket and all direct connections.
+     **/
+    virtual ~DirectConnection( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the socket to listen direct connections is created.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Returns the handle of the socket to listen direct connections.
+     **/
+    inline SOCKETHANDLE getSocketHandle( void ) const;
+
+    /**
+     * \brief   Returns the address of the socket to listen direct connections.
+     **/
+    inline NESocket::SocketAddress getAddress( void ) const;
+
+    /**
+     * \brief   Sets the cookie of the process assigned by the routing service.
+     *          The cookie is used to introduce the process when connecting to the peer.
+     **/
+    inline void setCookie( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Returns the cookie of the process assigned by the routing service.
+     **/
+    inline ITEM_ID getCookie( void ) const;
+
+    /**
+     * \brief   Returns true if there is a direct connection with the process of specified cookie.
+     **/
+    inline bool isPeerConnected( const ITEM_ID & cookie ) const;
+
+    /**
+     * \brief   Returns the peer socket of specified handle. The returned object is invalid
+     *          if there is no direct connection with specified socket handle.
+     **/
+    inline SocketAccepted getPeerByHandle( SOCKETHANDLE hSocket ) const;
+
+    /**
+     * \brief   Returns the cookie of the peer of specified socket handle. Returns NEService::COOKIE_UNKNOWN
+     *          if the socket is not connected or the peer did not introduce itself yet.
+     **/
+    inline ITEM_ID getPeerCookie( SOCKETHANDLE hSocket ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the socket to listen direct connections. If the port is busy,
+     *          tries next ports in the range NEConnection::DIRECT_PORT_RANGE, so that
+     *          multiple processes on the same host can use the same configuration.
+     * \param   hostName    The IP-address or the name of the host to bind.
+     * \param   portNr      The first port number to try to bind.
+     * \return  Returns true if succeeded to create the socket and to start listening.
+     **/
+    bool createSocket( const String & hostName, unsigned short portNr );
+
+    /**
+     * \brief   Closes the listening socket and all direct connections.
+     **/
+    void closeSocket( void );
+
+    /**
+     * \brief   Closes all direct connections and clears the endpoints waiting to connect.
+     *          The listening socket remains valid.
+     **/
+    void closePeers( void );
+
+    /**
+     * \brief   Waits for events of the listening socket and of the direct connections.
+     *          The call is blocking until there is an event or the wait is interrupted.
+     * \param   out_events  The list of events to fill on output.
+     * \param   maxEvents   The maximum number of entries in the list.
+     * \return  Returns the number of events in the list. Returns zero if the wait was interrupted.
+     *          Returns negative value if failed.
+     **/
+    int waitForConnectionEvents( SocketPoller::sPollEvent * out_events, int maxEvents );
+
+    /**
+     * \brief   Wakes up the thread waiting for connection events.
+     **/
+    void interrupt( void );
+
+    /**
+     * \brief   Accepts pending direct connection. The connection is closed if the host is not
+     *          the host of any peer announced by the routing service. The accepted connection
+     *          is not bound to any cookie until the peer introduces itself.
+     * \return  Returns true if succeeded to accept connection.
+     **/
+    bool acceptPeer( void );
+
+    /**
+     * \brief   Queues the endpoint of the process of service provider to connect and wakes up the
+     *          thread waiting for connection events. Nothing happens if there is already a direct
+     *          connection with the process of specified cookie.
+     * \param   cookie      The cookie of the process of service provider.
+     * \param   endpoint    The endpoint announced by the process of service provider.
+     * \param   secret      The secret of the pair of processes to introduce via direct connection.
+     **/
+    void queuePeer( const ITEM_ID & cookie, const NESocket::SocketAddress & endpoint, uint64_t secret );
+
+    /**
+     * \brief   Saves the peer announced by the routing service, which is going to connect
+     *          and to introduce itself. Only the announced peers are accepted and bound.
+     * \param   cookie      The cookie of the process of service consumer.
+     * \param   address     The IP-address of the host of service consumer.
+     * \param   secret      The secret of the pair of processes to verify the introduction.
+     **/
+    void announcePeer( const ITEM_ID & cookie, const String & address, uint64_t secret );
+
+    /**
+     * \brief   Connects to the queued endpoints and introduces the process by cookie.
+     *          The call is blocking and should be called by the thread receiving messages
+     *          of direct connections.
+     **/
+    void connectPeers( void );
+
+    /**
+     * \brief   Binds the accepted connection with the cookie of the peer, which introduced itself.
+     *          The peer should be announced by the routing service, the secret and the host
+     *          of the peer should match the announced.
+     * \param   hSocket         The handle of the accepted socket.
+     * \param   msgIntroduce    The introduction message received from the peer.
+     * \return  Returns true if the message introduces the announced peer to this process.
+     **/
+    bool bindPeer( SOCKETHANDLE hSocket, const RemoteMessage & msgIntroduce );
+
+    /**
+     * \brief   Closes the direct connection of specified socket handle. If there is another direct
+     *          connection with the same peer, it is used to send messages.
+     * \param   hSocket     The handle of the socket to close.
+     **/
+    void closePeer( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Sends the executable message via direct connection with the target of the message.
+     *          If failed to send, the direct connection is closed.
+     * \param   in_message  The message to send.
+     * \return  Returns the number of bytes sent. Returns negative value if the message is not
+     *          executable, there is no direct connection with the target or failed to send.
+     **/
+    int sendMessage( const RemoteMessage & in_message );
+
+    /**
+     * \brief   Receives the message from the peer. The call is blocking until the complete
+     *          message is received.
+     * \param   out_message The message object to receive data.
+     * \param   peer        The socket of direct connection to receive message.
+     * \return  Returns the number of bytes received. Returns negative value or zero if failed.
+     **/
+    inline int receiveMessage( RemoteMessage & out_message, const SocketAccepted & peer ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Registers the peer socket in the poller and in the list of direct connections.
+     *          If the cookie is valid and there is no other connection with the peer, the socket
+     *          is used to send messages to the peer.
+     **/
+    bool _registerPeer( const SocketAccepted & peer, const ITEM_ID & cookie );
+
+    /**
+     * \brief   Returns true if the accepted connection is alive and the host is the host of a peer
+     *          announced by the routing service.
+     **/
+    bool _canAcceptPeer( const SocketAccepted & peer ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The socket to listen direct connections.
+     **/
+    SocketServer        mServerSocket;
+    /**
+     * \brief   The cookie of the process assigned by the routing service.
+     **/
+    ITEM_ID             mCookie;
+    /**
+     * \brief   The sockets of direct connections, where the keys are socket handles.
+     **/
+    MapSocketToObject   mPeerSockets;
+    /**
+     * \brief   The sockets to send messages, where the keys are cookies of peers.
+     **/
+    MapCookieToSocket   mCookieToSocket;
+    /**
+     * \brief   The cookies of peers, where the keys are socket handles.
+     **/
+    MapSocketToCookie   mSocketToCookie;
+    /**
+     * \brief   The endpoints of the peers to connect, where the keys are cookies of peers.
+     **/
+    MapCookieToPeer     mPendingPeers;
+    /**
+     * \brief   The peers announced by the routing service to accept, where the keys are cookies of peers.
+     **/
+    MapCookieToPeer     mAnnouncedPeers;
+    /**
+     * \brief   The poller of listening socket and sockets of direct connections.
+     **/
+    SocketPoller        mSocketPoller;
+    /**
+     * \brief   Synchronization object for data sharing.
+     **/
+    mutable ResourceLock    mLock;
+    /**
+     * \brief   Synchronization object to send messages, so that the messages are not interleaved.
+     **/
+    mutable ResourceLock    mSendLock;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( DirectConnection );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// DirectConnection class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool DirectConnection::isValid( void ) const
+{
+    Lock lock( mLock );
+    return mServerSocket.isValid( );
+}
+
+inline SOCKETHANDLE DirectConnection::getSocketHandle( void ) const
+{
+    Lock lock( mLock );
+    return mServerSocket.getHandle( );
+}
+
+inline NESocket::SocketAddress DirectConnection::getAddress( void ) const
+{
+    Lock lock( mLock );
+    return mServerSocket.getAddress( );
+}
+
+inline void DirectConnection::setCookie( const ITEM_ID & cookie )
+{
+    Lock lock( mLock );
+    mCookie = cookie;
+}
+
+inline ITEM_ID DirectConnection::getCookie( void ) const
+{
+    Lock lock( mLock );
+    return mCookie;
+}
+
+inline bool DirectConnection::isPeerConnected( const ITEM_ID & cookie ) const
+{
+    Lock lock( mLock );
+    return mCookieToSocket.contains( cookie );
+}
+
+inline SocketAccepted DirectConnection::getPeerByHandle( SOCKETHANDLE hSocket ) const
+{
+    Lock lock( mLock );
+    MapSocketToObject::MAPPOS pos = mPeerSockets.find( hSocket );
+    return (mPeerSockets.isValidPosition( pos ) ? mPeerSockets.valueAtPosition( pos ) : SocketAccepted( ));
+}
+
+inline ITEM_ID DirectConnection::getPeerCookie( SOCKETHANDLE hSocket ) const
+{
+    Lock lock( mLock );
+    MapSocketToCookie::MAPPOS pos = mSocketToCookie.find( hSocket );
+    return (mSocketToCookie.isValidPosition( pos ) ? mSocketToCookie.valueAtPosition( pos ) : NEService::COOKIE_UNKNOWN);
+}
+
+inline int DirectConnection::receiveMessage( RemoteMessage & out_message, const SocketAccepted & peer ) const
+{
+    return SocketConnectionBase::receiveMessage( out_message, peer );
+}
+
+#endif  // AREG_IPC_PRIVATE_DIRECTCONNECTION_HPP
@@ -0,0 +1,145 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectReceiveThread.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the thread to accept, to establish and to
+ *              receive messages of direct connections.
+ ************************************************************************/
+#include "areg/ipc/private/DirectReceiveThread.hpp"
+
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/IERemoteMessageHandler.hpp"
+#include "areg/ipc/private/DirectConnection.hpp"
+#include "areg/ipc/private/NEConnection.hpp"
+
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_ipc_private_DirectReceiveThread_runDispatcher);
+DEF_TRACE_SCOPE(areg_ipc_private_DirectReceiveThread__receiveMessage);
+
+DirectReceiveThread::DirectReceiveThread( IERemoteMessageHandler & remoteService, DirectConnection & connection, const String & namePrefix )
+    : DispatcherThread  ( namePrefix + NEConnection::CLIENT_DIRECT_MESSAGE_THREAD )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+{
+}
+
+void DirectReceiveThread::triggerExit( void )
+{
+    DispatcherThread::triggerExit( );
+    mConnection.interrupt( );
+}
+
+bool DirectReceiveThread::runDispatcher( void )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectReceiveThread_runDispatcher);
+    TRACE_DBG("Starting dispatcher [ %s ]", getName( ).getString( ));
+
+    readyForEvents( true );
+
+    IESynchObject * syncObjects[2] = { &mEventExit, &mEventQueue };
+    MultiLock multiLock( syncObjects, 2, false );
+    SocketPoller::sPollEvent events[SocketPoller::MAX_POLL_EVENTS];
+    RemoteMessage msgReceived;
+    int whichEvent{ static_cast<int>(EventDispatcherBase::eEventOrder::EventError) };
+    uint32_t retryCount{ 0 };
+
+    do
+    {
+        whichEvent = multiLock.lock( NECommon::DO_NOT_WAIT, false );
+        if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
+
+            // The endpoints are queued by the thread receiving messages of routing service.
+            mConnection.connectPeers( );
+            int count = mConnection.waitForConnectionEvents( events, SocketPoller::MAX_POLL_EVENTS );
+            if ( count < 0 )
+            {
+                TRACE_WARN("Failed to wait direct connection events, going to retry [ %d ] times before exit.", static_cast<int>(RETRY_COUNT - retryCount - 1));
+                if ( ++ retryCount >= RETRY_COUNT )
+                {
+                    whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
+                }
+            }
+            else
+            {
+                retryCount = 0;
+                const SOCKETHANDLE hServer = mConnection.getSocketHandle( );
+                for ( int i = 0; i < count; ++ i )
+                {
+                    const SocketPoller::sPollEvent & entry = events[i];
+                    if ( entry.peSocket == hServer )
+                    {
+                        static_cast<void>(mConnection.acceptPeer( ));
+                    }
+                    else
+                    {
+                        _receiveMessage( entry.peSocket, msgReceived );
+                    }
+                }
+            }
+        }
+        else
+        {
+            Event * eventElem = whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) ? pickEvent( ) : nullptr;
+            whichEvent = isExitEvent( eventElem ) ? static_cast<int>(EventDispatcherBase::eEventOrder::EventExit) : whichEvent;
+        }
+
+    } while ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) );
+
+    readyForEvents( false );
+    removeAllEvents( );
+
+    TRACE_DBG("Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString( ));
+    return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
+}
+
+void DirectReceiveThread::_receiveMessage( SOCKETHANDLE hSocket, RemoteMessage & msgReceived )
+{
+    TRACE_SCOPE(areg_ipc_private_DirectReceiveThread__receiveMessage);
+
+    SocketAccepted peer{ mConnection.getPeerByHandle( hSocket ) };
+    if ( peer.isValid( ) == false )
+    {
+        TRACE_DBG("Ignoring event of closed direct connection socket [ %u ]", static_cast<uint32_t>(hSocket));
+    }
+    else if ( mConnection.receiveMessage( msgReceived, peer ) <= 0 )
+    {
+        TRACE_DBG("Failed to receive message via direct connection socket [ %u ], closing connection", static_cast<uint32_t>(hSocket));
+        mConnection.closePeer( hSocket );
+    }
+    else if ( static_cast<NEService::eFuncIdRange>(msgReceived.getMessageId( )) == NEService::eFuncIdRange::SystemServiceDirectEndpoint )
+    {
+        if ( mConnection.bindPeer( hSocket, msgReceived ) == false )
+        {
+            mConnection.closePeer( hSocket );
+        }
+    }
+    else if ( NEService::isExecutableId( msgReceived.getMessageId( ) ) && (mConnection.getPeerCookie( hSocket ) == msgReceived.getSource( )) )
+    {
+        TRACE_DBG("Received message [ %p ] from source [ %p ] via direct connection socket [ %u ]"
+                    , static_cast<id_type>(msgReceived.getMessageId( ))
+                    , static_cast<id_type>(msgReceived.getSource( ))
+                    , static_cast<uint32_t>(hSocket));
+
+        mRemoteService.processReceivedMessage( msgReceived, peer );
+    }
+    else
+    {
+        TRACE_WARN("Ignoring message [ %p ] of source [ %p ] via direct connection socket [ %u ], the peer is not introduced"
+                    , static_cast<id_type>(msgReceived.getMessageId( ))
+                    , static_cast<id_type>(msgReceived.getSource( ))
+                    , static_cast<uint32_t>(hSocket));
+    }
+
+    msgReceived.invalidate( );
+}
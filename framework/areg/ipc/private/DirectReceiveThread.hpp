@@ -0,0 +1,123 @@
+#ifndef AREG_IPC_PRIVATE_DIRECTRECEIVETHREAD_HPP
+#define AREG_IPC_PRIVATE_DIRECTRECEIVETHREAD_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/DirectReceiveThread.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the thread to accept, to establish and to
+ *              receive messages of direct connections.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/component/DispatcherThread.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class DirectConnection;
+class IERemoteMessageHandler;
+class RemoteMessage;
+
+//////////////////////////////////////////////////////////////////////////
+// DirectReceiveThread class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The thread of direct connections between the processes of service
+ *          providers and service consumers. The thread accepts the connections of
+ *          peers, connects to the queued endpoints and receives the messages.
+ *          The received service messages are passed to the remote service handler
+ *          in the same way as the messages received via routing service.
+ *          The failures of direct connections are handled in the thread and do not
+ *          affect the connection with the routing service.
+ **/
+class DirectReceiveThread   : public    DispatcherThread
+{
+    //!< The number of attempts to wait for events before the thread exits.
+    static constexpr uint32_t   RETRY_COUNT { 5 };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the remote servicing handler and the direct connection objects.
+     * \param   remoteService   The instance of remote service to process messages.
+     * \param   connection      The instance of direct connection object.
+     * \param   namePrefix      The prefix to add to the NEConnection::CLIENT_DIRECT_MESSAGE_THREAD
+     *                          to have unique thread names.
+     **/
+    DirectReceiveThread( IERemoteMessageHandler & remoteService, DirectConnection & connection, const String & namePrefix );
+
+    /**
+     * \brief   Destructor.
+     **/
+    virtual ~DirectReceiveThread( void ) = default;
+
+/************************************************************************/
+// Actions and attributes.
+/************************************************************************/
+public:
+    /**
+     * \brief   Sets exit event in the queue and wakes up the thread waiting for connection events.
+     **/
+    virtual void triggerExit( void ) override;
+
+protected:
+/************************************************************************/
+// DispatcherThread overrides
+/************************************************************************/
+
+    /**
+     * \brief	Triggered when dispatcher starts running.
+     *          In this function runs main dispatching loop.
+     *          Events are picked and dispatched here.
+     *          Override if logic should be changed.
+     * \return	Returns true if Exit Event is signaled.
+     **/
+    virtual bool runDispatcher( void ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Receives and processes the message of direct connection.
+     *          Closes the direct connection if failed to receive.
+     * \param   hSocket     The handle of the socket, which has data to read.
+     * \param   msgReceived The message object to receive data.
+     **/
+    void _receiveMessage( SOCKETHANDLE hSocket, RemoteMessage & msgReceived );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The instance of remote service handler to dispatch messages.
+     **/
+    IERemoteMessageHandler &    mRemoteService;
+    /**
+     * \brief   The instance of direct connection object.
+     **/
+    DirectConnection &          mConnection;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DirectReceiveThread( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( DirectReceiveThread );
+};
+
+#endif  // AREG_IPC_PRIVATE_DIRECTRECEIVETHREAD_HPP
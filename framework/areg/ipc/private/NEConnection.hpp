@@ -47,6 +47,11 @@ namespace NEConnection
      *          Fixed name of client message dispatcher thread
      **/
     constexpr std::string_view  CLIENT_DISPATCH_MESSAGE_THREAD  { "CLIENT_DISPATCH_MESSAGE_THREAD" };
+    /**
+     * \brief   NEConnection::CLIENT_DIRECT_MESSAGE_THREAD
+     *          Fixed name of client thread accepting direct connections and receiving messages of direct connections
+     **/
+    constexpr std::string_view  CLIENT_DIRECT_MESSAGE_THREAD    { "CLIENT_DIRECT_MESSAGE_THREAD" };
     /**
      * \brief   NEConnection::SERVER_SEND_MESSAGE_THREAD
      *          Fixed name of server message sender thread
@@ -62,6 +67,11 @@ namespace NEConnection
      *          Fixed name of server message dispatcher thread
      **/
     constexpr std::string_view  SERVER_DISPATCH_MESSAGE_THREAD  { "SERVER_DISPATCH_MESSAGE_THREAD" };
+    /**
+     * \brief   NEConnection::SERVER_SHARED_MEMORY_THREAD
+     *          Fixed name of server thread receiving messages via shared memory
+     **/
+    constexpr std::string_view  SERVER_SHARED_MEMORY_THREAD     { "SERVER_SHARED_MEMORY_THREAD" };
     /**
      * \brief   NEConnection::CLIENT_CONNECT_TIMER_NAME
      *          Fixed name of client connection retry timer name
@@ -77,6 +87,18 @@ namespace NEConnection
      *          Default connect retry timer timeout value in milliseconds
      **/
     constexpr unsigned int      DEFAULT_RETRY_CONNECT_TIMEOUT   { NECommon::TIMEOUT_500_MS };  // 500 ms
+    /**
+     * \brief   NEConnection::DIRECT_PORT_RANGE
+     *          The number of ports, starting from configured port, to try to listen for direct connections.
+     *          Each process on the same host listens on its own port.
+     **/
+    constexpr unsigned short    DIRECT_PORT_RANGE               { 64u };
+    /**
+     * \brief   NEConnection::DIRECT_ANY_ADDRESS
+     *          The address to listen direct connections on all network interfaces.
+     *          In this case the address of the connection with routing service is announced.
+     **/
+    constexpr std::string_view  DIRECT_ANY_ADDRESS              { "0.0.0.0" };
 }
 
 #endif  // AREG_IPC_NECONNECTION_HPP
@@ -262,6 +262,31 @@ AREG_API_IMPL const NEMemory::sRemoteMessage & NERemoteService::getMessageRegist
     return _messageRegisterNotify;
 }
 
+AREG_API_IMPL const NEMemory::sRemoteMessage & NERemoteService::getMessageDirectEndpoint( void )
+{
+    static constexpr NEMemory::sRemoteMessage _messageDirectEndpoint
+    {
+        {
+            {   /*rbhBufHeader*/
+                  sizeof(NEMemory::sRemoteMessage)          // biBufSize
+                , sizeof(unsigned char)                     // biLength
+                , sizeof(NEMemory::sRemoteMessageHeader)    // biOffset
+                , NEMemory::eBufferType::BufferRemote       // biBufType
+                , 0                                         // biUsed
+            }
+            , NEService::COOKIE_ROUTER                      // rbhTarget
+            , NEMemory::INVALID_VALUE                       // rbhChecksum
+            , NEMemory::INVALID_VALUE                       // rbhSource
+            , static_cast<uint32_t>(NEService::eFuncIdRange::SystemServiceDirectEndpoint)   // rbhMessageId
+            , NEMemory::MESSAGE_SUCCESS                     // rbhResult
+            , NEService::SEQUENCE_NUMBER_NOTIFY             // rbhSequenceNr
+        }
+        , {static_cast<char>(0)}
+    };
+
+    return _messageDirectEndpoint;
+}
+
 AREG_API_IMPL RemoteMessage NERemoteService::createRouterRegisterService( const StubAddress & stub, const ITEM_ID & source, const ITEM_ID & target)
 {
     RemoteMessage msgResult;
@@ -435,6 +460,21 @@ AREG_API_IMPL RemoteMessage NERemoteService::createServiceClientUnregisteredNoti
     return msgResult;
 }
 
+AREG_API_IMPL RemoteMessage NERemoteService::createDirectEndpoint( const String & address, unsigned short portNr, uint64_t secret, const ITEM_ID & source, const ITEM_ID & target )
+{
+    RemoteMessage msgEndpoint;
+    if ( _isValidSource(source) && (msgEndpoint.initMessage( NERemoteService::getMessageDirectEndpoint().rbHeader ) != nullptr) )
+    {
+        msgEndpoint.setSource(source);
+        msgEndpoint.setTarget(target);
+        msgEndpoint << address;
+        msgEndpoint << portNr;
+        msgEndpoint << secret;
+    }
+
+    return msgEndpoint;
+}
+
 AREG_API_IMPL RemoteMessage NERemoteService::createConnectRequest(const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource)
 {
     RemoteMessage msgHelloServer;
@@ -0,0 +1,278 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/NESharedMemory.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the ring buffers of the shared memory segment.
+ ************************************************************************/
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+#include "areg/base/NEMemory.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+
+namespace NESharedMemory
+{
+/************************************************************************/
+// Declaration of OS specific methods
+/************************************************************************/
+
+    /**
+     * \brief   Returns true if the shared memory segments and waiting on the shared words are supported.
+     **/
+    extern bool _osIsSupported( void );
+
+    /**
+     * \brief   Creates and maps the named shared memory segment of specified size filled with zeros.
+     **/
+    extern void * _osCreateSegment( const char * name, uint32_t size );
+
+    /**
+     * \brief   Opens and maps the existing named shared memory segment of specified size.
+     **/
+    extern void * _osOpenSegment( const char * name, uint32_t size );
+
+    /**
+     * \brief   Unmaps the shared memory segment.
+     **/
+    extern void _osCloseSegment( void * segment, uint32_t size );
+
+    /**
+     * \brief   Removes the name of the shared memory segment.
+     **/
+    extern void _osDeleteSegment( const char * name );
+
+    /**
+     * \brief   Sleeps while the 32-bit word is equal to expected value, until waked up or timeout expires.
+     **/
+    extern void _osWaitWord( std::atomic<uint32_t> & word, uint32_t expected, unsigned int msTimeout );
+
+    /**
+     * \brief   Wakes up all processes sleeping on the 32-bit word.
+     **/
+    extern void _osWakeWord( std::atomic<uint32_t> & word );
+
+    /**
+     * \brief   Returns true if the process with specified ID exists.
+     **/
+    extern bool _osIsProcessAlive( uint32_t processId );
+}
+
+String NESharedMemory::getSegmentName( const String & service, unsigned short portNr )
+{
+    String result( NESharedMemory::SEGMENT_PREFIX );
+    result += service;
+    result += "_";
+    result += String::makeString( static_cast<uint32_t>(portNr) );
+    return result;
+}
+
+uint32_t NESharedMemory::writeRing( NESharedMemory::sRingBuffer & ring, unsigned char * data, const unsigned char * buffer, uint32_t length )
+{
+    constexpr uint32_t mask{ NESharedMemory::RING_SIZE - 1u };
+
+    // Only the producer changes the head, only the consumer changes the tail.
+    const uint32_t head { ring.rbHead.load( std::memory_order_relaxed ) };
+    const uint32_t tail { ring.rbTail.load( std::memory_order_acquire ) };
+    const uint32_t used { head - tail };
+    // The tail is written by other process, never write out of the data area of the ring.
+    const uint32_t space{ used <= NESharedMemory::RING_SIZE ? NESharedMemory::RING_SIZE - used : 0u };
+    const uint32_t result{ MACRO_MIN( length, space ) };
+    if ( result != 0u )
+    {
+        const uint32_t pos  { head & mask };
+        const uint32_t first{ MACRO_MIN( result, NESharedMemory::RING_SIZE - pos ) };
+        NEMemory::memCopy( data + pos, first, buffer, first );
+        NEMemory::memCopy( data, result - first, buffer + first, result - first );
+        ring.rbHead.store( head + result, std::memory_order_release );
+    }
+
+    return result;
+}
+
+int NESharedMemory::readRing( NESharedMemory::sRingBuffer & ring, const unsigned char * data, RemoteMessageDecoder & decoder )
+{
+    constexpr uint32_t mask{ NESharedMemory::RING_SIZE - 1u };
+
+    const uint32_t head { ring.rbHead.load( std::memory_order_acquire ) };
+    uint32_t tail       { ring.rbTail.load( std::memory_order_relaxed ) };
+    uint32_t available  { head - tail };
+    int result{ 0 };
+
+    if ( available > NESharedMemory::RING_SIZE )
+    {
+        // The head is written by other process, which either crashed or is not trusted anymore.
+        result    = -1;
+        available = 0u;
+    }
+
+    while ( available != 0u )
+    {
+        const uint32_t pos  { tail & mask };
+        const uint32_t chunk{ MACRO_MIN( available, NESharedMemory::RING_SIZE - pos ) };
+        const int copied{ decoder.writeData( data + pos, chunk ) };
+        if ( copied < 0 )
+        {
+            result = -1;
+            break;
+        }
+        else if ( copied == 0 )
+        {
+            // The decoder is full, the messages should be extracted first.
+            break;
+        }
+
+        tail      += static_cast<uint32_t>(copied);
+        available -= static_cast<uint32_t>(copied);
+        result    += copied;
+    }
+
+    if ( result > 0 )
+    {
+        ring.rbTail.store( tail, std::memory_order_release );
+    }
+
+    return result;
+}
+
+void NESharedMemory::resetRing( NESharedMemory::sRingBuffer & ring )
+{
+    ring.rbHead.store( 0u, std::memory_order_relaxed );
+    ring.rbTail.store( 0u, std::memory_order_relaxed );
+    ring.rbReaderWaits.store( 0u, std::memory_order_relaxed );
+    ring.rbWriterWaits.store( 0u, std::memory_order_relaxed );
+}
+
+void NESharedMemory::notifyReader( NESharedMemory::sRingBuffer & ring )
+{
+    // Pairs with the fence of the consumer in waitReadable(), either the consumer sees new head or the producer sees the flag.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( ring.rbReaderWaits.load( std::memory_order_relaxed ) != 0u )
+    {
+        _osWakeWord( ring.rbHead );
+    }
+}
+
+bool NESharedMemory::notifyWriter( NESharedMemory::sRingBuffer & ring )
+{
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    const bool result{ ring.rbWriterWaits.load( std::memory_order_relaxed ) != 0u };
+    if ( result )
+    {
+        _osWakeWord( ring.rbTail );
+    }
+
+    return result;
+}
+
+bool NESharedMemory::requestWritable( NESharedMemory::sRingBuffer & ring )
+{
+    // Pairs with the fence of the consumer in notifyWriter(), either the producer sees new tail or the consumer sees the flag.
+    ring.rbWriterWaits.store( 1u, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    return (NESharedMemory::hasSpace( ring ) == false);
+}
+
+bool NESharedMemory::waitReadable( NESharedMemory::sRingBuffer & ring, unsigned int msTimeout )
+{
+    const uint32_t tail{ ring.rbTail.load( std::memory_order_relaxed ) };
+    ring.rbReaderWaits.store( 1u, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    const uint32_t head{ ring.rbHead.load( std::memory_order_acquire ) };
+    if ( head == tail )
+    {
+        _osWaitWord( ring.rbHead, head, msTimeout );
+    }
+
+    ring.rbReaderWaits.store( 0u, std::memory_order_relaxed );
+    return (ring.rbHead.load( std::memory_order_acquire ) != tail);
+}
+
+bool NESharedMemory::waitWritable( NESharedMemory::sRingBuffer & ring, unsigned int msTimeout )
+{
+    const uint32_t head{ ring.rbHead.load( std::memory_order_relaxed ) };
+    ring.rbWriterWaits.store( 1u, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    const uint32_t tail{ ring.rbTail.load( std::memory_order_acquire ) };
+    if ( (head - tail) == NESharedMemory::RING_SIZE )
+    {
+        _osWaitWord( ring.rbTail, tail, msTimeout );
+    }
+
+    ring.rbWriterWaits.store( 0u, std::memory_order_relaxed );
+    return ((head - ring.rbTail.load( std::memory_order_acquire )) != NESharedMemory::RING_SIZE);
+}
+
+void NESharedMemory::ringDoorbell( NESharedMemory::sSegmentHeader & segment )
+{
+    segment.shDoorbell.fetch_add( 1u, std::memory_order_seq_cst );
+    if ( segment.shServerWaits.load( std::memory_order_seq_cst ) != 0u )
+    {
+        _osWakeWord( segment.shDoorbell );
+    }
+}
+
+void NESharedMemory::waitDoorbell( NESharedMemory::sSegmentHeader & segment, uint32_t doorbell, unsigned int msTimeout )
+{
+    segment.shServerWaits.store( 1u, std::memory_order_seq_cst );
+    if ( segment.shDoorbell.load( std::memory_order_seq_cst ) == doorbell )
+    {
+        _osWaitWord( segment.shDoorbell, doorbell, msTimeout );
+    }
+
+    segment.shServerWaits.store( 0u, std::memory_order_relaxed );
+}
+
+bool NESharedMemory::isSupported( void )
+{
+    return _osIsSupported( );
+}
+
+void * NESharedMemory::createSegment( const String & name, uint32_t size )
+{
+    return (name.isEmpty( ) == false) && (size != 0u) ? _osCreateSegment( name.getString( ), size ) : nullptr;
+}
+
+void * NESharedMemory::openSegment( const String & name, uint32_t size )
+{
+    return (name.isEmpty( ) == false) && (size != 0u) ? _osOpenSegment( name.getString( ), size ) : nullptr;
+}
+
+void NESharedMemory::closeSegment( void * segment, uint32_t size )
+{
+    if ( segment != nullptr )
+    {
+        _osCloseSegment( segment, size );
+    }
+}
+
+void NESharedMemory::deleteSegment( const String & name )
+{
+    if ( name.isEmpty( ) == false )
+    {
+        _osDeleteSegment( name.getString( ) );
+    }
+}
+
+void NESharedMemory::waitWord( std::atomic<uint32_t> & word, uint32_t expected, unsigned int msTimeout )
+{
+    _osWaitWord( word, expected, msTimeout );
+}
+
+void NESharedMemory::wakeWord( std::atomic<uint32_t> & word )
+{
+    _osWakeWord( word );
+}
+
+bool NESharedMemory::isProcessAlive( uint32_t processId )
+{
+    return _osIsProcessAlive( processId );
+}
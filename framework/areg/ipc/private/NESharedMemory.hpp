@@ -0,0 +1,399 @@
+#ifndef AREG_IPC_PRIVATE_NESHAREDMEMORY_HPP
+#define AREG_IPC_PRIVATE_NESHAREDMEMORY_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/NESharedMemory.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the layout of the shared memory segment
+ *              to exchange remote messages between processes of the same host.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NECommon.hpp"
+#include "areg/base/String.hpp"
+
+#include <atomic>
+#include <string_view>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessageDecoder;
+
+//////////////////////////////////////////////////////////////////////////
+// NESharedMemory namespace declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The shared memory segment is created by the server of the remote
+ *          service (for example, message router) and is opened by the clients
+ *          that run on the same host. The segment contains a fixed number of
+ *          slots, each slot is owned by a single client and has two single
+ *          producer, single consumer ring buffers: one to send data from client
+ *          to the server and one to send data from server to the client.
+ *          The data in the rings have the same framing as remote messages sent
+ *          via socket. The client still keeps the TCP/IP connection with the
+ *          server, which is used to bind the slot with the connection, to detect
+ *          the disconnection and as a fallback if the shared memory is not available.
+ *
+ *          The waiting sides sleep on the 32-bit words of the segment, which are
+ *          the futex words on Linux. The server waits on a single doorbell word,
+ *          which is changed by the clients on every write, the client waits on
+ *          the head of the ring of the server.
+ *
+ *          The segment is created with 0660 permissions, which are the only
+ *          protection of the slots. Every process of the same user or group
+ *          can claim a slot, read and inject the messages.
+ **/
+namespace NESharedMemory
+{
+    /**
+     * \brief   NESharedMemory::SEGMENT_MAGIC
+     *          The magic number to validate the shared memory segment.
+     **/
+    constexpr uint32_t      SEGMENT_MAGIC       { 0x41524753u };    // "AREGS"
+
+    /**
+     * \brief   NESharedMemory::SEGMENT_VERSION
+     *          The version of the layout of the shared memory segment.
+     **/
+    constexpr uint32_t      SEGMENT_VERSION     { 1u };
+
+    /**
+     * \brief   NESharedMemory::SLOT_COUNT
+     *          The maximum number of clients that can communicate via shared memory.
+     *          The other clients use the TCP/IP connection.
+     **/
+    constexpr uint32_t      SLOT_COUNT          { 64u };
+
+    /**
+     * \brief   NESharedMemory::RING_SIZE
+     *          The size in bytes of a single ring buffer. Must be power of 2.
+     *          The messages bigger than the ring are streamed.
+     **/
+    constexpr uint32_t      RING_SIZE           { 256u * 1024u };
+
+    /**
+     * \brief   NESharedMemory::SPIN_COUNT
+     *          The number of attempts to check the ring before the waiting side sleeps.
+     **/
+    constexpr uint32_t      SPIN_COUNT          { 256u };
+
+    /**
+     * \brief   NESharedMemory::WAIT_SLICE
+     *          The timeout in milliseconds of a single sleep, after which the waiting
+     *          side checks whether the other side and the connection are still alive.
+     **/
+    constexpr unsigned int  WAIT_SLICE          { 100u };
+
+    /**
+     * \brief   NESharedMemory::BIND_TIMEOUT
+     *          The timeout in milliseconds to wait for the server to bind the slot claimed by the client.
+     **/
+    constexpr unsigned int  BIND_TIMEOUT        { 500u };
+
+    /**
+     * \brief   NESharedMemory::SEND_TIMEOUT
+     *          The timeout in milliseconds to wait for the space in the ring when sending data.
+     *          If the reader does not free the space, the connection is considered as lost.
+     **/
+    constexpr unsigned int  SEND_TIMEOUT        { NECommon::TIMEOUT_1_SEC * 5 };
+
+    /**
+     * \brief   NESharedMemory::SEGMENT_PREFIX
+     *          The prefix of the name of the shared memory segment.
+     **/
+    constexpr std::string_view  SEGMENT_PREFIX  { "/areg_" };
+
+    /**
+     * \brief   NESharedMemory::eSlotState
+     *          The states of the slot of a client.
+     **/
+    typedef enum class E_SlotState : uint32_t
+    {
+          SlotFree          = 0 //!< The slot is free and can be claimed by a client.
+        , SlotClaimed       = 1 //!< The slot is claimed by a client and waits to be bound by the server.
+        , SlotBound         = 2 //!< The slot is bound with the client connection, the data is exchanged.
+        , SlotClientClosed  = 3 //!< The client closed the slot, the server should free it.
+        , SlotServerClosed  = 4 //!< The server closed the slot, the client should acknowledge.
+    } eSlotState;
+
+    /**
+     * \brief   NESharedMemory::sRingBuffer
+     *          The control block of a single producer, single consumer ring buffer.
+     *          The head and tail are free running counters of written and read bytes.
+     *          The data of the ring is located in the data area of the segment.
+     **/
+    struct sRingBuffer
+    {
+        //!< The number of bytes written by the producer, the futex word of the waiting consumer.
+        alignas(64) std::atomic<uint32_t>   rbHead;
+        //!< The flag, indicating that the consumer sleeps.
+        std::atomic<uint32_t>               rbReaderWaits;
+        //!< The number of bytes read by the consumer, the futex word of the waiting producer.
+        alignas(64) std::atomic<uint32_t>   rbTail;
+        //!< The flag, indicating that the producer sleeps.
+        std::atomic<uint32_t>               rbWriterWaits;
+    };
+
+    /**
+     * \brief   NESharedMemory::sSlot
+     *          The slot of a single client.
+     **/
+    struct sSlot
+    {
+        //!< The state of the slot, one of eSlotState values. The futex word of the client waiting to bind.
+        alignas(64) std::atomic<uint32_t>   slState;
+        //!< The generation of the slot, incremented on every claim.
+        std::atomic<uint32_t>               slGeneration;
+        //!< The ID of the client process.
+        std::atomic<uint32_t>               slProcess;
+        //!< The IPv4 address of the client socket in network byte order.
+        std::atomic<uint32_t>               slAddress;
+        //!< The port number of the client socket.
+        std::atomic<uint32_t>               slPort;
+        //!< The ring to send data from client to server.
+        sRingBuffer                         slClientRing;
+        //!< The ring to send data from server to client.
+        sRingBuffer                         slServerRing;
+    };
+
+    /**
+     * \brief   NESharedMemory::sSegmentHeader
+     *          The header of the shared memory segment followed by the data area of the rings.
+     **/
+    struct sSegmentHeader
+    {
+        //!< The magic number of the segment.
+        uint32_t                            shMagic;
+        //!< The version of the layout.
+        uint32_t                            shVersion;
+        //!< The number of slots in the segment.
+        uint32_t                            shSlotCount;
+        //!< The size of a single ring.
+        uint32_t                            shRingSize;
+        //!< The ID of the server process.
+        std::atomic<uint32_t>               shProcess;
+        //!< The flag, indicating whether the server is running.
+        std::atomic<uint32_t>               shRunning;
+        //!< The doorbell of the server, changed by the clients on every write. The futex word of the server.
+        alignas(64) std::atomic<uint32_t>   shDoorbell;
+        //!< The flag, indicating that the server sleeps.
+        std::atomic<uint32_t>               shServerWaits;
+        //!< The slots of the clients.
+        sSlot                               shSlots[SLOT_COUNT];
+    };
+
+    /**
+     * \brief   NESharedMemory::DATA_OFFSET
+     *          The offset of the data area of the rings in the segment, aligned to the page.
+     **/
+    constexpr uint32_t      DATA_OFFSET         { ((sizeof(sSegmentHeader) + 4095u) / 4096u) * 4096u };
+
+    /**
+     * \brief   NESharedMemory::SEGMENT_SIZE
+     *          The total size of the shared memory segment.
+     **/
+    constexpr uint32_t      SEGMENT_SIZE        { DATA_OFFSET + 2u * SLOT_COUNT * RING_SIZE };
+
+    static_assert((RING_SIZE & (RING_SIZE - 1u)) == 0u, "The size of the ring must be power of 2");
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The atomic words must have the size of the futex word");
+
+    /**
+     * \brief   Returns the name of the shared memory segment of the remote service.
+     * \param   service     The name of the remote service like "router".
+     * \param   portNr      The TCP/IP port number of the remote service.
+     **/
+    AREG_API String getSegmentName( const String & service, unsigned short portNr );
+
+    /**
+     * \brief   Returns the pointer to the data of the ring in the segment.
+     * \param   segment     The segment header.
+     * \param   slot        The index of the slot.
+     * \param   clientRing  If true, returns the data of the ring to send data from client to server.
+     **/
+    inline unsigned char * getRingData( sSegmentHeader & segment, uint32_t slot, bool clientRing );
+
+    /**
+     * \brief   Writes the data in the ring without blocking.
+     * \param   ring    The control block of the ring.
+     * \param   data    The data area of the ring.
+     * \param   buffer  The buffer with data to write.
+     * \param   length  The length in bytes of the data to write.
+     * \return  Returns number of bytes written, which is limited by the free space in the ring.
+     *          Returns zero if the ring is corrupted, i.e. the consumer moved the tail ahead of the head.
+     **/
+    AREG_API uint32_t writeRing( sRingBuffer & ring, unsigned char * data, const unsigned char * buffer, uint32_t length );
+
+    /**
+     * \brief   Moves available data of the ring into the decoder without blocking.
+     * \param   ring    The control block of the ring.
+     * \param   data    The data area of the ring.
+     * \param   decoder The decoder of remote messages to copy data.
+     * \return  Returns the number of bytes moved. Returns negative value if the decoder failed,
+     *          or the ring is corrupted, i.e. the producer moved the head more than the size of the ring
+     *          ahead of the tail. The other side of the ring cannot be trusted and the slot should be closed.
+     **/
+    AREG_API int readRing( sRingBuffer & ring, const unsigned char * data, RemoteMessageDecoder & decoder );
+
+    /**
+     * \brief   Resets the ring buffer. Should be called only when neither producer nor consumer use the ring.
+     **/
+    AREG_API void resetRing( sRingBuffer & ring );
+
+    /**
+     * \brief   Returns true if the ring has data to read.
+     **/
+    inline bool hasData( const sRingBuffer & ring );
+
+    /**
+     * \brief   Returns true if the head and the tail of the ring are consistent,
+     *          i.e. the ring does not contain more data than its size.
+     **/
+    inline bool isRingValid( const sRingBuffer & ring );
+
+    /**
+     * \brief   Called by the producer after writing data to wake up the sleeping consumer.
+     **/
+    AREG_API void notifyReader( sRingBuffer & ring );
+
+    /**
+     * \brief   Called by the consumer after reading data to wake up the sleeping producer.
+     * \return  Returns true if the producer waits for free space in the ring.
+     **/
+    AREG_API bool notifyWriter( sRingBuffer & ring );
+
+    /**
+     * \brief   Called by the producer, which does not sleep, when the ring is full.
+     *          Sets the flag, so that the consumer notifies when it reads data.
+     * \param   ring    The control block of the ring.
+     * \return  Returns true if the ring is still full. Returns false if the consumer
+     *          has freed space meanwhile and the producer can continue writing.
+     **/
+    AREG_API bool requestWritable( sRingBuffer & ring );
+
+    /**
+     * \brief   Returns true if the ring has free space to write.
+     **/
+    inline bool hasSpace( const sRingBuffer & ring );
+
+    /**
+     * \brief   Called by the consumer to sleep until the ring has data or the timeout expires.
+     * \param   ring        The control block of the ring.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     * \return  Returns true if the ring has data to read.
+     **/
+    AREG_API bool waitReadable( sRingBuffer & ring, unsigned int msTimeout );
+
+    /**
+     * \brief   Called by the producer to sleep until the ring has free space or the timeout expires.
+     * \param   ring        The control block of the ring.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     * \return  Returns true if the ring has free space to write.
+     **/
+    AREG_API bool waitWritable( sRingBuffer & ring, unsigned int msTimeout );
+
+    /**
+     * \brief   Called by the clients to notify the server about the changes in the slots.
+     **/
+    AREG_API void ringDoorbell( sSegmentHeader & segment );
+
+    /**
+     * \brief   Called by the server to sleep until the doorbell changes or the timeout expires.
+     * \param   segment     The segment header.
+     * \param   doorbell    The value of the doorbell observed before the server checked the slots.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     **/
+    AREG_API void waitDoorbell( sSegmentHeader & segment, uint32_t doorbell, unsigned int msTimeout );
+
+    /**
+     * \brief   Returns true if the shared memory is supported by the platform.
+     **/
+    AREG_API bool isSupported( void );
+
+    /**
+     * \brief   Creates the shared memory segment of specified size, the memory is filled with zeros.
+     *          If the segment with the same name exists, it is removed.
+     * \param   name    The name of the segment.
+     * \param   size    The size of the segment in bytes.
+     * \return  Returns the address of the mapped segment or nullptr if failed.
+     **/
+    AREG_API void * createSegment( const String & name, uint32_t size );
+
+    /**
+     * \brief   Opens the existing shared memory segment.
+     * \param   name    The name of the segment.
+     * \param   size    The expected size of the segment in bytes.
+     * \return  Returns the address of the mapped segment or nullptr if failed.
+     **/
+    AREG_API void * openSegment( const String & name, uint32_t size );
+
+    /**
+     * \brief   Unmaps the shared memory segment.
+     * \param   segment The address of the mapped segment.
+     * \param   size    The size of the segment in bytes.
+     **/
+    AREG_API void closeSegment( void * segment, uint32_t size );
+
+    /**
+     * \brief   Removes the name of the shared memory segment. The processes, which mapped
+     *          the segment, can continue using it until unmapped.
+     * \param   name    The name of the segment.
+     **/
+    AREG_API void deleteSegment( const String & name );
+
+    /**
+     * \brief   Sleeps if the value of the word is equal to expected value until the word is waked up or timeout expires.
+     * \param   word        The 32-bit word in the shared memory to wait.
+     * \param   expected    The expected value of the word.
+     * \param   msTimeout   The timeout in milliseconds to wait.
+     **/
+    AREG_API void waitWord( std::atomic<uint32_t> & word, uint32_t expected, unsigned int msTimeout );
+
+    /**
+     * \brief   Wakes up all processes sleeping on the word.
+     * \param   word        The 32-bit word in the shared memory to wake up.
+     **/
+    AREG_API void wakeWord( std::atomic<uint32_t> & word );
+
+    /**
+     * \brief   Returns true if the process with specified ID exists.
+     **/
+    AREG_API bool isProcessAlive( uint32_t processId );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NESharedMemory namespace inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline unsigned char * NESharedMemory::getRingData( NESharedMemory::sSegmentHeader & segment, uint32_t slot, bool clientRing )
+{
+    return reinterpret_cast<unsigned char *>(&segment) + NESharedMemory::DATA_OFFSET + (2u * slot + (clientRing ? 0u : 1u)) * NESharedMemory::RING_SIZE;
+}
+
+inline bool NESharedMemory::hasData( const NESharedMemory::sRingBuffer & ring )
+{
+    return (ring.rbHead.load( std::memory_order_acquire ) != ring.rbTail.load( std::memory_order_relaxed ));
+}
+
+inline bool NESharedMemory::hasSpace( const NESharedMemory::sRingBuffer & ring )
+{
+    return ((ring.rbHead.load( std::memory_order_relaxed ) - ring.rbTail.load( std::memory_order_acquire )) < NESharedMemory::RING_SIZE);
+}
+
+inline bool NESharedMemory::isRingValid( const NESharedMemory::sRingBuffer & ring )
+{
+    return ((ring.rbHead.load( std::memory_order_acquire ) - ring.rbTail.load( std::memory_order_acquire )) <= NESharedMemory::RING_SIZE);
+}
+
+#endif  // AREG_IPC_PRIVATE_NESHAREDMEMORY_HPP
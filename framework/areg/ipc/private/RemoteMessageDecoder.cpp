@@ -0,0 +1,310 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/RemoteMessageDecoder.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, incremental decoder of remote messages
+ *              received from the socket connection.
+ ************************************************************************/
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+
+#include "areg/base/GEMacros.h"
+#include "areg/base/Socket.hpp"
+
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageDecoder class implementation
+//////////////////////////////////////////////////////////////////////////
+
+RemoteMessageDecoder::RemoteMessageDecoder( uint32_t bufferSize /*= RemoteMessageDecoder::DEFAULT_BUFFER_SIZE*/ )
+    : mBuffer       ( nullptr )
+    , mCapacity     ( MACRO_MAX(bufferSize, static_cast<uint32_t>(sizeof(NEMemory::sRemoteMessageHeader))) )
+    , mHead         ( 0u )
+    , mSize         ( 0u )
+    , mState        ( eDecodeState::DecodeHeader )
+    , mHeader       ( )
+    , mHeaderRead   ( 0u )
+    , mMessage      ( )
+    , mData         ( nullptr )
+    , mDataLength   ( 0u )
+    , mDataSpace    ( 0u )
+    , mDataRead     ( 0u )
+{
+}
+
+RemoteMessageDecoder::RemoteMessageDecoder( RemoteMessageDecoder && src ) noexcept
+    : mBuffer       ( src.mBuffer )
+    , mCapacity     ( src.mCapacity )
+    , mHead         ( src.mHead )
+    , mSize         ( src.mSize )
+    , mState        ( src.mState )
+    , mHeader       ( src.mHeader )
+    , mHeaderRead   ( src.mHeaderRead )
+    , mMessage      ( std::move(src.mMessage) )
+    , mData         ( src.mData )
+    , mDataLength   ( src.mDataLength )
+    , mDataSpace    ( src.mDataSpace )
+    , mDataRead     ( src.mDataRead )
+{
+    src.mBuffer = nullptr;
+    src.mData   = nullptr;
+    src.reset();
+}
+
+RemoteMessageDecoder::~RemoteMessageDecoder( void )
+{
+    delete [] mBuffer;
+    mBuffer = nullptr;
+}
+
+RemoteMessageDecoder & RemoteMessageDecoder::operator = ( RemoteMessageDecoder && src ) noexcept
+{
+    if ( this != &src )
+    {
+        delete [] mBuffer;
+
+        mBuffer     = src.mBuffer;
+        mCapacity   = src.mCapacity;
+        mHead       = src.mHead;
+        mSize       = src.mSize;
+        mState      = src.mState;
+        mHeader     = src.mHeader;
+        mHeaderRead = src.mHeaderRead;
+        mMessage    = std::move(src.mMessage);
+        mData       = src.mData;
+        mDataLength = src.mDataLength;
+        mDataSpace  = src.mDataSpace;
+        mDataRead   = src.mDataRead;
+
+        src.mBuffer = nullptr;
+        src.mData   = nullptr;
+        src.reset();
+    }
+
+    return (*this);
+}
+
+int RemoteMessageDecoder::readSocket( const Socket & socket )
+{
+    if ( mState == eDecodeState::DecodeFailed )
+        return -1;
+
+    int result{ 0 };
+    if ( (mState == eDecodeState::DecodeData) && (mSize == 0u) && (mDataRead < mDataSpace) )
+    {
+        // Nothing is buffered, receive directly into the message to avoid extra copying.
+        result = socket.receiveAvailable(mData + mDataRead, static_cast<int>(mDataSpace - mDataRead));
+        mDataRead += result > 0 ? static_cast<uint32_t>(result) : 0u;
+    }
+    else
+    {
+        if ( mBuffer == nullptr )
+        {
+            mBuffer = DEBUG_NEW unsigned char[mCapacity];
+            if ( mBuffer == nullptr )
+                return -1;
+        }
+
+        if ( mSize == 0u )
+        {
+            mHead = 0u;
+        }
+
+        if ( mSize < mCapacity )
+        {
+            // Receive into the contiguous free space of the ring buffer.
+            uint32_t tail   = (mHead + mSize) % mCapacity;
+            uint32_t space  = tail >= mHead ? mCapacity - tail : mHead - tail;
+            result = socket.receiveAvailable(mBuffer + tail, static_cast<int>(space));
+            mSize += result > 0 ? static_cast<uint32_t>(result) : 0u;
+        }
+    }
+
+    return result;
+}
+
+int RemoteMessageDecoder::writeData( const unsigned char * data, uint32_t length )
+{
+    if ( mState == eDecodeState::DecodeFailed )
+        return -1;
+
+    uint32_t result{ 0u };
+    if ( (mState == eDecodeState::DecodeData) && (mSize == 0u) && (mDataRead < mDataSpace) )
+    {
+        // Nothing is buffered, copy directly into the message to avoid extra copying.
+        result = MACRO_MIN(length, mDataSpace - mDataRead);
+        NEMemory::memCopy(mData + mDataRead, result, data, result);
+        mDataRead += result;
+    }
+    else
+    {
+        if ( mBuffer == nullptr )
+        {
+            mBuffer = DEBUG_NEW unsigned char[mCapacity];
+            if ( mBuffer == nullptr )
+                return -1;
+        }
+
+        if ( mSize == 0u )
+        {
+            mHead = 0u;
+        }
+
+        // Copy into the free space of the ring buffer, which may wrap.
+        result = MACRO_MIN(length, mCapacity - mSize);
+        uint32_t tail   = (mHead + mSize) % mCapacity;
+        uint32_t first  = MACRO_MIN(result, mCapacity - tail);
+        NEMemory::memCopy(mBuffer + tail, first, data, first);
+        NEMemory::memCopy(mBuffer, result - first, data + first, result - first);
+        mSize += result;
+    }
+
+    return static_cast<int>(result);
+}
+
+bool RemoteMessageDecoder::nextMessage( RemoteMessage & out_message )
+{
+    bool result{ false };
+    bool hasData{ true };
+
+    while ( hasData && (result == false) )
+    {
+        switch ( mState )
+        {
+        case eDecodeState::DecodeHeader:
+            mHeaderRead += _readBuffer(reinterpret_cast<unsigned char *>(&mHeader) + mHeaderRead, sizeof(NEMemory::sRemoteMessageHeader) - mHeaderRead);
+            if ( mHeaderRead == sizeof(NEMemory::sRemoteMessageHeader) )
+            {
+                if ( _decodeHeader( ) == false )
+                {
+                    mState  = eDecodeState::DecodeFailed;
+                    hasData = false;
+                }
+                else if ( mState == eDecodeState::DecodeHeader )
+                {
+                    // There is no data, the message is complete.
+                    result  = _completeMessage(out_message);
+                    hasData = result;
+                }
+            }
+            else
+            {
+                hasData = false;
+            }
+            break;
+
+        case eDecodeState::DecodeData:
+            if ( mDataRead < mDataSpace )
+            {
+                mDataRead += _readBuffer(mData + mDataRead, mDataSpace - mDataRead);
+            }
+
+            if ( mDataRead >= mDataSpace )
+            {
+                // Drop the aligned data that does not fit the message buffer.
+                mDataRead += _readBuffer(nullptr, mDataLength - mDataRead);
+            }
+
+            if ( mDataRead == mDataLength )
+            {
+                result  = _completeMessage(out_message);
+                hasData = result;
+            }
+            else
+            {
+                hasData = false;
+            }
+            break;
+
+        case eDecodeState::DecodeFailed:    // fall through
+        default:
+            hasData = false;
+            break;
+        }
+    }
+
+    return result;
+}
+
+void RemoteMessageDecoder::reset( void )
+{
+    mHead       = 0u;
+    mSize       = 0u;
+    mState      = eDecodeState::DecodeHeader;
+    mHeaderRead = 0u;
+    mData       = nullptr;
+    mDataLength = 0u;
+    mDataSpace  = 0u;
+    mDataRead   = 0u;
+    mMessage.invalidate();
+}
+
+uint32_t RemoteMessageDecoder::_readBuffer( unsigned char * dst, uint32_t length )
+{
+    uint32_t result = MACRO_MIN(length, mSize);
+    uint32_t first  = MACRO_MIN(result, mCapacity - mHead);
+    if ( dst != nullptr )
+    {
+        NEMemory::memCopy(dst, first, mBuffer + mHead, first);
+        NEMemory::memCopy(dst + first, result - first, mBuffer, result - first);
+    }
+
+    mHead   = (mHead + result) % mCapacity;
+    mSize  -= result;
+
+    return result;
+}
+
+bool RemoteMessageDecoder::_decodeHeader( void )
+{
+    const NEMemory::sBuferHeader & bufHeader = mHeader.rbhBufHeader;
+    if ( (bufHeader.biLength < bufHeader.biUsed) || (bufHeader.biLength > RemoteMessageDecoder::MAXIMUM_MESSAGE_SIZE) )
+        return false;
+
+    mData = mMessage.initMessage(mHeader);
+    if ( mData == nullptr )
+        return false;
+
+    if ( bufHeader.biUsed != 0u )
+    {
+        // receive aligned length of data.
+        mState      = eDecodeState::DecodeData;
+        mDataLength = bufHeader.biLength;
+        mDataSpace  = MACRO_MIN(bufHeader.biLength, mMessage.getRemoteMessage()->rbHeader.rbhBufHeader.biLength);
+        mDataRead   = 0u;
+    }
+
+    return true;
+}
+
+bool RemoteMessageDecoder::_completeMessage( RemoteMessage & out_message )
+{
+    bool result{ false };
+    mMessage.moveToBegin();
+    if ( mMessage.isChecksumValid() )
+    {
+        out_message = std::move(mMessage);
+        mState      = eDecodeState::DecodeHeader;
+        mHeaderRead = 0u;
+        mData       = nullptr;
+        mDataLength = 0u;
+        mDataSpace  = 0u;
+        mDataRead   = 0u;
+        result      = true;
+    }
+    else
+    {
+        mMessage.invalidate();
+        mState = eDecodeState::DecodeFailed;
+    }
+
+    return result;
+}
@@ -0,0 +1,251 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/RemoteMessageQueue.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, outbound queue of remote messages
+ *              to send to the socket connection.
+ ************************************************************************/
+#include "areg/ipc/RemoteMessageQueue.hpp"
+
+#include "areg/base/GEMacros.h"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/Socket.hpp"
+#include "areg/ipc/SharedMemoryServer.hpp"
+
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////
+// RemoteMessageQueue class implementation
+//////////////////////////////////////////////////////////////////////////
+
+inline uint32_t RemoteMessageQueue::_messageLength( const sQueuedMessage & entry )
+{
+    const NEMemory::sRemoteMessageHeader & header = entry.qmHeader;
+    return static_cast<uint32_t>(sizeof(NEMemory::sRemoteMessageHeader)) + (header.rbhBufHeader.biUsed != 0 ? header.rbhBufHeader.biLength : 0u);
+}
+
+RemoteMessageQueue::RemoteMessageQueue( void )
+    : mMessages     ( )
+    , mSentBytes    ( 0u )
+    , mQueuedBytes  ( 0u )
+{
+}
+
+RemoteMessageQueue::RemoteMessageQueue( RemoteMessageQueue && src ) noexcept
+    : mMessages     ( std::move(src.mMessages) )
+    , mSentBytes    ( src.mSentBytes )
+    , mQueuedBytes  ( src.mQueuedBytes )
+{
+    src.mSentBytes      = 0u;
+    src.mQueuedBytes    = 0u;
+}
+
+RemoteMessageQueue & RemoteMessageQueue::operator = ( RemoteMessageQueue && src ) noexcept
+{
+    if ( this != &src )
+    {
+        mMessages       = std::move(src.mMessages);
+        mSentBytes      = src.mSentBytes;
+        mQueuedBytes    = src.mQueuedBytes;
+
+        src.mSentBytes  = 0u;
+        src.mQueuedBytes= 0u;
+    }
+
+    return (*this);
+}
+
+void RemoteMessageQueue::pushMessage( const RemoteMessage & message )
+{
+    ASSERT( message.isValid( ) );
+
+    message.bufferCompletionFix( );
+    pushShared( message, message.getTarget( ) );
+}
+
+void RemoteMessageQueue::pushShared( const RemoteMessage & message, const ITEM_ID & target )
+{
+    ASSERT( message.isValid( ) );
+
+    sQueuedMessage entry{ message, reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*message.getByteBuffer( )) };
+    entry.qmHeader.rbhTarget = target;
+    mQueuedBytes += _messageLength( entry );
+    mMessages.pushLast( std::move(entry) );
+}
+
+int RemoteMessageQueue::sendMessages( const Socket & socket )
+{
+    NESocket::sSendBuffer buffers[NESocket::MAXIMUM_SEND_BUFFERS];
+    int result{ 0 };
+
+    while ( mMessages.isEmpty( ) == false )
+    {
+        int count   = _fillBuffers( buffers, NESocket::MAXIMUM_SEND_BUFFERS );
+        int sent    = socket.sendAvailable( buffers, count );
+        if ( sent < 0 )
+        {
+            result = -1;
+            break;
+        }
+        else if ( sent == 0 )
+        {
+            break;  // the socket cannot send more data, wait until it is writable.
+        }
+
+        _removeSent( static_cast<uint32_t>(sent) );
+        result += sent;
+    }
+
+    return result;
+}
+
+int RemoteMessageQueue::flushMessages( const Socket & socket )
+{
+    NESocket::sSendBuffer buffers[NESocket::MAXIMUM_SEND_BUFFERS];
+    int result{ 0 };
+
+    while ( mMessages.isEmpty( ) == false )
+    {
+        int count   = _fillBuffers( buffers, NESocket::MAXIMUM_SEND_BUFFERS );
+        int sent    = socket.sendBuffers( buffers, count );
+        if ( sent < 0 )
+        {
+            result = -1;
+            break;
+        }
+
+        _removeSent( static_cast<uint32_t>(sent) );
+        result += sent;
+    }
+
+    return result;
+}
+
+int RemoteMessageQueue::sendShared( SharedMemoryServer & sharedMemory, uint32_t slot )
+{
+    NESocket::sSendBuffer buffers[NESocket::MAXIMUM_SEND_BUFFERS];
+    int result{ 0 };
+
+    while ( mMessages.isEmpty( ) == false )
+    {
+        int count   = _fillBuffers( buffers, NESocket::MAXIMUM_SEND_BUFFERS );
+        int sent    = sharedMemory.writeAvailable( slot, buffers, count );
+        if ( sent < 0 )
+        {
+            result = -1;
+            break;
+        }
+        else if ( sent == 0 )
+        {
+            break;  // the ring is full, wait until the client reads data.
+        }
+
+        _removeSent( static_cast<uint32_t>(sent) );
+        result += sent;
+    }
+
+    return result;
+}
+
+int RemoteMessageQueue::flushShared( SharedMemoryServer & sharedMemory, uint32_t slot )
+{
+    NESocket::sSendBuffer buffers[NESocket::MAXIMUM_SEND_BUFFERS];
+    int result{ 0 };
+
+    while ( mMessages.isEmpty( ) == false )
+    {
+        int count   = _fillBuffers( buffers, NESocket::MAXIMUM_SEND_BUFFERS );
+        int sent    = sharedMemory.writeBuffers( slot, buffers, count );
+        if ( sent < 0 )
+        {
+            result = -1;
+            break;
+        }
+
+        _removeSent( static_cast<uint32_t>(sent) );
+        result += sent;
+    }
+
+    return result;
+}
+
+void RemoteMessageQueue::clear( void )
+{
+    mMessages.clear( );
+    mSentBytes  = 0u;
+    mQueuedBytes= 0u;
+}
+
+int RemoteMessageQueue::_fillBuffers( NESocket::sSendBuffer * out_buffers, int maxCount ) const
+{
+    int result{ 0 };
+    uint32_t skip{ mSentBytes };
+
+    for ( auto pos = mMessages.firstPosition( ); mMessages.isValidPosition( pos ) && (result < maxCount); pos = mMessages.nextPosition( pos ) )
+    {
+        const sQueuedMessage & entry = mMessages.valueAtPosition( pos );
+        const RemoteMessage & message = entry.qmMessage;
+        const NEMemory::sRemoteMessageHeader & header = entry.qmHeader;
+        constexpr uint32_t sizeHeader{ static_cast<uint32_t>(sizeof(NEMemory::sRemoteMessageHeader)) };
+
+        if ( skip < sizeHeader )
+        {
+            out_buffers[result].sbData  = reinterpret_cast<const unsigned char *>(&header) + skip;
+            out_buffers[result].sbLength= sizeHeader - skip;
+            ++ result;
+            skip = 0u;
+        }
+        else
+        {
+            skip -= sizeHeader;
+        }
+
+        if ( (header.rbhBufHeader.biUsed != 0) && (result < maxCount) )
+        {
+            // send the aligned length.
+            ASSERT( header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed );
+            ASSERT( skip < header.rbhBufHeader.biLength );
+            out_buffers[result].sbData  = message.getBuffer( ) + skip;
+            out_buffers[result].sbLength= header.rbhBufHeader.biLength - skip;
+            ++ result;
+        }
+        else if ( header.rbhBufHeader.biUsed != 0 )
+        {
+            break;  // there is no space for data of the message.
+        }
+
+        skip = 0u;
+    }
+
+    return result;
+}
+
+void RemoteMessageQueue::_removeSent( uint32_t sentBytes )
+{
+    ASSERT( sentBytes <= mQueuedBytes );
+    mQueuedBytes -= sentBytes;
+
+    while ( (sentBytes != 0u) && (mMessages.isEmpty( ) == false) )
+    {
+        uint32_t remain = _messageLength( mMessages.firstEntry( ) ) - mSentBytes;
+        if ( sentBytes >= remain )
+        {
+            sentBytes  -= remain;
+            mSentBytes  = 0u;
+            mMessages.removeFirst( );
+        }
+        else
+        {
+            mSentBytes += sentBytes;
+            sentBytes   = 0u;
+        }
+    }
+}
@@ -14,6 +14,7 @@
  ************************************************************************/
 #include "areg/ipc/private/RouterClient.hpp"
 
+#include "areg/ipc/ConnectionConfiguration.hpp"
 #include "areg/ipc/IEServiceRegisterConsumer.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
 
@@ -40,6 +41,8 @@ DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_unregisterServiceProvider);
 DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_registerServiceConsumer);
 DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_unregisterServiceConsumer);
 
+DEF_TRACE_SCOPE(areg_ipc_private_RouterClient__startDirectConnection);
+
 //////////////////////////////////////////////////////////////////////////
 // RouterClient class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -47,7 +50,7 @@ DEF_TRACE_SCOPE(areg_ipc_private_RouterClient_unregisterServiceConsumer);
 RouterClient::RouterClient(IEServiceConnectionConsumer& connectionConsumer, IEServiceRegisterConsumer& registerConsumer)
     : ServiceClientConnectionBase   ( NEService::COOKIE_ROUTER
                                     , NERemoteService::eRemoteServices::ServiceRouter
-                                    , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip)
+                                    , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectSM) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectUds) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectDirect)
                                     , NEService::eMessageSource::MessageSourceClient
                                     , connectionConsumer
                                     , static_cast<IERemoteMessageHandler &>(self())
@@ -58,6 +61,8 @@ RouterClient::RouterClient(IEServiceConnectionConsumer& connectionConsumer, IESe
     , IERemoteEventConsumer         ( )
 
     , mRegisterConsumer (registerConsumer)
+    , mDirectConnection ( )
+    , mThreadDirect     ( static_cast<IERemoteMessageHandler &>(self()), mDirectConnection, RouterClient::PREFIX_THREAD )
 {
 }
 
@@ -91,14 +96,30 @@ void RouterClient::disconnectServiceHost(void)
         completionWait(NECommon::WAIT_INFINITE);
         shutdownThread(NECommon::DO_NOT_WAIT);
     }
+
+    _stopDirectConnection();
 }
 
 void RouterClient::onServiceExit(void)
 {
     ServiceClientConnectionBase::onServiceExit();
+    _stopDirectConnection();
     triggerExit();
 }
 
+void RouterClient::onChannelConnected(const ITEM_ID & cookie)
+{
+    ServiceClientConnectionBase::onChannelConnected(cookie);
+
+    // The cookies of peers are not valid anymore if the connection with the routing service is lost.
+    mDirectConnection.closePeers();
+    mDirectConnection.setCookie(cookie >= NEService::COOKIE_REMOTE_SERVICE ? cookie : NEService::COOKIE_UNKNOWN);
+    if (cookie >= NEService::COOKIE_REMOTE_SERVICE)
+    {
+        _startDirectConnection(cookie);
+    }
+}
+
 bool RouterClient::registerServiceProvider( const StubAddress & stubService )
 {
     TRACE_SCOPE(areg_ipc_private_RouterClient_registerServiceProvider);
@@ -253,7 +274,7 @@ void RouterClient::failedProcessMessage( const RemoteMessage & msgUnprocessed )
                 RemoteMessage data;
                 if ( RemoteEventFactory::createStreamFromEvent( data, *eventError, mChannel) )
                 {
-                    sendMessage(data);
+                    _sendServiceMessage(data);
                 }
             }
         }
@@ -351,6 +372,32 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
             }
             break;
 
+        case NEService::eFuncIdRange::SystemServiceDirectEndpoint:
+            {
+                // The routing service forwards the endpoint of the process of service provider to
+                // the consumer, and announces the consumer with invalid port number to the provider.
+                String address;
+                unsigned short port{ NESocket::InvalidPort };
+                uint64_t secret{ 0u };
+                msgReceived >> address;
+                msgReceived >> port;
+                msgReceived >> secret;
+                if ( mDirectConnection.isValid() && (msgReceived.getSource() != mClientConnection.getCookie()) )
+                {
+                    if ( port != NESocket::InvalidPort )
+                    {
+                        TRACE_DBG("Direct connection endpoint [ %s : %u ] of peer [ %llu ]", address.getString(), static_cast<uint32_t>(port), msgReceived.getSource());
+                        mDirectConnection.queuePeer(msgReceived.getSource(), NESocket::SocketAddress(address, port), secret);
+                    }
+                    else
+                    {
+                        TRACE_DBG("Announced direct connection of peer [ %llu ] from host [ %s ]", msgReceived.getSource(), address.getString());
+                        mDirectConnection.announcePeer(msgReceived.getSource(), address, secret);
+                    }
+                }
+            }
+            break;
+
         case NEService::eFuncIdRange::ServiceLastId:                    // fall through
         case NEService::eFuncIdRange::SystemServiceQueryInstances:      // fall through
         case NEService::eFuncIdRange::SystemServiceRequestRegister:     // fall through
@@ -417,7 +464,7 @@ void RouterClient::processRemoteRequestEvent( RemoteRequestEvent & requestEvent)
                       , data.getSource()
                       , data.getTarget());
 
-            sendMessage(data);
+            _sendServiceMessage(data);
         }
         else
         {
@@ -445,7 +492,7 @@ void RouterClient::processRemoteNotifyRequestEvent( RemoteNotifyRequestEvent & r
                       , data.getSource()
                       , data.getTarget());
 
-            sendMessage(data);
+            _sendServiceMessage(data);
         }
         else
         {
@@ -474,7 +521,7 @@ void RouterClient::processRemoteResponseEvent(RemoteResponseEvent & responseEven
                       , data.getSource()
                       , data.getTarget());
 
-            sendMessage(data);
+            _sendServiceMessage(data);
         }
         else
         {
@@ -513,3 +560,50 @@ void RouterClient::readyForEvents(bool isReady)
     }
 }
 
+void RouterClient::_sendServiceMessage(const RemoteMessage & data)
+{
+    if (mDirectConnection.sendMessage(data) <= 0)
+    {
+        sendMessage(data);
+    }
+}
+
+void RouterClient::_startDirectConnection(const ITEM_ID & cookie)
+{
+    TRACE_SCOPE(areg_ipc_private_RouterClient__startDirectConnection);
+
+    ConnectionConfiguration config(mService, NERemoteService::eConnectionTypes::ConnectDirect);
+    if (((mConnectTypes & static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectDirect)) != 0) && config.isConnectionTypeEnabled())
+    {
+        // The listening socket and the thread remain valid when reconnecting to the routing service.
+        const String address{ config.getConnectionAddress() };
+        if ((mDirectConnection.isValid() || mDirectConnection.createSocket(address, config.getConnectionPort())) &&
+            (mThreadDirect.isRunning() || (mThreadDirect.createThread(NECommon::WAIT_INFINITE) && mThreadDirect.waitForDispatcherStart(NECommon::WAIT_INFINITE))))
+        {
+            String host{ address };
+            if (host.isEmpty() || (host == NEConnection::DIRECT_ANY_ADDRESS))
+            {
+                // Announce the address, which is reachable by the routing service.
+                NESocket::SocketAddress local;
+                host = local.resolveLocalSocket(mClientConnection.getSocket().getHandle()) ? local.getHostAddress() : String(NESocket::LocalAddress);
+            }
+
+            const unsigned short port{ mDirectConnection.getAddress().getHostPort() };
+            TRACE_DBG("Announcing direct connection endpoint [ %s : %u ] of process [ %llu ]", host.getString(), static_cast<uint32_t>(port), cookie);
+            sendMessage(NERemoteService::createDirectEndpoint(host, port, 0u, cookie, NEService::COOKIE_ROUTER), Event::eEventPriority::EventPriorityHigh);
+        }
+        else
+        {
+            TRACE_WARN("Failed to start direct connections, the messages are sent via routing service");
+            mDirectConnection.closeSocket();
+        }
+    }
+}
+
+void RouterClient::_stopDirectConnection(void)
+{
+    // Wakes up the thread waiting for events of direct connections.
+    mThreadDirect.triggerExit();
+    mThreadDirect.shutdownThread(NECommon::WAIT_INFINITE);
+    mDirectConnection.closeSocket();
+}
@@ -24,6 +24,8 @@
 #include "areg/ipc/IEServiceRegisterProvider.hpp"
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 #include "areg/ipc/ServiceClientConnectionBase.hpp"
+#include "areg/ipc/private/DirectConnection.hpp"
+#include "areg/ipc/private/DirectReceiveThread.hpp"
 
 /************************************************************************
  * Dependencies
@@ -87,6 +89,14 @@ protected:
      **/
     virtual void onServiceExit(void) override;
 
+    /**
+     * \brief   Called when need to inform the channel connection.
+     *          If direct connections are enabled, announces the endpoint
+     *          to accept direct connections of the peers.
+     * \param   cookie  The channel connection cookie.
+     **/
+    virtual void onChannelConnected(const ITEM_ID & cookie) override;
+
 /************************************************************************/
 // IERemoteMessageHandler interface overrides
 /************************************************************************/
@@ -218,6 +228,25 @@ private:
      **/
     inline RouterClient & self( void );
 
+    /**
+     * \brief   Sends the message via direct connection with the target process.
+     *          If there is no direct connection or failed to send, the message
+     *          is queued to send via routing service.
+     * \param   data    The message to send.
+     **/
+    void _sendServiceMessage( const RemoteMessage & data );
+
+    /**
+     * \brief   Starts listening direct connections and announces the endpoint to the routing service.
+     * \param   cookie  The cookie of the process assigned by the routing service.
+     **/
+    void _startDirectConnection( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Stops the thread of direct connections and closes all direct connections.
+     **/
+    void _stopDirectConnection( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -226,6 +255,14 @@ private:
      * \brief   The instance of service register consumer.
      **/
     IEServiceRegisterConsumer &     mRegisterConsumer;
+    /**
+     * \brief   The direct connections with the processes of service providers and service consumers.
+     **/
+    DirectConnection                mDirectConnection;
+    /**
+     * \brief   The thread to accept, to establish and to receive messages of direct connections.
+     **/
+    DirectReceiveThread             mThreadDirect;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -16,71 +16,221 @@
 
 #include "areg/component/NEService.hpp"
 
+namespace
+{
+    //!< The generator of unique IDs of server connection objects.
+    std::atomic_uint    _instanceIds    { 0u };
+}
+
 ServerConnectionBase::ServerConnectionBase( void )
     : mServerSocket         ( )
+    , mLocalSocket          ( )
     , mCookieGenerator      ( NEService::COOKIE_REMOTE_SERVICE )
+    , mSocketProfile        ( NESocket::DefaultSocketProfile )
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mConnectionIds        ( std::make_shared<const sConnectionIds>( ) )
+    , mIdsVersion           ( 1u )
+    , mInstanceId           ( ++ _instanceIds )
+    , mWorkerCount          ( 1u )
+    , mSocketPollers        ( )
     , mLock                 ( )
 {
 }
 
 ServerConnectionBase::ServerConnectionBase(const String & hostName, unsigned short portNr)
     : mServerSocket         ( hostName, portNr )
+    , mLocalSocket          ( )
     , mCookieGenerator      ( NEService::COOKIE_REMOTE_SERVICE )
+    , mSocketProfile        ( NESocket::DefaultSocketProfile )
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mConnectionIds        ( std::make_shared<const sConnectionIds>( ) )
+    , mIdsVersion           ( 1u )
+    , mInstanceId           ( ++ _instanceIds )
+    , mWorkerCount          ( 1u )
+    , mSocketPollers        ( )
     , mLock                 ( )
 {
 }
 
 ServerConnectionBase::ServerConnectionBase(const NESocket::SocketAddress & serverAddress)
     : mServerSocket         ( serverAddress )
+    , mLocalSocket          ( )
     , mCookieGenerator      ( NEService::COOKIE_REMOTE_SERVICE )
+    , mSocketProfile        ( NESocket::DefaultSocketProfile )
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mConnectionIds        ( std::make_shared<const sConnectionIds>( ) )
+    , mIdsVersion           ( 1u )
+    , mInstanceId           ( ++ _instanceIds )
+    , mWorkerCount          ( 1u )
+    , mSocketPollers        ( )
     , mLock                 ( )
 {
 }
 
+ServerConnectionBase::~ServerConnectionBase( void )
+{
+    for (SocketPoller & poller : mSocketPollers)
+    {
+        poller.release();
+    }
+}
+
+bool ServerConnectionBase::setWorkerCount( uint32_t count )
+{
+    Lock lock(mLock);
+    bool result{ mServerSocket.isValid() == false };
+    if ( result )
+    {
+        mWorkerCount = MACRO_MIN(MACRO_MAX(count, 1u), MAXIMUM_WORKERS);
+    }
+
+    return result;
+}
+
+bool ServerConnectionBase::isConnectionAccepted( SOCKETHANDLE connection ) const
+{
+    return _getConnectionIds().ciSocketToCookie.contains(connection);
+}
+
+ITEM_ID ServerConnectionBase::getCookie(SOCKETHANDLE socketHandle) const
+{
+    const MapSocketToCookie & socketToCookie = _getConnectionIds().ciSocketToCookie;
+    MapSocketToCookie::MAPPOS pos = socketToCookie.find( socketHandle );
+    return (socketToCookie.isValidPosition(pos) ? socketToCookie.valueAtPosition(pos) : NEService::COOKIE_UNKNOWN );
+}
+
 bool ServerConnectionBase::createSocket(const String & hostName, unsigned short portNr)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket(hostName, portNr);
+    return mServerSocket.createSocket(hostName, portNr) && _registerServerSocket();
 }
 
 bool ServerConnectionBase::createSocket(void)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket();
+    return mServerSocket.createSocket() && _registerServerSocket();
+}
+
+bool ServerConnectionBase::createLocalSocket(const String & socketPath)
+{
+    Lock lock(mLock);
+    bool result{ false };
+    if ( mServerSocket.isValid() && mLocalSocket.createLocalSocket(socketPath) )
+    {
+        result = mSocketPollers[0].addSocket(mLocalSocket.getHandle(), static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), false);
+        if ( result == false )
+        {
+            mLocalSocket.closeSocket();
+        }
+    }
+
+    return result;
 }
 
 void ServerConnectionBase::closeSocket(void)
 {
     Lock lock(mLock);
-    mMasterList.clear();
+    _removeAllConnections();
+
+    mSocketPollers[0].removeSocket(mServerSocket.getHandle());
+    mSocketPollers[0].removeSocket(mLocalSocket.getHandle());
+    for (uint32_t i = 0; i < mWorkerCount; ++ i)
+    {
+        mSocketPollers[i].interrupt();
+    }
+
+    mLocalSocket.closeSocket();
+    mServerSocket.closeSocket();
+}
+
+bool ServerConnectionBase::serverListen(int maxQueueSize /*= NESocket::MAXIMUM_LISTEN_QUEUE_SIZE */)
+{
+    return mServerSocket.listenConnection(maxQueueSize) && ((mLocalSocket.isValid() == false) || mLocalSocket.listenConnection(maxQueueSize));
+}
+
+int ServerConnectionBase::waitForConnectionEvents( SocketPoller::sPollEvent * out_events, int maxEvents, uint32_t worker /*= 0*/ )
+{
+    ASSERT(worker < mWorkerCount);
+    return mSocketPollers[worker].waitEvents(out_events, maxEvents, NECommon::WAIT_INFINITE);
+}
+
+SOCKETHANDLE ServerConnectionBase::acceptNewConnection( NESocket::SocketAddress & out_addrNewAccepted )
+{
+    SOCKETHANDLE hSocket = mServerSocket.acceptConnection(out_addrNewAccepted);
+    if (hSocket != NESocket::InvalidSocketHandle)
+    {
+        static_cast<void>(NESocket::applySocketProfile(hSocket, mSocketProfile));
+    }
+
+    return hSocket;
+}
+
+SOCKETHANDLE ServerConnectionBase::acceptLocalConnection( NESocket::SocketAddress & out_addrNewAccepted )
+{
+    return mLocalSocket.acceptConnection(out_addrNewAccepted);
+}
+
+bool ServerConnectionBase::_registerServerSocket( void )
+{
+    bool result{ true };
+    for (uint32_t i = 0; result && (i < mWorkerCount); ++ i)
+    {
+        result = mSocketPollers[i].create();
+    }
+
+    // The listening socket is level-triggered, so that every wake up accepts one pending connection.
+    return result && mSocketPollers[0].addSocket(mServerSocket.getHandle(), static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), false);
+}
+
+void ServerConnectionBase::_removeAllConnections( void )
+{
+    for (MapSocketToCookie::MAPPOS pos = mSocketToCookie.firstPosition(); mSocketToCookie.isValidPosition(pos); pos = mSocketToCookie.nextPosition(pos))
+    {
+        _getWorkerPoller(mSocketToCookie.valueAtPosition(pos)).removeSocket(mSocketToCookie.keyAtPosition(pos));
+    }
+
     mCookieToSocket.clear();
     mSocketToCookie.clear();
     mAcceptedConnections.clear();
     mCookieGenerator = NEService::COOKIE_REMOTE_SERVICE;
-
-    mServerSocket.closeSocket();
+    _publishConnections();
 }
 
-bool ServerConnectionBase::serverListen(int maxQueueSize /*= NESocket::MAXIMUM_LISTEN_QUEUE_SIZE */)
+void ServerConnectionBase::_publishConnections( void )
 {
-    return mServerSocket.listenConnection(maxQueueSize);
+    std::shared_ptr<sConnectionIds> ids = std::make_shared<sConnectionIds>();
+    ids->ciSocketToCookie = mSocketToCookie;
+    mConnectionIds = ids;
+    mIdsVersion.fetch_add(1u, std::memory_order_release);
 }
 
-SOCKETHANDLE ServerConnectionBase::waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted)
+const ServerConnectionBase::sConnectionIds & ServerConnectionBase::_getConnectionIds( void ) const
 {
-    return mServerSocket.waitConnectionEvent(out_addrNewAccepted, static_cast<const SOCKETHANDLE *>(mMasterList), mMasterList.getSize());
+    //!< The snapshot of cookies cached by the thread.
+    struct sCachedIds
+    {
+        uint32_t    ciInstance  { 0u };                 //!< The ID of the server connection object.
+        uint32_t    ciVersion   { 0u };                 //!< The version of the cached snapshot.
+        std::shared_ptr<const sConnectionIds> ciIds;    //!< The cached snapshot.
+    };
+
+    // The connections are rarely modified, the thread uses the cached snapshot until the version changes.
+    thread_local sCachedIds _cached;
+    if ( (_cached.ciInstance != mInstanceId) || (_cached.ciVersion != mIdsVersion.load(std::memory_order_acquire)) )
+    {
+        Lock lock(mLock);
+        _cached.ciInstance  = mInstanceId;
+        _cached.ciVersion   = mIdsVersion.load(std::memory_order_relaxed);
+        _cached.ciIds       = mConnectionIds;
+    }
+
+    return *_cached.ciIds;
 }
 
 bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
@@ -93,19 +243,22 @@ bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
         const SOCKETHANDLE hSocket = clientConnection.getHandle();
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
 
-        if ( mMasterList.find(hSocket) == -1)
+        if ( mAcceptedConnections.contains(hSocket) == false )
         {
-            ASSERT(mAcceptedConnections.contains( hSocket ) == false);
             ASSERT(mSocketToCookie.contains(hSocket) == false);
 
-            ITEM_ID cookie{ mCookieGenerator ++ };
+            // The socket is owned by the worker selected by the cookie.
+            ITEM_ID cookie{ mCookieGenerator };
             ASSERT(cookie >= NEService::COOKIE_REMOTE_SERVICE);
-
-            mAcceptedConnections.setAt(hSocket, clientConnection);
-            mCookieToSocket.setAt(cookie, hSocket);
-            mSocketToCookie.setAt(hSocket, cookie);
-            mMasterList.add( hSocket );
-            result = true;
+            if ( _getWorkerPoller(cookie).addSocket(hSocket, static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), true) )
+            {
+                ++ mCookieGenerator;
+                mAcceptedConnections.setAt(hSocket, clientConnection);
+                mCookieToSocket.setAt(cookie, hSocket);
+                mSocketToCookie.setAt(hSocket, cookie);
+                _publishConnections();
+                result = true;
+            }
         }
         else
         {
@@ -129,7 +282,11 @@ void ServerConnectionBase::closeConnection(SocketAccepted & clientConnection)
     mSocketToCookie.removeAt(hSocket);
     mCookieToSocket.removeAt(cookie);
     mAcceptedConnections.removeAt(hSocket);
-    mMasterList.removeElem(hSocket, 0);
+    if (cookie != NEService::COOKIE_UNKNOWN)
+    {
+        _getWorkerPoller(cookie).removeSocket(hSocket);
+        _publishConnections();
+    }
 
     clientConnection.closeSocket();
 }
@@ -146,7 +303,8 @@ void ServerConnectionBase::closeConnection( const ITEM_ID & cookie )
 
         mCookieToSocket.removePosition( posCookie );        
         mSocketToCookie.removeAt( hSocket );
-        mMasterList.removeElem( hSocket, 0 );
+        _getWorkerPoller( cookie ).removeSocket( hSocket );
+        _publishConnections( );
         if (mAcceptedConnections.isValidPosition(posClient))
         {
             SocketAccepted client(mAcceptedConnections.valueAtPosition(posClient));
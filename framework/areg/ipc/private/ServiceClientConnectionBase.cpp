@@ -20,6 +20,7 @@
 #include "areg/ipc/ConnectionConfiguration.hpp"
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
 #include "areg/trace/GETrace.h"
 
 DEF_TRACE_SCOPE(areg_ipc_private_ServiceClientConnectionBase_onServiceReconnectTimerExpired);
@@ -142,6 +143,7 @@ bool ServiceClientConnectionBase::setupServiceConnectionData(NERemoteService::eR
             {
                 String address{ config.getConnectionAddress() };
                 unsigned short port{ config.getConnectionPort() };
+                mClientConnection.setSocketProfile(config.getSocketProfile());
                 result = mClientConnection.setAddress(address, port);
             }
         }
@@ -380,8 +382,24 @@ bool ServiceClientConnectionBase::startConnection(void)
     bool result = false;
     mTimerConnect.stopTimer();
 
-    if ( mClientConnection.createSocket() )
+    bool isLocal{ false };
+    ConnectionConfiguration configLocal(mService, NERemoteService::eConnectionTypes::ConnectUds);
+    if (((mConnectTypes & static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUds)) != 0) && configLocal.isConnectionTypeEnabled())
     {
+        // If the service runs on the same host, connect via local socket.
+        isLocal = mClientConnection.createLocalSocket(configLocal.getConnectionAddress());
+    }
+
+    if ( isLocal || mClientConnection.createSocket() )
+    {
+        ConnectionConfiguration config(mService, NERemoteService::eConnectionTypes::ConnectSM);
+        if ((isLocal == false) && ((mConnectTypes & static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectSM)) != 0) && config.isConnectionTypeEnabled())
+        {
+            // If the service runs on the same host, the messages are exchanged via shared memory.
+            String segment{ NESharedMemory::getSegmentName(config.getRemoteServiceName(), mClientConnection.getAddress().getHostPort()) };
+            mClientConnection.attachSharedMemory(segment);
+        }
+
         if ( mThreadReceive.createThread( NECommon::WAIT_INFINITE ) && mThreadSend.createThread( NECommon::WAIT_INFINITE ) )
         {
             VERIFY( mThreadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
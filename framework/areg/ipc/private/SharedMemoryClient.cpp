@@ -0,0 +1,314 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/SharedMemoryClient.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the client side of the shared memory
+ *              connection with the remote service on the same host.
+ ************************************************************************/
+#include "areg/ipc/SharedMemoryClient.hpp"
+
+#include "areg/base/NESocket.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/Socket.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+#include "areg/trace/GETrace.h"
+
+#if defined(_POSIX) || defined(POSIX)
+    #include <netinet/in.h>
+#endif  // defined(_POSIX) || defined(POSIX)
+
+DEF_TRACE_SCOPE(areg_ipc_private_SharedMemoryClient_attach);
+
+SharedMemoryClient::SharedMemoryClient( void )
+    : mSegment      ( nullptr )
+    , mSlot         ( nullptr )
+    , mSlotIndex    ( 0u )
+    , mAttached     ( false )
+    , mSocketDrained( false )
+    , mDecoder      ( NESharedMemory::RING_SIZE )
+    , mSendLock     ( false )
+    , mReceiveLock  ( false )
+{
+}
+
+SharedMemoryClient::~SharedMemoryClient( void )
+{
+    detach( );
+    _unmapSegment( );
+}
+
+bool SharedMemoryClient::attach( const String & segmentName, const Socket & socket )
+{
+    TRACE_SCOPE(areg_ipc_private_SharedMemoryClient_attach);
+
+    detach( );
+
+    Lock lockSend( mSendLock );
+    Lock lockReceive( mReceiveLock );
+
+    _unmapSegment( );
+
+    NESocket::SocketAddress local;
+    struct sockaddr_in addr { };
+    if ( NESharedMemory::isSupported( ) && socket.isValid( ) && local.resolveLocalSocket( socket.getHandle( ) ) && local.getAddress( addr ) )
+    {
+        mSegment = reinterpret_cast<NESharedMemory::sSegmentHeader *>(NESharedMemory::openSegment( segmentName, NESharedMemory::SEGMENT_SIZE ));
+        if ( (mSegment != nullptr)                                          &&
+             (mSegment->shMagic     == NESharedMemory::SEGMENT_MAGIC)       &&
+             (mSegment->shVersion   == NESharedMemory::SEGMENT_VERSION)     &&
+             (mSegment->shSlotCount == NESharedMemory::SLOT_COUNT)          &&
+             (mSegment->shRingSize  == NESharedMemory::RING_SIZE)           &&
+             (mSegment->shRunning.load( std::memory_order_acquire ) != 0u) )
+        {
+            if ( _claimSlot( static_cast<uint32_t>(addr.sin_addr.s_addr), local.getHostPort( ) ) )
+            {
+                TRACE_DBG("Attached to slot [ %u ] of shared memory [ %s ]", mSlotIndex, segmentName.getString( ));
+                mDecoder.reset( );
+                mSocketDrained = false;
+                mAttached = true;
+            }
+            else
+            {
+                TRACE_WARN("Failed to get a slot of shared memory [ %s ], communicating via socket", segmentName.getString( ));
+            }
+        }
+        else
+        {
+            TRACE_DBG("The shared memory [ %s ] is not available, communicating via socket", segmentName.getString( ));
+            _unmapSegment( );
+        }
+    }
+
+    return mAttached;
+}
+
+void SharedMemoryClient::detach( void )
+{
+    if ( mAttached.exchange( false ) )
+    {
+        ASSERT( (mSegment != nullptr) && (mSlot != nullptr) );
+
+        // Wake up the sending and receiving threads, which are waiting on the rings.
+        NESharedMemory::wakeWord( mSlot->slClientRing.rbTail );
+        NESharedMemory::wakeWord( mSlot->slServerRing.rbHead );
+
+        Lock lockSend( mSendLock );
+        Lock lockReceive( mReceiveLock );
+
+        uint32_t state{ static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound) };
+        if ( mSlot->slState.compare_exchange_strong( state, static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClientClosed) ) == false )
+        {
+            state = static_cast<uint32_t>(NESharedMemory::eSlotState::SlotServerClosed);
+            mSlot->slState.compare_exchange_strong( state, static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClientClosed) );
+        }
+
+        NESharedMemory::ringDoorbell( *mSegment );
+        mDecoder.reset( );
+    }
+}
+
+int SharedMemoryClient::sendMessage( const RemoteMessage & in_message )
+{
+    int result{ -1 };
+    if ( in_message.isValid( ) && mAttached )
+    {
+        in_message.bufferCompletionFix( );
+        const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*in_message.getByteBuffer( ));
+        const uint32_t length{ header.rbhBufHeader.biUsed != 0 ? header.rbhBufHeader.biLength : 0u };
+        ASSERT( header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed );
+
+        Lock lock( mSendLock );
+        if ( _writeData( reinterpret_cast<const unsigned char *>(&header), sizeof( NEMemory::sRemoteMessageHeader ) ) &&
+             ((length == 0u) || _writeData( in_message.getBuffer( ), length )) )
+        {
+            result = static_cast<int>(sizeof( NEMemory::sRemoteMessageHeader ) + length);
+        }
+    }
+
+    return result;
+}
+
+int SharedMemoryClient::receiveMessage( RemoteMessage & out_message, const Socket & socket )
+{
+    int result{ 0 };
+    out_message.invalidate( );
+
+    Lock lock( mReceiveLock );
+    if ( mAttached )
+    {
+        NESharedMemory::sRingBuffer & ring{ mSlot->slServerRing };
+        const unsigned char * data{ NESharedMemory::getRingData( *mSegment, mSlotIndex, false ) };
+        uint32_t spin{ 0u };
+
+        while ( mAttached )
+        {
+            if ( mDecoder.nextMessage( out_message ) )
+            {
+                result = static_cast<int>(sizeof( NEMemory::sRemoteMessageHeader ) + out_message.getSizeUsed( ));
+                break;
+            }
+            else if ( mDecoder.isFailed( ) )
+            {
+                result = -1;
+                break;
+            }
+            else if ( NESharedMemory::hasData( ring ) )
+            {
+                // The messages sent via socket before the slot was bound are received first.
+                // When the server writes in the ring, all data it sent via socket is already
+                // in the socket, so that it is enough to check it once.
+                if ( (mSocketDrained == false) && (socket.pendingRead( ) > 0) )
+                {
+                    break;
+                }
+
+                mSocketDrained = true;
+                spin = 0u;
+                const int copied{ NESharedMemory::readRing( ring, data, mDecoder ) };
+                if ( copied > 0 )
+                {
+                    if ( NESharedMemory::notifyWriter( ring ) )
+                    {
+                        // The server does not sleep on the ring, wake up the thread, which resumes sending.
+                        NESharedMemory::ringDoorbell( *mSegment );
+                    }
+                }
+                else if ( copied < 0 )
+                {
+                    result = -1;
+                    break;
+                }
+            }
+            else if ( ++ spin < NESharedMemory::SPIN_COUNT )
+            {
+                continue;
+            }
+            else if ( (mSocketDrained == false) && (socket.pendingRead( ) > 0) )
+            {
+                break;
+            }
+            else if ( (NESharedMemory::waitReadable( ring, NESharedMemory::WAIT_SLICE ) == false) && (_isBound( ) == false) )
+            {
+                // The server closed the slot or does not run anymore, continue via socket.
+                detach( );
+            }
+        }
+    }
+
+    return result;
+}
+
+bool SharedMemoryClient::_claimSlot( uint32_t address, unsigned short portNr )
+{
+    constexpr uint32_t stateFree   { static_cast<uint32_t>(NESharedMemory::eSlotState::SlotFree) };
+    constexpr uint32_t stateClaimed{ static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClaimed) };
+    constexpr uint32_t stateBound  { static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound) };
+    constexpr uint32_t stateClosed { static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClientClosed) };
+    constexpr unsigned int waitStep{ 10u };
+
+    bool result{ false };
+    mSlot = nullptr;
+    for ( uint32_t i = 0; i < NESharedMemory::SLOT_COUNT; ++ i )
+    {
+        uint32_t state{ stateFree };
+        if ( mSegment->shSlots[i].slState.compare_exchange_strong( state, stateClaimed ) )
+        {
+            mSlotIndex = i;
+            mSlot = &mSegment->shSlots[i];
+            break;
+        }
+    }
+
+    if ( mSlot != nullptr )
+    {
+        mSlot->slGeneration.fetch_add( 1u, std::memory_order_relaxed );
+        NESharedMemory::resetRing( mSlot->slClientRing );
+        NESharedMemory::resetRing( mSlot->slServerRing );
+        mSlot->slProcess.store( static_cast<uint32_t>(Process::getInstance( ).getId( )), std::memory_order_relaxed );
+        mSlot->slAddress.store( address, std::memory_order_relaxed );
+        // The port is set last, the server binds the slot only if the port is set.
+        mSlot->slPort.store( static_cast<uint32_t>(portNr), std::memory_order_release );
+        NESharedMemory::ringDoorbell( *mSegment );
+
+        for ( unsigned int waited = 0; (waited < NESharedMemory::BIND_TIMEOUT) && (mSlot->slState.load( std::memory_order_acquire ) == stateClaimed); waited += waitStep )
+        {
+            NESharedMemory::waitWord( mSlot->slState, stateClaimed, waitStep );
+        }
+
+        uint32_t state{ stateClaimed };
+        if ( mSlot->slState.compare_exchange_strong( state, stateClosed ) )
+        {
+            // The server did not bind the slot in time.
+            NESharedMemory::ringDoorbell( *mSegment );
+        }
+        else if ( state == stateBound )
+        {
+            result = true;
+        }
+        else if ( state != stateClosed )
+        {
+            // The server closed the slot, acknowledge it.
+            mSlot->slState.compare_exchange_strong( state, stateClosed );
+            NESharedMemory::ringDoorbell( *mSegment );
+        }
+    }
+
+    return result;
+}
+
+bool SharedMemoryClient::_writeData( const unsigned char * data, uint32_t length )
+{
+    NESharedMemory::sRingBuffer & ring{ mSlot->slClientRing };
+    unsigned char * ringData{ NESharedMemory::getRingData( *mSegment, mSlotIndex, true ) };
+    unsigned int waited{ 0u };
+
+    while ( (length != 0u) && mAttached && (waited < NESharedMemory::SEND_TIMEOUT) )
+    {
+        const uint32_t written{ NESharedMemory::writeRing( ring, ringData, data, length ) };
+        if ( written != 0u )
+        {
+            data   += written;
+            length -= written;
+            waited  = 0u;
+            NESharedMemory::ringDoorbell( *mSegment );
+        }
+        else if ( _isBound( ) == false )
+        {
+            break;
+        }
+        else if ( NESharedMemory::waitWritable( ring, NESharedMemory::WAIT_SLICE ) == false )
+        {
+            waited += NESharedMemory::WAIT_SLICE;
+        }
+    }
+
+    return (length == 0u);
+}
+
+bool SharedMemoryClient::_isBound( void ) const
+{
+    return (mSlot->slState.load( std::memory_order_acquire ) == static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound)) &&
+           (mSegment->shRunning.load( std::memory_order_acquire ) != 0u) &&
+           NESharedMemory::isProcessAlive( mSegment->shProcess.load( std::memory_order_relaxed ) );
+}
+
+void SharedMemoryClient::_unmapSegment( void )
+{
+    if ( mSegment != nullptr )
+    {
+        NESharedMemory::closeSegment( mSegment, NESharedMemory::SEGMENT_SIZE );
+        mSegment = nullptr;
+        mSlot = nullptr;
+        mSlotIndex = 0u;
+    }
+}
@@ -0,0 +1,320 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/SharedMemoryServer.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the server side of the shared memory
+ *              connections with the clients on the same host.
+ ************************************************************************/
+#include "areg/ipc/SharedMemoryServer.hpp"
+
+#include "areg/base/Process.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+
+#include "areg/trace/GETrace.h"
+
+#if defined(_POSIX) || defined(POSIX)
+    #include <netinet/in.h>
+#endif  // defined(_POSIX) || defined(POSIX)
+
+DEF_TRACE_SCOPE(areg_ipc_private_SharedMemoryServer_createSegment);
+
+SharedMemoryServer::SharedMemoryServer( void )
+    : mSegment      ( nullptr )
+    , mSegmentName  ( )
+{
+}
+
+SharedMemoryServer::~SharedMemoryServer( void )
+{
+    releaseSegment( );
+}
+
+bool SharedMemoryServer::createSegment( const String & segmentName )
+{
+    TRACE_SCOPE(areg_ipc_private_SharedMemoryServer_createSegment);
+
+    releaseSegment( );
+    if ( NESharedMemory::isSupported( ) )
+    {
+        mSegment = reinterpret_cast<NESharedMemory::sSegmentHeader *>(NESharedMemory::createSegment( segmentName, NESharedMemory::SEGMENT_SIZE ));
+    }
+
+    if ( mSegment != nullptr )
+    {
+        // The new segment is filled with zeros, all slots are free.
+        mSegmentName            = segmentName;
+        mSegment->shMagic       = NESharedMemory::SEGMENT_MAGIC;
+        mSegment->shVersion     = NESharedMemory::SEGMENT_VERSION;
+        mSegment->shSlotCount   = NESharedMemory::SLOT_COUNT;
+        mSegment->shRingSize    = NESharedMemory::RING_SIZE;
+        mSegment->shProcess.store( static_cast<uint32_t>(Process::getInstance( ).getId( )), std::memory_order_relaxed );
+        mSegment->shRunning.store( 1u, std::memory_order_release );
+
+        TRACE_DBG("Created shared memory [ %s ] of [ %u ] bytes", segmentName.getString( ), NESharedMemory::SEGMENT_SIZE);
+    }
+    else
+    {
+        TRACE_WARN("Failed to create shared memory [ %s ], the clients communicate via socket", segmentName.getString( ));
+    }
+
+    return (mSegment != nullptr);
+}
+
+void SharedMemoryServer::releaseSegment( void )
+{
+    if ( mSegment != nullptr )
+    {
+        mSegment->shRunning.store( 0u, std::memory_order_release );
+        for ( uint32_t i = 0; i < NESharedMemory::SLOT_COUNT; ++ i )
+        {
+            closeSlot( i );
+        }
+
+        interrupt( );
+        NESharedMemory::deleteSegment( mSegmentName );
+        NESharedMemory::closeSegment( mSegment, NESharedMemory::SEGMENT_SIZE );
+
+        mSegment = nullptr;
+        mSegmentName.clear( );
+    }
+}
+
+uint32_t SharedMemoryServer::getDoorbell( void ) const
+{
+    return (mSegment != nullptr ? mSegment->shDoorbell.load( std::memory_order_seq_cst ) : 0u);
+}
+
+void SharedMemoryServer::waitEvents( uint32_t doorbell, unsigned int msTimeout )
+{
+    if ( mSegment != nullptr )
+    {
+        NESharedMemory::waitDoorbell( *mSegment, doorbell, msTimeout );
+    }
+}
+
+void SharedMemoryServer::interrupt( void )
+{
+    if ( mSegment != nullptr )
+    {
+        NESharedMemory::ringDoorbell( *mSegment );
+    }
+}
+
+NESharedMemory::eSlotState SharedMemoryServer::getSlotState( uint32_t slot ) const
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+    return static_cast<NESharedMemory::eSlotState>(mSegment->shSlots[slot].slState.load( std::memory_order_acquire ));
+}
+
+bool SharedMemoryServer::isSlotProcessAlive( uint32_t slot ) const
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+    return NESharedMemory::isProcessAlive( mSegment->shSlots[slot].slProcess.load( std::memory_order_relaxed ) );
+}
+
+bool SharedMemoryServer::getClaimedAddress( uint32_t slot, NESocket::SocketAddress & out_address ) const
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    bool result{ false };
+    const NESharedMemory::sSlot & entry{ mSegment->shSlots[slot] };
+    // The client sets the port last.
+    const uint32_t port{ entry.slPort.load( std::memory_order_acquire ) };
+    if ( (port != 0u) && (entry.slState.load( std::memory_order_acquire ) == static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClaimed)) )
+    {
+        struct sockaddr_in addr { };
+        addr.sin_family         = AF_INET;
+        addr.sin_port           = htons( static_cast<unsigned short>(port) );
+        addr.sin_addr.s_addr    = entry.slAddress.load( std::memory_order_relaxed );
+        out_address.setAddress( addr );
+        result = true;
+    }
+
+    return result;
+}
+
+bool SharedMemoryServer::bindSlot( uint32_t slot )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    NESharedMemory::sSlot & entry{ mSegment->shSlots[slot] };
+    uint32_t state{ static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClaimed) };
+    bool result = entry.slState.compare_exchange_strong( state, static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound) );
+    NESharedMemory::wakeWord( entry.slState );
+    return result;
+}
+
+void SharedMemoryServer::closeSlot( uint32_t slot )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    NESharedMemory::sSlot & entry{ mSegment->shSlots[slot] };
+    constexpr uint32_t stateClosed{ static_cast<uint32_t>(NESharedMemory::eSlotState::SlotServerClosed) };
+    uint32_t state{ static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound) };
+    if ( entry.slState.compare_exchange_strong( state, stateClosed ) == false )
+    {
+        state = static_cast<uint32_t>(NESharedMemory::eSlotState::SlotClaimed);
+        entry.slState.compare_exchange_strong( state, stateClosed );
+    }
+
+    // Wake up the client, which waits to bind, to receive or to send.
+    NESharedMemory::wakeWord( entry.slState );
+    NESharedMemory::wakeWord( entry.slServerRing.rbHead );
+    NESharedMemory::wakeWord( entry.slClientRing.rbTail );
+}
+
+void SharedMemoryServer::freeSlot( uint32_t slot )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    NESharedMemory::sSlot & entry{ mSegment->shSlots[slot] };
+    entry.slPort.store( 0u, std::memory_order_relaxed );
+    entry.slAddress.store( 0u, std::memory_order_relaxed );
+    entry.slProcess.store( 0u, std::memory_order_relaxed );
+    entry.slState.store( static_cast<uint32_t>(NESharedMemory::eSlotState::SlotFree), std::memory_order_release );
+}
+
+int SharedMemoryServer::readSlot( uint32_t slot, RemoteMessageDecoder & decoder )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    NESharedMemory::sRingBuffer & ring{ mSegment->shSlots[slot].slClientRing };
+    int result = NESharedMemory::readRing( ring, NESharedMemory::getRingData( *mSegment, slot, true ), decoder );
+    if ( result > 0 )
+    {
+        NESharedMemory::notifyWriter( ring );
+    }
+
+    return result;
+}
+
+int SharedMemoryServer::sendMessage( const RemoteMessage & in_message, const ITEM_ID & target, uint32_t slot )
+{
+    int result{ -1 };
+    if ( in_message.isValid( ) && (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) )
+    {
+        in_message.bufferCompletionFix( );
+        NEMemory::sRemoteMessageHeader header{ reinterpret_cast<const NEMemory::sRemoteMessageHeader &>(*in_message.getByteBuffer( )) };
+        header.rbhTarget = target;
+        const uint32_t length{ header.rbhBufHeader.biUsed != 0 ? header.rbhBufHeader.biLength : 0u };
+        ASSERT( header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed );
+
+        const NESocket::sSendBuffer buffers[2]
+        {
+              { reinterpret_cast<const unsigned char *>(&header), static_cast<unsigned int>(sizeof( NEMemory::sRemoteMessageHeader )) }
+            , { in_message.getBuffer( ), length }
+        };
+
+        result = writeBuffers( slot, buffers, length != 0u ? 2 : 1 );
+    }
+
+    return result;
+}
+
+int SharedMemoryServer::writeAvailable( uint32_t slot, const NESocket::sSendBuffer * buffers, int count )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    int result{ -1 };
+    NESharedMemory::sRingBuffer & ring{ mSegment->shSlots[slot].slServerRing };
+    if ( _isBound( slot ) && NESharedMemory::isRingValid( ring ) )
+    {
+        unsigned char * ringData{ NESharedMemory::getRingData( *mSegment, slot, false ) };
+        uint32_t written{ 0u };
+        bool isFull{ false };
+
+        for ( int i = 0; (i < count) && (isFull == false); ++ i )
+        {
+            const unsigned char * data{ buffers[i].sbData };
+            uint32_t length{ buffers[i].sbLength };
+            while ( (length != 0u) && (isFull == false) )
+            {
+                const uint32_t chunk{ NESharedMemory::writeRing( ring, ringData, data, length ) };
+                data    += chunk;
+                length  -= chunk;
+                written += chunk;
+                // The rest is written when the client reads data, unless it has read meanwhile.
+                isFull   = (chunk == 0u) && NESharedMemory::requestWritable( ring );
+            }
+        }
+
+        if ( written != 0u )
+        {
+            NESharedMemory::notifyReader( ring );
+        }
+
+        result = static_cast<int>(written);
+    }
+
+    return result;
+}
+
+int SharedMemoryServer::writeBuffers( uint32_t slot, const NESocket::sSendBuffer * buffers, int count )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    uint32_t written{ 0u };
+    bool succeeded{ true };
+    for ( int i = 0; (i < count) && succeeded; ++ i )
+    {
+        const uint32_t chunk{ _writeData( slot, buffers[i].sbData, buffers[i].sbLength ) };
+        written  += chunk;
+        succeeded = (chunk == buffers[i].sbLength);
+    }
+
+    return (succeeded ? static_cast<int>(written) : -1);
+}
+
+bool SharedMemoryServer::checkWritable( uint32_t slot )
+{
+    ASSERT( (mSegment != nullptr) && (slot < NESharedMemory::SLOT_COUNT) );
+
+    // Check the space first, so that the flag is not reset while the ring is full.
+    NESharedMemory::sRingBuffer & ring{ mSegment->shSlots[slot].slServerRing };
+    return NESharedMemory::hasSpace( ring ) && (ring.rbWriterWaits.exchange( 0u, std::memory_order_relaxed ) != 0u);
+}
+
+uint32_t SharedMemoryServer::_writeData( uint32_t slot, const unsigned char * data, uint32_t length )
+{
+    uint32_t result{ 0u };
+    NESharedMemory::sRingBuffer & ring{ mSegment->shSlots[slot].slServerRing };
+    unsigned char * ringData{ NESharedMemory::getRingData( *mSegment, slot, false ) };
+    unsigned int waited{ 0u };
+
+    while ( (length != 0u) && (waited < NESharedMemory::SEND_TIMEOUT) )
+    {
+        const uint32_t written{ NESharedMemory::writeRing( ring, ringData, data, length ) };
+        if ( written != 0u )
+        {
+            data   += written;
+            length -= written;
+            result += written;
+            waited  = 0u;
+            NESharedMemory::notifyReader( ring );
+        }
+        else if ( (_isBound( slot ) == false) || (NESharedMemory::isRingValid( ring ) == false) )
+        {
+            break;
+        }
+        else if ( NESharedMemory::waitWritable( ring, NESharedMemory::WAIT_SLICE ) == false )
+        {
+            waited += NESharedMemory::WAIT_SLICE;
+        }
+    }
+
+    return result;
+}
+
+bool SharedMemoryServer::_isBound( uint32_t slot ) const
+{
+    return (getSlotState( slot ) == NESharedMemory::eSlotState::SlotBound) && isSlotProcessAlive( slot );
+}
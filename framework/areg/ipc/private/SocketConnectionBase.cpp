@@ -27,13 +27,23 @@ int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const So
     {
         in_message.bufferCompletionFix();
         const NEMemory::sRemoteMessageHeader & buffer = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *in_message.getByteBuffer() );
-        result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&buffer), sizeof(NEMemory::sRemoteMessageHeader) );
-        if ((result == sizeof(NEMemory::sRemoteMessageHeader)) && (buffer.rbhBufHeader.biUsed != 0))
+        // The header and the data are sent by a single call, so that they are not split in separate packets.
+        NESocket::sSendBuffer buffers[2]
+        {
+              { reinterpret_cast<const unsigned char *>(&buffer), static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader)) }
+            , { in_message.getBuffer(), 0u }
+        };
+
+        int count{ 1 };
+        if (buffer.rbhBufHeader.biUsed != 0)
         {
             ASSERT(buffer.rbhBufHeader.biLength >= buffer.rbhBufHeader.biUsed);
             // send the aligned length.
-            result += clientSocket.sendData(in_message.getBuffer(), static_cast<int>(buffer.rbhBufHeader.biLength));
+            buffers[1].sbLength = static_cast<unsigned int>(buffer.rbhBufHeader.biLength);
+            count = 2;
         }
+
+        result = clientSocket.sendBuffers(buffers, count);
     }
 
     return result;
@@ -0,0 +1,161 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/posix/NESharedMemoryPosix.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory POSIX specific implementation.
+ *              On Linux uses POSIX shared memory and futex, on other
+ *              POSIX systems the shared memory is not supported.
+ ************************************************************************/
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <unistd.h>
+    #include <errno.h>
+    #include <time.h>
+#endif  // defined(__linux__)
+
+namespace NESharedMemory
+{
+
+#if defined(__linux__)
+
+    bool _osIsSupported( void )
+    {
+        return true;
+    }
+
+    void * _osCreateSegment( const char * name, uint32_t size )
+    {
+        // The segment of the previous instance is removed, the clients of old segment detect closed server.
+        ::shm_unlink( name );
+
+        void * result{ nullptr };
+        int fd = ::shm_open( name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP );
+        if ( fd >= 0 )
+        {
+            // The new segment is filled with zeros.
+            if ( ::ftruncate( fd, static_cast<off_t>(size) ) == 0 )
+            {
+                result = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+                result = result != MAP_FAILED ? result : nullptr;
+            }
+
+            ::close( fd );
+            if ( result == nullptr )
+            {
+                ::shm_unlink( name );
+            }
+        }
+
+        return result;
+    }
+
+    void * _osOpenSegment( const char * name, uint32_t size )
+    {
+        void * result{ nullptr };
+        int fd = ::shm_open( name, O_RDWR, 0 );
+        if ( fd >= 0 )
+        {
+            struct stat info{ };
+            if ( (::fstat( fd, &info ) == 0) && (info.st_size == static_cast<off_t>(size)) )
+            {
+                result = ::mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+                result = result != MAP_FAILED ? result : nullptr;
+            }
+
+            ::close( fd );
+        }
+
+        return result;
+    }
+
+    void _osCloseSegment( void * segment, uint32_t size )
+    {
+        ::munmap( segment, size );
+    }
+
+    void _osDeleteSegment( const char * name )
+    {
+        ::shm_unlink( name );
+    }
+
+    void _osWaitWord( std::atomic<uint32_t> & word, uint32_t expected, unsigned int msTimeout )
+    {
+        struct timespec timeout { };
+        timeout.tv_sec  = static_cast<time_t>(msTimeout / 1'000u);
+        timeout.tv_nsec = static_cast<long>(msTimeout % 1'000u) * 1'000'000l;
+
+        // The shared futex, the word is mapped in several processes.
+        ::syscall( SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected
+                 , msTimeout != NECommon::WAIT_INFINITE ? &timeout : nullptr, nullptr, 0 );
+    }
+
+    void _osWakeWord( std::atomic<uint32_t> & word )
+    {
+        ::syscall( SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0 );
+    }
+
+    bool _osIsProcessAlive( uint32_t processId )
+    {
+        return (processId != 0u) && ((::kill( static_cast<pid_t>(processId), 0 ) == 0) || (errno != ESRCH));
+    }
+
+#else   // defined(__linux__)
+
+    bool _osIsSupported( void )
+    {
+        return false;
+    }
+
+    void * _osCreateSegment( const char * /*name*/, uint32_t /*size*/ )
+    {
+        return nullptr;
+    }
+
+    void * _osOpenSegment( const char * /*name*/, uint32_t /*size*/ )
+    {
+        return nullptr;
+    }
+
+    void _osCloseSegment( void * /*segment*/, uint32_t /*size*/ )
+    {
+    }
+
+    void _osDeleteSegment( const char * /*name*/ )
+    {
+    }
+
+    void _osWaitWord( std::atomic<uint32_t> & /*word*/, uint32_t /*expected*/, unsigned int /*msTimeout*/ )
+    {
+    }
+
+    void _osWakeWord( std::atomic<uint32_t> & /*word*/ )
+    {
+    }
+
+    bool _osIsProcessAlive( uint32_t /*processId*/ )
+    {
+        return false;
+    }
+
+#endif  // defined(__linux__)
+
+}
+
+#endif  // defined(_POSIX) || defined(POSIX)
@@ -0,0 +1,61 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/win32/NESharedMemoryWin32.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the shared memory Windows specific implementation.
+ *              The waiting on the address works only within a process,
+ *              so that the shared memory is not supported and the
+ *              connections use TCP/IP.
+ ************************************************************************/
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+#ifdef  _WINDOWS
+
+namespace NESharedMemory
+{
+    bool _osIsSupported( void )
+    {
+        return false;
+    }
+
+    void * _osCreateSegment( const char * /*name*/, uint32_t /*size*/ )
+    {
+        return nullptr;
+    }
+
+    void * _osOpenSegment( const char * /*name*/, uint32_t /*size*/ )
+    {
+        return nullptr;
+    }
+
+    void _osCloseSegment( void * /*segment*/, uint32_t /*size*/ )
+    {
+    }
+
+    void _osDeleteSegment( const char * /*name*/ )
+    {
+    }
+
+    void _osWaitWord( std::atomic<uint32_t> & /*word*/, uint32_t /*expected*/, unsigned int /*msTimeout*/ )
+    {
+    }
+
+    void _osWakeWord( std::atomic<uint32_t> & /*word*/ )
+    {
+    }
+
+    bool _osIsProcessAlive( uint32_t /*processId*/ )
+    {
+        return false;
+    }
+}
+
+#endif  // _WINDOWS
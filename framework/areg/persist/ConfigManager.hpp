@@ -20,6 +20,7 @@
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
 
+#include "areg/base/NESocket.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/Version.hpp"
@@ -514,6 +515,79 @@ public:
      **/
     void setLogFileAppend(bool newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the policy to synchronize the log file with the storage device.
+     *          The value is one of 'never', 'batch' or 'error'.
+     **/
+    String getLogFileSync(void) const;
+
+    /**
+     * \brief   Sets the policy to synchronize the log file with the storage device.
+     * \param   newValue    The policy to synchronize the log file. Either 'never',
+     *                      'batch' or 'error'.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogFileSync(const String& newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the maximum size in megabytes of the log file. When the file reaches
+     *          the size, it is rotated. The value 0 means that the file is not rotated by size.
+     **/
+    uint32_t getLogFileMaxSize(void) const;
+
+    /**
+     * \brief   Sets the maximum size in megabytes of the log file. When the file reaches
+     *          the size, it is rotated. The value 0 means that the file is not rotated by size.
+     * \param   newValue    The maximum size in megabytes of the log file.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogFileMaxSize(uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the time interval in minutes to rotate the log file.
+     *          The value 0 means that the file is not rotated by time.
+     **/
+    uint32_t getLogFileInterval(void) const;
+
+    /**
+     * \brief   Sets the time interval in minutes to rotate the log file.
+     *          The value 0 means that the file is not rotated by time.
+     * \param   newValue    The time interval in minutes to rotate the log file.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogFileInterval(uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the number of rotated log files to keep. The older files are deleted.
+     *          The value 0 means to keep all rotated files.
+     **/
+    uint32_t getLogFileKeep(void) const;
+
+    /**
+     * \brief   Sets the number of rotated log files to keep. The older files are deleted.
+     *          The value 0 means to keep all rotated files.
+     * \param   newValue    The number of rotated log files to keep.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogFileKeep(uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the flag, indicating whether the rotated log files are compressed.
+     **/
+    bool getLogFileCompress(void) const;
+
+    /**
+     * \brief   Sets the flag, indicating whether the rotated log files are compressed.
+     * \param   newValue    The flag, indicating whether the rotated log files are compressed.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogFileCompress(bool newValue, bool isTemporary = false);
+
     /**
      * \brief   Returns the maximum queue size of log messages while there is no connection with remote logger.
      **/
@@ -529,6 +603,21 @@ public:
      **/
     void setLogRemoteQueueSize(uint32_t newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the maximum size in bytes of the log records sent to remote logger in one message.
+     **/
+    uint32_t getLogRemoteBatchSize(void) const;
+
+    /**
+     * \brief   Sets the maximum size in bytes of the log records sent to remote logger in one message.
+     *          The value 0 means do not batch and send every log record in a separate message.
+     * \param   newValue    The size in bytes of the batch of log records.
+     *                      Value 0 means disable batching.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setLogRemoteBatchSize(uint32_t newValue, bool isTemporary = false);
+
     /**
      * \brief   Returns the layout format of the log enter scope message.
      **/
@@ -744,6 +833,54 @@ public:
      **/
     void setRemoteServicePort(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType, uint16_t newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the limit in bytes of data queued to send to a single client of the remote service
+     *          that supports the specified connection. Zero means there is no limit.
+     * \param   service     The string value of the remote service.
+     * \param   connectType The string value of the connection type, which name should be read out.
+     **/
+    uint32_t getRemoteServiceQueue(const String& service, const String& connectType) const;
+
+    /**
+     * \brief   Returns the limit in bytes of data queued to send to a single client of the remote service
+     *          that supports the specified connection. Zero means there is no limit.
+     * \param   service     The remote service.
+     * \param   connectType The connection type, which name should be read out.
+     **/
+    uint32_t getRemoteServiceQueue(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const;
+
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the clients of the remote service
+     *          that supports the specified connection. Zero means the number of processor cores.
+     * \param   service     The string value of the remote service.
+     * \param   connectType The string value of the connection type, which name should be read out.
+     **/
+    uint32_t getRemoteServiceWorkers(const String& service, const String& connectType) const;
+
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the clients of the remote service
+     *          that supports the specified connection. Zero means the number of processor cores.
+     * \param   service     The remote service.
+     * \param   connectType The connection type, which name should be read out.
+     **/
+    uint32_t getRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const;
+
+    /**
+     * \brief   Returns the profile of socket options of the remote service that supports the specified connection.
+     *          The options, which are not set in the configuration, have the values of NESocket::DefaultSocketProfile.
+     * \param   service     The string value of the remote service.
+     * \param   connectType The string value of the connection type, which name should be read out.
+     **/
+    NESocket::sSocketProfile getRemoteServiceSocketProfile(const String& service, const String& connectType) const;
+
+    /**
+     * \brief   Returns the profile of socket options of the remote service that supports the specified connection.
+     *          The options, which are not set in the configuration, have the values of NESocket::DefaultSocketProfile.
+     * \param   service     The remote service.
+     * \param   connectType The connection type, which name should be read out.
+     **/
+    NESocket::sSocketProfile getRemoteServiceSocketProfile(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const;
+
     /**
      * \brief   Returns the log database property entry of specified position.
      * \param   whichPosition   The position of log database property.
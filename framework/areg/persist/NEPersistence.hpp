@@ -151,31 +151,46 @@ namespace NEPersistence
         , EntryLogEnable            = 4     //!< The logging type (in target) enabled / disabled flag.
         , EntryLogFileLocation      = 5     //!< The log file location and file name mask.
         , EntryLogFileAppend        = 6     //!< The flag to append logs into the file.
-        , EntryLogRemoteQueueSize   = 7     //!< The queue size of remote logging.
-        , EntryLogRemoteService     = 8     //!< The service name of the remote logging.
-
-        , EntryLogDatabaseName      = 9     //!< The log database name.
-        , EntryLogDatabaseLocation  = 10    //!< The log database location.
-        , EntryLogDatabaseDriver    = 11    //!< The log database driver.
-        , EntryLogDatabaseAddress   = 12    //!< The log database address.
-        , EntryLogDatabasePort      = 13    //!< The log database port.
-        , EntryLogDatabaseUsername  = 14    //!< The log database user-name.
-        , EntryLogDatabasePassword  = 15    //!< The log database user-password.
-
-        , EntryLogLayoutEnter       = 16    //!< The layout of enter scope message.
-        , EntryLogLayoutMessage     = 17    //!< The layout of log message.
-        , EntryLogLayoutExit        = 18    //!< The layout of exit scope message.
-        , EntryLogScope             = 19    //!< The log scope enable / disable flag.
-
-        , EntryServiceList          = 20    //!< The list of supported remote services.
-
-        , EntryServiceName          = 21    //!< The process name of the remote service.
-        , EntryServiceConnection    = 22    //!< The list of connection type of the remote service.
-        , EntryServiceEnable        = 23    //!< The connection enable / disable flag of the remote service.
-        , EntryServiceAddress       = 24    //!< The connection address of the remote service.
-        , EntryServicePort          = 25    //!< The connection port number of the remote service.
-
-        , EntryAnyKey               = 26    //!< Indicates any key type.
+        , EntryLogFileSync          = 7     //!< The policy to synchronize the log file with the storage.
+        , EntryLogFileMaxSize       = 8     //!< The maximum size in megabytes of the log file to rotate.
+        , EntryLogFileInterval      = 9     //!< The time interval in minutes to rotate the log file.
+        , EntryLogFileKeep          = 10    //!< The number of rotated log files to keep.
+        , EntryLogFileCompress      = 11    //!< The flag to compress the rotated log files.
+        , EntryLogRemoteQueueSize   = 12    //!< The queue size of remote logging.
+        , EntryLogRemoteService     = 13    //!< The service name of the remote logging.
+        , EntryLogRemoteBatchSize   = 14    //!< The size of the batch of records in remote logging.
+
+        , EntryLogDatabaseName      = 15    //!< The log database name.
+        , EntryLogDatabaseLocation  = 16    //!< The log database location.
+        , EntryLogDatabaseDriver    = 17    //!< The log database driver.
+        , EntryLogDatabaseAddress   = 18    //!< The log database address.
+        , EntryLogDatabasePort      = 19    //!< The log database port.
+        , EntryLogDatabaseUsername  = 20    //!< The log database user-name.
+        , EntryLogDatabasePassword  = 21    //!< The log database user-password.
+        , EntryLogDatabasePartTime  = 22    //!< The time in minutes of a log database partition.
+        , EntryLogDatabasePartSize  = 23    //!< The size in megabytes of a log database partition.
+        , EntryLogDatabaseRetention = 24    //!< The time in minutes to keep the log database partitions.
+
+        , EntryLogLayoutEnter       = 25    //!< The layout of enter scope message.
+        , EntryLogLayoutMessage     = 26    //!< The layout of log message.
+        , EntryLogLayoutExit        = 27    //!< The layout of exit scope message.
+        , EntryLogScope             = 28    //!< The log scope enable / disable flag.
+
+        , EntryServiceList          = 29    //!< The list of supported remote services.
+
+        , EntryServiceName          = 30    //!< The process name of the remote service.
+        , EntryServiceConnection    = 31    //!< The list of connection type of the remote service.
+        , EntryServiceEnable        = 32    //!< The connection enable / disable flag of the remote service.
+        , EntryServiceAddress       = 33    //!< The connection address of the remote service.
+        , EntryServicePort          = 34    //!< The connection port number of the remote service.
+        , EntryServiceQueue         = 35    //!< The limit of queued data to send to a client of the remote service.
+        , EntryServiceNoDelay       = 36    //!< The flag to send small messages of the remote service connection without delay.
+        , EntryServiceKeepAlive     = 37    //!< The flag to enable keep-alive probes of the remote service connection.
+        , EntryServiceBuffer        = 38    //!< The size of socket buffers of the remote service connection.
+        , EntryServiceBusyPoll      = 39    //!< The time in microseconds to busy poll the socket of the remote service connection.
+        , EntryServiceWorkers       = 40    //!< The number of threads to send and receive messages of the remote service connection.
+
+        , EntryAnyKey               = 41    //!< Indicates any key type.
     };
 
     /**
@@ -191,31 +206,46 @@ namespace NEPersistence
             , {"log"    , "*"   , "enable"  , "*"       }   //! 4   , The logging type (in target) enabled / disabled flag property structure.
             , {"log"    , "*"   , "file"    , "location"}   //! 5   , The log file location and file name mask property structure.
             , {"log"    , "*"   , "file"    , "append"  }   //! 6   , The flag to append logs into the file property structure.
-            , {"log"    , "*"   , "remote"  , "queue"   }   //! 7   , The queue size of remote logging property structure.
-            , {"log"    , "*"   , "remote"  , "service" }   //! 8   , The service name of the remote logging.
+            , {"log"    , "*"   , "file"    , "sync"    }   //! 7   , The policy to synchronize the log file with the storage property structure.
+            , {"log"    , "*"   , "file"    , "maxsize" }   //! 8   , The maximum size in megabytes of the log file to rotate property structure.
+            , {"log"    , "*"   , "file"    , "interval"}   //! 9   , The time interval in minutes to rotate the log file property structure.
+            , {"log"    , "*"   , "file"    , "keep"    }   //! 10  , The number of rotated log files to keep property structure.
+            , {"log"    , "*"   , "file"    , "compress"}   //! 11  , The flag to compress the rotated log files property structure.
+            , {"log"    , "*"   , "remote"  , "queue"   }   //! 12  , The queue size of remote logging property structure.
+            , {"log"    , "*"   , "remote"  , "service" }   //! 13  , The service name of the remote logging.
+            , {"log"    , "*"   , "remote"  , "batch"   }   //! 14  , The size of the batch of records in remote logging.
         
-            , {"log"    , "*"   , "db"      , "name"    }   //! 9   , The name of the log database.
-            , {"log"    , "*"   , "db"      , "location"}   //! 10  , The location of log database.
-            , {"log"    , "*"   , "db"      , "driver"  }   //! 11  , The log database driver.
-            , {"log"    , "*"   , "db"      , "address" }   //! 12  , The address of the remote log database engine (DB Server).
-            , {"log"    , "*"   , "db"      , "port"    }   //! 13  , The port of the remote log database engine (DB Server).
-            , {"log"    , "*"   , "db"      , "username"}   //! 14  , The user name to log-in into the log database.
-            , {"log"    , "*"   , "db"      , "password"}   //! 15  , The user password to log-in into the log database.
-
-            , {"log"    , "*"   , "layout"  , "enter"   }   //! 16  , The layout of enter scope message property structure.
-            , {"log"    , "*"   , "layout"  , "message" }   //! 17  , The layout of log message property structure.
-            , {"log"    , "*"   , "layout"  , "exit"    }   //! 18  , The layout of exit scope message property structure.
-            , {"log"    , "*"   , "scope"   , "*"       }   //! 19  , The log scope enable / disable flag property structure.
-
-            , {"service", "*"   , "list"    , ""        }   //! 20  , The list of supported remote services property structure.
-
-            , {"*"      , "*"   , "service" , ""        }   //! 21  , The process name of the remote service property structure.
-            , {"*"      , "*"   , "connect" , ""        }   //! 22  , The list of connection type of the remote service property structure.
-            , {"*"      , "*"   , "enable"  , "*"       }   //! 23  , The connection enable / disable flag of the remote service property structure.
-            , {"*"      , "*"   , "address" , "*"       }   //! 24  , The connection address of the remote service property structure.
-            , {"*"      , "*"   , "port"    , "*"       }   //! 25  , The connection port number of the remote service property structure.
-
-            , {"*"      , "*"   , "*"       , "*"       }   //! 26  , Indicates any key type.
+            , {"log"    , "*"   , "db"      , "name"    }   //! 15  , The name of the log database.
+            , {"log"    , "*"   , "db"      , "location"}   //! 16  , The location of log database.
+            , {"log"    , "*"   , "db"      , "driver"  }   //! 17  , The log database driver.
+            , {"log"    , "*"   , "db"      , "address" }   //! 18  , The address of the remote log database engine (DB Server).
+            , {"log"    , "*"   , "db"      , "port"    }   //! 19  , The port of the remote log database engine (DB Server).
+            , {"log"    , "*"   , "db"      , "username"}   //! 20  , The user name to log-in into the log database.
+            , {"log"    , "*"   , "db"      , "password"}   //! 21  , The user password to log-in into the log database.
+            , {"log"    , "*"   , "db"      , "parttime"}   //! 22  , The time in minutes of a log database partition.
+            , {"log"    , "*"   , "db"      , "partsize"}   //! 23  , The size in megabytes of a log database partition.
+            , {"log"    , "*"   , "db"      , "retention"}  //! 24  , The time in minutes to keep the log database partitions.
+
+            , {"log"    , "*"   , "layout"  , "enter"   }   //! 25  , The layout of enter scope message property structure.
+            , {"log"    , "*"   , "layout"  , "message" }   //! 26  , The layout of log message property structure.
+            , {"log"    , "*"   , "layout"  , "exit"    }   //! 27  , The layout of exit scope message property structure.
+            , {"log"    , "*"   , "scope"   , "*"       }   //! 28  , The log scope enable / disable flag property structure.
+
+            , {"service", "*"   , "list"    , ""        }   //! 29  , The list of supported remote services property structure.
+
+            , {"*"      , "*"   , "service" , ""        }   //! 30  , The process name of the remote service property structure.
+            , {"*"      , "*"   , "connect" , ""        }   //! 31  , The list of connection type of the remote service property structure.
+            , {"*"      , "*"   , "enable"  , "*"       }   //! 32  , The connection enable / disable flag of the remote service property structure.
+            , {"*"      , "*"   , "address" , "*"       }   //! 33  , The connection address of the remote service property structure.
+            , {"*"      , "*"   , "port"    , "*"       }   //! 34  , The connection port number of the remote service property structure.
+            , {"*"      , "*"   , "queue"   , "*"       }   //! 35  , The limit of queued data to send to a client of the remote service property structure.
+            , {"*"      , "*"   , "nodelay" , "*"       }   //! 36  , The flag to send small messages without delay property structure.
+            , {"*"      , "*"   , "keepalive", "*"      }   //! 37  , The flag to enable keep-alive probes property structure.
+            , {"*"      , "*"   , "buffer"  , "*"       }   //! 38  , The size of socket buffers property structure.
+            , {"*"      , "*"   , "busypoll", "*"       }   //! 39  , The time in microseconds to busy poll the socket property structure.
+            , {"*"      , "*"   , "workers" , "*"       }   //! 40  , The number of threads to send and receive messages property structure.
+
+            , {"*"      , "*"   , "*"       , "*"       }   //! 41  , Indicates any key type.
         };
 
     /**
@@ -253,11 +283,41 @@ namespace NEPersistence
      **/
     inline const NEPersistence::sPropertyKey& getLogFileAppend(void);
 
+    /**
+     * \brief   Returns the policy to synchronize the log file with the storage property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileSync(void);
+
+    /**
+     * \brief   Returns the maximum size in megabytes of the log file to rotate property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileMaxSize(void);
+
+    /**
+     * \brief   Returns the time interval in minutes to rotate the log file property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileInterval(void);
+
+    /**
+     * \brief   Returns the number of rotated log files to keep property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileKeep(void);
+
+    /**
+     * \brief   Returns the flag to compress the rotated log files property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileCompress(void);
+
     /**
      * \brief   Returns the queue size of remote logging property structure.
      **/
     inline const NEPersistence::sPropertyKey& getLogRemoteQueueSize(void);
 
+    /**
+     * \brief   Returns the size of the batch of records in remote logging property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogRemoteBatchSize(void);
+
     /**
      * \brief   Returns the layout of enter scope message property structure.
      **/
@@ -308,6 +368,36 @@ namespace NEPersistence
      **/
     inline const NEPersistence::sPropertyKey& getServicePort(void);
 
+    /**
+     * \brief   Returns the limit of queued data to send to a client of the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceQueue(void);
+
+    /**
+     * \brief   Returns the flag to send small messages of the remote service connection without delay property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceNoDelay(void);
+
+    /**
+     * \brief   Returns the flag to enable keep-alive probes of the remote service connection property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceKeepAlive(void);
+
+    /**
+     * \brief   Returns the size of socket buffers of the remote service connection property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceBuffer(void);
+
+    /**
+     * \brief   Returns the time in microseconds to busy poll the socket of the remote service connection property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceBusyPoll(void);
+
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the remote service connection property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceWorkers(void);
+
     /**
      * \brief   Returns the log database name.
      **/
@@ -343,6 +433,21 @@ namespace NEPersistence
      * \brief   The password to use when connect to the database engine.
      **/
     inline const NEPersistence::sPropertyKey& getLogDatabasePassword(void);
+
+    /**
+     * \brief   Returns the time in minutes of a log database partition.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabasePartTime(void);
+
+    /**
+     * \brief   Returns the size in megabytes of a log database partition.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabasePartSize(void);
+
+    /**
+     * \brief   Returns the time in minutes to keep the log database partitions.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseRetention(void);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -389,11 +494,41 @@ inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileAppend(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileAppend)];
 }
 
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileSync(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileSync)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileMaxSize(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileMaxSize)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileInterval(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileInterval)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileKeep(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileKeep)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogFileCompress(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileCompress)];
+}
+
 inline const NEPersistence::sPropertyKey& NEPersistence::getLogRemoteQueueSize(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRemoteQueueSize)];
 }
 
+inline const NEPersistence::sPropertyKey& NEPersistence::getLogRemoteBatchSize(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRemoteBatchSize)];
+}
+
 inline const NEPersistence::sPropertyKey& NEPersistence::getLogLayoutEnter(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogLayoutEnter)];
@@ -439,6 +574,36 @@ inline const NEPersistence::sPropertyKey& NEPersistence::getServicePort(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServicePort)];
 }
 
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceQueue(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceQueue)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceNoDelay(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceNoDelay)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceKeepAlive(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceKeepAlive)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceBuffer(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceBuffer)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceBusyPoll(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceBusyPoll)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceWorkers(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceWorkers)];
+}
+
 const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseName(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseName)];
@@ -474,4 +639,19 @@ const NEPersistence::sPropertyKey& NEPersistence::getLogDatabasePassword(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabasePassword)];
 }
 
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabasePartTime(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabasePartTime)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabasePartSize(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabasePartSize)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseRetention(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseRetention)];
+}
+
 #endif  // AREG_PERSIST_NEPERSISTEN_HPP
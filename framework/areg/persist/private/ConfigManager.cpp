@@ -685,6 +685,91 @@ void ConfigManager::setLogFileAppend(bool newValue, bool isTemporary /*= false*/
     setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
 }
 
+String ConfigManager::getLogFileSync(void) const
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileSync;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileSync();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getString() : String(NEApplication::DEFAULT_LOG_FILE_SYNC));
+}
+
+void ConfigManager::setLogFileSync(const String& newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileSync;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileSync();
+    setModuleProperty(key.section, key.property, key.position, newValue, confKey, isTemporary);
+}
+
+uint32_t ConfigManager::getLogFileMaxSize(void) const
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileMaxSize;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileMaxSize();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : 0u);
+}
+
+void ConfigManager::setLogFileMaxSize(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileMaxSize;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileMaxSize();
+    setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::getLogFileInterval(void) const
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileInterval;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileInterval();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : 0u);
+}
+
+void ConfigManager::setLogFileInterval(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileInterval;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileInterval();
+    setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+uint32_t ConfigManager::getLogFileKeep(void) const
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileKeep;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileKeep();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : 0u);
+}
+
+void ConfigManager::setLogFileKeep(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileKeep;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileKeep();
+    setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+bool ConfigManager::getLogFileCompress(void) const
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileCompress;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileCompress();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getBoolean() : false);
+}
+
+void ConfigManager::setLogFileCompress(bool newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogFileCompress;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileCompress();
+    setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
 uint32_t ConfigManager::getLogRemoteQueueSize(void) const
 {
     Lock lock(mLock);
@@ -704,6 +789,25 @@ void ConfigManager::setLogRemoteQueueSize(uint32_t newValue, bool isTemporary /*
     setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
 }
 
+uint32_t ConfigManager::getLogRemoteBatchSize(void) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogRemoteBatchSize;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRemoteBatchSize();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_LOG_BATCH_SIZE);
+}
+
+void ConfigManager::setLogRemoteBatchSize(uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryLogRemoteBatchSize;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRemoteBatchSize();
+    setModuleProperty(key.section, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
 String ConfigManager::getLogLayoutEnter(void) const
 {
     Lock lock(mLock);
@@ -1049,6 +1153,80 @@ void ConfigManager::setRemoteServicePort(NERemoteService::eRemoteServices servic
     setRemoteServicePort(service, connect, newValue, isTemporary);
 }
 
+uint32_t ConfigManager::getRemoteServiceQueue(const String& service, const String& connectType) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceQueue;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceQueue();
+    const PropertyValue* value = getPropertyValue(service, key.property, connectType, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_SEND_QUEUE_SIZE);
+}
+
+uint32_t ConfigManager::getRemoteServiceQueue(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    const String & connect = Identifier::convToString(static_cast<unsigned int>(connectType)
+                                                    , NEApplication::ConnectionIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUndefined));
+    return getRemoteServiceQueue(service, connect);
+}
+
+uint32_t ConfigManager::getRemoteServiceWorkers(const String& service, const String& connectType) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWorkers;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWorkers();
+    const PropertyValue* value = getPropertyValue(service, key.property, connectType, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_SERVICE_WORKERS);
+}
+
+uint32_t ConfigManager::getRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    const String & connect = Identifier::convToString(static_cast<unsigned int>(connectType)
+                                                    , NEApplication::ConnectionIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUndefined));
+    return getRemoteServiceWorkers(service, connect);
+}
+
+NESocket::sSocketProfile ConfigManager::getRemoteServiceSocketProfile(const String& service, const String& connectType) const
+{
+    Lock lock(mLock);
+
+    NESocket::sSocketProfile result{ NESocket::DefaultSocketProfile };
+
+    const PropertyValue* value = getPropertyValue(service, NEPersistence::getServiceNoDelay().property, connectType, NEPersistence::eConfigKeys::EntryServiceNoDelay);
+    result.spNoDelay = (value != nullptr ? value->getBoolean() : result.spNoDelay);
+
+    value = getPropertyValue(service, NEPersistence::getServiceKeepAlive().property, connectType, NEPersistence::eConfigKeys::EntryServiceKeepAlive);
+    result.spKeepAlive = (value != nullptr ? value->getBoolean() : result.spKeepAlive);
+
+    value = getPropertyValue(service, NEPersistence::getServiceBuffer().property, connectType, NEPersistence::eConfigKeys::EntryServiceBuffer);
+    result.spBufferSize = (value != nullptr ? value->getInteger() : result.spBufferSize);
+
+    value = getPropertyValue(service, NEPersistence::getServiceBusyPoll().property, connectType, NEPersistence::eConfigKeys::EntryServiceBusyPoll);
+    result.spBusyPoll = (value != nullptr ? value->getInteger() : result.spBusyPoll);
+
+    return result;
+}
+
+NESocket::sSocketProfile ConfigManager::getRemoteServiceSocketProfile(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    const String & connect = Identifier::convToString(static_cast<unsigned int>(connectType)
+                                                    , NEApplication::ConnectionIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eConnectionTypes::ConnectUndefined));
+    return getRemoteServiceSocketProfile(service, connect);
+}
+
 String ConfigManager::getLogDatabaseProperty(const String& whichPosition)
 {
     const NEPersistence::sPropertyKey& key = NEPersistence::getLogDatabaseName();
@@ -19,10 +19,13 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/NEMath.hpp"
 #include "areg/trace/NETrace.hpp"
 #include "areg/trace/TraceScope.hpp"
 #include "areg/trace/TraceMessage.hpp"
 
+#include <type_traits>
+
 /**
  * \brief   Use these MACRO instead of direct declaration of scopes
  *          and messaging. The MACRO gives possibility to compile application(s)
@@ -139,9 +142,10 @@
     #define TRACER_STOP_LOGGING()                       NETrace::stopLogging( true )
 
     /**
-     * \brief   Use this macro to define scope in source code. This will create scope variable and set name
+     * \brief   Use this macro to define scope in source code. This will create scope variable and set name.
+     *          The ID of the scope is calculated from the name at compile time.
      **/
-    #define DEF_TRACE_SCOPE(scope)                      static TraceScope _##scope( #scope )
+    #define DEF_TRACE_SCOPE(scope)                      static TraceScope _##scope( #scope, std::integral_constant<unsigned int, NEMath::crc32Constexpr(#scope)>::value )
 
     /**
      * \brief   Use this macro to define message object by passing scope in constructor.
@@ -152,24 +156,26 @@
 
     /**
      * \brief   Use this macro to log Debug priority messages in logging target (file or remote host)
+     *          If the format is a character array, the message is formatted in the logging thread.
+     *          Only the format, which is a string literal, is not copied.
      **/
-    #define TRACE_DBG(...)                              if (_messager.isDbgEnabled())   _messager.logMessage( NETrace::PrioDebug    , __VA_ARGS__ )
+    #define TRACE_DBG(...)                              if (_messager.isDbgEnabled())   _messager.logDeferred<TraceMessage::isLiteralFormat( #__VA_ARGS__ )>( NETrace::PrioDebug    , __VA_ARGS__ )
     /**
      * \brief   Use this macro to log Information priority messages in logging target (file or remote host)
      **/
-    #define TRACE_INFO(...)                             if (_messager.isInfoEnabled())  _messager.logMessage( NETrace::PrioInfo     , __VA_ARGS__ )
+    #define TRACE_INFO(...)                             if (_messager.isInfoEnabled())  _messager.logDeferred<TraceMessage::isLiteralFormat( #__VA_ARGS__ )>( NETrace::PrioInfo     , __VA_ARGS__ )
     /**
      * \brief   Use this macro to log Warning priority messages in logging target (file or remote host)
      **/
-    #define TRACE_WARN(...)                             if (_messager.isWarnEnabled())  _messager.logMessage( NETrace::PrioWarning  , __VA_ARGS__ )
+    #define TRACE_WARN(...)                             if (_messager.isWarnEnabled())  _messager.logDeferred<TraceMessage::isLiteralFormat( #__VA_ARGS__ )>( NETrace::PrioWarning  , __VA_ARGS__ )
     /**
      * \brief   Use this macro to log Error priority messages in logging target (file or remote host)
      **/
-    #define TRACE_ERR(...)                              if (_messager.isErrEnabled())   _messager.logMessage( NETrace::PrioError    , __VA_ARGS__ )
+    #define TRACE_ERR(...)                              if (_messager.isErrEnabled())   _messager.logDeferred<TraceMessage::isLiteralFormat( #__VA_ARGS__ )>( NETrace::PrioError    , __VA_ARGS__ )
     /**
      * \brief   Use this macro to log Fatal Error priority messages in logging target (file or remote host)
      **/
-    #define TRACE_FATAL(...)                            if (_messager.isFatalEnabled()) _messager.logMessage( NETrace::PrioFatal    , __VA_ARGS__ )
+    #define TRACE_FATAL(...)                            if (_messager.isFatalEnabled()) _messager.logDeferred<TraceMessage::isLiteralFormat( #__VA_ARGS__ )>( NETrace::PrioFatal    , __VA_ARGS__ )
 
     /**
      * \brief   Use this macro to define global scope and global message object.
@@ -179,7 +185,7 @@
      **/
     #define GLOBAL_TRACE_SCOPE(scope)                   static TraceMessage & _getGlobalScope( void )   \
                                                         {                                               \
-                                                            static TraceScope     _##scope(#scope);     \
+                                                            static TraceScope     _##scope(#scope, std::integral_constant<unsigned int, NEMath::crc32Constexpr(#scope)>::value); \
                                                             static TraceMessage  _messager(_##scope);   \
                                                             static bool isActivated { false };          \
                                                             if (isActivated == false)                   \
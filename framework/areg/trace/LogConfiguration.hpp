@@ -25,6 +25,7 @@
 #include "areg/persist/Property.hpp"
 #include "areg/trace/NETrace.hpp"
 
+#include <string_view>
 #include <vector>
 
 /************************************************************************
@@ -42,6 +43,16 @@ class ScopeController;
  **/
 class AREG_API LogConfiguration
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The policy to never synchronize the log file with the storage device.
+    static constexpr std::string_view   SYNC_NEVER  { "never" };
+    //!< The policy to synchronize the log file after writing every batch of log messages.
+    static constexpr std::string_view   SYNC_BATCH  { "batch" };
+    //!< The policy to synchronize the log file after writing an error message.
+    static constexpr std::string_view   SYNC_ERROR  { "error" };
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Protected
@@ -122,6 +133,12 @@ public:
     uint32_t getStackSize( void ) const;
     void setStackSize( uint32_t prop );
 
+    /**
+     * \brief   Gets and sets property value of the size of the batch of log records.
+     **/
+    uint32_t getBatchSize( void ) const;
+    void setBatchSize( uint32_t prop );
+
     /**
      * \brief   Gets and sets property value of logging status (enabled / disabled).
      **/
@@ -134,6 +151,39 @@ public:
     bool getAppendData( void ) const;
     void setAppendData( bool prop );
 
+    /**
+     * \brief   Gets and sets property value of the policy to synchronize the log file.
+     **/
+    NETrace::eLogFileSync getFileSync( void ) const;
+    void setFileSync( NETrace::eLogFileSync prop );
+
+    /**
+     * \brief   Gets and sets property value of the size in megabytes to rotate the log file.
+     *          The value 0 means that the log file is not rotated by size.
+     **/
+    uint32_t getFileMaxSize( void ) const;
+    void setFileMaxSize( uint32_t megabytes, bool isTemporary = false );
+
+    /**
+     * \brief   Gets and sets property value of the time interval in minutes to rotate the log file.
+     *          The value 0 means that the log file is not rotated by time.
+     **/
+    uint32_t getFileInterval( void ) const;
+    void setFileInterval( uint32_t minutes, bool isTemporary = false );
+
+    /**
+     * \brief   Gets and sets property value of the number of rotated log files to keep.
+     *          The value 0 means to keep all rotated log files.
+     **/
+    uint32_t getFileKeep( void ) const;
+    void setFileKeep( uint32_t count, bool isTemporary = false );
+
+    /**
+     * \brief   Gets and sets property value of the flag to compress the rotated log files.
+     **/
+    bool getFileCompress( void ) const;
+    void setFileCompress( bool prop, bool isTemporary = false );
+
     /**
      * \brief   Gets and sets property value of file logging setting.
      **/
@@ -202,6 +252,27 @@ public:
     void setDatabaseUser(const NESocket::UserData& dbUser, bool isTemporary = false);
     void setDatabaseUser(const String& dbUserName, const String& dbUserPassword, bool isTemporary = false);
 
+    /**
+     * \brief   Gets and sets the time in minutes to log in a single partition of the database.
+     *          The value 0 means that the partitions are not limited by time.
+     **/
+    uint32_t getDatabasePartitionTime(void) const;
+    void setDatabasePartitionTime(uint32_t minutes, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the size in megabytes of a single partition of the database.
+     *          The value 0 means that the partitions are not limited by size.
+     **/
+    uint32_t getDatabasePartitionSize(void) const;
+    void setDatabasePartitionSize(uint32_t megabytes, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the time in minutes to keep the partitions of the database.
+     *          The older partitions are dropped. The value 0 means to keep all partitions.
+     **/
+    uint32_t getDatabaseRetention(void) const;
+    void setDatabaseRetention(uint32_t minutes, bool isTemporary = false);
+
     /**
      * \brief   Saves the configuration in the current config file.
      **/
@@ -0,0 +1,151 @@
+#ifndef AREG_TRACE_LOGSOURCENAMES_HPP
+#define AREG_TRACE_LOGSOURCENAMES_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/trace/LogSourceNames.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the table of thread and module names of
+ *              the remote log sources.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/trace/NETrace.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// LogSourceNames class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The table of names of the remote log sources. The compact log records
+ *          contain the names of the thread and the module only once per connection.
+ *          The receiver of the records keeps the names in the table and sets them
+ *          in the decoded log messages. The names are kept per cookie of the log source
+ *          and should be removed when the log source disconnects.
+ *          The object is not thread safe.
+ **/
+class AREG_API LogSourceNames
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   LogSourceNames::sSourceNames
+     *          The names of a single log source.
+     **/
+    struct sSourceNames
+    {
+        //!< The name of the module.
+        String                      snModule;
+        //!< The names of the threads, where the key is the ID of the thread.
+        TEHashMap<ITEM_ID, String>  snThreads;
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogSourceNames( void );
+
+    ~LogSourceNames( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Decodes the next log record of the message, which may contain a single
+     *          record or a batch of records. If the record contains the names, saves them
+     *          in the table. Otherwise, sets the names from the table. The records, which
+     *          contain only names, are skipped. The decoding starts at the position 0 and
+     *          continues until the method returns false.
+     * \param   msgLog          The message with the log records.
+     * \param   position        On input, the position of the record to decode.
+     *                          On output, the position of the next record.
+     * \param   out_logMessage  On output, contains the decoded log message.
+     * \return  Returns true if decoded the message to log. Returns false if there
+     *          are no more records to log or the record is invalid.
+     **/
+    bool decodeMessage( const RemoteMessage & msgLog, uint32_t & IN OUT position, NETrace::sLogMessage & OUT out_logMessage );
+
+    /**
+     * \brief   Decodes the next log record of the message, which may contain a single
+     *          record or a batch of records. Unlike decodeMessage(), the records, which
+     *          contain only names, are not skipped, so that the caller can check the flags.
+     * \param   msgLog          The message with the log records.
+     * \param   position        On input, the position of the record to decode.
+     *                          On output, the position of the next record.
+     * \param   out_logMessage  On output, contains the decoded log message.
+     * \param   out_flags       On output, contains the flags of the decoded record.
+     * \return  Returns true if decoded the record. Returns false if there are no more
+     *          records or the record is invalid.
+     **/
+    bool decodeRecord( const RemoteMessage & msgLog, uint32_t & IN OUT position, NETrace::sLogMessage & OUT out_logMessage, unsigned char & OUT out_flags );
+
+    /**
+     * \brief   Creates the list of messages with the names of every known thread
+     *          of log sources, to send to the specified target.
+     * \param   target      The cookie of the target to receive the names.
+     * \param   out_list    On output, contains the list of messages to send.
+     **/
+    void createNamesMessages( const ITEM_ID & target, TEArrayList<RemoteMessage> & OUT out_list ) const;
+
+    /**
+     * \brief   Removes the names of the specified log source.
+     * \param   cookie      The cookie of the log source.
+     **/
+    void removeSource( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Removes all names.
+     **/
+    void removeAll( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Saves the names of the decoded record in the table or sets the names from the table.
+     * \param   cookie      The cookie of the log source.
+     * \param   logMessage  The decoded log message to save or set the names.
+     * \param   flags       The flags of the decoded record.
+     * \return  Returns false if the record contains only names. Otherwise, returns true.
+     **/
+    bool _applyNames( const ITEM_ID & cookie, NETrace::sLogMessage & IN OUT logMessage, unsigned char flags );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The names of the log sources, where the key is the cookie of the source.
+     **/
+    TEHashMap<ITEM_ID, sSourceNames>    mSources;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogSourceNames );
+};
+
+#endif  // AREG_TRACE_LOGSOURCENAMES_HPP
@@ -101,6 +101,17 @@ namespace NETrace
         , LogTypeDatabase   = 8 //!< Logging is in database, not implemented yet.
     };
 
+    /**
+     * \brief   NETrace::eLogFileSync
+     *          The policy to synchronize the log file with the storage device.
+     **/
+    enum class eLogFileSync : unsigned char
+    {
+          SyncNever     = 0 //!< Never synchronize, the operating system decides when to write the data.
+        , SyncBatch     = 1 //!< Synchronize after writing every batch of log messages.
+        , SyncError     = 2 //!< Synchronize after writing a fatal error or error message.
+    };
+
     /**
      * \brief   NETrace::eLogPriority
      *          Log priority definition set when logging message
@@ -276,6 +287,29 @@ namespace NETrace
     {
           LogDataLocal          = 0 //!< The message data is generated locally.
         , LogDataRemote         = 1 //!< The message data is prepared for remote logging.
+        , LogDataCompact        = 2 //!< The message data is encoded as a compact record for remote logging.
+        , LogDataBatch          = 3 //!< The message data contains a batch of compact records for remote logging.
+    };
+
+    /**
+     * \brief   NETrace::LOG_COMPACT_VERSION
+     *          The version of the compact log record.
+     **/
+    constexpr unsigned char LOG_COMPACT_VERSION { 1 };
+
+    /**
+     * \brief   NETrace::eLogCompactFlags
+     *          The flags of the compact log record, which indicate the optional
+     *          fields of the record. The names of the thread and the module are sent
+     *          once per connection and the receiver keeps them in the table of names.
+     **/
+    enum eLogCompactFlags : unsigned char
+    {
+          CompactNoNames        = 0x00  //!< The record contains neither thread, nor module name.
+        , CompactThreadName     = 0x01  //!< The record contains the name of the thread.
+        , CompactModuleName     = 0x02  //!< The record contains the name of the module.
+        , CompactNamesOnly      = 0x04  //!< The record contains only names and has no message to log.
+        , CompactAllNames       = 0x03  //!< The record contains the names of thread and module.
     };
 
     /**
@@ -327,6 +361,26 @@ namespace NETrace
         char                        logModule[LOG_NAMES_SIZE];  //!< The name of the module that generated the log. Valid only for remote logging.
     };
 
+    /**
+     * \brief   NETrace::sLogFilter
+     *          The filter of log messages, which the log observer sets at the logger service
+     *          to receive only the matching messages. The empty list of sources or scopes
+     *          matches any source or any scope. The scope groups are the names of scopes,
+     *          where the name ending with '*' matches any scope with the same prefix.
+     *          The priority is the lowest priority of text messages to receive, for example
+     *          NETrace::PrioWarning passes warning, error and fatal error messages.
+     *          The message types is the bitwise combination of NETrace::eLogMessageType values,
+     *          where 0 matches any message type.
+     **/
+    struct sLogFilter
+    {
+        TEArrayList<ITEM_ID>    lfSources;                          //!< The cookies of the log sources.
+        TEArrayList<uint32_t>   lfScopes;                           //!< The IDs of the scopes.
+        TEArrayList<String>     lfScopeGroups;                      //!< The names or the prefixes of the scopes.
+        NETrace::eLogPriority   lfPriority  { NETrace::PrioDebug }; //!< The lowest priority of text messages.
+        uint32_t                lfMsgTypes  { 0u };                 //!< The bitwise combination of message types.
+    };
+
     /**
      * \brief   Start logging. If specified file is not nullptr, it configures logging first, then starts logging.
      * \param   fileConfig  The relative or absolute path to logging configuration file.
@@ -467,6 +521,122 @@ namespace NETrace
      **/
     AREG_API RemoteMessage createLogMessage(const NETrace::sLogMessage& logMessage, NETrace::eLogDataType dataType, const ITEM_ID & srcCookie);
 
+    /**
+     * \brief   Creates a network communication message with the compact log record.
+     *          Unlike the message created by createLogMessage(), the record contains
+     *          variable length encoded IDs and timestamp, the length prefixed text
+     *          and optionally the names of the thread and the module. The cookie of
+     *          the source is not part of the record, it is the source of the message.
+     * \param   logMessage  The message log structure.
+     * \param   srcCookie   The source of cookie to set in the message.
+     * \param   flags       The bitwise combination of NETrace::eLogCompactFlags values
+     *                      to indicate, whether the names of the thread and the module
+     *                      should be included in the record.
+     * \return  Returns message object for network communication.
+     **/
+    AREG_API RemoteMessage createCompactLogMessage(const NETrace::sLogMessage& logMessage, const ITEM_ID& srcCookie, unsigned char flags);
+
+    /**
+     * \brief   Creates a network communication message with the compact record, which
+     *          contains only the names of the thread and the module of the log source.
+     *          The logger sends such records to the observers, which connected after
+     *          the log source sent the names.
+     * \param   source      The cookie of the log source.
+     * \param   target      The cookie of the target to receive the names.
+     * \param   threadId    The ID of the thread in the log source.
+     * \param   threadName  The name of the thread.
+     * \param   moduleName  The name of the module.
+     * \return  Returns message object for network communication.
+     **/
+    AREG_API RemoteMessage createCompactLogNames(const ITEM_ID& source, const ITEM_ID& target, const ITEM_ID& threadId, const String& threadName, const String& moduleName);
+
+    /**
+     * \brief   Returns the flags of the compact log record in the message.
+     *          Returns NETrace::CompactNoNames if the message does not contain compact record.
+     * \param   msgLog      The message with the log record.
+     **/
+    AREG_API unsigned char getCompactLogFlags(const RemoteMessage& msgLog);
+
+    /**
+     * \brief   Decodes the log record of the message. The message may contain either the
+     *          compact record or the structure NETrace::sLogMessage sent by the earlier
+     *          versions. The cookie of the decoded structure is the source of the message.
+     *          The names, which are not part of the record, remain empty.
+     * \param   msgLog          The message with the log record.
+     * \param   out_logMessage  On output, contains the decoded data.
+     * \param   out_flags       On output, contains the flags of the record.
+     *                          The structure NETrace::sLogMessage always contains the names.
+     * \return  Returns true if succeeded to decode the record.
+     **/
+    AREG_API bool readLogMessage(const RemoteMessage& msgLog, NETrace::sLogMessage& OUT out_logMessage, unsigned char& OUT out_flags);
+
+    /**
+     * \brief   Creates a network communication message to send a batch of compact log records.
+     *          The records are added by appendLogBatch(). Every record in the batch is
+     *          prefixed by its length, so that the receiver can skip the invalid record.
+     * \param   srcCookie   The source of cookie to set in the message.
+     * \param   reserve     The size in bytes to reserve in the message for the records.
+     * \return  Returns message object for network communication.
+     **/
+    AREG_API RemoteMessage createLogBatch(const ITEM_ID& srcCookie, uint32_t reserve);
+
+    /**
+     * \brief   Adds the compact log record at the end of the batch.
+     * \param   msgBatch    The message created by createLogBatch().
+     * \param   logMessage  The message log structure to add.
+     * \param   flags       The bitwise combination of NETrace::eLogCompactFlags values
+     *                      to indicate, whether the names of the thread and the module
+     *                      should be included in the record.
+     * \return  Returns true if the record is added to the batch.
+     **/
+    AREG_API bool appendLogBatch(RemoteMessage& msgBatch, const NETrace::sLogMessage& logMessage, unsigned char flags);
+
+    /**
+     * \brief   Adds the encoded record of the other batch at the end of the batch.
+     *          The record is copied as it is, without decoding. The positions are
+     *          the ones passed to and returned by readLogMessage().
+     * \param   msgBatch    The message created by createLogBatch().
+     * \param   msgSource   The batch of log records to copy the record.
+     * \param   begin       The position of the record to copy.
+     * \param   end         The position of the next record.
+     * \return  Returns true if the record is added to the batch.
+     **/
+    AREG_API bool appendLogBatch(RemoteMessage& msgBatch, const RemoteMessage& msgSource, uint32_t begin, uint32_t end);
+
+    /**
+     * \brief   Adds the record with only names of the thread and the module at the end of the batch.
+     *          The names are taken from the decoded log message, so that the receiver
+     *          keeps the names of the records, which are not added to the batch.
+     * \param   msgBatch    The message created by createLogBatch().
+     * \param   logMessage  The decoded log message with the names.
+     * \param   flags       The bitwise combination of NETrace::eLogCompactFlags values
+     *                      to indicate, which names should be included in the record.
+     * \return  Returns true if the record is added to the batch.
+     **/
+    AREG_API bool appendLogBatchNames(RemoteMessage& msgBatch, const NETrace::sLogMessage& logMessage, unsigned char flags);
+
+    /**
+     * \brief   Returns true if the message contains a batch of compact log records.
+     * \param   msgLog      The message with the log records.
+     **/
+    AREG_API bool isLogBatch(const RemoteMessage& msgLog);
+
+    /**
+     * \brief   Decodes the log record at the specified position of the message and sets
+     *          the position of the next record. If the message contains a batch, the
+     *          records are decoded one by one. Otherwise, the message contains the single
+     *          record at the position 0. The decoding starts at the position 0 and
+     *          continues until the method returns false.
+     * \param   msgLog          The message with the log records.
+     * \param   position        On input, the position of the record to decode.
+     *                          On output, the position of the next record.
+     * \param   out_logMessage  On output, contains the decoded data.
+     * \param   out_flags       On output, contains the flags of the record.
+     * \return  Returns true if succeeded to decode the record. Returns false
+     *          if there are no more records or the record is invalid.
+     **/
+    AREG_API bool readLogMessage(const RemoteMessage& msgLog, uint32_t& IN OUT position, NETrace::sLogMessage& OUT out_logMessage, unsigned char& OUT out_flags);
+
     /**
      * \brief   Triggers an event to log the message, contained in the remote buffer.
      * \param   message     The shared buffer with the information to log.
@@ -574,6 +744,17 @@ namespace NETrace
      **/
     AREG_API RemoteMessage messageConfigurationSaved(void);
 
+    /**
+     * \brief   Creates a message to send the filter of log messages to the logger service.
+     *          The logger forwards to the log observer only the messages, which match the filter.
+     *          The new filter replaces the previous one. The empty filter removes the filter.
+     * \param   source      The ID of the log observer, which sets the filter.
+     * \param   target      The target ID to receive the message, normally the ID of the logger service.
+     * \param   logFilter   The filter of log messages to set.
+     * \return  Returns generated message ready to send to the logger service.
+     **/
+    AREG_API RemoteMessage messageLogFilter(const ITEM_ID& source, const ITEM_ID& target, const NETrace::sLogFilter& logFilter);
+
     /**
      * \brief   Call to set external logging database engine.
      **/
@@ -640,6 +821,28 @@ inline IEOutStream& operator << (IEOutStream& stream, const NETrace::sScopeInfo
     return stream;
 }
 
+/**
+ * \brief   De-serializes the filter of log messages from the stream.
+ * \param   stream  The source of data that contains the filter of log messages.
+ * \param   input   On output this contains the filter of log messages.
+ **/
+inline const IEInStream& operator >> (const IEInStream& stream, NETrace::sLogFilter & input)
+{
+    stream >> input.lfSources >> input.lfScopes >> input.lfScopeGroups >> input.lfPriority >> input.lfMsgTypes;
+    return stream;
+}
+
+/**
+ * \brief   Serializes the filter of log messages to the stream.
+ * \param   stream  The streaming object to save the filter of log messages.
+ * \param   output  The source of the filter of log messages.
+ **/
+inline IEOutStream& operator << (IEOutStream& stream, const NETrace::sLogFilter & output)
+{
+    stream << output.lfSources << output.lfScopes << output.lfScopeGroups << output.lfPriority << output.lfMsgTypes;
+    return stream;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // NETrace namespace inline methods
 //////////////////////////////////////////////////////////////////////////////
@@ -19,7 +19,12 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/trace/NETrace.hpp"
+#include "areg/base/String.hpp"
+
 #include <stdarg.h>
+#include <string.h>
+#include <tuple>
+#include <type_traits>
 
 /************************************************************************
  * Dependencies
@@ -46,6 +51,33 @@ class LogMessage;
  **/
 class AREG_API TraceMessage
 {
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The function to format the deferred log record on the logging thread.
+     * \param   buffer  The buffer to write the formatted message.
+     * \param   space   The space in the buffer, including the null-terminating character.
+     * \param   format  The format of the message.
+     * \param   args    The packed arguments of the message.
+     * \return  Returns the number of characters written in the buffer.
+     **/
+    using FuncFormatRecord  = int (*)( char * /*buffer*/, int /*space*/, const char * /*format*/, const unsigned char * /*args*/ );
+
+    /**
+     * \brief   TraceMessage::RECORD_ARGS_SIZE
+     *          The maximum size in bytes of the packed arguments of the deferred log record,
+     *          including the copied strings. The longer strings are truncated.
+     **/
+    static constexpr unsigned int   RECORD_ARGS_SIZE    { NETrace::LOG_MESSAGE_IZE };
+
+    /**
+     * \brief   TraceMessage::RECORD_NULL_STRING
+     *          The offset of the packed string argument, which indicates nullptr.
+     **/
+    static constexpr uint32_t       RECORD_NULL_STRING  { 0xFFFFFFFFu };
+
 //////////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////////
@@ -136,6 +168,36 @@ public:
      **/
     void logMessage( NETrace::eLogPriority logPrio, const char * format, ...);
 
+    /**
+     * \brief   Logs message of given priority without checking whether the priority
+     *          is enabled or not. If the format is a character array and the arguments
+     *          are numbers, enumerations or pointers, the message is not formatted in
+     *          the calling thread. Instead, the format and the raw bytes of arguments
+     *          are queued, and the message is formatted in the logging thread.
+     *          Only the pointer to the format is queued if it is a string literal,
+     *          which has static storage. Otherwise, the format is copied in the record,
+     *          because the array may be a local variable or a member of the object.
+     *          The strings passed as 'const char *' are copied, the other pointers are
+     *          copied as addresses. In all other cases the message is formatted immediately,
+     *          the same as 'logMessage()' does.
+     * \tparam  IsLiteral   Flag, indicating whether the format is a string literal.
+     *                      Is set by logging macros, see isLiteralFormat().
+     * \param   logPrio     The logging priority of the message.
+     * \param   format      The format of message. Should be a character array to defer formatting.
+     * \param   args        The arguments of the message.
+     **/
+    template<bool IsLiteral, typename Format, typename ... Args>
+    inline void logDeferred( NETrace::eLogPriority logPrio, Format && format, Args ... args );
+
+    /**
+     * \brief   Returns true if the stringized arguments of the logging macro start
+     *          with a string literal, i.e. the format of the message is a string literal.
+     *          The macro arguments, which start with a macro name or a variable,
+     *          are not considered as literals.
+     * \param   macroArgs   The arguments of the logging macro converted to string.
+     **/
+    static constexpr bool isLiteralFormat( const char * macroArgs );
+
     /**
      * \brief   Returns true if for message tracer object logging the message scope is enabled.
      **/
@@ -191,6 +253,76 @@ private:
      **/
     static void _sendLog( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, va_list args );
 
+    /**
+     * \brief   Formats the message and forwards to logging targets.
+     * \param   scopeId     The ID of trace scope to make messaging
+     * \param   msgPrio     The priority of message to output
+     * \param   format      The formated text to output, followed by arguments.
+     **/
+    static void _sendFormatted( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, ... );
+
+    /**
+     * \brief   Creates the deferred log record and forwards to logging targets.
+     *          The message is formatted in the logging thread.
+     * \param   scopeId     The ID of trace scope to make messaging
+     * \param   msgPrio     The priority of message to output
+     * \param   format      The format of the message. Should remain valid until the message is formatted.
+     * \param   formatter   The function to format the message in the logging thread.
+     * \param   args        The packed arguments of the message.
+     * \param   size        The size in bytes of the packed arguments.
+     **/
+    static void _sendRecord( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, FuncFormatRecord formatter, const unsigned char * args, unsigned int size );
+
+    /**
+     * \brief   Returns true if the argument is a string, which content is copied in the deferred log record.
+     **/
+    template<typename Arg>
+    static constexpr bool _isRecordString( void );
+
+    /**
+     * \brief   Returns true if the argument can be packed in the deferred log record.
+     *          These are the numbers, enumerations, strings and pointers to non-character types.
+     **/
+    template<typename Arg>
+    static constexpr bool _isRecordArgument( void );
+
+    /**
+     * \brief   Returns the size in bytes of the packed argument. The strings are packed as offsets.
+     **/
+    template<typename Arg>
+    static constexpr uint32_t _getRecordSize( void );
+
+    /**
+     * \brief   Packs the argument in the buffer of the deferred log record.
+     * \param   buffer      The buffer to pack the arguments. Contains RECORD_ARGS_SIZE bytes.
+     * \param   position    On input, the position to pack the argument. On output, the position of the next argument.
+     * \param   strings     On input, the position to copy the string. On output, the end of copied strings.
+     * \param   arg         The argument to pack.
+     **/
+    template<typename Arg>
+    static inline void _packRecordArg( unsigned char * buffer, uint32_t & IN OUT position, uint32_t & IN OUT strings, Arg arg );
+
+    /**
+     * \brief   Unpacks the argument from the buffer of the deferred log record.
+     * \param   args        The packed arguments.
+     * \param   position    On input, the position of the argument. On output, the position of the next argument.
+     **/
+    template<typename Arg>
+    static inline auto _unpackRecordArg( const unsigned char * args, uint32_t & IN OUT position );
+
+    /**
+     * \brief   Formats the deferred log record. Called in the logging thread.
+     **/
+    template<typename ... Args>
+    static int _formatRecord( char * buffer, int space, const char * format, const unsigned char * args );
+
+    /**
+     * \brief   Formats the deferred log record, which format is copied after the packed arguments.
+     *          Called in the logging thread. The parameter of the format is ignored.
+     **/
+    template<typename ... Args>
+    static int _formatCopiedRecord( char * buffer, int space, const char * format, const unsigned char * args );
+
 //////////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////////
@@ -255,6 +387,159 @@ inline bool TraceMessage::isPrioEnabled(NETrace::eLogPriority msgPrio) const
     return (msgPrio == NETrace::PrioScope ? mScopePrio &  static_cast<unsigned int>(NETrace::PrioScope) : mScopePrio >= static_cast<unsigned int>(msgPrio)) ;
 }
 
+template<bool IsLiteral, typename Format, typename ... Args>
+inline void TraceMessage::logDeferred( NETrace::eLogPriority logPrio, Format && format, Args ... args )
+{
+    using FormatType = std::remove_reference_t<Format>;
+    constexpr bool isFormat     { std::is_array_v<FormatType> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<FormatType>>, char> };
+    constexpr bool isPacked     { (TraceMessage::_isRecordArgument<Args>( ) && ...) };
+    constexpr uint32_t argsSize { (TraceMessage::_getRecordSize<Args>( ) + ... + 0u) };
+
+    if constexpr ( IsLiteral && isFormat && (sizeof ... (Args) == 0) )
+    {
+        TraceMessage::_sendRecord( mScopeId, logPrio, format, &TraceMessage::_formatRecord<>, nullptr, 0u );
+    }
+    else if constexpr ( IsLiteral && isFormat && isPacked && (argsSize < RECORD_ARGS_SIZE) )
+    {
+        unsigned char buffer[ RECORD_ARGS_SIZE ];
+        uint32_t position{ 0u };
+        uint32_t strings{ argsSize };
+        ( TraceMessage::_packRecordArg<Args>( buffer, position, strings, args ), ... );
+        static_cast<void>(position);
+        TraceMessage::_sendRecord( mScopeId, logPrio, format, &TraceMessage::_formatRecord<Args ...>, buffer, strings );
+    }
+    else if constexpr ( isFormat && isPacked && (argsSize + sizeof( uint32_t ) < RECORD_ARGS_SIZE) )
+    {
+        // the array may be destroyed before the logging thread formats the message,
+        // the format is copied right after the offset, which follows the arguments.
+        uint32_t strings{ argsSize + static_cast<uint32_t>(sizeof( uint32_t )) };
+        const uint32_t length{ static_cast<uint32_t>(::strlen( format )) };
+        if ( strings + length < RECORD_ARGS_SIZE )
+        {
+            unsigned char buffer[ RECORD_ARGS_SIZE ];
+            ::memcpy( buffer + argsSize, &strings, sizeof( uint32_t ) );
+            ::memcpy( buffer + strings, format, length + 1u );
+            strings += length + 1u;
+
+            uint32_t position{ 0u };
+            ( TraceMessage::_packRecordArg<Args>( buffer, position, strings, args ), ... );
+            static_cast<void>(position);
+            TraceMessage::_sendRecord( mScopeId, logPrio, nullptr, &TraceMessage::_formatCopiedRecord<Args ...>, buffer, strings );
+        }
+        else
+        {
+            TraceMessage::_sendFormatted( mScopeId, logPrio, format, args ... );
+        }
+    }
+    else
+    {
+        TraceMessage::_sendFormatted( mScopeId, logPrio, format, args ... );
+    }
+}
+
+constexpr bool TraceMessage::isLiteralFormat( const char * macroArgs )
+{
+    return (macroArgs != nullptr) && (macroArgs[0] == '\"');
+}
+
+template<typename Arg>
+constexpr bool TraceMessage::_isRecordString( void )
+{
+    return (std::is_pointer_v<Arg> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<Arg>>, char>);
+}
+
+template<typename Arg>
+constexpr bool TraceMessage::_isRecordArgument( void )
+{
+    using Pointee = std::remove_cv_t<std::remove_pointer_t<Arg>>;
+
+    return  std::is_arithmetic_v<Arg>   ||
+            std::is_enum_v<Arg>         ||
+            TraceMessage::_isRecordString<Arg>( ) ||
+            ( std::is_pointer_v<Arg> && (std::is_same_v<Pointee, wchar_t> == false) && (std::is_same_v<Pointee, unsigned char> == false) && (std::is_same_v<Pointee, signed char> == false) );
+}
+
+template<typename Arg>
+constexpr uint32_t TraceMessage::_getRecordSize( void )
+{
+    return static_cast<uint32_t>(TraceMessage::_isRecordString<Arg>( ) ? sizeof( uint32_t ) : sizeof( Arg ));
+}
+
+template<typename Arg>
+inline void TraceMessage::_packRecordArg( unsigned char * buffer, uint32_t & IN OUT position, uint32_t & IN OUT strings, Arg arg )
+{
+    if constexpr ( TraceMessage::_isRecordString<Arg>( ) )
+    {
+        // the strings are copied after the arguments and are always null-terminated.
+        // if there is no more space, the offset refers to the last null-terminating character.
+        uint32_t offset{ RECORD_NULL_STRING };
+        if ( arg != nullptr )
+        {
+            offset = strings < RECORD_ARGS_SIZE ? strings : RECORD_ARGS_SIZE - 1u;
+            for ( ; (strings < RECORD_ARGS_SIZE - 1u) && (*arg != String::EmptyChar); ++ strings, ++ arg )
+            {
+                buffer[ strings ] = static_cast<unsigned char>(*arg);
+            }
+
+            if ( strings < RECORD_ARGS_SIZE )
+            {
+                buffer[ strings ++ ] = static_cast<unsigned char>(String::EmptyChar);
+            }
+        }
+
+        ::memcpy( buffer + position, &offset, sizeof( uint32_t ) );
+    }
+    else
+    {
+        ::memcpy( buffer + position, &arg, sizeof( Arg ) );
+    }
+
+    position += TraceMessage::_getRecordSize<Arg>( );
+}
+
+template<typename Arg>
+inline auto TraceMessage::_unpackRecordArg( const unsigned char * args, uint32_t & IN OUT position )
+{
+    if constexpr ( TraceMessage::_isRecordString<Arg>( ) )
+    {
+        uint32_t offset{ RECORD_NULL_STRING };
+        ::memcpy( &offset, args + position, sizeof( uint32_t ) );
+        position += sizeof( uint32_t );
+        return (offset != RECORD_NULL_STRING ? reinterpret_cast<const char *>(args + offset) : nullptr);
+    }
+    else
+    {
+        Arg value{ };
+        ::memcpy( &value, args + position, sizeof( Arg ) );
+        position += sizeof( Arg );
+        return value;
+    }
+}
+
+template<typename ... Args>
+int TraceMessage::_formatRecord( char * buffer, int space, const char * format, const unsigned char * args )
+{
+    uint32_t position{ 0u };
+    // the braced initialization guarantees to unpack the arguments from left to right.
+    std::tuple<decltype(TraceMessage::_unpackRecordArg<Args>( args, position )) ...> values{ TraceMessage::_unpackRecordArg<Args>( args, position ) ... };
+    static_cast<void>(args);
+    static_cast<void>(position);
+
+    return std::apply( [buffer, space, format]( auto ... arg ) -> int
+                        {
+                            return String::formatString( buffer, space, format, arg ... );
+                        }, values );
+}
+
+template<typename ... Args>
+int TraceMessage::_formatCopiedRecord( char * buffer, int space, const char * /*format*/, const unsigned char * args )
+{
+    constexpr uint32_t argsSize{ (TraceMessage::_getRecordSize<Args>( ) + ... + 0u) };
+    uint32_t offset{ 0u };
+    ::memcpy( &offset, args + argsSize, sizeof( uint32_t ) );
+    return TraceMessage::_formatRecord<Args ...>( buffer, space, reinterpret_cast<const char *>(args + offset), args );
+}
+
 #endif  // AREG_LOGS
 
 #endif  // AREG_TRACE_TRACEMESSAGE_HPP
@@ -36,6 +36,13 @@
  *          generate scope ID. Neither name, nor scope ID can be changed. The scope
  *          priority can be changed during runtime and to enable dynamically certain
  *          logs and associated priorities.
+ *
+ *          The scopes are not registered in the scope controller when they are created.
+ *          They are linked in the static list without locking, and the scope controller
+ *          binds all listed scopes and their priorities in one pass when the logging starts
+ *          or when the scopes are accessed first time. The scopes created later are bound
+ *          immediately. The scopes defined by DEF_TRACE_SCOPE get the ID calculated at
+ *          compile time.
  * 
  *          This makes logging dynamic. To see certain logs in output target,
  *          there is no need to stop and start application, it is enough
@@ -58,6 +65,7 @@ class AREG_API TraceScope
 // friend class declaration to access internals
 //////////////////////////////////////////////////////////////////////////////
     friend class TraceMessage;
+    friend class ScopeController;
 
 //////////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -76,6 +84,16 @@ public:
      **/
     TraceScope( const char * scopeName, NETrace::eLogPriority priority = NETrace::eLogPriority::PrioNotset );
 
+    /**
+     * \brief   Sets the name, the ID and the message priority of the scope. The ID should be
+     *          equal to the value of NETrace::makeScopeId( scopeName ), which is calculated at
+     *          compile time by NEMath::crc32Constexpr( scopeName ) in DEF_TRACE_SCOPE macro.
+     * \param   scopeName   The name of trace scope, which should be unique within process.
+     * \param   scopeId     The ID of the scope calculated from the name.
+     * \param   priority    The logging message priority of trace scope
+     **/
+    TraceScope( const char * scopeName, unsigned int scopeId, NETrace::eLogPriority priority = NETrace::eLogPriority::PrioNotset );
+
     /**
      * \brief   Initializes the trace scope object from the stream.
      *          Unlike the previous initializer, this trace scope object is not inserted into the map.
@@ -194,6 +212,10 @@ private:
      * \brief   The trace message priority of scope.
      **/
     unsigned int        mScopePrio;
+    /**
+     * \brief   The next scope in the static list of scopes, which are not bound yet.
+     **/
+    TraceScope *        mNextScope;
 
 //////////////////////////////////////////////////////////////////////////////
 // Hidden methods
@@ -204,6 +226,14 @@ private:
      **/
     inline TraceScope & self( void );
 
+    /**
+     * \brief   Takes the static list of scopes, which are not bound yet, and marks that
+     *          the scopes created later should be bound immediately. The scopes in the list
+     *          are linked by mNextScope. Called by the scope controller.
+     * \return  Returns the first scope in the list or nullptr if the list is empty.
+     **/
+    static TraceScope * _takeStaticScopes( void );
+
 //////////////////////////////////////////////////////////////////////////////
 // Forbidden methods
 //////////////////////////////////////////////////////////////////////////////
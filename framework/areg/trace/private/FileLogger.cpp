@@ -17,13 +17,27 @@
 #include "areg/trace/LogConfiguration.hpp"
 #include "areg/base/Process.hpp"
 #include "areg/base/DateTime.hpp"
+#include "areg/base/WideString.hpp"
 
 #if AREG_LOGS
 
 FileLogger::FileLogger( LogConfiguration & tracerConfig )
     : LoggerBase( tracerConfig )
 
+    , IEOutStream       ( )
     , mLogFile          ( )
+    , mLogBuffer        ( )
+    , mFileSync         ( NETrace::eLogFileSync::SyncBatch )
+    , mFilePath         ( )
+    , mMaxSize          ( 0 )
+    , mInterval         ( 0 )
+    , mKeepFiles        ( 0 )
+    , mCompress         ( false )
+    , mFileSize         ( 0 )
+    , mFileOpened       ( 0 )
+    , mRotateIndex      ( 0 )
+    , mRotatedFiles     ( )
+    , mCompressor       ( )
 {
 }
 
@@ -48,7 +62,23 @@ bool FileLogger::openLogger( void )
 
             if ( mLogFile.open( fileName, mode) && createLayouts() )
             {
-                    
+                mFileSync = mLogConfiguration.getFileSync();
+                mLogBuffer.reserve(LOG_BUFFER_SIZE);
+
+                mFilePath   = mLogFile.getName();
+                mMaxSize    = static_cast<uint64_t>(mLogConfiguration.getFileMaxSize()) * ONE_MEGABYTE;
+                mInterval   = static_cast<TIME64>(mLogConfiguration.getFileInterval()) * ONE_MINUTE;
+                mKeepFiles  = mLogConfiguration.getFileKeep();
+                mCompress   = mLogConfiguration.getFileCompress();
+                mFileSize   = mLogFile.getLength();
+                mFileOpened = DateTime::getNow().getTime();
+                mRotateIndex= 0;
+                mRotatedFiles.clear();
+                if (mCompress)
+                {
+                    mCompressor.startCompressor();
+                }
+
                 Process & curProcess = Process::getInstance();
                 NETrace::sLogMessage logMsgHello(NETrace::eLogMessageType::LogMessageText, 0, NETrace::eLogPriority::PrioIgnoreLayout, nullptr, 0);
                 String::formatString( logMsgHello.logMessage
@@ -84,10 +114,12 @@ void FileLogger::closeLogger(void)
                             , logMsgGoodbye.logModuleId);
 
         logMessage(logMsgGoodbye);
+        flushLogs();
     }
 
     releaseLayouts();
     mLogFile.close();
+    mCompressor.stopCompressor();
 }
 
 void FileLogger::logMessage( const NETrace::sLogMessage & logMessage )
@@ -97,21 +129,32 @@ void FileLogger::logMessage( const NETrace::sLogMessage & logMessage )
         switch (logMessage.logMsgType)
         {
         case NETrace::eLogMessageType::LogMessageText:
-            getLayoutMessage().logMessage(logMessage, static_cast<IEOutStream&>(mLogFile));
+            getLayoutMessage().logMessage(logMessage, static_cast<IEOutStream&>(*this));
             break;
 
         case NETrace::eLogMessageType::LogMessageScopeEnter:
-            getLayoutEnterScope().logMessage( logMessage, static_cast<IEOutStream &>(mLogFile) );
+            getLayoutEnterScope().logMessage( logMessage, static_cast<IEOutStream &>(*this) );
             break;
 
         case NETrace::eLogMessageType::LogMessageScopeExit:
-            getLayoutExitScope().logMessage( logMessage, static_cast<IEOutStream &>(mLogFile) );
+            getLayoutExitScope().logMessage( logMessage, static_cast<IEOutStream &>(*this) );
             break;
 
         default:
             ASSERT(false);  // unexpected message to log
             break;
         }
+
+        if ( (mFileSync == NETrace::eLogFileSync::SyncError) &&
+             ((logMessage.logMessagePrio == NETrace::eLogPriority::PrioFatal) || (logMessage.logMessagePrio == NETrace::eLogPriority::PrioError)) )
+        {
+            flush();
+            mLogFile.flush();
+        }
+        else if (mLogBuffer.getLength() >= static_cast<NEString::CharCount>(LOG_BUFFER_SIZE))
+        {
+            flush();
+        }
     }
 }
 
@@ -122,7 +165,129 @@ bool FileLogger::isLoggerOpened(void) const
 
 void FileLogger::flushLogs(void)
 {
-    mLogFile.flush();
+    flush();
+    if (mFileSync == NETrace::eLogFileSync::SyncBatch)
+    {
+        mLogFile.flush();
+    }
+}
+
+unsigned int FileLogger::write(const unsigned char * buffer, unsigned int size)
+{
+    mLogBuffer.append(reinterpret_cast<const char *>(buffer), static_cast<NEString::CharCount>(size));
+    return size;
+}
+
+unsigned int FileLogger::write(const IEByteBuffer & buffer)
+{
+    return write(buffer.getBuffer(), buffer.getSizeUsed());
+}
+
+unsigned int FileLogger::write( const String & asciiString )
+{
+    mLogBuffer += asciiString;
+    return asciiString.getSpace();
+}
+
+unsigned int FileLogger::write( const WideString & wideString )
+{
+    mLogBuffer += wideString;
+    return wideString.getSpace();
+}
+
+void FileLogger::flush(void)
+{
+    if (mLogBuffer.isEmpty() == false)
+    {
+        if (mLogFile.isOpened())
+        {
+            const unsigned int length{ static_cast<unsigned int>(mLogBuffer.getLength()) };
+            if (_isRotationDue(length))
+            {
+                _rotateFile();
+            }
+
+            mLogFile.write(reinterpret_cast<const unsigned char *>(mLogBuffer.getString()), length);
+            mFileSize += length;
+        }
+
+        mLogBuffer.clear();
+    }
+}
+
+unsigned int FileLogger::getSizeWritable(void) const
+{
+    return static_cast<unsigned int>(0xFFFF);
+}
+
+bool FileLogger::_isRotationDue(uint32_t dataSize) const
+{
+    return ( ((mMaxSize != 0) && (mFileSize != 0) && (mFileSize + dataSize > mMaxSize)) ||
+             ((mInterval != 0) && (DateTime::getNow().getTime() - mFileOpened >= mInterval)) );
+}
+
+void FileLogger::_rotateFile(void)
+{
+    constexpr unsigned int mode{ File::FO_MODE_WRITE | File::FO_MODE_READ | File::FO_MODE_SHARE_READ | File::FO_MODE_SHARE_WRITE | File::FO_MODE_TEXT };
+
+    String rotated{ _nextRotatedName() };
+    mLogFile.close();
+
+    if (File::moveFile(mFilePath, rotated))
+    {
+        mLogFile.open(mFilePath, mode | File::FO_MODE_CREATE);
+
+        if (mCompress)
+        {
+            mCompressor.compressFile(rotated);
+        }
+
+        mRotatedFiles.add(rotated);
+        while ((mKeepFiles != 0) && (mRotatedFiles.getSize() > mKeepFiles))
+        {
+            String oldest{ mRotatedFiles[0] };
+            mRotatedFiles.removeAt(0);
+            if (mCompress)
+            {
+                // delete in the order of jobs, after the file is compressed.
+                mCompressor.deleteFile(oldest);
+            }
+            else
+            {
+                File::deleteFile(oldest);
+            }
+        }
+
+        mFileSize = 0;
+    }
+    else
+    {
+        // failed to rename, continue logging in the same file and try next time.
+        mLogFile.open(mFilePath, mode | File::FO_MODE_EXIST);
+        mFileSize = mLogFile.getLength();
+        mLogFile.moveToEnd();
+    }
+
+    mFileOpened = DateTime::getNow().getTime();
+}
+
+String FileLogger::_nextRotatedName(void)
+{
+    const String ext{ File::getFileExtension(mFilePath) };
+    String base;
+    mFilePath.substring(base, NEString::START_POS, mFilePath.getLength() - ext.getLength());
+
+    String result;
+    String compressed;
+    do
+    {
+        ++ mRotateIndex;
+        result.format("%s.%03u%s", base.getString(), mRotateIndex, ext.getString());
+        compressed = result;
+        compressed += LogFileCompressor::COMPRESSED_EXTENSION;
+    } while (File::existFile(result) || File::existFile(compressed));
+
+    return result;
 }
 
 #endif // AREG_LOGS
@@ -22,6 +22,10 @@
 #include "areg/trace/private/LoggerBase.hpp"
 
 #include "areg/base/File.hpp"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/trace/private/LogFileCompressor.hpp"
 
 #if AREG_LOGS
 
@@ -32,9 +36,30 @@
  * \brief   Message logger to output messages in to the file.
  *          At the moment the output logger supports only ASCII messages
  *          and any Unicode character might output wrong.
+ *
+ *          The log file is rotated when it reaches the configured size or when
+ *          the configured time interval expires. The rotated file gets the index
+ *          in the name, like 'trace.001.log', and the logging continues in the new file
+ *          with the original name. The rotated files are optionally compressed
+ *          in the thread of the lowest priority and only the configured number
+ *          of rotated files are kept.
  **/
 class FileLogger    : public    LoggerBase
+                    , private   IEOutStream
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The size of the buffer to collect the formatted log messages before writing them in the file.
+    static constexpr uint32_t   LOG_BUFFER_SIZE { 64 * 1024 };
+
+    //!< The number of bytes in a megabyte to calculate the maximum size of the log file.
+    static constexpr uint64_t   ONE_MEGABYTE    { 1024 * 1024 };
+
+    //!< The number of microseconds in a minute to calculate the time interval to rotate the log file.
+    static constexpr TIME64     ONE_MINUTE      { 60'000'000 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -96,6 +121,83 @@ public:
      **/
     void flushLogs(void);
 
+//////////////////////////////////////////////////////////////////////////
+// Overrides
+//////////////////////////////////////////////////////////////////////////
+protected:
+/************************************************************************/
+// IEOutStream interface overrides
+/************************************************************************/
+
+    /**
+     * \brief	Write data to output stream object from given buffer
+     *          and returns the size of written data
+     * \param	buffer	The pointer to buffer to read data and 
+     *          copy to output stream object
+     * \param	size	The size in bytes of data buffer
+     * \return	Returns the size in bytes of written data
+     **/
+    virtual unsigned int write( const unsigned char * buffer, unsigned int size ) override;
+
+    /**
+     * \brief	Writes Binary data from Byte Buffer object to Output Stream object
+     *          and returns the size of written data. Overwrite this method if need 
+     *          to change behavior of streaming buffer.
+     * \param	buffer	The instance of Byte Buffer object containing data to stream to Output Stream.
+     * \return	Returns the size in bytes of written data
+     **/
+    virtual unsigned int write( const IEByteBuffer & buffer ) override;
+
+    /**
+     * \brief   Writes string data from given ASCII String object to output stream object.
+     *          Overwrite method if need to change behavior of streaming string.
+     * \param   asciiString     The buffer of String containing data to stream to Output Stream.
+     * \return  Returns the size in bytes of copied string data.
+     **/
+    virtual unsigned int write( const String & asciiString ) override;
+
+    /**
+     * \brief   Writes string data from given wide-char String object to output stream object.
+     *          Overwrite method if need to change behavior of streaming string.
+     * \param   wideString  The buffer of String containing data to stream to Output Stream.
+     * \return  Returns the size in bytes of copied string data.
+     **/
+    virtual unsigned int write( const WideString & wideString ) override;
+
+    /**
+     * \brief	Writes the collected log messages in the file.
+     **/
+    virtual void flush( void ) override;
+
+    /**
+     * \brief	Returns size in bytes of available space that can be written, 
+     *          i.e. remaining writable size.
+     **/
+    virtual unsigned int getSizeWritable( void ) const override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if the log file should be rotated before writing the data of the given size.
+     * \param   dataSize    The size in bytes of data to write.
+     **/
+    bool _isRotationDue( uint32_t dataSize ) const;
+
+    /**
+     * \brief   Rotates the log file. Renames the active file, opens the new file with the
+     *          original name, queues the rotated file for compression and deletes the
+     *          oldest rotated files, which exceed the configured number of files to keep.
+     *          Called in the logging thread between writes, so that no message is lost.
+     **/
+    void _rotateFile( void );
+
+    /**
+     * \brief   Returns the unique name of the next rotated log file.
+     **/
+    String _nextRotatedName( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -103,7 +205,57 @@ private:
     /**
      * \brief   The log file object
      **/
-    File              mLogFile;
+    File                    mLogFile;
+    /**
+     * \brief   The buffer of formatted log messages, which are not written in the file yet.
+     *          The layouts write the parts of the messages in the buffer and the buffer
+     *          is written in the file at once.
+     **/
+    String                  mLogBuffer;
+    /**
+     * \brief   The policy to synchronize the log file with the storage device.
+     **/
+    NETrace::eLogFileSync   mFileSync;
+    /**
+     * \brief   The path of the active log file.
+     **/
+    String                  mFilePath;
+    /**
+     * \brief   The maximum size in bytes of the log file. If zero, the file is not rotated by size.
+     **/
+    uint64_t                mMaxSize;
+    /**
+     * \brief   The time interval in microseconds to rotate the log file. If zero, the file is not rotated by time.
+     **/
+    TIME64                  mInterval;
+    /**
+     * \brief   The number of rotated log files to keep. If zero, all rotated files are kept.
+     **/
+    uint32_t                mKeepFiles;
+    /**
+     * \brief   Flag, indicating whether the rotated log files are compressed.
+     **/
+    bool                    mCompress;
+    /**
+     * \brief   The size in bytes of the data written in the active log file.
+     **/
+    uint64_t                mFileSize;
+    /**
+     * \brief   The timestamp when the active log file was opened.
+     **/
+    TIME64                  mFileOpened;
+    /**
+     * \brief   The index of the last rotated log file.
+     **/
+    uint32_t                mRotateIndex;
+    /**
+     * \brief   The list of the rotated log files, starting from the oldest.
+     **/
+    TEArrayList<String>     mRotatedFiles;
+    /**
+     * \brief   The object to compress and to delete the rotated log files in the background.
+     **/
+    LogFileCompressor       mCompressor;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden / Forbidden calls.
@@ -117,6 +117,16 @@ void LogConfiguration::setStackSize(uint32_t prop)
     Application::getConfigManager().setLogRemoteQueueSize(prop);
 }
 
+uint32_t LogConfiguration::getBatchSize(void) const
+{
+    return Application::getConfigManager().getLogRemoteBatchSize();
+}
+
+void LogConfiguration::setBatchSize(uint32_t prop)
+{
+    Application::getConfigManager().setLogRemoteBatchSize(prop);
+}
+
 bool LogConfiguration::getStatus(void) const
 {
     return Application::getConfigManager().getLoggingStatus();
@@ -137,6 +147,83 @@ void LogConfiguration::setAppendData(bool prop)
     Application::getConfigManager().setLogFileAppend(prop);
 }
 
+NETrace::eLogFileSync LogConfiguration::getFileSync(void) const
+{
+    String sync{ Application::getConfigManager().getLogFileSync() };
+    sync.makeLower();
+
+    NETrace::eLogFileSync result{ NETrace::eLogFileSync::SyncBatch };
+    if (sync == LogConfiguration::SYNC_NEVER)
+    {
+        result = NETrace::eLogFileSync::SyncNever;
+    }
+    else if (sync == LogConfiguration::SYNC_ERROR)
+    {
+        result = NETrace::eLogFileSync::SyncError;
+    }
+
+    return result;
+}
+
+void LogConfiguration::setFileSync(NETrace::eLogFileSync prop)
+{
+    switch (prop)
+    {
+    case NETrace::eLogFileSync::SyncNever:
+        Application::getConfigManager().setLogFileSync(String(LogConfiguration::SYNC_NEVER));
+        break;
+
+    case NETrace::eLogFileSync::SyncError:
+        Application::getConfigManager().setLogFileSync(String(LogConfiguration::SYNC_ERROR));
+        break;
+
+    case NETrace::eLogFileSync::SyncBatch:
+    default:
+        Application::getConfigManager().setLogFileSync(String(LogConfiguration::SYNC_BATCH));
+        break;
+    }
+}
+
+uint32_t LogConfiguration::getFileMaxSize(void) const
+{
+    return Application::getConfigManager().getLogFileMaxSize();
+}
+
+void LogConfiguration::setFileMaxSize(uint32_t megabytes, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileMaxSize(megabytes, isTemporary);
+}
+
+uint32_t LogConfiguration::getFileInterval(void) const
+{
+    return Application::getConfigManager().getLogFileInterval();
+}
+
+void LogConfiguration::setFileInterval(uint32_t minutes, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileInterval(minutes, isTemporary);
+}
+
+uint32_t LogConfiguration::getFileKeep(void) const
+{
+    return Application::getConfigManager().getLogFileKeep();
+}
+
+void LogConfiguration::setFileKeep(uint32_t count, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileKeep(count, isTemporary);
+}
+
+bool LogConfiguration::getFileCompress(void) const
+{
+    return Application::getConfigManager().getLogFileCompress();
+}
+
+void LogConfiguration::setFileCompress(bool prop, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileCompress(prop, isTemporary);
+}
+
 String LogConfiguration::getLogFile(void) const
 {
     return Application::getConfigManager().getLogFileLocation();
@@ -267,6 +354,36 @@ void LogConfiguration::setDatabaseUser(const String& dbUserName, const String& d
     Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabasePassword().position, dbUserPassword, isTemporary);
 }
 
+uint32_t LogConfiguration::getDatabasePartitionTime(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabasePartTime().position).toUInt32();
+}
+
+void LogConfiguration::setDatabasePartitionTime(uint32_t minutes, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabasePartTime().position, String::makeString(minutes), isTemporary);
+}
+
+uint32_t LogConfiguration::getDatabasePartitionSize(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabasePartSize().position).toUInt32();
+}
+
+void LogConfiguration::setDatabasePartitionSize(uint32_t megabytes, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabasePartSize().position, String::makeString(megabytes), isTemporary);
+}
+
+uint32_t LogConfiguration::getDatabaseRetention(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseRetention().position).toUInt32();
+}
+
+void LogConfiguration::setDatabaseRetention(uint32_t minutes, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseRetention().position, String::makeString(minutes), isTemporary);
+}
+
 void LogConfiguration::saveConfiguration(void)
 {
     Application::getConfigManager().saveConfig();
@@ -0,0 +1,500 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/LogFileCompressor.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the background compressor of rotated log files.
+ ************************************************************************/
+#include "areg/trace/private/LogFileCompressor.hpp"
+
+#include "areg/base/File.hpp"
+#include "areg/base/NEMath.hpp"
+
+#include <string.h>
+#include <utility>
+#include <vector>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////
+// Local types and constants
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    //!< The size of the sliding window of DEFLATE algorithm.
+    constexpr uint32_t  WINDOW_SIZE     { 32 * 1024 };
+    //!< The mask of the position in the sliding window.
+    constexpr uint32_t  WINDOW_MASK     { WINDOW_SIZE - 1 };
+    //!< The minimum length of the match.
+    constexpr uint32_t  MIN_MATCH       { 3 };
+    //!< The maximum length of the match.
+    constexpr uint32_t  MAX_MATCH       { 258 };
+    //!< The minimum number of bytes to read ahead before searching the match.
+    constexpr uint32_t  MIN_LOOKAHEAD   { MAX_MATCH + MIN_MATCH + 1 };
+    //!< The number of bits of the hash of 3 bytes.
+    constexpr uint32_t  HASH_BITS       { 15 };
+    //!< The size of the hash table.
+    constexpr uint32_t  HASH_SIZE       { 1u << HASH_BITS };
+    //!< The maximum number of the previous positions to check when searching the match.
+    constexpr uint32_t  MAX_CHAIN       { 64 };
+    //!< The size of the buffer of compressed data before writing in the file.
+    constexpr uint32_t  OUTPUT_SIZE     { 64 * 1024 };
+    //!< The invalid position in the sliding window.
+    constexpr int32_t   NO_POSITION     { -1 };
+
+    //!< The base lengths of the length codes 257 - 285.
+    constexpr uint16_t  LENGTH_BASE[]   { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    //!< The number of extra bits of the length codes 257 - 285.
+    constexpr uint8_t   LENGTH_EXTRA[]  { 0, 0, 0, 0, 0, 0, 0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3,  4,  4,  4,   4,   5,   5,   5,   5,   0 };
+    //!< The base distances of the distance codes 0 - 29.
+    constexpr uint16_t  DIST_BASE[]     { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    //!< The number of extra bits of the distance codes 0 - 29.
+    constexpr uint8_t   DIST_EXTRA[]    { 0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,   6,   6,   7,   7,   8,   8,    9,    9,   10,   10,   11,   11,   12,    12,    13,    13 };
+
+    //!< The header of gzip file: magic number, DEFLATE method, no flags, no time, no extra flags, unknown OS.
+    constexpr unsigned char GZIP_HEADER[]{ 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+
+    /**
+     * \brief   Writes the compressed data bit by bit in the file. The bits are
+     *          packed starting from the least significant bit of a byte.
+     **/
+    class DeflateOutput
+    {
+    public:
+        explicit DeflateOutput( File & file )
+            : mFile     ( file )
+            , mBuffer   ( OUTPUT_SIZE )
+            , mUsed     ( 0 )
+            , mBits     ( 0 )
+            , mCount    ( 0 )
+            , mFailed   ( false )
+        {
+        }
+
+        //!< Writes the bits of the value, starting from the least significant bit.
+        inline void writeBits( uint32_t value, uint32_t count )
+        {
+            mBits  |= static_cast<uint64_t>(value) << mCount;
+            mCount += count;
+            while ( mCount >= 8 )
+            {
+                writeByte( static_cast<unsigned char>(mBits & 0xFFu) );
+                mBits  >>= 8;
+                mCount  -= 8;
+            }
+        }
+
+        //!< Writes the Huffman code, which is packed starting from the most significant bit.
+        inline void writeCode( uint32_t code, uint32_t length )
+        {
+            uint32_t reversed{ 0 };
+            for ( uint32_t i = 0; i < length; ++ i )
+            {
+                reversed = (reversed << 1) | ((code >> i) & 1u);
+            }
+
+            writeBits( reversed, length );
+        }
+
+        //!< Writes the literal or length symbol 0 - 287 with the fixed Huffman code.
+        inline void writeSymbol( uint32_t symbol )
+        {
+            if ( symbol < 144 )
+            {
+                writeCode( 0x30u + symbol, 8 );
+            }
+            else if ( symbol < 256 )
+            {
+                writeCode( 0x190u + (symbol - 144), 9 );
+            }
+            else if ( symbol < 280 )
+            {
+                writeCode( symbol - 256, 7 );
+            }
+            else
+            {
+                writeCode( 0xC0u + (symbol - 280), 8 );
+            }
+        }
+
+        //!< Writes the match of the given length and distance.
+        inline void writeMatch( uint32_t length, uint32_t distance )
+        {
+            uint32_t lenCode{ 0 };
+            while ( (lenCode + 1 < MACRO_ARRAYLEN(LENGTH_BASE)) && (LENGTH_BASE[lenCode + 1] <= length) )
+            {
+                ++ lenCode;
+            }
+
+            writeSymbol( 257 + lenCode );
+            writeBits( length - LENGTH_BASE[lenCode], LENGTH_EXTRA[lenCode] );
+
+            uint32_t distCode{ 0 };
+            while ( (distCode + 1 < MACRO_ARRAYLEN(DIST_BASE)) && (DIST_BASE[distCode + 1] <= distance) )
+            {
+                ++ distCode;
+            }
+
+            writeCode( distCode, 5 );
+            writeBits( distance - DIST_BASE[distCode], DIST_EXTRA[distCode] );
+        }
+
+        //!< Writes the byte in the buffer and writes the buffer in the file if it is full.
+        inline void writeByte( unsigned char byte )
+        {
+            mBuffer[ mUsed ++ ] = byte;
+            if ( mUsed == OUTPUT_SIZE )
+            {
+                flush( );
+            }
+        }
+
+        //!< Writes the remaining bits, padding the last byte with zeros.
+        inline void alignByte( void )
+        {
+            if ( mCount != 0 )
+            {
+                writeBits( 0, 8 - mCount );
+            }
+        }
+
+        //!< Writes the buffered data in the file.
+        inline void flush( void )
+        {
+            if ( (mUsed != 0) && (mFile.write( mBuffer.data( ), mUsed ) != mUsed) )
+            {
+                mFailed = true;
+            }
+
+            mUsed = 0;
+        }
+
+        //!< Returns true if failed to write data in the file.
+        inline bool isFailed( void ) const
+        {
+            return mFailed;
+        }
+
+    private:
+        File &                      mFile;
+        std::vector<unsigned char>  mBuffer;
+        uint32_t                    mUsed;
+        uint64_t                    mBits;
+        uint32_t                    mCount;
+        bool                        mFailed;
+    };
+
+    //!< Returns the hash value of 3 bytes.
+    inline uint32_t _hash3( const unsigned char * data )
+    {
+        uint32_t value = (static_cast<uint32_t>(data[0]) << 16) | (static_cast<uint32_t>(data[1]) << 8) | static_cast<uint32_t>(data[2]);
+        return ((value * 2654435761u) >> (32 - HASH_BITS));
+    }
+
+    //!< Writes 32-bit value in little-endian byte order.
+    inline void _writeUInt32( DeflateOutput & output, uint32_t value )
+    {
+        output.writeByte( static_cast<unsigned char>(value & 0xFFu) );
+        output.writeByte( static_cast<unsigned char>((value >> 8) & 0xFFu) );
+        output.writeByte( static_cast<unsigned char>((value >> 16) & 0xFFu) );
+        output.writeByte( static_cast<unsigned char>((value >> 24) & 0xFFu) );
+    }
+
+    /**
+     * \brief   Reads the data from the source file, compresses by LZ77 algorithm and writes
+     *          the literals and matches with fixed Huffman codes.
+     * \param   srcFile     The file to read data to compress.
+     * \param   output      The output to write compressed data.
+     * \param   size        On output, contains the size of the source data.
+     * \return  Returns the CRC32 of the source data.
+     **/
+    unsigned int _deflate( const File & srcFile, DeflateOutput & output, uint32_t & OUT size )
+    {
+        std::vector<unsigned char> window( 2 * WINDOW_SIZE );
+        std::vector<int32_t> head( HASH_SIZE, NO_POSITION );
+        std::vector<int32_t> prev( WINDOW_SIZE, NO_POSITION );
+
+        unsigned int crc{ NEMath::crc32Init( ) };
+        uint32_t strStart{ 0 };
+        uint32_t lookahead{ 0 };
+        bool endOfFile{ false };
+        size = 0;
+
+        do
+        {
+            // fill the window, sliding the upper half down when the end is reached.
+            while ( (endOfFile == false) && (lookahead < MIN_LOOKAHEAD) )
+            {
+                if ( strStart >= 2 * WINDOW_SIZE - MIN_LOOKAHEAD )
+                {
+                    ::memmove( window.data( ), window.data( ) + WINDOW_SIZE, WINDOW_SIZE );
+                    strStart -= WINDOW_SIZE;
+                    for ( int32_t & pos : head )
+                    {
+                        pos = pos >= static_cast<int32_t>(WINDOW_SIZE) ? pos - static_cast<int32_t>(WINDOW_SIZE) : NO_POSITION;
+                    }
+
+                    for ( int32_t & pos : prev )
+                    {
+                        pos = pos >= static_cast<int32_t>(WINDOW_SIZE) ? pos - static_cast<int32_t>(WINDOW_SIZE) : NO_POSITION;
+                    }
+                }
+
+                unsigned char * dst = window.data( ) + strStart + lookahead;
+                uint32_t space = 2 * WINDOW_SIZE - (strStart + lookahead);
+                uint32_t read  = srcFile.read( dst, space );
+                if ( read == 0 )
+                {
+                    endOfFile = true;
+                }
+                else
+                {
+                    crc = NEMath::crc32Start( crc, dst, static_cast<int>(read) );
+                    size      += read;
+                    lookahead += read;
+                }
+            }
+
+            const unsigned char * data = window.data( );
+            uint32_t matchLen{ 0 };
+            uint32_t matchDist{ 0 };
+            if ( lookahead >= MIN_MATCH )
+            {
+                const uint32_t hash = _hash3( data + strStart );
+                int32_t candidate = head[ hash ];
+                prev[ strStart & WINDOW_MASK ] = candidate;
+                head[ hash ] = static_cast<int32_t>(strStart);
+
+                const uint32_t maxLen = MACRO_MIN( MAX_MATCH, lookahead );
+                for ( uint32_t chain = 0; (candidate != NO_POSITION) && (chain < MAX_CHAIN); ++ chain )
+                {
+                    const uint32_t distance = strStart - static_cast<uint32_t>(candidate);
+                    if ( distance > WINDOW_SIZE )
+                    {
+                        break;
+                    }
+
+                    uint32_t len{ 0 };
+                    while ( (len < maxLen) && (data[ candidate + len ] == data[ strStart + len ]) )
+                    {
+                        ++ len;
+                    }
+
+                    if ( len > matchLen )
+                    {
+                        matchLen  = len;
+                        matchDist = distance;
+                        if ( len == maxLen )
+                        {
+                            break;
+                        }
+                    }
+
+                    candidate = prev[ static_cast<uint32_t>(candidate) & WINDOW_MASK ];
+                }
+            }
+
+            if ( matchLen >= MIN_MATCH )
+            {
+                output.writeMatch( matchLen, matchDist );
+                // add the positions inside of the match to the hash chains.
+                for ( uint32_t i = 1; i < matchLen; ++ i )
+                {
+                    const uint32_t pos = strStart + i;
+                    if ( lookahead - i >= MIN_MATCH )
+                    {
+                        const uint32_t hash = _hash3( data + pos );
+                        prev[ pos & WINDOW_MASK ] = head[ hash ];
+                        head[ hash ] = static_cast<int32_t>(pos);
+                    }
+                }
+
+                strStart  += matchLen;
+                lookahead -= matchLen;
+            }
+            else if ( lookahead != 0 )
+            {
+                output.writeSymbol( data[ strStart ] );
+                ++ strStart;
+                -- lookahead;
+            }
+
+        } while ( lookahead != 0 );
+
+        return NEMath::crc32Finish( crc );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileCompressor class implementation
+//////////////////////////////////////////////////////////////////////////
+
+bool LogFileCompressor::compress( const String & srcPath, const String & dstPath )
+{
+    bool result{ false };
+    File srcFile;
+    File dstFile;
+    if ( srcFile.open( srcPath, File::FO_MODE_READ | File::FO_MODE_BINARY | File::FO_MODE_EXIST ) &&
+         dstFile.open( dstPath, File::FO_MODE_WRITE | File::FO_MODE_BINARY | File::FO_MODE_CREATE ) )
+    {
+        DeflateOutput output( dstFile );
+        for ( unsigned char byte : GZIP_HEADER )
+        {
+            output.writeByte( byte );
+        }
+
+        // a single final block with fixed Huffman codes.
+        output.writeBits( 1, 1 );
+        output.writeBits( 1, 2 );
+
+        uint32_t size{ 0 };
+        unsigned int crc = _deflate( srcFile, output, size );
+
+        // end of block, then the gzip trailer with CRC32 and the size of original data.
+        output.writeSymbol( 256 );
+        output.alignByte( );
+        _writeUInt32( output, crc );
+        _writeUInt32( output, size );
+        output.flush( );
+
+        result = output.isFailed( ) == false;
+        dstFile.close( );
+        srcFile.close( );
+
+        if ( result == false )
+        {
+            File::deleteFile( dstPath );
+        }
+    }
+
+    return result;
+}
+
+LogFileCompressor::LogFileCompressor( void )
+    : IEThreadConsumer  ( )
+    , mCompressThread   ( static_cast<IEThreadConsumer &>(self()), COMPRESSOR_THREAD_NAME )
+    , mJobLock          ( false )
+    , mJobEvent         ( true, true )
+    , mCompressQuit     ( false )
+    , mCompressRuns     ( false )
+    , mJobs             ( )
+{
+}
+
+LogFileCompressor::~LogFileCompressor( void )
+{
+    stopCompressor( );
+}
+
+void LogFileCompressor::startCompressor( void )
+{
+    if ( mCompressRuns == false )
+    {
+        mCompressQuit = false;
+        mCompressRuns = mCompressThread.createThread( NECommon::WAIT_INFINITE );
+        if ( mCompressRuns )
+        {
+            mCompressThread.setPriority( Thread::eThreadPriority::PriorityLowest );
+        }
+    }
+}
+
+void LogFileCompressor::stopCompressor( void )
+{
+    if ( mCompressRuns )
+    {
+        mCompressRuns = false;
+        mCompressQuit = true;
+        mJobEvent.setEvent( );
+        mCompressThread.shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    _processJobs( );
+}
+
+void LogFileCompressor::compressFile( const String & filePath )
+{
+    _queueJob( filePath, true );
+}
+
+void LogFileCompressor::deleteFile( const String & filePath )
+{
+    _queueJob( filePath, false );
+}
+
+void LogFileCompressor::onThreadRuns( void )
+{
+    while ( mCompressQuit == false )
+    {
+        mJobEvent.lock( NECommon::WAIT_INFINITE );
+        _processJobs( );
+    }
+}
+
+void LogFileCompressor::_queueJob( const String & filePath, bool compress )
+{
+    do
+    {
+        Lock lock( mJobLock );
+        mJobs.add( sFileJob{ filePath, compress } );
+    } while ( false );
+
+    if ( mCompressRuns )
+    {
+        mJobEvent.setEvent( );
+    }
+    else
+    {
+        _processJobs( );
+    }
+}
+
+void LogFileCompressor::_processJobs( void )
+{
+    TEArrayList<sFileJob> jobs;
+
+    do
+    {
+        Lock lock( mJobLock );
+        std::swap( mJobs, jobs );
+    } while ( false );
+
+    for ( uint32_t i = 0; i < jobs.getSize( ); ++ i )
+    {
+        const sFileJob & job = jobs[ i ];
+        if ( job.fjCompress )
+        {
+            String dstPath( job.fjPath );
+            dstPath += COMPRESSED_EXTENSION;
+            if ( LogFileCompressor::compress( job.fjPath, dstPath ) )
+            {
+                File::deleteFile( job.fjPath );
+            }
+        }
+        else
+        {
+            // the file might be compressed or not, if the compression failed.
+            String compressed( job.fjPath );
+            compressed += COMPRESSED_EXTENSION;
+            if ( File::existFile( compressed ) )
+            {
+                File::deleteFile( compressed );
+            }
+
+            if ( File::existFile( job.fjPath ) )
+            {
+                File::deleteFile( job.fjPath );
+            }
+        }
+    }
+}
+
+#endif  // AREG_LOGS
@@ -0,0 +1,199 @@
+#ifndef AREG_TRACE_PRIVATE_LOGFILECOMPRESSOR_HPP
+#define AREG_TRACE_PRIVATE_LOGFILECOMPRESSOR_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/LogFileCompressor.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the background compressor of rotated log files.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/IEThreadConsumer.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <atomic>
+#include <string_view>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileCompressor class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Compresses the rotated log files in gzip format and deletes the outdated
+ *          log files in the own thread of the lowest priority, so that the logging
+ *          thread never waits for the compression. The jobs are processed in the
+ *          order they are queued, so that a file is deleted only after it is compressed.
+ *          If the thread does not run, the jobs are processed in the calling thread.
+ **/
+class AREG_API LogFileCompressor : private IEThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   LogFileCompressor::COMPRESSOR_THREAD_NAME
+     *          The name of the thread to compress log files.
+     **/
+    static constexpr std::string_view   COMPRESSOR_THREAD_NAME  { "_AREG_LOG_FILE_COMPRESSOR_" };
+
+    /**
+     * \brief   LogFileCompressor::COMPRESSED_EXTENSION
+     *          The extension added to the name of the compressed log file.
+     **/
+    static constexpr std::string_view   COMPRESSED_EXTENSION    { ".gz" };
+
+private:
+    /**
+     * \brief   LogFileCompressor::sFileJob
+     *          The job to compress or to delete a log file.
+     **/
+    struct sFileJob
+    {
+        //!< The path of the log file.
+        String  fjPath;
+        //!< If true, the file is compressed and the original is deleted. Otherwise, the file is deleted.
+        bool    fjCompress;
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    LogFileCompressor( void );
+    virtual ~LogFileCompressor( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Starts the thread to compress log files. Does nothing if the thread already runs.
+     **/
+    void startCompressor( void );
+
+    /**
+     * \brief   Stops the thread to compress log files. The queued jobs are completed before the thread exits.
+     **/
+    void stopCompressor( void );
+
+    /**
+     * \brief   Queues the job to compress the log file. The compressed file gets the
+     *          extension COMPRESSED_EXTENSION and the original file is deleted.
+     * \param   filePath    The path of the log file to compress.
+     **/
+    void compressFile( const String & filePath );
+
+    /**
+     * \brief   Queues the job to delete the log file and its compressed copy.
+     *          The files are deleted after the jobs queued before are completed.
+     * \param   filePath    The path of the log file to delete.
+     **/
+    void deleteFile( const String & filePath );
+
+    /**
+     * \brief   Returns true if the thread to compress log files runs.
+     **/
+    inline bool isRunning( void ) const;
+
+    /**
+     * \brief   Compresses the source file in gzip format and saves in the target file.
+     *          The data is compressed by the DEFLATE algorithm with fixed Huffman codes.
+     * \param   srcPath     The path of the file to compress.
+     * \param   dstPath     The path of the compressed file to create.
+     * \return  Returns true if succeeded to compress the file.
+     **/
+    static bool compress( const String & srcPath, const String & dstPath );
+
+//////////////////////////////////////////////////////////////////////////
+// IEThreadConsumer interface overrides.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Waits for the queued jobs and processes them.
+     **/
+    virtual void onThreadRuns( void ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Queues the job. If the thread does not run, processes the job immediately.
+     **/
+    void _queueJob( const String & filePath, bool compress );
+
+    /**
+     * \brief   Takes the queued jobs and processes them.
+     **/
+    void _processJobs( void );
+
+    inline LogFileCompressor & self( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The thread to compress log files.
+    Thread                  mCompressThread;
+
+    //!< The lock to synchronize the access to the jobs.
+    ResourceLock            mJobLock;
+
+    //!< The event signaled when a job is queued.
+    SynchEvent              mJobEvent;
+
+    //!< Flag, indicating whether the thread should exit.
+    std::atomic_bool        mCompressQuit;
+
+    //!< Flag, indicating whether the thread runs.
+    std::atomic_bool        mCompressRuns;
+
+    //!< The queued jobs.
+    TEArrayList<sFileJob>   mJobs;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogFileCompressor );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// LogFileCompressor inline methods.
+//////////////////////////////////////////////////////////////////////////
+
+inline bool LogFileCompressor::isRunning( void ) const
+{
+    return mCompressRuns;
+}
+
+inline LogFileCompressor & LogFileCompressor::self( void )
+{
+    return (*this);
+}
+
+#endif  // AREG_LOGS
+#endif  // AREG_TRACE_PRIVATE_LOGFILECOMPRESSOR_HPP
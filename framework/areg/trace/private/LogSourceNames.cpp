@@ -0,0 +1,118 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/trace/private/LogSourceNames.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the table of thread and module names of
+ *              the remote log sources.
+ ************************************************************************/
+#include "areg/trace/LogSourceNames.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// LogSourceNames class implementation
+//////////////////////////////////////////////////////////////////////////
+
+LogSourceNames::LogSourceNames( void )
+    : mSources  ( )
+{
+}
+
+bool LogSourceNames::decodeMessage( const RemoteMessage & msgLog, uint32_t & IN OUT position, NETrace::sLogMessage & OUT out_logMessage )
+{
+    unsigned char flags{ NETrace::CompactNoNames };
+    bool result{ false };
+
+    while ( (result == false) && NETrace::readLogMessage( msgLog, position, out_logMessage, flags ) )
+    {
+        result = _applyNames( msgLog.getSource( ), out_logMessage, flags );
+    }
+
+    return result;
+}
+
+bool LogSourceNames::decodeRecord( const RemoteMessage & msgLog, uint32_t & IN OUT position, NETrace::sLogMessage & OUT out_logMessage, unsigned char & OUT out_flags )
+{
+    bool result{ NETrace::readLogMessage( msgLog, position, out_logMessage, out_flags ) };
+    if ( result )
+    {
+        _applyNames( msgLog.getSource( ), out_logMessage, out_flags );
+    }
+
+    return result;
+}
+
+bool LogSourceNames::_applyNames( const ITEM_ID & cookie, NETrace::sLogMessage & IN OUT logMessage, unsigned char flags )
+{
+    bool result{ true };
+
+    if ( logMessage.logDataType == NETrace::eLogDataType::LogDataRemote )
+    {
+        if ( (flags & NETrace::CompactAllNames) != 0 )
+        {
+            sSourceNames & source{ mSources[cookie] };
+            if ( (flags & NETrace::CompactModuleName) != 0 )
+            {
+                source.snModule = logMessage.logModule;
+            }
+
+            if ( (flags & NETrace::CompactThreadName) != 0 )
+            {
+                source.snThreads.setAt( logMessage.logThreadId, String( logMessage.logThread ) );
+            }
+        }
+
+        if ( (flags & NETrace::CompactAllNames) != NETrace::CompactAllNames )
+        {
+            auto pos = mSources.find( cookie );
+            if ( mSources.isValidPosition( pos ) )
+            {
+                const sSourceNames & source{ mSources.valueAtPosition( pos ) };
+                if ( (flags & NETrace::CompactModuleName) == 0 )
+                {
+                    logMessage.logModuleLen = NEMemory::memCopy( logMessage.logModule, NETrace::LOG_NAMES_SIZE - 1u, source.snModule.getString( ), static_cast<uint32_t>(source.snModule.getLength( )) );
+                    logMessage.logModule[logMessage.logModuleLen] = '\0';
+                }
+
+                auto posThread = (flags & NETrace::CompactThreadName) == 0 ? source.snThreads.find( logMessage.logThreadId ) : source.snThreads.invalidPosition( );
+                if ( source.snThreads.isValidPosition( posThread ) )
+                {
+                    const String & thread{ source.snThreads.valueAtPosition( posThread ) };
+                    logMessage.logThreadLen = NEMemory::memCopy( logMessage.logThread, NETrace::LOG_NAMES_SIZE - 1u, thread.getString( ), static_cast<uint32_t>(thread.getLength( )) );
+                    logMessage.logThread[logMessage.logThreadLen] = '\0';
+                }
+            }
+        }
+
+        result = (flags & NETrace::CompactNamesOnly) == 0;
+    }
+
+    return result;
+}
+
+void LogSourceNames::createNamesMessages( const ITEM_ID & target, TEArrayList<RemoteMessage> & OUT out_list ) const
+{
+    for ( const auto & source : mSources.getData( ) )
+    {
+        for ( const auto & thread : source.second.snThreads.getData( ) )
+        {
+            out_list.add( NETrace::createCompactLogNames( source.first, target, thread.first, thread.second, source.second.snModule ) );
+        }
+    }
+}
+
+void LogSourceNames::removeSource( const ITEM_ID & cookie )
+{
+    mSources.removeAt( cookie );
+}
+
+void LogSourceNames::removeAll( void )
+{
+    mSources.clear( );
+}
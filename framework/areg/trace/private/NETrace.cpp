@@ -106,6 +106,267 @@ namespace
 }
 #endif // AREG_LOGS
 
+namespace
+{
+    /**
+     * \brief   The size of the fixed part of the compact log record:
+     *          the data type, the version, the flags and the message type.
+     **/
+    constexpr uint32_t  COMPACT_HEADER_SIZE { 4u };
+
+    /**
+     * \brief   The maximum size of the variable length encoded 64-bit integer.
+     **/
+    constexpr uint32_t  VARINT_MAX_SIZE     { 10u };
+
+    /**
+     * \brief   Encodes the value as a variable length integer, 7 bits per byte,
+     *          and returns the position after the last written byte.
+     **/
+    inline unsigned char * _writeVarint(unsigned char * dst, uint64_t value)
+    {
+        while (value >= 0x80u)
+        {
+            *dst ++ = static_cast<unsigned char>(value | 0x80u);
+            value >>= 7;
+        }
+
+        *dst ++ = static_cast<unsigned char>(value);
+        return dst;
+    }
+
+    /**
+     * \brief   Decodes the variable length integer. Returns the position after the last
+     *          read byte or nullptr if the buffer ends before the value is complete.
+     **/
+    inline const unsigned char * _readVarint(const unsigned char * src, const unsigned char * end, uint64_t & out_value)
+    {
+        const unsigned char * result{ nullptr };
+        uint64_t value{ 0u };
+        uint32_t shift{ 0u };
+
+        while ((src != nullptr) && (src < end) && (shift < 64u))
+        {
+            unsigned char byte{ *src ++ };
+            value |= static_cast<uint64_t>(byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0)
+            {
+                result = src;
+                break;
+            }
+
+            shift += 7u;
+        }
+
+        out_value = value;
+        return result;
+    }
+
+    /**
+     * \brief   Writes the length prefixed text and returns the position after the last written byte.
+     **/
+    inline unsigned char * _writeText(unsigned char * dst, const char * text, uint32_t length)
+    {
+        dst = _writeVarint(dst, length);
+        NEMemory::memCopy(dst, length, text, length);
+        return (dst + length);
+    }
+
+    /**
+     * \brief   Reads the length prefixed text into the buffer of specified size.
+     *          The text, which does not fit into the buffer, is truncated.
+     *          Returns the position after the text or nullptr if the record is invalid.
+     **/
+    inline const unsigned char * _readText(const unsigned char * src, const unsigned char * end, char * dst, uint32_t dstSize, unsigned int & out_length)
+    {
+        uint64_t length{ 0u };
+        src = _readVarint(src, end, length);
+        if ((src != nullptr) && (length <= static_cast<uint64_t>(end - src)))
+        {
+            out_length = static_cast<unsigned int>(MACRO_MIN(length, static_cast<uint64_t>(dstSize - 1u)));
+            NEMemory::memCopy(dst, dstSize, src, out_length);
+            dst[out_length] = '\0';
+            src += length;
+        }
+        else
+        {
+            src = nullptr;
+        }
+
+        return src;
+    }
+
+    /**
+     * \brief   The maximum size of the compact log record, which contains the names
+     *          of the thread and the module.
+     **/
+    constexpr uint32_t  COMPACT_RECORD_MAX  { COMPACT_HEADER_SIZE + 10u * VARINT_MAX_SIZE + NETrace::LOG_MESSAGE_IZE + 2u * NETrace::LOG_NAMES_SIZE };
+
+    /**
+     * \brief   Returns the size of the compact log record, which contains the text and the names.
+     **/
+    inline uint32_t _compactRecordSize(uint32_t lenMessage, uint32_t lenThread, uint32_t lenModule)
+    {
+        return (COMPACT_HEADER_SIZE + 10u * VARINT_MAX_SIZE + lenMessage + lenThread + lenModule);
+    }
+
+    /**
+     * \brief   Writes the compact log record and returns the position after the last written byte.
+     *          The names are written only if they are specified in the flags. The buffer should
+     *          have enough space to write the record.
+     **/
+    unsigned char * _writeCompactRecord( unsigned char * dst
+                                       , const NETrace::sLogMessage & logMessage
+                                       , unsigned char flags
+                                       , const String & threadName
+                                       , const String & moduleName)
+    {
+        uint32_t lenMessage{ MACRO_MIN(logMessage.logMessageLen, NETrace::LOG_MESSAGE_IZE - 1u) };
+
+        *dst ++ = static_cast<unsigned char>(NETrace::eLogDataType::LogDataCompact);
+        *dst ++ = NETrace::LOG_COMPACT_VERSION;
+        *dst ++ = static_cast<unsigned char>(flags & NETrace::CompactAllNames);
+        *dst ++ = static_cast<unsigned char>(logMessage.logMsgType);
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logMessagePrio));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logSource));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logTarget));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logModuleId));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logThreadId));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logTimestamp));
+        dst = _writeVarint(dst, static_cast<uint64_t>(logMessage.logScopeId));
+        dst = _writeText(dst, logMessage.logMessage, lenMessage);
+        if ((flags & NETrace::CompactThreadName) != 0)
+        {
+            dst = _writeText(dst, threadName.getString(), MACRO_MIN(static_cast<uint32_t>(threadName.getLength()), NETrace::LOG_NAMES_SIZE - 1u));
+        }
+
+        if ((flags & NETrace::CompactModuleName) != 0)
+        {
+            dst = _writeText(dst, moduleName.getString(), MACRO_MIN(static_cast<uint32_t>(moduleName.getLength()), NETrace::LOG_NAMES_SIZE - 1u));
+        }
+
+        return dst;
+    }
+
+    /**
+     * \brief   Writes the compact record, which contains only the names of the thread and the module,
+     *          and returns the position after the last written byte. The names are written only
+     *          if they are specified in the flags.
+     **/
+    unsigned char * _writeCompactNames( unsigned char * dst
+                                      , const ITEM_ID & threadId
+                                      , unsigned char flags
+                                      , const char * threadName
+                                      , uint32_t lenThread
+                                      , const char * moduleName
+                                      , uint32_t lenModule)
+    {
+        *dst ++ = static_cast<unsigned char>(NETrace::eLogDataType::LogDataCompact);
+        *dst ++ = NETrace::LOG_COMPACT_VERSION;
+        *dst ++ = static_cast<unsigned char>(NETrace::CompactNamesOnly | (flags & NETrace::CompactAllNames));
+        *dst ++ = static_cast<unsigned char>(NETrace::eLogMessageType::LogMessageUndefined);
+        dst = _writeVarint(dst, static_cast<uint64_t>(threadId));
+        if ((flags & NETrace::CompactThreadName) != 0)
+        {
+            dst = _writeText(dst, threadName, MACRO_MIN(lenThread, NETrace::LOG_NAMES_SIZE - 1u));
+        }
+
+        if ((flags & NETrace::CompactModuleName) != 0)
+        {
+            dst = _writeText(dst, moduleName, MACRO_MIN(lenModule, NETrace::LOG_NAMES_SIZE - 1u));
+        }
+
+        return dst;
+    }
+
+    /**
+     * \brief   Writes the length prefix and the record to the end of the batch.
+     *          The record should be located after VARINT_MAX_SIZE bytes reserved
+     *          in the buffer for the length prefix.
+     **/
+    bool _appendBatchRecord(RemoteMessage & msgBatch, unsigned char * begin, unsigned char * end)
+    {
+        unsigned char prefix[VARINT_MAX_SIZE];
+        uint32_t lenPrefix{ static_cast<uint32_t>(_writeVarint(prefix, static_cast<uint64_t>(end - begin)) - prefix) };
+        begin -= lenPrefix;
+        NEMemory::memCopy(begin, lenPrefix, prefix, lenPrefix);
+
+        uint32_t size{ static_cast<uint32_t>(end - begin) };
+        msgBatch.moveToEnd();
+        return (msgBatch.write(begin, size) == size);
+    }
+
+    /**
+     * \brief   Decodes the compact log record located between the specified positions.
+     *          The cookie of the decoded structure is set to the specified value.
+     *          Returns true if the record is valid.
+     **/
+    bool _readCompactRecord( const unsigned char * src
+                           , const unsigned char * end
+                           , const ITEM_ID & cookie
+                           , NETrace::sLogMessage & out_logMessage
+                           , unsigned char & out_flags)
+    {
+        bool result{ false };
+        out_flags = NETrace::CompactNoNames;
+        if ( (static_cast<uint32_t>(end - src) >= COMPACT_HEADER_SIZE)
+          && (src[0] == static_cast<unsigned char>(NETrace::eLogDataType::LogDataCompact))
+          && (src[1] == NETrace::LOG_COMPACT_VERSION))
+        {
+            out_flags = src[2];
+            out_logMessage.logDataType  = NETrace::eLogDataType::LogDataRemote;
+            out_logMessage.logMsgType   = static_cast<NETrace::eLogMessageType>(src[3]);
+            out_logMessage.logCookie    = cookie;
+            out_logMessage.logMessageLen= 0u;
+            out_logMessage.logMessage[0]= '\0';
+            out_logMessage.logThreadLen = 0u;
+            out_logMessage.logThread[0] = '\0';
+            out_logMessage.logModuleLen = 0u;
+            out_logMessage.logModule[0] = '\0';
+            src += COMPACT_HEADER_SIZE;
+
+            uint64_t value{ 0u };
+            if ((out_flags & NETrace::CompactNamesOnly) == 0)
+            {
+                src = _readVarint(src, end, value);
+                out_logMessage.logMessagePrio = static_cast<NETrace::eLogPriority>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logSource    = static_cast<ITEM_ID>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logTarget    = static_cast<ITEM_ID>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logModuleId  = static_cast<ITEM_ID>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logThreadId  = static_cast<ITEM_ID>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logTimestamp = static_cast<TIME64>(value);
+                src = _readVarint(src, end, value);
+                out_logMessage.logScopeId   = static_cast<unsigned int>(value);
+                src = src != nullptr ? _readText(src, end, out_logMessage.logMessage, NETrace::LOG_MESSAGE_IZE, out_logMessage.logMessageLen) : nullptr;
+            }
+            else
+            {
+                src = _readVarint(src, end, value);
+                out_logMessage.logThreadId  = static_cast<ITEM_ID>(value);
+            }
+
+            if ((src != nullptr) && ((out_flags & NETrace::CompactThreadName) != 0))
+            {
+                src = _readText(src, end, out_logMessage.logThread, NETrace::LOG_NAMES_SIZE, out_logMessage.logThreadLen);
+            }
+
+            if ((src != nullptr) && ((out_flags & NETrace::CompactModuleName) != 0))
+            {
+                src = _readText(src, end, out_logMessage.logModule, NETrace::LOG_NAMES_SIZE, out_logMessage.logModuleLen);
+            }
+
+            result = (src != nullptr);
+        }
+
+        return result;
+    }
+}
+
 NETrace::sLogMessage::sLogMessage(NETrace::eLogMessageType msgType)
     : logDataType   { NETrace::eLogDataType::LogDataLocal }
     , logMsgType    { msgType }
@@ -362,6 +623,206 @@ AREG_API_IMPL RemoteMessage NETrace::createLogMessage(const NETrace::sLogMessage
     return msgLog;
 }
 
+AREG_API_IMPL RemoteMessage NETrace::createCompactLogMessage(const NETrace::sLogMessage& logMessage, const ITEM_ID& srcCookie, unsigned char flags)
+{
+    RemoteMessage msgLog;
+#if AREG_LOGS
+    const String& threadName{ (flags & NETrace::CompactThreadName) != 0 ? Thread::getThreadName(static_cast<id_type>(logMessage.logThreadId)) : String::getEmptyString() };
+    const String& moduleName{ (flags & NETrace::CompactModuleName) != 0 ? Process::getInstance().getAppName() : String::getEmptyString() };
+    uint32_t reserve{ _compactRecordSize(logMessage.logMessageLen, static_cast<uint32_t>(threadName.getLength()), static_cast<uint32_t>(moduleName.getLength())) };
+
+    unsigned char* buffer{ msgLog.initMessage(_getLogMessage().rbHeader, MACRO_MIN(reserve, COMPACT_RECORD_MAX)) };
+    if (buffer != nullptr)
+    {
+        unsigned char* end{ _writeCompactRecord(buffer, logMessage, flags, threadName, moduleName) };
+        msgLog.setSizeUsed(static_cast<unsigned int>(end - buffer));
+        msgLog.moveToEnd();
+        msgLog.setSource(srcCookie);
+    }
+#endif  // AREG_LOGS
+
+    return msgLog;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::createCompactLogNames(const ITEM_ID& source, const ITEM_ID& target, const ITEM_ID& threadId, const String& threadName, const String& moduleName)
+{
+    RemoteMessage msgLog;
+#if AREG_LOGS
+    uint32_t lenThread { MACRO_MIN(static_cast<uint32_t>(threadName.getLength()), NETrace::LOG_NAMES_SIZE - 1u) };
+    uint32_t lenModule { MACRO_MIN(static_cast<uint32_t>(moduleName.getLength()), NETrace::LOG_NAMES_SIZE - 1u) };
+    uint32_t reserve   { COMPACT_HEADER_SIZE + 3u * VARINT_MAX_SIZE + lenThread + lenModule };
+
+    unsigned char* buffer{ msgLog.initMessage(_getLogMessage().rbHeader, reserve) };
+    if (buffer != nullptr)
+    {
+        unsigned char* dst{ _writeCompactNames(buffer, threadId, NETrace::CompactAllNames, threadName.getString(), lenThread, moduleName.getString(), lenModule) };
+
+        msgLog.setSizeUsed(static_cast<unsigned int>(dst - buffer));
+        msgLog.moveToEnd();
+        msgLog.setSource(source);
+        msgLog.setTarget(target);
+    }
+#endif  // AREG_LOGS
+
+    return msgLog;
+}
+
+AREG_API_IMPL unsigned char NETrace::getCompactLogFlags(const RemoteMessage& msgLog)
+{
+    const unsigned char* buffer{ msgLog.getBuffer() };
+    return (    (msgLog.getSizeUsed() >= COMPACT_HEADER_SIZE)
+             && (buffer[0] == static_cast<unsigned char>(NETrace::eLogDataType::LogDataCompact))
+             && (buffer[1] == NETrace::LOG_COMPACT_VERSION) ? buffer[2] : static_cast<unsigned char>(NETrace::CompactNoNames));
+}
+
+AREG_API_IMPL bool NETrace::readLogMessage(const RemoteMessage& msgLog, NETrace::sLogMessage& OUT out_logMessage, unsigned char& OUT out_flags)
+{
+    const unsigned char* src{ msgLog.getBuffer() };
+    const uint32_t size{ msgLog.getSizeUsed() };
+    bool result{ false };
+
+    out_flags = NETrace::CompactNoNames;
+    if ((size >= COMPACT_HEADER_SIZE) && (src[0] == static_cast<unsigned char>(NETrace::eLogDataType::LogDataCompact)))
+    {
+        result = _readCompactRecord(src, src + size, msgLog.getSource(), out_logMessage, out_flags);
+    }
+    else if (size >= static_cast<uint32_t>(offsetof(NETrace::sLogMessage, logMessage)))
+    {
+        // the structure sent by earlier versions, which contains the names.
+        NEMemory::memCopy(&out_logMessage, static_cast<uint32_t>(sizeof(NETrace::sLogMessage)), src, MACRO_MIN(size, static_cast<uint32_t>(sizeof(NETrace::sLogMessage))));
+        out_logMessage.logMessageLen = MACRO_MIN(out_logMessage.logMessageLen, NETrace::LOG_MESSAGE_IZE - 1u);
+        out_logMessage.logMessage[out_logMessage.logMessageLen] = '\0';
+        out_logMessage.logThreadLen  = MACRO_MIN(out_logMessage.logThreadLen, NETrace::LOG_NAMES_SIZE - 1u);
+        out_logMessage.logThread[out_logMessage.logThreadLen]   = '\0';
+        out_logMessage.logModuleLen  = MACRO_MIN(out_logMessage.logModuleLen, NETrace::LOG_NAMES_SIZE - 1u);
+        out_logMessage.logModule[out_logMessage.logModuleLen]   = '\0';
+        out_flags = NETrace::CompactAllNames;
+        result = true;
+    }
+
+    return result;
+}
+
+AREG_API_IMPL RemoteMessage NETrace::createLogBatch(const ITEM_ID& srcCookie, uint32_t reserve)
+{
+    RemoteMessage msgBatch;
+#if AREG_LOGS
+    unsigned char* buffer{ msgBatch.initMessage(_getLogMessage().rbHeader, MACRO_MAX(reserve, COMPACT_HEADER_SIZE)) };
+    if (buffer != nullptr)
+    {
+        buffer[0] = static_cast<unsigned char>(NETrace::eLogDataType::LogDataBatch);
+        buffer[1] = NETrace::LOG_COMPACT_VERSION;
+        buffer[2] = 0u;
+        buffer[3] = 0u;
+
+        msgBatch.setSizeUsed(COMPACT_HEADER_SIZE);
+        msgBatch.moveToEnd();
+        msgBatch.setSource(srcCookie);
+    }
+#endif  // AREG_LOGS
+
+    return msgBatch;
+}
+
+AREG_API_IMPL bool NETrace::appendLogBatch(RemoteMessage& msgBatch, const NETrace::sLogMessage& logMessage, unsigned char flags)
+{
+    bool result{ false };
+#if AREG_LOGS
+    if (NETrace::isLogBatch(msgBatch))
+    {
+        const String& threadName{ (flags & NETrace::CompactThreadName) != 0 ? Thread::getThreadName(static_cast<id_type>(logMessage.logThreadId)) : String::getEmptyString() };
+        const String& moduleName{ (flags & NETrace::CompactModuleName) != 0 ? Process::getInstance().getAppName() : String::getEmptyString() };
+
+        // the record is written after the space reserved for the length prefix.
+        unsigned char record[VARINT_MAX_SIZE + COMPACT_RECORD_MAX];
+        unsigned char* begin{ record + VARINT_MAX_SIZE };
+        unsigned char* end{ _writeCompactRecord(begin, logMessage, flags, threadName, moduleName) };
+        result = _appendBatchRecord(msgBatch, begin, end);
+    }
+#endif  // AREG_LOGS
+
+    return result;
+}
+
+AREG_API_IMPL bool NETrace::appendLogBatch(RemoteMessage& msgBatch, const RemoteMessage& msgSource, uint32_t begin, uint32_t end)
+{
+    bool result{ false };
+#if AREG_LOGS
+    begin = MACRO_MAX(begin, COMPACT_HEADER_SIZE);
+    if (NETrace::isLogBatch(msgBatch) && NETrace::isLogBatch(msgSource) && (begin < end) && (end <= msgSource.getSizeUsed()))
+    {
+        // the records of the batch are already length prefixed, copy as it is.
+        uint32_t size{ end - begin };
+        msgBatch.moveToEnd();
+        result = (msgBatch.write(msgSource.getBuffer() + begin, size) == size);
+    }
+#endif  // AREG_LOGS
+
+    return result;
+}
+
+AREG_API_IMPL bool NETrace::appendLogBatchNames(RemoteMessage& msgBatch, const NETrace::sLogMessage& logMessage, unsigned char flags)
+{
+    bool result{ false };
+#if AREG_LOGS
+    if (NETrace::isLogBatch(msgBatch) && ((flags & NETrace::CompactAllNames) != 0))
+    {
+        unsigned char record[VARINT_MAX_SIZE + COMPACT_HEADER_SIZE + VARINT_MAX_SIZE + 2u * (VARINT_MAX_SIZE + NETrace::LOG_NAMES_SIZE)];
+        unsigned char* begin{ record + VARINT_MAX_SIZE };
+        unsigned char* end{ _writeCompactNames( begin
+                                              , logMessage.logThreadId
+                                              , flags
+                                              , logMessage.logThread
+                                              , logMessage.logThreadLen
+                                              , logMessage.logModule
+                                              , logMessage.logModuleLen) };
+        result = _appendBatchRecord(msgBatch, begin, end);
+    }
+#endif  // AREG_LOGS
+
+    return result;
+}
+
+AREG_API_IMPL bool NETrace::isLogBatch(const RemoteMessage& msgLog)
+{
+    const unsigned char* buffer{ msgLog.getBuffer() };
+    return (    (msgLog.getSizeUsed() >= COMPACT_HEADER_SIZE)
+             && (buffer[0] == static_cast<unsigned char>(NETrace::eLogDataType::LogDataBatch))
+             && (buffer[1] == NETrace::LOG_COMPACT_VERSION));
+}
+
+AREG_API_IMPL bool NETrace::readLogMessage(const RemoteMessage& msgLog, uint32_t& IN OUT position, NETrace::sLogMessage& OUT out_logMessage, unsigned char& OUT out_flags)
+{
+    const unsigned char* buffer{ msgLog.getBuffer() };
+    const uint32_t size{ msgLog.getSizeUsed() };
+    bool result{ false };
+
+    out_flags = NETrace::CompactNoNames;
+    if (NETrace::isLogBatch(msgLog))
+    {
+        position = MACRO_MAX(position, COMPACT_HEADER_SIZE);
+        uint64_t length{ 0u };
+        const unsigned char* src{ position < size ? _readVarint(buffer + position, buffer + size, length) : nullptr };
+        if ((src != nullptr) && (length <= static_cast<uint64_t>(buffer + size - src)))
+        {
+            const unsigned char* end{ src + length };
+            result = _readCompactRecord(src, end, msgLog.getSource(), out_logMessage, out_flags);
+            position = static_cast<uint32_t>(end - buffer);
+        }
+        else
+        {
+            position = size;
+        }
+    }
+    else if (position == 0u)
+    {
+        result = NETrace::readLogMessage(msgLog, out_logMessage, out_flags);
+        position = size;
+    }
+
+    return result;
+}
+
 AREG_API_IMPL void NETrace::logMessage(const RemoteMessage& message)
 {
 #if AREG_LOGS
@@ -520,6 +981,25 @@ AREG_API_IMPL RemoteMessage NETrace::messageSaveConfiguration(const ITEM_ID& sou
     return msgRequest;
 }
 
+AREG_API_IMPL RemoteMessage NETrace::messageLogFilter(const ITEM_ID& source, const ITEM_ID& target, const NETrace::sLogFilter& logFilter)
+{
+    RemoteMessage msgFilter;
+
+#if AREG_LOGS
+    if ((source != NEService::COOKIE_UNKNOWN) &&
+        (target != NEService::COOKIE_UNKNOWN) &&
+        (msgFilter.initMessage(_getLogEmptyMessage().rbHeader) != nullptr))
+    {
+        msgFilter.setMessageId(static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogFilter));
+        msgFilter.setTarget(target);
+        msgFilter.setSource(source);
+        msgFilter << logFilter;
+    }
+#endif  // AREG_LOGS
+
+    return msgFilter;
+}
+
 AREG_API_IMPL RemoteMessage NETrace::messageConfigurationSaved(void)
 {
     RemoteMessage msgScope;
@@ -32,7 +32,7 @@ NetTcpLogger::NetTcpLogger(LogConfiguration & logConfig, ScopeController & scope
     : LoggerBase                    (logConfig)
     , ServiceClientConnectionBase   ( NEService::COOKIE_LOGGER
                                     , NERemoteService::eRemoteServices::ServiceLogger
-                                    , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip)
+                                    , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectSM) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectUds)
                                     , NEService::eMessageSource::MessageSourceClient
                                     , static_cast<IEServiceConnectionConsumer &>(self())
                                     , static_cast<IERemoteMessageHandler &>(self())
@@ -44,6 +44,12 @@ NetTcpLogger::NetTcpLogger(LogConfiguration & logConfig, ScopeController & scope
     , mScopeController  ( scopeController )
     , mIsEnabled        ( false )
     , mRingStack        ( 0, NECommon::eRingOverlap::ShiftOnOverlap )
+    , mConnectSequence  ( 0u )
+    , mNamesSequence    ( 0u )
+    , mSentNames        ( )
+    , mBatchSize        ( 0u )
+    , mBatch            ( )
+    , mBatchTime        ( 0 )
 {
 }
 
@@ -59,6 +65,7 @@ bool NetTcpLogger::openLogger(void)
         {
             registerForServiceClientCommands();
             mRingStack.reserve(mLogConfiguration.getStackSize());
+            mBatchSize = mLogConfiguration.getBatchSize();
 
             String host{ mLogConfiguration.getRemoteTcpAddress()};
             uint16_t port{ mLogConfiguration.getRemoteTcpPort() };
@@ -82,6 +89,7 @@ bool NetTcpLogger::openLogger(void)
 
 void NetTcpLogger::closeLogger(void)
 {
+    _sendBatch();
     mRingStack.discard();
     onServiceExit();
     unregisterForServiceClientCommands();
@@ -93,11 +101,43 @@ void NetTcpLogger::logMessage(const NETrace::sLogMessage& logMessage)
     {
         if (mChannel.isValid() && isConnectState())
         {
-            sendMessage(NETrace::createLogMessage(logMessage, NETrace::eLogDataType::LogDataRemote, mChannel.getCookie()), Event::eEventPriority::EventPriorityNormal);
+            // the names of the thread and the module are sent once per connection.
+            unsigned int sequence{ mConnectSequence.load() };
+            if (mNamesSequence != sequence)
+            {
+                mNamesSequence = sequence;
+                mSentNames.clear();
+            }
+
+            unsigned char flags{ mSentNames.addIfUnique(logMessage.logThreadId, true).second ? NETrace::CompactAllNames : NETrace::CompactNoNames };
+            if (mBatchSize == 0u)
+            {
+                sendMessage(NETrace::createCompactLogMessage(logMessage, mChannel.getCookie(), flags), Event::eEventPriority::EventPriorityNormal);
+            }
+            else
+            {
+                if (NETrace::isLogBatch(mBatch) == false)
+                {
+                    mBatch = NETrace::createLogBatch(mChannel.getCookie(), mBatchSize);
+                    mBatchTime = logMessage.logTimestamp;
+                }
+
+                NETrace::appendLogBatch(mBatch, logMessage, flags);
+
+                // the errors are sent immediately, the batch is also sent if it is full or too old.
+                if ( (mBatch.getSizeUsed() >= mBatchSize)
+                  || (logMessage.logMessagePrio == NETrace::eLogPriority::PrioFatal)
+                  || (logMessage.logMessagePrio == NETrace::eLogPriority::PrioError)
+                  || ((logMessage.logTimestamp - mBatchTime) >= BATCH_LATENCY))
+                {
+                    _sendBatch();
+                }
+            }
         }
         else if (mRingStack.capacity() != 0)
         {
-            mRingStack.pushLast(NETrace::createLogMessage(logMessage, NETrace::eLogDataType::LogDataRemote, mChannel.getCookie()));
+            // the queued messages contain the names, since they are sent when the connection is established.
+            mRingStack.pushLast(NETrace::createCompactLogMessage(logMessage, mChannel.getCookie(), NETrace::CompactAllNames));
         }
     }
 }
@@ -108,6 +148,38 @@ bool NetTcpLogger::isLoggerOpened(void) const
     return isConnectedState();
 }
 
+void NetTcpLogger::flushLogs(void)
+{
+    _sendBatch();
+}
+
+inline void NetTcpLogger::_sendBatch(void)
+{
+    if (NETrace::isLogBatch(mBatch))
+    {
+        if (mChannel.isValid() && isConnectState())
+        {
+            sendMessage(mBatch, Event::eEventPriority::EventPriorityNormal);
+        }
+        else
+        {
+            _queueBatch();
+        }
+
+        mBatch.invalidate();
+    }
+}
+
+inline void NetTcpLogger::_queueBatch(void)
+{
+    if (NETrace::isLogBatch(mBatch) && (mRingStack.capacity() != 0))
+    {
+        mRingStack.pushLast(mBatch);
+    }
+
+    mBatch.invalidate();
+}
+
 void NetTcpLogger::connectedRemoteServiceChannel(const Channel & channel)
 {
     ASSERT(channel.isValid());
@@ -115,12 +187,13 @@ void NetTcpLogger::connectedRemoteServiceChannel(const Channel & channel)
     ASSERT(mChannel.isValid());
 
     mIsEnabled = true;
+    ++ mConnectSequence;
     const ITEM_ID& cookie = channel.getCookie();
     while (mRingStack.isEmpty() == false)
     {
+        // the compact record has no cookie, it is the source of the message.
         RemoteMessage msgLog{ mRingStack.popFirst() };
         msgLog.setSource(cookie);
-        reinterpret_cast<NETrace::sLogMessage*>(msgLog.getBuffer())->logCookie = cookie;
         sendMessage(msgLog, Event::eEventPriority::EventPriorityNormal);
     }
 }
@@ -129,12 +202,16 @@ void NetTcpLogger::disconnectedRemoteServiceChannel(const Channel & channel)
 {
     ASSERT(mChannel.isValid() == false);
     mIsEnabled = false;
+    ++ mConnectSequence;
+    _queueBatch();
     mClientConnection.setCookie(NEService::COOKIE_UNKNOWN);
 }
 
 void NetTcpLogger::lostRemoteServiceChannel(const Channel & channel)
 {
     ASSERT(mChannel.isValid() == false);
+    ++ mConnectSequence;
+    _queueBatch();
     mClientConnection.setCookie(NEService::COOKIE_UNKNOWN);
 }
 
@@ -26,12 +26,14 @@
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 
 #include "areg/base/IEIOStream.hpp"
+#include "areg/base/TEHashMap.hpp"
 #include "areg/base/TERingStack.hpp"
 #include "areg/base/Thread.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
 #include "areg/ipc/ClientConnection.hpp"
 
+#include <atomic>
 #include <string_view>
 
 #if AREG_LOGS
@@ -67,6 +69,9 @@ private:
     //!< A prefix to add in front of thread and timer names.
     static constexpr std::string_view   PREFIX_THREAD{ "logger_" };
 
+    //!< The maximum time in microseconds between the first and the last record in the batch of log records.
+    static constexpr TIME64             BATCH_LATENCY{ 100'000 };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -120,6 +125,13 @@ public:
      **/
     virtual bool isLoggerOpened( void ) const override;
 
+public:
+    /**
+     * \brief   Call to send the batch of log records, if there are any queued.
+     *          Called when there are no more messages to log.
+     **/
+    void flushLogs( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -191,6 +203,17 @@ private:
     //!< Wrapper of 'this' pointer.
     inline NetTcpLogger& self(void);
 
+    /**
+     * \brief   Sends the batch of log records, if it is not empty.
+     **/
+    inline void _sendBatch( void );
+
+    /**
+     * \brief   Moves the batch of log records, which is not sent, to the ring stack
+     *          to send when the connection is established again.
+     **/
+    inline void _queueBatch( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -201,6 +224,18 @@ private:
     bool                mIsEnabled;
     //!< The ring stack to queue log messages if the connection setup did not complete yet.
     RingStack           mRingStack;
+    //!< The sequence number of established connection, increased when connected to the logger.
+    std::atomic_uint    mConnectSequence;
+    //!< The sequence number of the connection, which the names of the threads were sent.
+    unsigned int        mNamesSequence;
+    //!< The IDs of threads, which names and the name of the module were sent in the current connection.
+    TEHashMap<ITEM_ID, bool>    mSentNames;
+    //!< The maximum size in bytes of the batch of log records. If 0, the records are not batched.
+    uint32_t            mBatchSize;
+    //!< The batch of log records to send in one message.
+    RemoteMessage       mBatch;
+    //!< The timestamp of the first record in the batch.
+    TIME64              mBatchTime;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -37,9 +37,33 @@ void ScopeController::registerScope( TraceScope & scope )
 
 void ScopeController::unregisterScope( TraceScope & scope )
 {
+    bindScopes( false );
     mMapTraceScope.unregisterResourceObject( static_cast<unsigned int>(scope) );
 }
 
+void ScopeController::bindScopes( bool activate )
+{
+    TraceScope * scope = TraceScope::_takeStaticScopes( );
+    if ( scope != nullptr )
+    {
+        mMapTraceScope.lock( );
+
+        unsigned int defaultPrio{ NELogging::DEFAULT_LOG_PRIORITY };
+        mConfigScopeGroup.find( NELogging::LOG_SCOPES_GRPOUP, defaultPrio );
+
+        for ( ; scope != nullptr; scope = scope->mNextScope )
+        {
+            registerScope( *scope );
+            if ( activate )
+            {
+                activateScope( *scope, defaultPrio );
+            }
+        }
+
+        mMapTraceScope.unlock( );
+    }
+}
+
 void ScopeController::setScopePriority( unsigned int scopeId, unsigned int newPrio )
 {
     mMapTraceScope.lock( );
@@ -264,6 +288,7 @@ void ScopeController::activateScope( TraceScope & traceScope, unsigned int defau
 
 void ScopeController::changeScopeActivityStatus( bool makeActive )
 {
+    bindScopes( false );
     mMapTraceScope.lock( );
 
     if ( makeActive )
@@ -289,6 +314,7 @@ void ScopeController::changeScopeActivityStatus( bool makeActive )
 
 void ScopeController::changeScopeActivityStatus( const String & scopeName, unsigned int scopeId, unsigned int logPrio )
 {
+    bindScopes( false );
     if ( _isScopeGroup( scopeName ) )
     {
         setScopeGroupPriority( scopeName, logPrio );
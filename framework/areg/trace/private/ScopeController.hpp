@@ -150,6 +150,15 @@ public:
      **/
     void unregisterScope( TraceScope & scope );
 
+    /**
+     * \brief   Registers all trace scopes, which are created and not bound yet, in one pass.
+     *          The scopes are taken from the static list of scopes without locking
+     *          and the map of scopes is locked only once.
+     * \param   activate    If true, activates the bound scopes and sets the priorities
+     *                      from the configuration. Otherwise, the priorities are not changed.
+     **/
+    void bindScopes( bool activate );
+
     /**
      * \brief   By given unique ID searches trace scope object in the map and if found,
      *          sets the specified scope priority.
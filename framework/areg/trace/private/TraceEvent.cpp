@@ -54,6 +54,16 @@ TraceEventData::TraceEventData( TraceEventData::eTraceAction action, const NETra
 {
 }
 
+TraceEventData::TraceEventData( TraceEventData::eTraceAction action, const TraceEventData::sLogRecord & record, const unsigned char * args )
+    : mAction       ( action )
+    , mDataBuffer   ( static_cast<uint32_t>(sizeof( TraceEventData::sLogRecord )) + record.lrArgsSize, reinterpret_cast<const unsigned char *>(&record), static_cast<uint32_t>(sizeof( TraceEventData::sLogRecord )) )
+{
+    if ( record.lrArgsSize != 0 )
+    {
+        mDataBuffer.write( args, record.lrArgsSize );
+    }
+}
+
 TraceEventData::TraceEventData( const TraceEventData & src )
     : mAction       ( src.mAction )
     , mDataBuffer   ( src.mDataBuffer )
@@ -20,6 +20,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/TEEvent.hpp"
 #include "areg/base/SharedBuffer.hpp"
+#include "areg/trace/TraceMessage.hpp"
 
 #if AREG_LOGS
 
@@ -64,8 +65,35 @@ public:
         , TraceLogMessage               //!< Action to output logging message
         , TraceUpdateScopes             //!< Action to update scope priorities
         , TraceQueryScopes              //!< Action to send the list of scopes.
+        , TraceLogRecord                //!< Action to format and output deferred log record
     } eTraceAction;
 
+    /**
+     * \brief   TraceEventData::sLogRecord
+     *          The header of the deferred log record. The log record contains the pointer
+     *          to the format of the message and the packed arguments, which follow the header.
+     *          The message is formatted in the logging thread.
+     **/
+    struct sLogRecord
+    {
+        //!< The function to format the message.
+        TraceMessage::FuncFormatRecord  lrFormatter;
+        //!< The format of the message.
+        const char *                    lrFormat;
+        //!< The cookie of the log source.
+        ITEM_ID                         lrCookie;
+        //!< The timestamp of the message.
+        TIME64                          lrTimestamp;
+        //!< The ID of the thread, which created the message.
+        id_type                         lrThreadId;
+        //!< The ID of the scope.
+        unsigned int                    lrScopeId;
+        //!< The priority of the message.
+        NETrace::eLogPriority           lrPriority;
+        //!< The size in bytes of the packed arguments, which follow the header.
+        unsigned int                    lrArgsSize;
+    };
+
     /**
      * \brief   Converts and returns the string of TraceEventData::eTraceAction value
      **/
@@ -100,6 +128,14 @@ public:
      **/
     TraceEventData( TraceEventData::eTraceAction action, const NETrace::sLogMessage & logData );
 
+    /**
+     * \brief   Creates the logging even data with specified action and deferred log record.
+     * \param   action  The action ID to set in event data
+     * \param   record  The header of the deferred log record.
+     * \param   args    The packed arguments of the log record. The size is set in the header.
+     **/
+    TraceEventData( TraceEventData::eTraceAction action, const TraceEventData::sLogRecord & record, const unsigned char * args );
+
     /**
      * \brief   Copies logging event data from given source.
      * \param   src     The source to copy data.
@@ -202,6 +238,7 @@ inline const char * TraceEventData::getString( TraceEventData::eTraceAction acti
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceLogMessage);
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceUpdateScopes);
     CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceQueryScopes);
+    CASE_MAKE_STRING(TraceEventData::eTraceAction::TraceLogRecord);
     CASE_DEFAULT("ERR: Undefined TraceEventData::eTraceAction value!");
     }
 }
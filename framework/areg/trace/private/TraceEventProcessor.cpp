@@ -20,7 +20,9 @@
 
 #include "areg/base/FileBuffer.hpp"
 #include "areg/base/IEIOStream.hpp"
+#include "areg/base/Process.hpp"
 #include "areg/trace/TraceScope.hpp"
+#include "areg/trace/private/LogMessage.hpp"
 #include "areg/trace/private/TraceManager.hpp"
 #include "areg/trace/private/ScopeNodes.hpp"
 
@@ -61,6 +63,10 @@ void TraceEventProcessor::processLogEvent( TraceEventData::eTraceAction cmdLog,
         _traceLogMessage( stream );
         break;
 
+    case TraceEventData::eTraceAction::TraceLogRecord:
+        _traceLogRecord( stream );
+        break;
+
     default:
         break; // ignore, do nothing
     }
@@ -93,6 +99,27 @@ inline void TraceEventProcessor::_traceLogMessage( const SharedBuffer & data )
     mTraceManager.writeLogMessage( *logMessage );
 }
 
+inline void TraceEventProcessor::_traceLogRecord( const SharedBuffer & data )
+{
+    const TraceEventData::sLogRecord * record = reinterpret_cast<const TraceEventData::sLogRecord *>(data.getBuffer( ));
+    ASSERT( record != nullptr );
+
+    LogMessage logData( NETrace::eLogMessageType::LogMessageText );
+    logData.logMessagePrio  = record->lrPriority;
+    logData.logCookie       = record->lrCookie;
+    logData.logModuleId     = Process::getInstance( ).getId( );
+    logData.logThreadId     = record->lrThreadId;
+    logData.logTimestamp    = record->lrTimestamp;
+    logData.logScopeId      = record->lrScopeId;
+
+    const unsigned char * args = reinterpret_cast<const unsigned char *>(record + 1);
+    int len = record->lrFormatter( logData.logMessage, static_cast<int>(NETrace::LOG_MESSAGE_IZE), record->lrFormat, args );
+    logData.logMessageLen   = len > 0 ? MACRO_MIN( static_cast<uint32_t>(len), NETrace::LOG_MESSAGE_IZE - 1u ) : 0u;
+    logData.logMessage[logData.logMessageLen] = String::EmptyChar;
+
+    mTraceManager.writeLogMessage( logData );
+}
+
 inline void TraceEventProcessor::_changeScopePriority( const SharedBuffer & stream, unsigned int scopeCount )
 {
     String scopeName{ };
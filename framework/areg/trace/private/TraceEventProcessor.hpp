@@ -98,6 +98,11 @@ private:
      **/
     void _traceLogMessage( const SharedBuffer & data );
 
+    /**
+     * \brief   Formats and logs the deferred log record.
+     **/
+    void _traceLogRecord( const SharedBuffer & data );
+
     /**
      * \brief   Changes the priority of the scopes. The streaming object contains the list of scopes
      *          with ID and priority to change. Each scope entry can be either a single scope
@@ -53,6 +53,11 @@ void TraceManager::logMessage(const RemoteMessage& logData)
     TraceManager::getInstance().sendLogEvent( TraceEventData(TraceEventData::eTraceAction::TraceLogMessage, logData) );
 }
 
+void TraceManager::logRecord( const TraceEventData::sLogRecord & record, const unsigned char * args )
+{
+    TraceManager::getInstance().sendLogEvent( TraceEventData(TraceEventData::eTraceAction::TraceLogRecord, record, args) );
+}
+
 void TraceManager::sendCommandMessage(TraceEventData::eTraceAction cmd, const SharedBuffer& data)
 {
     TraceManager::getInstance().sendLogEvent(TraceEventData(cmd, data));
@@ -90,6 +95,7 @@ void TraceManager::updateScopeConfiguration(void)
     TraceManager& traceManager = TraceManager::getInstance();
     Lock lock(traceManager.mLock);
 
+    traceManager.mScopeController.bindScopes(traceManager.mIsStarted);
     LogConfiguration config;
     config.updateScopeConfiguration(traceManager.mScopeController);
 }
@@ -130,6 +136,7 @@ void TraceManager::setDefaultConfiguration(bool overwriteExisting)
 
 bool TraceManager::setScopePriority( const char * scopeName, unsigned int newPrio )
 {
+    TraceManager::bindTraceScopes( );
     ScopeController & ctrScope = TraceManager::getInstance( ).mScopeController;
     unsigned int scopeId = NETrace::makeScopeId( scopeName );
     const TraceScope * scope = ctrScope.getScope( scopeId );
@@ -151,6 +158,7 @@ void TraceManager::updateScopes(const String & scopeName, unsigned int scopeId,
 
 unsigned int TraceManager::getScopePriority( const char * scopeName )
 {
+    TraceManager::bindTraceScopes( );
     ScopeController & ctrScope = TraceManager::getInstance( ).mScopeController;
     unsigned int scopeId = NETrace::makeScopeId( scopeName );
     const TraceScope * scope = ctrScope.getScope( scopeId );
@@ -358,6 +366,7 @@ void TraceManager::writeLogMessage( const NETrace::sLogMessage & logMessage )
     if ( hasMoreEvents() == false )
     {
         mLoggerFile.flushLogs();
+        mLoggerTcp.flushLogs();
         mLoggerDatabase.flushLogs();
     }
 }
@@ -100,6 +100,14 @@ public:
      **/
     static void logMessage( const RemoteMessage& logData );
 
+    /**
+     * \brief   Triggers an event to format and log the deferred log record created locally
+     *          in the same process. The message is formatted in the logging thread.
+     * \param   record  The header of the deferred log record.
+     * \param   args    The packed arguments of the log record.
+     **/
+    static void logRecord( const TraceEventData::sLogRecord & record, const unsigned char * args );
+
     /**
      * \brief   Generates and queues a message to execute internal command.
      * \param   cmd     The command to execute.
@@ -159,11 +167,17 @@ public:
     inline static void waitLoggingEnd(void);
 
     /**
-     * \brief   Registers instance of trace scope object in trace manager.
-     *          The trace scope should have unique ID.
-     * \param   scope   The instance of trace scope object to register
+     * \brief   Registers in trace manager all trace scopes, which are created and not bound yet.
+     *          If the logging is started, activates the scopes and sets the priorities.
      **/
-    inline static void registerTraceScope( TraceScope & scope );
+    inline static void bindTraceScopes( void );
+
+    /**
+     * \brief   Creates the instance of trace manager, if it is not created yet.
+     *          Called by the first static trace scope, so that the trace manager
+     *          is destroyed after the scopes, which unregister in destructor.
+     **/
+    inline static void createTraceManager( void );
 
     /**
      * \brief   Unregisters instance of trace scope object in trace manager.
@@ -508,9 +522,15 @@ inline void TraceManager::waitLoggingEnd(void)
     getInstance().waitLoggingThreadEnd();
 }
 
-inline void TraceManager::registerTraceScope(TraceScope& scope)
+inline void TraceManager::bindTraceScopes( void )
+{
+    TraceManager & traceManager = getInstance( );
+    traceManager.mScopeController.bindScopes( traceManager.mIsStarted );
+}
+
+inline void TraceManager::createTraceManager( void )
 {
-    getInstance().mScopeController.registerScope(scope);
+    static_cast<void>(getInstance( ));
 }
 
 inline void TraceManager::unregisterTraceScope( TraceScope & scope )
@@ -19,6 +19,8 @@
 #include "areg/trace/private/LogMessage.hpp"
 #include "areg/trace/private/TraceEvent.hpp"
 #include "areg/trace/private/TraceManager.hpp"
+#include "areg/base/DateTime.hpp"
+#include "areg/base/Thread.hpp"
 
 #include <stdarg.h>
 
@@ -123,6 +125,31 @@ inline void TraceMessage::_sendLog( unsigned int scopeId, NETrace::eLogPriority
     TraceManager::logMessage( logData );
 }
 
+void TraceMessage::_sendFormatted( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, ... )
+{
+    va_list args;
+    va_start(args, format);
+    TraceMessage::_sendLog(scopeId, msgPrio, format, args);
+    va_end(args);
+}
+
+void TraceMessage::_sendRecord( unsigned int scopeId, NETrace::eLogPriority msgPrio, const char * format, FuncFormatRecord formatter, const unsigned char * args, unsigned int size )
+{
+    const TraceEventData::sLogRecord record
+    {
+          formatter
+        , format
+        , TraceManager::getConnectionCookie( )
+        , DateTime::getNow( )
+        , Thread::getCurrentThreadId( )
+        , scopeId
+        , msgPrio
+        , size
+    };
+
+    TraceManager::logRecord( record, args );
+}
+
 #else   // AREG_LOGS
 
 TraceMessage::TraceMessage(const TraceScope& /*traceScope*/)
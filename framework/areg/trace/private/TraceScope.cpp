@@ -19,6 +19,8 @@
 #include "areg/trace/TraceScope.hpp"
 #include "areg/trace/private/TraceManager.hpp"
 
+#include <atomic>
+
 //////////////////////////////////////////////////////////////////////////////
 // TraceScope class implementation
 //////////////////////////////////////////////////////////////////////////////
@@ -29,18 +31,49 @@
 
 #if AREG_LOGS
 
+namespace
+{
+    //!< The head of the static list of scopes, which are not bound to the scope controller yet.
+    std::atomic<TraceScope *>   _staticScopes   { nullptr };
+    //!< The flag, indicating whether the scope controller has taken the static list of scopes.
+    std::atomic_bool            _scopesBound    { false };
+}
+
 TraceScope::TraceScope( const char * scopeName, NETrace::eLogPriority priority /*= NETrace::PrioNotset*/ )
+    : TraceScope    ( scopeName, NETrace::makeScopeId(scopeName), priority )
+{
+}
+
+TraceScope::TraceScope( const char * scopeName, unsigned int scopeId, NETrace::eLogPriority priority /*= NETrace::PrioNotset*/ )
     : mScopeName    ( scopeName != nullptr ? scopeName : "" )
-    , mScopeId      ( NETrace::makeScopeId(mScopeName.getString())  )
+    , mScopeId      ( scopeId )
     , mScopePrio    ( priority )
+    , mNextScope    ( _staticScopes.load( ) )
 {
-    TraceManager::registerTraceScope( self() );
+    ASSERT( mScopeId == NETrace::makeScopeId( mScopeName.getString( ) ) );
+
+    // no lock is used, the scope is bound by the scope controller.
+    while ( _staticScopes.compare_exchange_weak( mNextScope, this ) == false )
+        ;
+
+    if ( mNextScope == nullptr )
+    {
+        // the scopes unregister in the destructor, the trace manager should be destroyed after the static scopes.
+        TraceManager::createTraceManager( );
+    }
+
+    if ( _scopesBound )
+    {
+        // the logging is already initialized, bind the scope now.
+        TraceManager::bindTraceScopes( );
+    }
 }
 
 TraceScope::TraceScope(const IEInStream & stream)
     : mScopeName    (stream)
     , mScopeId      (stream.read32Bits())
     , mScopePrio    (stream.read32Bits())
+    , mNextScope    (nullptr)
 {
 }
 
@@ -59,12 +92,27 @@ void TraceScope::setPriority(const String& newPrio)
     setPriority(NETrace::stringToLogPrio(newPrio));
 }
 
+TraceScope * TraceScope::_takeStaticScopes( void )
+{
+    _scopesBound = true;
+    return _staticScopes.exchange( nullptr );
+}
+
 #else   // AREG_LOGS
 
 TraceScope::TraceScope(const char* /*scopeName*/, NETrace::eLogPriority /*priority*/ /*= NETrace::PrioNotset*/)
     : mScopeName    ()
     , mScopeId      ( 0 )
     , mScopePrio    ( static_cast<unsigned int>(NETrace::eLogPriority::PrioInvalid) )
+    , mNextScope    ( nullptr )
+{
+}
+
+TraceScope::TraceScope(const char* /*scopeName*/, unsigned int /*scopeId*/, NETrace::eLogPriority /*priority*/ /*= NETrace::PrioNotset*/)
+    : mScopeName    ()
+    , mScopeId      ( 0 )
+    , mScopePrio    ( static_cast<unsigned int>(NETrace::eLogPriority::PrioInvalid) )
+    , mNextScope    ( nullptr )
 {
 }
 
@@ -72,7 +120,13 @@ TraceScope::TraceScope(const IEInStream& stream)
     : mScopeName    ()
     , mScopeId      ( 0 )
     , mScopePrio    ( static_cast<unsigned int>(NETrace::eLogPriority::PrioInvalid) )
+    , mNextScope    ( nullptr )
+{
+}
+
+TraceScope * TraceScope::_takeStaticScopes( void )
 {
+    return nullptr;
 }
 
 TraceScope::~TraceScope(void)
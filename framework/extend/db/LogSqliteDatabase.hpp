@@ -18,19 +18,96 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/IEThreadConsumer.hpp"
 #include "areg/trace/IELogDatabaseEngine.hpp"
 #include "sqlite3/amalgamation/sqlite3.h"
 
 #include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/NEService.hpp"
+
+#include <atomic>
 
 //////////////////////////////////////////////////////////////////////////
 // LogSqliteDatabase class declaration
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The logging database engine, responsible to log messages in the database.
+ *          The log messages are not written in the caller thread. They are queued and
+ *          the writer thread inserts them in the database by prepared statements in a single
+ *          transaction, when either the queue contains GROUP_COMMIT_SIZE messages or the
+ *          GROUP_COMMIT_TIMEOUT expires. Other operations are performed in the caller thread
+ *          after the queued messages are written. The database uses write-ahead logging.
+ *
+ *          If the partition time or size is set, the log messages are written in the
+ *          partitions, which are separate database files next to the main database file.
+ *          The writer starts a new partition when the current partition is older than
+ *          the partition time or is bigger than the partition size. The main database
+ *          contains the manifest of partitions with the time span and the sources of the
+ *          messages of each partition. The queries of log messages check only the partitions
+ *          matching the time range, and the retention drops the old partitions as whole files.
+ *          If the partitioning is disabled, the main database is the only partition.
  **/
-class LogSqliteDatabase : public IELogDatabaseEngine
+class LogSqliteDatabase : public    IELogDatabaseEngine
+                        , private   IEThreadConsumer
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   LogSqliteDatabase::GROUP_COMMIT_SIZE
+     *          The number of queued log messages to write in a single transaction.
+     **/
+    static constexpr uint32_t   GROUP_COMMIT_SIZE       { 2048 };
+
+    /**
+     * \brief   LogSqliteDatabase::GROUP_COMMIT_TIMEOUT
+     *          The maximum time in milliseconds the log messages stay in the queue.
+     **/
+    static constexpr uint32_t   GROUP_COMMIT_TIMEOUT    { 200 };
+
+    /**
+     * \brief   LogSqliteDatabase::WRITER_THREAD_NAME
+     *          The name of the thread to write log messages in the database.
+     **/
+    static constexpr std::string_view   WRITER_THREAD_NAME  { "_AREG_LOG_DB_WRITER_" };
+
+    /**
+     * \brief   LogSqliteDatabase::sPartition
+     *          The entry of the manifest of log partitions.
+     **/
+    struct sPartition
+    {
+        //!< The ID of the partition.
+        uint32_t                ptId        { 0u };
+        //!< The name of the partition database file, located in the directory of the main database.
+        String                  ptFile      { };
+        //!< The number of log messages in the partition.
+        uint32_t                ptCount     { 0u };
+        //!< The creation timestamp of the oldest log message in the partition.
+        TIME64                  ptBegin     { 0u };
+        //!< The creation timestamp of the newest log message in the partition.
+        TIME64                  ptEnd       { 0u };
+        //!< The cookies of the log sources of the messages in the partition.
+        TEArrayList<ITEM_ID>    ptSources   { };
+    };
+
+private:
+    /**
+     * \brief   LogSqliteDatabase::sLogEntry
+     *          The log message queued to write in the database.
+     **/
+    struct sLogEntry
+    {
+        //!< The log message.
+        NETrace::sLogMessage    leMessage;
+        //!< The timestamp when the message is received.
+        TIME64                  leReceived;
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -56,6 +133,66 @@ public:
      **/
     inline void setDatabaseLoggingEnabled(bool enable);
 
+    /**
+     * \brief   Sets the limits of a single partition of log messages. The writer starts
+     *          a new partition when either limit is reached. If both limits are 0,
+     *          the log messages are written in the main database without partitions.
+     *          The limits should be set before connecting the database.
+     * \param   minutes     The maximum time in minutes to write in a single partition.
+     *                      The value 0 means no time limit.
+     * \param   megabytes   The maximum size in megabytes of a single partition.
+     *                      The value 0 means no size limit.
+     **/
+    inline void setPartitioning(uint32_t minutes, uint32_t megabytes);
+
+    /**
+     * \brief   Sets the retention time of the partitions. When starting a new partition,
+     *          the partitions with messages older than the retention time are dropped.
+     * \param   minutes     The time in minutes to keep the partitions. The value 0 means
+     *                      to keep all partitions.
+     **/
+    inline void setRetention(uint32_t minutes);
+
+    /**
+     * \brief   Returns true if log messages are written in the partitions.
+     **/
+    inline bool isPartitioned(void) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Returns the list of partitions, which contain log messages created in
+     *          the specified time range. The partitions are checked in the manifest.
+     * \param   timeBegin       The begin of the time range.
+     * \param   timeEnd         The end of the time range.
+     * \param   out_partitions  On output, contains the matching partitions.
+     * \return  Returns the number of matching partitions.
+     **/
+    uint32_t queryPartitions(const DateTime & timeBegin, const DateTime & timeEnd, TEArrayList<sPartition> & OUT out_partitions);
+
+    /**
+     * \brief   Queries the log messages created in the specified time range. The partitions
+     *          out of the time range or without messages of the specified source are not opened.
+     *          The messages are sorted by the creation time within each partition, and the
+     *          partitions are queried in the order of creation.
+     * \param   timeBegin       The begin of the time range.
+     * \param   timeEnd         The end of the time range.
+     * \param   out_messages    On output, contains the log messages.
+     * \param   cookie          The cookie of the log source. NEService::COOKIE_ANY matches any source.
+     * \param   scopeId         The ID of the scope. The value 0 matches any scope.
+     * \param   maxMessages     The maximum number of messages to query. The value 0 means no limit.
+     * \return  Returns the number of queried log messages.
+     **/
+    uint32_t queryLogs( const DateTime & timeBegin
+                      , const DateTime & timeEnd
+                      , TEArrayList<NETrace::sLogMessage> & OUT out_messages
+                      , const ITEM_ID & cookie  = NEService::COOKIE_ANY
+                      , uint32_t scopeId        = 0u
+                      , uint32_t maxMessages    = 0u);
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -101,7 +238,8 @@ public:
     virtual bool begin(void) override;
 
     /**
-     * \brief   Commits or rolls back the SqliteDatabase changes and returns true if succeeded.
+     * \brief   Writes the queued log messages, then commits or rolls back the changes of
+     *          the transaction started by begin(). Returns true if succeeded.
      * \param   doCommit    If true, the SqliteDatabase engine should commit the changes.
      *                      Otherwise, the SqliteDatabase engine should rollback the changes.
      * \return  Returns true if operation succeeded. Otherwise, returns false.
@@ -120,9 +258,10 @@ public:
 
     /**
      * \brief   Called when logging message should be saved in the database.
+     *          The message is queued and written by the writer thread.
      * \param   message     The structure of the message to log.
      * \param   timestamp   The timestamp to register when the message is logged.
-     * \return  Returns true if succeeded to save the log in the database.
+     * \return  Returns true if succeeded to queue the log message.
      **/
     virtual bool logMessage(const NETrace::sLogMessage & message, const DateTime & timestamp) override;
 
@@ -189,6 +328,16 @@ public:
      **/
     virtual bool logScopeDeactivate(const ITEM_ID & cookie, unsigned int scopeId, const DateTime & timestamp) override;
 
+/************************************************************************/
+// IEThreadConsumer interface overrides.
+/************************************************************************/
+private:
+
+    /**
+     * \brief   Runs the loop of the writer thread.
+     **/
+    virtual void onThreadRuns(void) override;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -225,6 +374,98 @@ private:
      **/
     inline bool _execute(const char * sql);
 
+    /**
+     * \brief   Prepares the statement to insert scopes. The tables should exist.
+     *          The statement to insert logs is prepared when opening a partition.
+     *          Returns true if succeeded.
+     **/
+    inline bool _prepareStatements(void);
+
+    /**
+     * \brief   Inserts an entry in the logs table by the prepared statement.
+     **/
+    inline bool _insertLog( const ITEM_ID & cookie, uint32_t scopeId, uint32_t msgType, uint32_t msgPrio
+                          , const ITEM_ID & moduleId, const ITEM_ID & threadId
+                          , const char * message, uint32_t msgLen
+                          , const char * thread, uint32_t threadLen
+                          , const char * module, uint32_t moduleLen
+                          , const TIME64 & created, const TIME64 & received);
+
+    /**
+     * \brief   Inserts an entry in the scopes table by the prepared statement.
+     **/
+    inline bool _insertScope(const char * scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID & cookie, const TIME64 & received);
+
+    /**
+     * \brief   Inserts the log generated by the observer. The log is not queued.
+     **/
+    inline bool _insertObserverLog(const char * message, const DateTime & timestamp);
+
+    /**
+     * \brief   Writes queued log messages in the database. If there is no active transaction,
+     *          the messages are written in a single transaction. The database lock should be acquired.
+     **/
+    void _writeQueued(void);
+
+    /**
+     * \brief   Returns the path of the partition database file with the specified name.
+     **/
+    inline String _partitionPath(const String & fileName) const;
+
+    /**
+     * \brief   Creates the manifest tables and loads the existing entries of the manifest.
+     **/
+    inline void _loadManifest(void);
+
+    /**
+     * \brief   Creates and attaches a new partition, and prepares the statement to insert logs.
+     *          If the partitioning is disabled, the main database is the partition.
+     **/
+    bool _openPartition(const TIME64 & now);
+
+    /**
+     * \brief   Detaches the current partition and finalizes the statement to insert logs.
+     **/
+    void _closePartition(void);
+
+    /**
+     * \brief   Returns true if the current partition reached the time or the size limit.
+     **/
+    bool _isPartitionFull(const TIME64 & now);
+
+    /**
+     * \brief   Updates the time span, the number of messages and the sources of the current
+     *          partition by the inserted log message. The manifest is updated by _updatePartition().
+     **/
+    inline void _trackLog(const ITEM_ID & cookie, const TIME64 & created);
+
+    /**
+     * \brief   Writes the changes of the current partition in the manifest.
+     **/
+    void _updatePartition(void);
+
+    /**
+     * \brief   Drops the partitions with messages older than the retention time.
+     **/
+    void _dropPartitions(const TIME64 & now);
+
+    /**
+     * \brief   Queries the log messages of the specified partition database file.
+     **/
+    uint32_t _queryPartition( const String & filePath, const TIME64 & timeBegin, const TIME64 & timeEnd
+                            , const ITEM_ID & cookie, uint32_t scopeId, uint32_t maxMessages
+                            , TEArrayList<NETrace::sLogMessage> & OUT out_messages) const;
+
+    /**
+     * \brief   Starts the writer thread of log messages.
+     **/
+    inline void _startWriter(void);
+
+    /**
+     * \brief   Stops the writer thread of log messages and writes the remaining queued messages.
+     **/
+    inline void _stopWriter(void);
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -241,10 +482,62 @@ protected:
     //!< Flag, indicating whether the database logging is enabled or not.
     bool        mDbLogEnabled;
 
+    //!< The prepared statement to insert an entry in the logs table.
+    sqlite3_stmt *  mStmtLog;
+
+    //!< The prepared statement to insert an entry in the scopes table.
+    sqlite3_stmt *  mStmtScope;
+
+    //!< The maximum time in minutes to write in a single partition. 0 means no limit.
+    uint32_t        mPartTime;
+
+    //!< The maximum size in megabytes of a single partition. 0 means no limit.
+    uint32_t        mPartSize;
+
+    //!< The time in minutes to keep the partitions. 0 means to keep all partitions.
+    uint32_t        mRetention;
+
+    //!< The timestamp when the current partition is opened.
+    TIME64          mPartOpened;
+
+    //!< The manifest of partitions, where the last entry is the current partition.
+    TEArrayList<sPartition> mPartitions;
+
+    //!< Flag, indicating whether the current partition has changes to write in the manifest.
+    bool            mPartChanged;
+
+private:
+    //!< The thread to write queued log messages.
+    Thread          mWriterThread;
+
+    //!< The lock of the database operations.
+    ResourceLock    mDbLock;
+
+    //!< The lock of the queue of log messages.
+    ResourceLock    mQueueLock;
+
+    //!< The event, signaled when the queued log messages should be written.
+    SynchEvent      mQueueEvent;
+
+    //!< Flag, indicating whether the writer thread should exit.
+    std::atomic_bool    mWriterQuit;
+
+    //!< Flag, indicating whether the writer thread runs and the log messages are queued.
+    std::atomic_bool    mWriterRuns;
+
+    //!< The queue of log messages to write.
+    TEArrayList<sLogEntry>  mQueue;
+
+    //!< The list of log messages, which are written by the writer thread.
+    TEArrayList<sLogEntry>  mWriting;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
 private:
+    //!< Wrapper of 'this' pointer.
+    inline LogSqliteDatabase & self(void);
+
     DECLARE_NOCOPY_NOMOVE(LogSqliteDatabase);
 };
 
@@ -262,4 +555,25 @@ inline void LogSqliteDatabase::setDatabaseLoggingEnabled(bool enable)
     mDbLogEnabled = enable;
 }
 
+inline void LogSqliteDatabase::setPartitioning(uint32_t minutes, uint32_t megabytes)
+{
+    mPartTime = minutes;
+    mPartSize = megabytes;
+}
+
+inline void LogSqliteDatabase::setRetention(uint32_t minutes)
+{
+    mRetention = minutes;
+}
+
+inline bool LogSqliteDatabase::isPartitioned(void) const
+{
+    return ((mPartTime != 0u) || (mPartSize != 0u));
+}
+
+inline LogSqliteDatabase & LogSqliteDatabase::self(void)
+{
+    return (*this);
+}
+
 #endif  // AREG_UTILITIES_DB_LOGSQLITEDATABASE_HPP
@@ -125,11 +125,11 @@ namespace
             ");"
     };
 
-    //! A string format to generate INSERT statement to insert an information about scope.
+    //! A statement to prepare, which inserts an information about scope.
     //! It is called when registering or updating scope list of the connected application.
-    constexpr std::string_view _fmtScopes
+    constexpr std::string_view _sqlInsertScope
     {
-        "INSERT INTO scopes (scope_id, cookie_id, scope_is_active, scope_prio, scope_name, time_received)  VALUES (%u, %llu, 1, %u, \'%s\', %llu);"
+        "INSERT INTO scopes (scope_id, cookie_id, scope_is_active, scope_prio, scope_name, time_received)  VALUES (?, ?, 1, ?, ?, ?);"
     };
 
     //! A string format to generate UPDATE statement to update the scope state of a connected instance.
@@ -152,11 +152,12 @@ namespace
         "UPDATE scopes SET time_inactivated = %llu, scope_is_active = 0 WHERE scope_is_active = 1;"
     };
 
-    //! Create a table with logs that contain information of application cookie ID,
-    //! scope ID, log priority, log message, and information like thread.
-    constexpr std::string_view  _sqlCreateTbLogs
+    //! A string format to generate CREATE statement of the table with logs in the specified schema.
+    //! The table contains information of application cookie ID, scope ID, log priority, log message,
+    //! and information like thread. The main database or each partition has own logs table.
+    constexpr std::string_view  _fmtCreateTbLogs
     {
-        "CREATE TABLE \"logs\" ("
+        "CREATE TABLE IF NOT EXISTS %s.\"logs\" ("
             "\"id\"	                INTEGER NOT NULL UNIQUE,"
             "\"cookie_id\"	        INTEGER,"
             "\"scope_id\"	        INTEGER,"
@@ -173,13 +174,162 @@ namespace
             ");"
     };
 
-    //! A string format to create INSERT statement to insert new log message in the logs table.
-    constexpr std::string_view _fmtLog
+    //! A string format to generate the statement to prepare, which inserts new log message
+    //! in the logs table of the specified schema.
+    constexpr std::string_view _fmtInsertLog
     {
-        "INSERT INTO logs "
+        "INSERT INTO %s.logs "
         "(cookie_id, scope_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received)"
         "VALUES "
-        "(%llu, %u, %u, %u, %llu, %llu, \'%s\', \'%s\', \'%s\', %llu, %llu);"
+        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
+    };
+
+    //! A script to switch the database in the write-ahead logging mode.
+    //! The writers do not block the readers and the transaction is not synchronized on every commit.
+    constexpr std::string_view  _sqlJournalWal
+    {
+        "PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL;"
+    };
+
+    //! A script to switch the attached partition in the write-ahead logging mode.
+    constexpr std::string_view  _sqlPartJournalWal
+    {
+        "PRAGMA part.journal_mode = WAL; PRAGMA part.synchronous = NORMAL;"
+    };
+
+    //! The name of the schema of the attached partition.
+    constexpr std::string_view  _schemaPart
+    {
+        "part"
+    };
+
+    //! The name of the schema of the main database.
+    constexpr std::string_view  _schemaMain
+    {
+        "main"
+    };
+
+    //! A statement to prepare, which attaches the partition database file.
+    constexpr std::string_view  _sqlAttachPart
+    {
+        "ATTACH DATABASE ? AS part;"
+    };
+
+    //! A script to detach the partition database file.
+    constexpr std::string_view  _sqlDetachPart
+    {
+        "DETACH DATABASE part;"
+    };
+
+    //! A script to get the number of pages of the attached partition.
+    constexpr std::string_view  _sqlPartPageCount
+    {
+        "PRAGMA part.page_count;"
+    };
+
+    //! A script to get the size of a page of the attached partition.
+    constexpr std::string_view  _sqlPartPageSize
+    {
+        "PRAGMA part.page_size;"
+    };
+
+    //! Create a table with the manifest of partitions. Each entry contains the name of
+    //! the partition file, the number of log messages and the time span of log messages.
+    constexpr std::string_view  _sqlCreateTbPartitions
+    {
+        "CREATE TABLE IF NOT EXISTS \"partitions\" ("
+            "\"part_id\"	        INTEGER NOT NULL UNIQUE,"
+            "\"part_file\"	        TEXT,"
+            "\"msg_count\"	        INTEGER,"
+            "\"time_begin\"	    NUMERIC,"
+            "\"time_end\"	        NUMERIC,"
+            "\"time_opened\"	    NUMERIC"
+            ");"
+    };
+
+    //! Create a table with the cookies of log sources of the messages in the partitions.
+    constexpr std::string_view  _sqlCreateTbPartSources
+    {
+        "CREATE TABLE IF NOT EXISTS \"partition_sources\" ("
+            "\"part_id\"	        INTEGER NOT NULL,"
+            "\"cookie_id\"	        INTEGER NOT NULL,"
+            "CONSTRAINT \"u_part_source\" UNIQUE(\"part_id\", \"cookie_id\")"
+            ");"
+    };
+
+    //! A string format to generate INSERT statement to insert a new entry in the manifest of partitions.
+    constexpr std::string_view  _fmtInsertPartition
+    {
+        "INSERT INTO partitions (part_id, part_file, msg_count, time_begin, time_end, time_opened) VALUES (%u, \'%s\', 0, 0, 0, %llu);"
+    };
+
+    //! A string format to generate UPDATE statement to update the number of messages and the time span of a partition.
+    constexpr std::string_view  _fmtUpdPartition
+    {
+        "UPDATE partitions SET msg_count = %u, time_begin = %llu, time_end = %llu WHERE part_id = %u;"
+    };
+
+    //! A string format to generate INSERT statement to insert a log source of a partition.
+    constexpr std::string_view  _fmtInsertPartSource
+    {
+        "INSERT OR IGNORE INTO partition_sources (part_id, cookie_id) VALUES (%u, %llu);"
+    };
+
+    //! A string format to generate DELETE statement to remove the dropped partition from the manifest.
+    constexpr std::string_view  _fmtDropPartition
+    {
+        "DELETE FROM partition_sources WHERE part_id = %u; DELETE FROM partitions WHERE part_id = %u;"
+    };
+
+    //! A script to select the entries of the manifest of partitions.
+    constexpr std::string_view  _sqlSelectPartitions
+    {
+        "SELECT part_id, part_file, msg_count, time_begin, time_end FROM partitions ORDER BY part_id;"
+    };
+
+    //! A script to select the log sources of the partitions.
+    constexpr std::string_view  _sqlSelectPartSources
+    {
+        "SELECT part_id, cookie_id FROM partition_sources;"
+    };
+
+    //! A script to select log messages in the time range. The conditions of the
+    //! source and the scope are appended, if needed.
+    constexpr std::string_view  _sqlSelectLogs
+    {
+        "SELECT cookie_id, scope_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created "
+        "FROM logs WHERE time_created >= ?1 AND time_created <= ?2"
+    };
+
+    //! The condition of the log source to append to the script to select log messages.
+    constexpr std::string_view  _sqlWhereCookie
+    {
+        " AND cookie_id = ?3"
+    };
+
+    //! The condition of the scope to append to the script to select log messages.
+    constexpr std::string_view  _sqlWhereScope
+    {
+        " AND scope_id = ?4"
+    };
+
+    //! The order of the selected log messages.
+    constexpr std::string_view  _sqlOrderLogs
+    {
+        " ORDER BY time_created LIMIT ?5;"
+    };
+
+    //! The suffix of the partition file name, followed by the ID of the partition.
+    constexpr std::string_view  _fmtPartFile
+    {
+        "%s_part%04u%s"
+    };
+
+    //! The suffixes of the auxiliary files of the database in the write-ahead logging mode.
+    constexpr std::string_view  _walSuffixes[]
+    {
+          "-wal"
+        , "-shm"
     };
 
     //! A script to create index of the instances table. 
@@ -194,10 +344,12 @@ namespace
         "CREATE UNIQUE INDEX \"idx_scope_id\" ON \"scopes\" (\"scope_id\", \"cookie_id\", \"time_received\", \"time_inactivated\");"
     };
 
-    //! A script to create index of the logs table
-    constexpr std::string_view  _sqlCreateIdxLogs
+    //! A string format to generate the script to create indexes of the logs table in the specified schema.
+    //! The index of the creation time is used by the queries of the time range.
+    constexpr std::string_view  _fmtCreateIdxLogs
     {
-        "CREATE INDEX \"idx_logs\" ON \"logs\" (\"cookie_id\", \"scope_id\", \"msg_thread_id\"); "
+        "CREATE INDEX IF NOT EXISTS %s.\"idx_logs\" ON \"logs\" (\"cookie_id\", \"scope_id\", \"msg_thread_id\"); "
+        "CREATE INDEX IF NOT EXISTS %s.\"idx_logs_time\" ON \"logs\" (\"time_created\");"
     };
 
     //! The size of the string buffer to generate a message.
@@ -206,8 +358,34 @@ namespace
     //! The size of the string buffer to format SQL scripts
     constexpr uint32_t  SQL_LEN     { 768 };
 
-    //! The size of the string buffer to format SQL script to insert a log.
-    constexpr uint32_t  SQL_LEN_MAX { 1024 };
+    //! The number of microseconds in a minute.
+    constexpr TIME64    MICROSEC_PER_MIN    { 60'000'000 };
+
+    //! The number of bytes in a megabyte.
+    constexpr uint64_t  BYTES_PER_MB        { 1024 * 1024 };
+
+    //! Executes the script, which results a single integer value, like PRAGMA page_count.
+    inline sqlite3_int64 _queryInteger(sqlite3 * dbObject, const std::string_view & sql)
+    {
+        sqlite3_int64 result{ 0 };
+        sqlite3_stmt* stmt{ nullptr };
+        if (SQLITE_OK == sqlite3_prepare_v2(dbObject, sql.data(), static_cast<int>(sql.length()), &stmt, nullptr))
+        {
+            result = SQLITE_ROW == sqlite3_step(stmt) ? sqlite3_column_int64(stmt, 0) : 0;
+        }
+
+        sqlite3_finalize(stmt);
+        return result;
+    }
+
+    //! Copies the text of the column of selected row to the buffer and returns the length of the copied text.
+    inline unsigned int _copyText(sqlite3_stmt * stmt, int column, char * buffer, uint32_t space)
+    {
+        const char* text{ reinterpret_cast<const char *>(sqlite3_column_text(stmt, column)) };
+        uint32_t len{ text != nullptr ? NEMemory::memCopy(buffer, space - 1, text, static_cast<uint32_t>(sqlite3_column_bytes(stmt, column))) : 0u };
+        buffer[len] = String::EmptyChar;
+        return len;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -221,11 +399,28 @@ LogSqliteDatabase::LogSqliteDatabase(void)
     , mDbObject             ( nullptr )
     , mIsInitialized        ( false )
     , mDbLogEnabled         ( true )
+    , mStmtLog              ( nullptr )
+    , mStmtScope            ( nullptr )
+    , mPartTime             ( 0u )
+    , mPartSize             ( 0u )
+    , mRetention            ( 0u )
+    , mPartOpened           ( 0u )
+    , mPartitions           ( )
+    , mPartChanged          ( false )
+    , mWriterThread         ( static_cast<IEThreadConsumer &>(self()), WRITER_THREAD_NAME )
+    , mDbLock               ( false )
+    , mQueueLock            ( false )
+    , mQueueEvent           ( true, true )
+    , mWriterQuit           ( false )
+    , mWriterRuns           ( false )
+    , mQueue                ( )
+    , mWriting              ( )
 {
 }
 
 LogSqliteDatabase::~LogSqliteDatabase(void)
 {
+    _stopWriter();
     _close();
 }
 
@@ -243,7 +438,11 @@ inline bool LogSqliteDatabase::_open(const String& dbPath)
         File::createDirCascaded(folder);
     }
 
-    if (SQLITE_OK != sqlite3_open(mDbPath.getString(), &mDbObject))
+    if (SQLITE_OK == sqlite3_open(mDbPath.getString(), &mDbObject))
+    {
+        _execute(_sqlJournalWal.data());
+    }
+    else
     {
         _close();
         result = false;
@@ -256,10 +455,17 @@ inline void LogSqliteDatabase::_close(void)
 {
     if (mDbObject != nullptr)
     {
+        sqlite3_finalize(mStmtLog);
+        sqlite3_finalize(mStmtScope);
+        mStmtLog    = nullptr;
+        mStmtScope  = nullptr;
         sqlite3_close(mDbObject);
         mDbObject = nullptr;
         mIsInitialized = false;
     }
+
+    mPartitions.clear();
+    mPartChanged = false;
 }
 
 inline void LogSqliteDatabase::_createTables(void)
@@ -269,24 +475,19 @@ inline void LogSqliteDatabase::_createTables(void)
     VERIFY(_execute(_sqlCreateTbVersion.data()));
     VERIFY(_execute(_sqlCreateTbInstances.data()));
     VERIFY(_execute(_sqlCreateTbScopes.data()));
-    VERIFY(_execute(_sqlCreateTbLogs.data()));
+    VERIFY(_execute(_sqlCreateTbPartitions.data()));
+    VERIFY(_execute(_sqlCreateTbPartSources.data()));
 }
 
 inline void LogSqliteDatabase::_createIndexes(void)
 {
     VERIFY(_execute(_sqlCraeteIdxCookie.data()));
     VERIFY(_execute(_sqlCreateIdxScopes.data()));
-    VERIFY(_execute(_sqlCreateIdxLogs.data()));
 }
 
 inline void LogSqliteDatabase::_initialize(void)
 {
-    Process& proc{ Process::getInstance() };
     DateTime now{ DateTime::getNow() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
-
     char sql[SQL_LEN]{};
     String::formatString( sql, SQL_LEN, _fmtVersion.data()
                         , Process::getInstance().getName().getString()
@@ -297,21 +498,7 @@ inline void LogSqliteDatabase::_initialize(void)
                         , static_cast<uint64_t>(now.getTime())
                         );
     VERIFY(_execute(sql));
-
-    String::formatString(sql, SQL_LEN, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , "Starting database logging..."
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint64_t>(now.getTime())
-                        );
-    VERIFY(_execute(sql));
+    VERIFY(_insertObserverLog("Starting database logging...", now));
 }
 
 inline bool LogSqliteDatabase::_execute(const char* sql)
@@ -325,6 +512,477 @@ inline bool LogSqliteDatabase::_execute(const char* sql)
     return false;
 }
 
+inline bool LogSqliteDatabase::_prepareStatements(void)
+{
+    ASSERT(mDbObject != nullptr);
+    return (SQLITE_OK == sqlite3_prepare_v2(mDbObject, _sqlInsertScope.data(), static_cast<int>(_sqlInsertScope.length()), &mStmtScope, nullptr));
+}
+
+inline void LogSqliteDatabase::_trackLog(const ITEM_ID & cookie, const TIME64 & created)
+{
+    if (mPartitions.isEmpty())
+        return;
+
+    sPartition& part{ mPartitions.lastEntry() };
+    part.ptBegin = (part.ptCount == 0u) || (created < part.ptBegin) ? created : part.ptBegin;
+    part.ptEnd   = (part.ptCount == 0u) || (created > part.ptEnd)   ? created : part.ptEnd;
+    ++ part.ptCount;
+    mPartChanged = true;
+
+    if (part.ptSources.contains(cookie) == false)
+    {
+        part.ptSources.add(cookie);
+
+        char sql[SQL_LEN];
+        String::formatString( sql, SQL_LEN, _fmtInsertPartSource.data()
+                            , part.ptId
+                            , static_cast<uint64_t>(cookie));
+        _execute(sql);
+    }
+}
+
+inline bool LogSqliteDatabase::_insertLog( const ITEM_ID & cookie, uint32_t scopeId, uint32_t msgType, uint32_t msgPrio
+                                         , const ITEM_ID & moduleId, const ITEM_ID & threadId
+                                         , const char * message, uint32_t msgLen
+                                         , const char * thread, uint32_t threadLen
+                                         , const char * module, uint32_t moduleLen
+                                         , const TIME64 & created, const TIME64 & received)
+{
+    if (mStmtLog == nullptr)
+        return false;
+
+    sqlite3_bind_int64(mStmtLog,  1, static_cast<sqlite3_int64>(cookie));
+    sqlite3_bind_int64(mStmtLog,  2, static_cast<sqlite3_int64>(scopeId));
+    sqlite3_bind_int(  mStmtLog,  3, static_cast<int>(msgType));
+    sqlite3_bind_int(  mStmtLog,  4, static_cast<int>(msgPrio));
+    sqlite3_bind_int64(mStmtLog,  5, static_cast<sqlite3_int64>(moduleId));
+    sqlite3_bind_int64(mStmtLog,  6, static_cast<sqlite3_int64>(threadId));
+    sqlite3_bind_text( mStmtLog,  7, message, static_cast<int>(msgLen), SQLITE_STATIC);
+    sqlite3_bind_text( mStmtLog,  8, thread, static_cast<int>(threadLen), SQLITE_STATIC);
+    sqlite3_bind_text( mStmtLog,  9, module, static_cast<int>(moduleLen), SQLITE_STATIC);
+    sqlite3_bind_int64(mStmtLog, 10, static_cast<sqlite3_int64>(created));
+    sqlite3_bind_int64(mStmtLog, 11, static_cast<sqlite3_int64>(received));
+
+    bool result{ SQLITE_DONE == sqlite3_step(mStmtLog) };
+    sqlite3_reset(mStmtLog);
+    if (result)
+    {
+        _trackLog(cookie, created);
+    }
+
+    return result;
+}
+
+inline bool LogSqliteDatabase::_insertScope(const char * scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID & cookie, const TIME64 & received)
+{
+    if (mStmtScope == nullptr)
+        return false;
+
+    sqlite3_bind_int64(mStmtScope, 1, static_cast<sqlite3_int64>(scopeId));
+    sqlite3_bind_int64(mStmtScope, 2, static_cast<sqlite3_int64>(cookie));
+    sqlite3_bind_int64(mStmtScope, 3, static_cast<sqlite3_int64>(scopePrio));
+    sqlite3_bind_text( mStmtScope, 4, scopeName, -1, SQLITE_STATIC);
+    sqlite3_bind_int64(mStmtScope, 5, static_cast<sqlite3_int64>(received));
+
+    bool result{ SQLITE_DONE == sqlite3_step(mStmtScope) };
+    sqlite3_reset(mStmtScope);
+    return result;
+}
+
+inline bool LogSqliteDatabase::_insertObserverLog(const char * message, const DateTime & timestamp)
+{
+    Process& proc{ Process::getInstance() };
+    const String& module{ proc.getAppName() };
+    id_type threadId{ Thread::getCurrentThreadId() };
+    const String& thread{ Thread::getThreadName(threadId) };
+
+    return _insertLog( NEService::COOKIE_LOCAL
+                     , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
+                     , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
+                     , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
+                     , static_cast<ITEM_ID>(proc.getId())
+                     , static_cast<ITEM_ID>(threadId)
+                     , message, static_cast<uint32_t>(NEString::getStringLength<char>(message))
+                     , thread.getString(), static_cast<uint32_t>(thread.getLength())
+                     , module.getString(), static_cast<uint32_t>(module.getLength())
+                     , static_cast<TIME64>(timestamp.getTime())
+                     , static_cast<TIME64>(timestamp.getTime()));
+}
+
+inline String LogSqliteDatabase::_partitionPath(const String & fileName) const
+{
+    String folder{ File::getFileDirectory(mDbPath) };
+    return (folder.isEmpty() ? fileName : folder + File::PATH_SEPARATOR + fileName);
+}
+
+inline void LogSqliteDatabase::_loadManifest(void)
+{
+    ASSERT(mDbObject != nullptr);
+    mPartitions.clear();
+
+    sqlite3_stmt* stmt{ nullptr };
+    if (SQLITE_OK == sqlite3_prepare_v2(mDbObject, _sqlSelectPartitions.data(), static_cast<int>(_sqlSelectPartitions.length()), &stmt, nullptr))
+    {
+        while (SQLITE_ROW == sqlite3_step(stmt))
+        {
+            sPartition part;
+            part.ptId   = static_cast<uint32_t>(sqlite3_column_int64(stmt, 0));
+            part.ptFile = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
+            part.ptCount= static_cast<uint32_t>(sqlite3_column_int64(stmt, 2));
+            part.ptBegin= static_cast<TIME64>(sqlite3_column_int64(stmt, 3));
+            part.ptEnd  = static_cast<TIME64>(sqlite3_column_int64(stmt, 4));
+            mPartitions.add(part);
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    stmt = nullptr;
+    if (SQLITE_OK == sqlite3_prepare_v2(mDbObject, _sqlSelectPartSources.data(), static_cast<int>(_sqlSelectPartSources.length()), &stmt, nullptr))
+    {
+        while (SQLITE_ROW == sqlite3_step(stmt))
+        {
+            uint32_t partId{ static_cast<uint32_t>(sqlite3_column_int64(stmt, 0)) };
+            ITEM_ID cookie{ static_cast<ITEM_ID>(sqlite3_column_int64(stmt, 1)) };
+            for (uint32_t i = 0; i < mPartitions.getSize(); ++i)
+            {
+                if (mPartitions[i].ptId == partId)
+                {
+                    mPartitions[i].ptSources.add(cookie);
+                    break;
+                }
+            }
+        }
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+bool LogSqliteDatabase::_openPartition(const TIME64 & now)
+{
+    ASSERT(mDbObject != nullptr);
+    ASSERT(mStmtLog == nullptr);
+
+    bool result{ false };
+    const char* schema{ _schemaMain.data() };
+    if (isPartitioned())
+    {
+        schema = _schemaPart.data();
+        uint32_t partId{ mPartitions.isEmpty() ? 1u : mPartitions.lastEntry().ptId + 1u };
+        char fileName[File::MAXIMUM_PATH + 1];
+        String::formatString( fileName, File::MAXIMUM_PATH, _fmtPartFile.data()
+                            , File::getFileName(mDbPath).getString()
+                            , partId
+                            , File::getFileExtension(mDbPath).getString());
+
+        String filePath{ _partitionPath(fileName) };
+        sqlite3_stmt* stmt{ nullptr };
+        if (SQLITE_OK == sqlite3_prepare_v2(mDbObject, _sqlAttachPart.data(), static_cast<int>(_sqlAttachPart.length()), &stmt, nullptr))
+        {
+            sqlite3_bind_text(stmt, 1, filePath.getString(), static_cast<int>(filePath.getLength()), SQLITE_STATIC);
+            result = (SQLITE_DONE == sqlite3_step(stmt));
+        }
+
+        sqlite3_finalize(stmt);
+        if (result)
+        {
+            _execute(_sqlPartJournalWal.data());
+
+            char sql[SQL_LEN];
+            String::formatString( sql, SQL_LEN, _fmtInsertPartition.data()
+                                , partId
+                                , fileName
+                                , static_cast<uint64_t>(now));
+            _execute(sql);
+
+            sPartition part;
+            part.ptId   = partId;
+            part.ptFile = fileName;
+            mPartitions.add(part);
+        }
+    }
+    else
+    {
+        // the main database is the only partition with ID 0.
+        int index{ -1 };
+        for (uint32_t i = 0; (index < 0) && (i < mPartitions.getSize()); ++i)
+        {
+            index = mPartitions[i].ptId == 0u ? static_cast<int>(i) : -1;
+        }
+
+        if (index < 0)
+        {
+            sPartition part;
+            part.ptFile = File::getFileNameWithExtension(mDbPath);
+
+            char sql[SQL_LEN];
+            String::formatString( sql, SQL_LEN, _fmtInsertPartition.data()
+                                , part.ptId
+                                , part.ptFile.getString()
+                                , static_cast<uint64_t>(now));
+            _execute(sql);
+            mPartitions.add(part);
+        }
+        else if (index != static_cast<int>(mPartitions.getSize() - 1))
+        {
+            sPartition part{ mPartitions[static_cast<uint32_t>(index)] };
+            mPartitions.removeAt(static_cast<uint32_t>(index));
+            mPartitions.add(part);
+        }
+
+        result = true;
+    }
+
+    if (result)
+    {
+        char sql[SQL_LEN];
+        String::formatString(sql, SQL_LEN, _fmtCreateTbLogs.data(), schema);
+        VERIFY(_execute(sql));
+        String::formatString(sql, SQL_LEN, _fmtCreateIdxLogs.data(), schema, schema);
+        VERIFY(_execute(sql));
+        String::formatString(sql, SQL_LEN, _fmtInsertLog.data(), schema);
+        result = (SQLITE_OK == sqlite3_prepare_v2(mDbObject, sql, -1, &mStmtLog, nullptr));
+        mPartOpened = now;
+    }
+
+    return result;
+}
+
+void LogSqliteDatabase::_closePartition(void)
+{
+    _updatePartition();
+
+    sqlite3_finalize(mStmtLog);
+    mStmtLog = nullptr;
+    if (isPartitioned() && (mDbObject != nullptr))
+    {
+        _execute(_sqlDetachPart.data());
+    }
+}
+
+bool LogSqliteDatabase::_isPartitionFull(const TIME64 & now)
+{
+    bool result{ false };
+    if ((mPartTime != 0u) && (now >= mPartOpened + static_cast<TIME64>(mPartTime) * MICROSEC_PER_MIN))
+    {
+        result = true;
+    }
+    else if (mPartSize != 0u)
+    {
+        uint64_t pages   { static_cast<uint64_t>(_queryInteger(mDbObject, _sqlPartPageCount)) };
+        uint64_t pageSize{ static_cast<uint64_t>(_queryInteger(mDbObject, _sqlPartPageSize)) };
+        result = (pages * pageSize) >= (static_cast<uint64_t>(mPartSize) * BYTES_PER_MB);
+    }
+
+    return result;
+}
+
+void LogSqliteDatabase::_updatePartition(void)
+{
+    if (mPartChanged && (mPartitions.isEmpty() == false))
+    {
+        const sPartition& part{ mPartitions.lastEntry() };
+        char sql[SQL_LEN];
+        String::formatString( sql, SQL_LEN, _fmtUpdPartition.data()
+                            , part.ptCount
+                            , static_cast<uint64_t>(part.ptBegin)
+                            , static_cast<uint64_t>(part.ptEnd)
+                            , part.ptId);
+        _execute(sql);
+        mPartChanged = false;
+    }
+}
+
+void LogSqliteDatabase::_dropPartitions(const TIME64 & now)
+{
+    if ((mRetention == 0u) || (now < static_cast<TIME64>(mRetention) * MICROSEC_PER_MIN))
+        return;
+
+    const TIME64 oldest{ now - static_cast<TIME64>(mRetention) * MICROSEC_PER_MIN };
+    char sql[SQL_LEN];
+
+    // the current partition is the last entry and it is never dropped, as well as the main database.
+    for (uint32_t i = 0; (i + 1) < mPartitions.getSize(); )
+    {
+        const sPartition& part{ mPartitions[i] };
+        if ((part.ptId != 0u) && (part.ptEnd < oldest))
+        {
+            String::formatString(sql, SQL_LEN, _fmtDropPartition.data(), part.ptId, part.ptId);
+            _execute(sql);
+
+            String filePath{ _partitionPath(part.ptFile) };
+            File::deleteFile(filePath);
+            for (const auto& suffix : _walSuffixes)
+            {
+                String auxPath{ filePath + suffix };
+                if (File::existFile(auxPath))
+                {
+                    File::deleteFile(auxPath);
+                }
+            }
+
+            mPartitions.removeAt(i);
+        }
+        else
+        {
+            ++ i;
+        }
+    }
+}
+
+uint32_t LogSqliteDatabase::_queryPartition( const String & filePath, const TIME64 & timeBegin, const TIME64 & timeEnd
+                                           , const ITEM_ID & cookie, uint32_t scopeId, uint32_t maxMessages
+                                           , TEArrayList<NETrace::sLogMessage> & OUT out_messages) const
+{
+    uint32_t result{ 0u };
+    sqlite3* dbObject{ nullptr };
+    if (SQLITE_OK != sqlite3_open_v2(filePath.getString(), &dbObject, SQLITE_OPEN_READONLY, nullptr))
+    {
+        sqlite3_close(dbObject);
+        return result;
+    }
+
+    String sql(_sqlSelectLogs);
+    if (cookie != NEService::COOKIE_ANY)
+    {
+        sql.append(_sqlWhereCookie);
+    }
+
+    if (scopeId != 0u)
+    {
+        sql.append(_sqlWhereScope);
+    }
+
+    sql.append(_sqlOrderLogs);
+
+    sqlite3_stmt* stmt{ nullptr };
+    if (SQLITE_OK == sqlite3_prepare_v2(dbObject, sql.getString(), static_cast<int>(sql.getLength()), &stmt, nullptr))
+    {
+        sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(timeBegin));
+        sqlite3_bind_int64(stmt, 2, static_cast<sqlite3_int64>(timeEnd));
+        if (cookie != NEService::COOKIE_ANY)
+        {
+            sqlite3_bind_int64(stmt, 3, static_cast<sqlite3_int64>(cookie));
+        }
+
+        if (scopeId != 0u)
+        {
+            sqlite3_bind_int64(stmt, 4, static_cast<sqlite3_int64>(scopeId));
+        }
+
+        // the negative limit means no limit.
+        sqlite3_bind_int64(stmt, 5, maxMessages != 0u ? static_cast<sqlite3_int64>(maxMessages) : -1);
+
+        NETrace::sLogMessage logMessage;
+        logMessage.logDataType = NETrace::eLogDataType::LogDataRemote;
+        while (SQLITE_ROW == sqlite3_step(stmt))
+        {
+            logMessage.logCookie     = static_cast<ITEM_ID>(sqlite3_column_int64(stmt, 0));
+            logMessage.logSource     = logMessage.logCookie;
+            logMessage.logScopeId    = static_cast<unsigned int>(sqlite3_column_int64(stmt, 1));
+            logMessage.logMsgType    = static_cast<NETrace::eLogMessageType>(sqlite3_column_int(stmt, 2));
+            logMessage.logMessagePrio= static_cast<NETrace::eLogPriority>(sqlite3_column_int(stmt, 3));
+            logMessage.logModuleId   = static_cast<ITEM_ID>(sqlite3_column_int64(stmt, 4));
+            logMessage.logThreadId   = static_cast<ITEM_ID>(sqlite3_column_int64(stmt, 5));
+            logMessage.logMessageLen = _copyText(stmt, 6, logMessage.logMessage, NETrace::LOG_MESSAGE_IZE);
+            logMessage.logThreadLen  = _copyText(stmt, 7, logMessage.logThread, NETrace::LOG_NAMES_SIZE);
+            logMessage.logModuleLen  = _copyText(stmt, 8, logMessage.logModule, NETrace::LOG_NAMES_SIZE);
+            logMessage.logTimestamp  = static_cast<TIME64>(sqlite3_column_int64(stmt, 9));
+            out_messages.add(logMessage);
+            ++ result;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    sqlite3_close(dbObject);
+    return result;
+}
+
+void LogSqliteDatabase::_writeQueued(void)
+{
+    do
+    {
+        Lock lock(mQueueLock);
+        std::swap(mQueue, mWriting);
+    } while (false);
+
+    if ((mWriting.isEmpty() == false) && (mDbObject != nullptr))
+    {
+        // if the transaction is started by begin(), the messages become part of it.
+        bool doTransaction{ sqlite3_get_autocommit(mDbObject) != 0 };
+
+        // the partition is switched only out of transaction, since the attached database cannot be detached in the transaction.
+        TIME64 now{ static_cast<TIME64>(DateTime::getNow().getTime()) };
+        if (doTransaction && isPartitioned() && _isPartitionFull(now))
+        {
+            _closePartition();
+            _openPartition(now);
+            _dropPartitions(now);
+        }
+
+        if (doTransaction)
+        {
+            _execute("BEGIN TRANSACTION;");
+        }
+
+        for (const sLogEntry& entry : mWriting.getData())
+        {
+            const NETrace::sLogMessage& message{ entry.leMessage };
+            _insertLog( message.logCookie
+                      , static_cast<uint32_t>(message.logScopeId)
+                      , static_cast<uint32_t>(message.logMsgType)
+                      , static_cast<uint32_t>(message.logMessagePrio)
+                      , message.logModuleId
+                      , message.logThreadId
+                      , message.logMessage, message.logMessageLen
+                      , message.logThread, message.logThreadLen
+                      , message.logModule, message.logModuleLen
+                      , message.logTimestamp
+                      , entry.leReceived);
+        }
+
+        _updatePartition();
+        if (doTransaction)
+        {
+            _execute("COMMIT;");
+        }
+    }
+
+    mWriting.clear();
+}
+
+inline void LogSqliteDatabase::_startWriter(void)
+{
+    mWriterQuit = false;
+    mQueue.reserve(GROUP_COMMIT_SIZE);
+    mWriting.reserve(GROUP_COMMIT_SIZE);
+    mWriterRuns = mWriterThread.createThread(NECommon::WAIT_INFINITE);
+}
+
+inline void LogSqliteDatabase::_stopWriter(void)
+{
+    if (mWriterRuns)
+    {
+        mWriterRuns = false;
+        mWriterQuit = true;
+        mQueueEvent.setEvent();
+        mWriterThread.shutdownThread(NECommon::WAIT_INFINITE);
+    }
+
+    Lock lock(mDbLock);
+    _writeQueued();
+}
+
+void LogSqliteDatabase::onThreadRuns(void)
+{
+    while (mWriterQuit == false)
+    {
+        mQueueEvent.lock(GROUP_COMMIT_TIMEOUT);
+
+        Lock lock(mDbLock);
+        _writeQueued();
+    }
+}
+
 bool LogSqliteDatabase::isOperable(void) const
 {
     return (mDbObject != nullptr);
@@ -339,9 +997,12 @@ bool LogSqliteDatabase::connect(const String& dbPath /*= String::EmptyString*/)
         {
             _createTables();
             _createIndexes();
+            _loadManifest();
+            VERIFY(_prepareStatements());
+            VERIFY(_openPartition(static_cast<TIME64>(DateTime::getNow().getTime())));
             _initialize();
-            commit(true);
             mIsInitialized = true;
+            _startWriter();
         }
     }
 
@@ -350,32 +1011,17 @@ bool LogSqliteDatabase::connect(const String& dbPath /*= String::EmptyString*/)
 
 void LogSqliteDatabase::disconnect(void)
 {
-    Process& proc{ Process::getInstance() };
-    DateTime now{ DateTime::getNow() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    _stopWriter();
 
+    Lock lock(mDbLock);
+    DateTime now{ DateTime::getNow() };
     char sql[SQL_LEN]{};
 
     String::formatString( sql, SQL_LEN, _fmtUpdVersion.data()
                         , static_cast<uint64_t>(now.getTime()));
     _execute(sql);
 
-    String::formatString( sql, SQL_LEN, _fmtLog.data()
-                        , NEService::COOKIE_LOCAL
-                        , NEMath::CHECKSUM_IGNORE
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , "Closing database logging..."
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint64_t>(now.getTime())
-                        );
-    _execute(sql);
+    _insertObserverLog("Closing database logging...", now);
 
     String::formatString( sql, SQL_LEN, _fmtCloseScopes.data()
                         , static_cast<uint64_t>(now.getTime()));
@@ -386,23 +1032,81 @@ void LogSqliteDatabase::disconnect(void)
                         , static_cast<uint64_t>(now.getTime()));
     _execute(sql);
 
-    commit(true);
+    _closePartition();
     _close();
 }
 
 bool LogSqliteDatabase::execute(const String& sql)
 {
+    Lock lock(mDbLock);
+    _writeQueued();
     return sql.isEmpty() ? false : _execute(sql.getString());
 }
 
 bool LogSqliteDatabase::begin(void)
 {
+    Lock lock(mDbLock);
+    _writeQueued();
     return _execute("BEGIN TRANSACTION;");
 }
 
 bool LogSqliteDatabase::commit(bool doCommit)
 {
-    return _execute(doCommit ? "COMMIT;" : "ROLLBACK;");
+    Lock lock(mDbLock);
+    _writeQueued();
+    if ((mDbObject != nullptr) && (sqlite3_get_autocommit(mDbObject) == 0))
+    {
+        return _execute(doCommit ? "COMMIT;" : "ROLLBACK;");
+    }
+
+    return (mDbObject != nullptr);
+}
+
+uint32_t LogSqliteDatabase::queryPartitions(const DateTime & timeBegin, const DateTime & timeEnd, TEArrayList<sPartition> & OUT out_partitions)
+{
+    Lock lock(mDbLock);
+    _writeQueued();
+    _updatePartition();
+
+    uint32_t result{ 0u };
+    for (const sPartition& part : mPartitions.getData())
+    {
+        if ((part.ptCount != 0u) && (part.ptBegin <= timeEnd.getTime()) && (part.ptEnd >= timeBegin.getTime()))
+        {
+            out_partitions.add(part);
+            ++ result;
+        }
+    }
+
+    return result;
+}
+
+uint32_t LogSqliteDatabase::queryLogs( const DateTime & timeBegin
+                                     , const DateTime & timeEnd
+                                     , TEArrayList<NETrace::sLogMessage> & OUT out_messages
+                                     , const ITEM_ID & cookie   /*= NEService::COOKIE_ANY*/
+                                     , uint32_t scopeId         /*= 0u*/
+                                     , uint32_t maxMessages     /*= 0u*/)
+{
+    TEArrayList<sPartition> partitions;
+    queryPartitions(timeBegin, timeEnd, partitions);
+
+    // the partitions are read by own connections, so that the writer thread is not blocked.
+    uint32_t result{ 0u };
+    for (const sPartition& part : partitions.getData())
+    {
+        if ((maxMessages != 0u) && (result >= maxMessages))
+            break;
+
+        if ((cookie == NEService::COOKIE_ANY) || part.ptSources.contains(cookie))
+        {
+            result += _queryPartition( _partitionPath(part.ptFile), timeBegin.getTime(), timeEnd.getTime()
+                                     , cookie, scopeId, maxMessages != 0u ? maxMessages - result : 0u
+                                     , out_messages);
+        }
+    }
+
+    return result;
 }
 
 bool LogSqliteDatabase::tablesInitialized(void) const
@@ -412,30 +1116,29 @@ bool LogSqliteDatabase::tablesInitialized(void) const
 
 bool LogSqliteDatabase::logMessage(const NETrace::sLogMessage& message, const DateTime& timestamp)
 {
-    char sql[SQL_LEN_MAX];
-    String::formatString(sql, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(message.logCookie)
-                        , static_cast<uint32_t>(message.logScopeId)
-                        , static_cast<uint32_t>(message.logMsgType)
-                        , static_cast<uint32_t>(message.logMessagePrio)
-                        , static_cast<uint64_t>(message.logModuleId)
-                        , static_cast<uint64_t>(message.logThreadId)
-                        , message.logMessage
-                        , message.logThreadLen != 0 ? message.logThread : String::EmptyString
-                        , message.logModuleId  != 0 ? message.logModule : String::EmptyString
-                        , static_cast<uint64_t>(message.logTimestamp)
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
+    if (mWriterRuns == false)
+        return false;
 
-    return _execute(sql);
+    bool doWrite{ false };
+    do
+    {
+        Lock lock(mQueueLock);
+        mQueue.add(sLogEntry{ message, static_cast<TIME64>(timestamp.getTime()) });
+        doWrite = mQueue.getSize() >= GROUP_COMMIT_SIZE;
+    } while (false);
+
+    if (doWrite)
+    {
+        mQueueEvent.setEvent();
+    }
+
+    return true;
 }
 
 bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedInstance& instance, const DateTime& timestamp)
 {
-    Process& proc{ Process::getInstance() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
+    Lock lock(mDbLock);
+    _writeQueued();
 
     char msg[MSG_LEN];
     String::formatString( msg, MSG_LEN, "The %u-bit instance [ %s ] with cookie [ %llu ] is connected at time [ %s ]"
@@ -444,21 +1147,6 @@ bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedI
                         , static_cast<uint64_t>(instance.ciCookie)
                         , timestamp.formatTime().getString());
 
-    char sqlLog[SQL_LEN_MAX];
-    String::formatString( sqlLog, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , msg
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
-
     char sqlInst[SQL_LEN];
     String::formatString( sqlInst, SQL_LEN, _fmtInstance.data()
                         , static_cast<uint64_t>(instance.ciCookie)
@@ -470,72 +1158,44 @@ bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedI
                         , static_cast<uint64_t>(timestamp.getTime())
                         );
 
-    return (_execute(sqlLog) && _execute(sqlInst));
+    return (_insertObserverLog(msg, timestamp) && _execute(sqlInst));
 }
 
 bool LogSqliteDatabase::logInstanceDisconnected(const ITEM_ID& cookie, const DateTime& timestamp)
 {
+    Lock lock(mDbLock);
     logScopesDeactivate(cookie, timestamp);
 
-    Process& proc{ Process::getInstance() };
-    String module{ proc.getAppName() };
-    id_type threadId{ Thread::getCurrentThreadId() };
-    String thread{ Thread::getThreadName(threadId) };
-
     char msg[MSG_LEN];
     String::formatString( msg, MSG_LEN, "The instance with cookie [ %llu ] is disconnected at time [ %s ]"
                         , static_cast<uint64_t>(cookie)
                         , timestamp.formatTime().getString());
 
-    char sqlLog[SQL_LEN_MAX];
-    String::formatString( sqlLog, SQL_LEN_MAX, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(NETrace::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NETrace::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , msg
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        , static_cast<uint64_t>(timestamp.getTime())
-                        );
-
     char sqlInst[SQL_LEN];
     String::formatString( sqlInst, SQL_LEN, _fmtUpdInstance.data()
                         , static_cast<uint64_t>(timestamp.getTime())
                         , static_cast<uint64_t>(DateTime::getNow().getTime())
                         , static_cast<uint64_t>(cookie));
 
-    return (_execute(sqlLog) && _execute(sqlInst));
+    return (_insertObserverLog(msg, timestamp) && _execute(sqlInst));
 }
 
 bool LogSqliteDatabase::logScopeActivate(const NETrace::sScopeInfo & scope, const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    char sql[SQL_LEN];
-    String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                        , static_cast<uint32_t>(scope.scopeId)
-                        , static_cast<uint64_t>(cookie)
-                        , static_cast<uint32_t>(scope.scopePrio)
-                        , scope.scopeName.getString()
-                        , static_cast<uint64_t>(timestamp.getTime()));
-    return _execute(sql);
+    Lock lock(mDbLock);
+    _writeQueued();
+    return _insertScope(scope.scopeName.getString(), scope.scopeId, scope.scopePrio, cookie, static_cast<TIME64>(timestamp.getTime()));
 }
 
 uint32_t LogSqliteDatabase::logScopesActivate(const NETrace::ScopeNames& scopes, const ITEM_ID& cookie, const DateTime& timestamp)
 {
+    Lock lock(mDbLock);
+    _writeQueued();
+
     uint32_t result{ 0 };
-    char sql[SQL_LEN];
     for (const auto& scope : scopes.getData())
     {
-        String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                            , static_cast<uint32_t>(scope.scopeId)
-                            , static_cast<uint64_t>(cookie)
-                            , static_cast<uint32_t>(scope.scopePrio)
-                            , scope.scopeName.getString()
-                            , static_cast<uint64_t>(timestamp.getTime()));
-        result += _execute(sql) ? 1 : 0;
+        result += _insertScope(scope.scopeName.getString(), scope.scopeId, scope.scopePrio, cookie, static_cast<TIME64>(timestamp.getTime())) ? 1 : 0;
     }
 
     return result;
@@ -543,18 +1203,16 @@ uint32_t LogSqliteDatabase::logScopesActivate(const NETrace::ScopeNames& scopes,
 
 bool LogSqliteDatabase::logScopeActivate(const String& scopeName, uint32_t scopeId, uint32_t scopePrio, const ITEM_ID& cookie, const DateTime& timestamp)
 {
-    char sql[SQL_LEN];
-    String::formatString( sql, SQL_LEN, _fmtScopes.data()
-                        , static_cast<uint32_t>(scopeId)
-                        , static_cast<uint64_t>(cookie)
-                        , static_cast<uint32_t>(scopePrio)
-                        , scopeName.getString()
-                        , static_cast<uint64_t>(timestamp.getTime()));
-    return _execute(sql);
+    Lock lock(mDbLock);
+    _writeQueued();
+    return _insertScope(scopeName.getString(), scopeId, scopePrio, cookie, static_cast<TIME64>(timestamp.getTime()));
 }
 
 bool LogSqliteDatabase::logScopesDeactivate(const ITEM_ID& cookie, const DateTime& timestamp)
 {
+    Lock lock(mDbLock);
+    _writeQueued();
+
     char sql[SQL_LEN];
     String::formatString( sql, SQL_LEN, _fmtUpdScopes.data()
                         , static_cast<uint64_t>(timestamp.getTime())
@@ -564,6 +1222,9 @@ bool LogSqliteDatabase::logScopesDeactivate(const ITEM_ID& cookie, const DateTim
 
 bool LogSqliteDatabase::logScopeDeactivate(const ITEM_ID& cookie, unsigned int scopeId, const DateTime& timestamp)
 {
+    Lock lock(mDbLock);
+    _writeQueued();
+
     char sql[SQL_LEN];
     String::formatString( sql, SQL_LEN, _fmtUpdScope.data()
                         , static_cast<uint64_t>(timestamp.getTime())
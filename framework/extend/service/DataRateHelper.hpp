@@ -21,6 +21,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 
+#include "areg/base/TEArrayList.hpp"
 #include "extend/service/private/ServerSendThread.hpp"
 #include "extend/service/private/ServerReceiveThread.hpp"
 
@@ -56,6 +57,11 @@ public:
     //!< The type of data rate. Contains value and the associated literal.
     using DataRate  = std::pair<float, std::string>;
 
+    //!< The list of threads sending data.
+    using SendThreads       = TEArrayList<ServerSendThread *>;
+    //!< The list of threads receiving data.
+    using ReceiveThreads    = TEArrayList<ServerReceiveThread *>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor.
 //////////////////////////////////////////////////////////////////////////
@@ -63,13 +69,14 @@ public:
     /**
      * \brief   Initializes the object, sets threads that the rate can be queried.
      *          If passed 'verbose' parameter is 'false' on each query it returns zero.
-     *          Otherwise, returns the actual value.
-     * \param   sendThread      The thread that can be queried the data size sent.
-     * \param   receiveThread   The threat that can be queried the data size received.
+     *          Otherwise, returns the actual value. The lists of threads should not
+     *          be modified while the data rate is queried.
+     * \param   sendThreads     The list of threads that can be queried the data size sent.
+     * \param   receiveThreads  The list of threads that can be queried the data size received.
      * \param   verbose         The flag, indicating whether the actual size should be
      *                          computed or should return zero.
      **/
-    DataRateHelper(ServerSendThread& sendThread, ServerReceiveThread& receiveThread, bool verbose);
+    DataRateHelper(const SendThreads & sendThreads, const ReceiveThreads & receiveThreads, bool verbose);
 
     ~DataRateHelper(void) = default;
 
@@ -120,8 +127,9 @@ public:
 // Hidden member variables.
 //////////////////////////////////////////////////////////////////////////
 private:
-    ServerSendThread &      mSendThread;    //!< The thread to query the sent data size in bytes.
-    ServerReceiveThread &   mReceiveThread; //!< The thread to query the received data size in bytes.
+    const SendThreads &     mSendThreads;   //!< The threads to query the sent data size in bytes.
+    const ReceiveThreads &  mReceiveThreads;//!< The threads to query the received data size in bytes.
+    bool                    mVerbose;       //!< The flag, indicating whether the data size is computed.
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -137,12 +145,24 @@ private:
 
 inline uint32_t DataRateHelper::queryBytesSent(void) const
 {
-    return mSendThread.extractDataSend();
+    uint32_t result{ 0u };
+    for (const ServerSendThread * thread : mSendThreads.getData())
+    {
+        result += thread->extractDataSend();
+    }
+
+    return result;
 }
 
 inline uint32_t DataRateHelper::queryBytesReceived(void) const
 {
-    return mReceiveThread.extractDataReceive();
+    uint32_t result{ 0u };
+    for (const ServerReceiveThread * thread : mReceiveThreads.getData())
+    {
+        result += thread->extractDataReceive();
+    }
+
+    return result;
 }
 
 inline DataRateHelper::DataRate DataRateHelper::queryBytesSentWithLiterals(void) const
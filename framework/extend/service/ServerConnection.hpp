@@ -26,6 +26,13 @@
 #include "areg/base/SocketAccepted.hpp"
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/ipc/SharedMemoryServer.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessageQueue;
 
 //////////////////////////////////////////////////////////////////////////
 // ServerConnection class declaration.
@@ -37,7 +44,10 @@
  *          connection is accepted, the client starts to send and receive data.
  *          Sending and receiving data are running in blocking mode. 
  *          To synchronize communication, there are send and receive threads
- *          are specified.
+ *          are specified. The clients running on the same host can exchange
+ *          messages via shared memory. In this case, the slot of the shared
+ *          memory is bound with the accepted socket of the client, which remains
+ *          open to detect the disconnection.
  **/
 class ServerConnection  : public    ServerConnectionBase
                         , private   SocketConnectionBase
@@ -106,6 +116,98 @@ public:
      **/
     void closeAllConnections( void );
 
+    /**
+     * \brief   Notifies the clients owned by the worker about disconnection and closes their connections.
+     *          The connections of other workers are not changed, so that each worker can send
+     *          its queued messages before closing own connections.
+     * \param   worker  The index of the worker, which owns the connections to close.
+     **/
+    void closeWorkerConnections( uint32_t worker );
+
+    /**
+     * \brief   Closes the accepted connection and the bound slot of the shared memory.
+     * \param   clientConnection    The accepted connection to close.
+     **/
+    void closeConnection( SocketAccepted & clientConnection );
+
+    /**
+     * \brief   Closes the accepted connection and the bound slot of the shared memory.
+     * \param   cookie  The cookie of the accepted connection to close.
+     **/
+    void closeConnection( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Creates the shared memory segment to communicate with the clients on the same host.
+     * \param   segmentName The name of the shared memory segment.
+     * \return  Returns true if succeeded to create the shared memory.
+     **/
+    bool createSharedMemory( const String & segmentName );
+
+    /**
+     * \brief   Closes all slots and removes the shared memory segment.
+     **/
+    void releaseSharedMemory( void );
+
+    /**
+     * \brief   Returns the shared memory object.
+     **/
+    inline SharedMemoryServer & getSharedMemory( void );
+
+    /**
+     * \brief   Binds the claimed slot of the shared memory with the accepted connection,
+     *          which address is same as the address set in the slot by the client.
+     * \param   slot    The index of the claimed slot.
+     * \return  Returns true if the slot is bound.
+     **/
+    bool bindSharedMemory( uint32_t slot );
+
+    /**
+     * \brief   Removes the binding of the slot with the accepted connection and frees the slot.
+     *          The messages to the client are sent via socket.
+     * \param   slot    The index of the slot to free.
+     **/
+    void freeSharedMemory( uint32_t slot );
+
+    /**
+     * \brief   Returns the accepted connection bound with the slot of the shared memory.
+     **/
+    SocketAccepted getClientBySlot( uint32_t slot ) const;
+
+    /**
+     * \brief   Returns true if the client with specified cookie is bound with the slot of the shared memory.
+     **/
+    bool isSharedMemoryClient( const ITEM_ID & clientCookie ) const;
+
+    /**
+     * \brief   Sends the message via shared memory if the client is bound with the slot.
+     * \param   in_message      The message to send.
+     * \param   clientCookie    The cookie of the target client.
+     * \return  Returns length in bytes of sent data. Returns zero if the client is not bound
+     *          with the shared memory and the message should be sent via socket. Returns
+     *          negative value if failed to send.
+     **/
+    int sendSharedMessage( const RemoteMessage & in_message, const ITEM_ID & clientCookie ) const;
+
+    /**
+     * \brief   Sends the queued messages via shared memory without blocking, if the client is bound with the slot.
+     *          Only the data, which fits the ring of the slot, is sent and the rest remains in the queue.
+     * \param   queue           The queue of messages to the client.
+     * \param   clientCookie    The cookie of the target client.
+     * \return  Returns length in bytes of sent data. Returns zero if the ring is full.
+     *          Returns negative value if failed or the client is not bound with the shared memory.
+     **/
+    int sendSharedMessages( RemoteMessageQueue & queue, const ITEM_ID & clientCookie ) const;
+
+    /**
+     * \brief   Sends all queued messages via shared memory and blocks until the data is sent,
+     *          if the client is bound with the slot.
+     * \param   queue           The queue of messages to the client.
+     * \param   clientCookie    The cookie of the target client.
+     * \return  Returns length in bytes of sent data. Returns negative value if failed
+     *          or the client is not bound with the shared memory.
+     **/
+    int flushSharedMessages( RemoteMessageQueue & queue, const ITEM_ID & clientCookie ) const;
+
     /**
      * \brief   If socket is valid, sends data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -164,7 +266,7 @@ public:
      *          Returns negative number if socket is not valid of failed to send.
      *          Returns zero, if checksum in Remote Buffer was not validated or Remote Buffer object is empty.
      **/
-    inline int sendMessage( const RemoteMessage & in_message, const ITEM_ID & clientCookie ) const;
+    int sendMessage( const RemoteMessage & in_message, const ITEM_ID & clientCookie ) const;
 
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
@@ -193,6 +295,35 @@ private:
      **/
     const ITEM_ID               mChannelId;
 
+    /**
+     * \brief   The shared memory to communicate with the clients on the same host.
+     **/
+    mutable SharedMemoryServer  mSharedMemory;
+
+    /**
+     * \brief   The map of cookies of clients and bound slots of the shared memory.
+     **/
+    TEMap<ITEM_ID, uint32_t>    mCookieToSlot;
+
+    /**
+     * \brief   The map of bound slots of the shared memory and sockets of clients.
+     **/
+    TEMap<uint32_t, SOCKETHANDLE>   mSlotToSocket;
+
+    /**
+     * \brief   The lock to synchronize the access to the shared memory.
+     **/
+    mutable ResourceLock        mSharedLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Closes the slot of the shared memory bound with the client of specified cookie.
+     **/
+    void _closeSharedMemory( const ITEM_ID & cookie );
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -215,9 +346,9 @@ inline int ServerConnection::sendMessage(const RemoteMessage & in_message, const
     return SocketConnectionBase::sendMessage(in_message, clientSocket);
 }
 
-inline int ServerConnection::sendMessage(const RemoteMessage & in_message, const ITEM_ID & clientCookie) const
+inline SharedMemoryServer & ServerConnection::getSharedMemory( void )
 {
-    return SocketConnectionBase::sendMessage(in_message, getClientByCookie(clientCookie) );
+    return mSharedMemory;
 }
 
 inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const SocketAccepted & clientSocket) const
@@ -34,6 +34,7 @@
 #include "extend/service/ServerConnection.hpp"
 #include "extend/service/private/ServerReceiveThread.hpp"
 #include "extend/service/private/ServerSendThread.hpp"
+#include "extend/service/private/ServerSharedMemoryThread.hpp"
 
 /************************************************************************
  * Dependencies
@@ -90,7 +91,7 @@ public:
     /**
      * \brief   Destructor
      **/
-    virtual ~ServiceCommunicatonBase( void ) = default;
+    virtual ~ServiceCommunicatonBase( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
@@ -152,6 +153,17 @@ public:
      **/
     inline bool sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
+    /**
+     * \brief   Queues the same message for sending to the list of targets. The data of
+     *          the message is not copied, every target receives the message with own
+     *          cookie set in the header. The message should not be modified after the call.
+     *          Each worker receives the message with the list of targets it owns.
+     * \param   data        The data of the message.
+     * \param   targets     The list of cookies of the targets to receive the message.
+     * \param   eventPrio   The priority of the message to set.
+     **/
+    bool sendMessage(const RemoteMessage & data, const TEArrayList<ITEM_ID> & targets, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
+
     /**
      * \brief   Returns the instance of data rate helper object to use when computing data rate.
      **/
@@ -412,15 +424,45 @@ public:
     void stopConnection( void );
 
     /**
-     * \brief   Starts the message sending thread and returns true if succeeded.
+     * \brief   Starts the message sending threads of all workers and returns true if succeeded.
      **/
     bool startSendThread( void );
 
     /**
-     * \brief   Starts the message receiving thread and returns true if succeeded.
+     * \brief   Starts the message receiving threads of all workers and returns true if succeeded.
      **/
     bool startReceiveThread( void );
 
+    /**
+     * \brief   Creates the send and receive threads of the workers. The threads are created only once,
+     *          the number of workers is not changed when the connection restarts.
+     * \param   workers     The number of workers. Zero means the number of processor cores.
+     **/
+    void createWorkers( uint32_t workers );
+
+    /**
+     * \brief   Returns the message sending thread of the worker, which owns the connection of the target.
+     * \param   target  The cookie of the target connection.
+     **/
+    inline ServerSendThread & getSendWorker( const ITEM_ID & target );
+
+    /**
+     * \brief   Creates the local (Unix domain) socket to accept connections of the clients
+     *          on the same host, if the local socket connection is enabled. Returns true if succeeded.
+     **/
+    bool startLocalSocket( void );
+
+    /**
+     * \brief   Creates the shared memory and starts the thread to receive messages via shared memory,
+     *          if the shared memory connection is enabled. Returns true if succeeded.
+     **/
+    bool startSharedMemory( void );
+
+    /**
+     * \brief   Stops the thread to receive messages via shared memory and releases the shared memory.
+     **/
+    void stopSharedMemory( void );
+
     /**
      * \brief   Call to send the event to process.
      * \param   cmd         The command to send and process.
@@ -479,6 +521,11 @@ private:
      **/
     inline ServiceCommunicatonBase & self( void );
 
+    /**
+     * \brief   Posts the message sending event to the thread. For internal use only.
+     **/
+    inline bool _postSendEvent( const SendMessageEventData & data, ServerSendThread & thread, Event::eEventPriority eventPrio );
+
 //////////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////////
@@ -488,8 +535,11 @@ protected:
     const unsigned int                      mConnectTypes;      //!< The bitwise flags of remote service connections.
     ServerConnection                        mServerConnection;  //!< The instance of server connection object.
     Timer                                   mTimerConnect;      //!< The timer object to trigger in case if failed to create server socket.
-    ServerSendThread                        mThreadSend;        //!< The thread to send messages to clients
-    ServerReceiveThread                     mThreadReceive;     //!< The thread to receive messages from clients
+    ServerSendThread                        mThreadSend;        //!< The thread of the first worker to send messages to clients
+    ServerReceiveThread                     mThreadReceive;     //!< The thread of the first worker to accept connections and receive messages from clients
+    DataRateHelper::SendThreads             mSendWorkers;       //!< The threads of all workers to send messages to own clients. The first is mThreadSend.
+    DataRateHelper::ReceiveThreads          mReceiveWorkers;    //!< The threads of all workers to receive messages from own clients. The first is mThreadReceive.
+    ServerSharedMemoryThread                mThreadShared;      //!< The thread to receive messages from clients via shared memory
     DataRateHelper                          mDataRateHelper;    //!< The helper object to query information of sent and receive bytes.
     StringArray                             mWhiteList;         //!< The list of enabled fixed client hosts.
     StringArray                             mBlackList;         //!< The list of disabled fixes client hosts.
@@ -516,6 +566,19 @@ inline ServiceCommunicatonBase & ServiceCommunicatonBase::self( void )
     return (*this);
 }
 
+inline ServerSendThread & ServiceCommunicatonBase::getSendWorker( const ITEM_ID & target )
+{
+    return *mSendWorkers[mServerConnection.getWorker( target )];
+}
+
+inline bool ServiceCommunicatonBase::_postSendEvent( const SendMessageEventData & data, ServerSendThread & thread, Event::eEventPriority eventPrio )
+{
+    return SendMessageEvent::sendEvent( data
+                                        , static_cast<IESendMessageEventConsumer &>(thread)
+                                        , static_cast<DispatcherThread &>(thread)
+                                        , eventPrio );
+}
+
 inline bool ServiceCommunicatonBase::isAddressInWhiteList(const NESocket::SocketAddress & addrClient) const
 {
     return mWhiteList.contains(addrClient.getHostAddress());
@@ -579,10 +642,8 @@ inline bool ServiceCommunicatonBase::sendCommunicationMessage( ServiceEventData:
 
 inline bool ServiceCommunicatonBase::sendMessage( const RemoteMessage & data, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
 {
-    return SendMessageEvent::sendEvent( SendMessageEventData( data )
-                                        , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                        , static_cast<DispatcherThread &>(mThreadSend)
-                                        , eventPrio );
+    // the message is queued in the lock-free event queue of the worker, which owns the target connection.
+    return _postSendEvent( SendMessageEventData( data ), getSendWorker( data.getTarget( ) ), eventPrio );
 }
 
 inline DataRateHelper& ServiceCommunicatonBase::getDataRateHelper(void) const
@@ -612,10 +673,10 @@ inline bool ServiceCommunicatonBase::isCalculateDataRateEnabled(void) const
 
 inline void ServiceCommunicatonBase::disconnectService( Event::eEventPriority eventPrio )
 {
-    SendMessageEvent::sendEvent( SendMessageEventData( )
-                                 , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                 , static_cast<DispatcherThread &>(mThreadSend)
-                                 , eventPrio );
+    for ( ServerSendThread * thread : mSendWorkers.getData( ) )
+    {
+        static_cast<void>(_postSendEvent( SendMessageEventData( ), *thread, eventPrio ));
+    }
 }
 
 #endif  // AREG_EXTEND_SERVICE_SERVICECOMMUNICATONBASE_HPP
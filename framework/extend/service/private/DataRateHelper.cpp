@@ -23,23 +23,31 @@
 // DataRateHelper class implementation
 //////////////////////////////////////////////////////////////////////////
 
-DataRateHelper::DataRateHelper(ServerSendThread& sendThread, ServerReceiveThread& receiveThread, bool verbose)
-    : mSendThread   (sendThread)
-    , mReceiveThread(receiveThread)
+DataRateHelper::DataRateHelper(const SendThreads & sendThreads, const ReceiveThreads & receiveThreads, bool verbose)
+    : mSendThreads      (sendThreads)
+    , mReceiveThreads   (receiveThreads)
+    , mVerbose          (verbose)
 {
-    mSendThread.setEnableCalculateData(verbose);
-    mReceiveThread.setEnableCalculateData(verbose);
+    setVerbose(verbose);
 }
 
 void DataRateHelper::setVerbose(bool verbose)
 {
-    mSendThread.setEnableCalculateData(verbose);
-    mReceiveThread.setEnableCalculateData(verbose);
+    mVerbose = verbose;
+    for (ServerSendThread * thread : mSendThreads.getData())
+    {
+        thread->setEnableCalculateData(verbose);
+    }
+
+    for (ServerReceiveThread * thread : mReceiveThreads.getData())
+    {
+        thread->setEnableCalculateData(verbose);
+    }
 }
 
 bool DataRateHelper::isVerbose(void) const
 {
-    return mSendThread.isCalculateDataEnabled() && mReceiveThread.isCalculateDataEnabled();
+    return mVerbose;
 }
 
 DataRateHelper::DataRate DataRateHelper::convertDataRateLiterals(uint32_t sizeBytes)
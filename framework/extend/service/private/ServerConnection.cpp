@@ -16,11 +16,19 @@
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/RemoteMessageQueue.hpp"
+#include "areg/trace/GETrace.h"
+
+DEF_TRACE_SCOPE(areg_extend_service_ServerConnection_bindSharedMemory);
 
 ServerConnection::ServerConnection(const ITEM_ID & channelId )
     : ServerConnectionBase  ( )
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mSharedMemory         ( )
+    , mCookieToSlot         ( )
+    , mSlotToSocket         ( )
+    , mSharedLock           ( false )
 {
 }
 
@@ -28,6 +36,10 @@ ServerConnection::ServerConnection(const ITEM_ID & channelId, const char * hostN
     : ServerConnectionBase  ( hostName, portNr)
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mSharedMemory         ( )
+    , mCookieToSlot         ( )
+    , mSlotToSocket         ( )
+    , mSharedLock           ( false )
 {
 }
 
@@ -35,6 +47,10 @@ ServerConnection::ServerConnection(const ITEM_ID & channelId, const NESocket::So
     : ServerConnectionBase  ( serverAddress )
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mSharedMemory         ( )
+    , mCookieToSlot         ( )
+    , mSlotToSocket         ( )
+    , mSharedLock           ( false )
 {
 }
 
@@ -48,6 +64,19 @@ void ServerConnection::rejectConnection(SocketAccepted & clientConnection)
 
 void ServerConnection::closeAllConnections(void)
 {
+    do
+    {
+        // The shared memory lock is always taken before the lock of connections.
+        Lock lockShared( mSharedLock );
+        for (auto pos = mCookieToSlot.firstPosition(); mCookieToSlot.isValidPosition(pos); pos = mCookieToSlot.nextPosition(pos))
+        {
+            mSharedMemory.closeSlot(mCookieToSlot.valueAtPosition(pos));
+        }
+
+        mCookieToSlot.clear();
+        mSlotToSocket.clear();
+    } while (false);
+
     Lock lock( mLock );
     RemoteMessage msgByeClient;
     if ( msgByeClient.initMessage(NERemoteService::getMessageNotifyClientConnection().rbHeader ) != nullptr )
@@ -69,10 +98,218 @@ void ServerConnection::closeAllConnections(void)
         }
     }
 
-    mMasterList.clear();
-    mCookieToSocket.clear();
-    mSocketToCookie.clear();
-    mAcceptedConnections.clear();
+    _removeAllConnections();
+}
+
+void ServerConnection::closeWorkerConnections(uint32_t worker)
+{
+    TEArrayList<ITEM_ID> cookies;
+    do
+    {
+        Lock lock( mLock );
+        for (MapCookieToSocket::MAPPOS pos = mCookieToSocket.firstPosition(); mCookieToSocket.isValidPosition(pos); pos = mCookieToSocket.nextPosition(pos))
+        {
+            if (getWorker(mCookieToSocket.keyAtPosition(pos)) == worker)
+            {
+                cookies.add(mCookieToSocket.keyAtPosition(pos));
+            }
+        }
+    } while (false);
+
+    RemoteMessage msgByeClient;
+    if (msgByeClient.initMessage(NERemoteService::getMessageNotifyClientConnection().rbHeader) != nullptr)
+    {
+        msgByeClient.setSequenceNr( NEService::SEQUENCE_NUMBER_ANY );
+        msgByeClient.setSource( mChannelId );
+    }
+
+    for (const ITEM_ID & target : cookies.getData())
+    {
+        // The slot is closed first, so that the client receives the notification via socket.
+        _closeSharedMemory(target);
+        SocketAccepted clientConnection{ getClientByCookie(target) };
+        if (msgByeClient.isValid() && clientConnection.isValid() && (target >= NEService::COOKIE_REMOTE_SERVICE))
+        {
+            RemoteMessage msgDisconnect{ msgByeClient.clone() };
+            msgDisconnect.setTarget(target);
+            msgDisconnect << target << NEService::eServiceConnection::ServiceDisconnected;
+            sendMessage(msgDisconnect, clientConnection);
+        }
+
+        ServerConnectionBase::closeConnection(target);
+    }
+}
+
+void ServerConnection::closeConnection(SocketAccepted & clientConnection)
+{
+    _closeSharedMemory(getCookie(clientConnection));
+    ServerConnectionBase::closeConnection(clientConnection);
+}
+
+void ServerConnection::closeConnection(const ITEM_ID & cookie)
+{
+    _closeSharedMemory(cookie);
+    ServerConnectionBase::closeConnection(cookie);
+}
+
+int ServerConnection::sendMessage(const RemoteMessage & in_message, const ITEM_ID & clientCookie) const
+{
+    int result = sendSharedMessage(in_message, clientCookie);
+    return (result == 0 ? SocketConnectionBase::sendMessage(in_message, getClientByCookie(clientCookie)) : result);
+}
+
+bool ServerConnection::createSharedMemory(const String & segmentName)
+{
+    Lock lock( mSharedLock );
+    mCookieToSlot.clear();
+    mSlotToSocket.clear();
+    return mSharedMemory.createSegment(segmentName);
+}
+
+void ServerConnection::releaseSharedMemory(void)
+{
+    Lock lock( mSharedLock );
+    mCookieToSlot.clear();
+    mSlotToSocket.clear();
+    mSharedMemory.releaseSegment();
+}
+
+bool ServerConnection::bindSharedMemory(uint32_t slot)
+{
+    TRACE_SCOPE(areg_extend_service_ServerConnection_bindSharedMemory);
+
+    bool result{ false };
+    NESocket::SocketAddress address;
+    Lock lock( mSharedLock );
+    if (mSharedMemory.isValid() && mSharedMemory.getClaimedAddress(slot, address))
+    {
+        SOCKETHANDLE hSocket{ NESocket::InvalidSocketHandle };
+        ITEM_ID cookie{ NEService::COOKIE_UNKNOWN };
+
+        do
+        {
+            // The peer address of the accepted socket is the local address of the client socket.
+            Lock lockConnections( mLock );
+            for (MapSocketToObject::MAPPOS pos = mAcceptedConnections.firstPosition(); mAcceptedConnections.isValidPosition(pos); pos = mAcceptedConnections.nextPosition(pos))
+            {
+                if (mAcceptedConnections.valueAtPosition(pos).getAddress() == address)
+                {
+                    hSocket = mAcceptedConnections.keyAtPosition(pos);
+                    cookie  = getCookie(hSocket);
+                    break;
+                }
+            }
+        } while (false);
+
+        if ((cookie != NEService::COOKIE_UNKNOWN) && mSharedMemory.bindSlot(slot))
+        {
+            TRACE_DBG("Bound slot [ %u ] of shared memory with client [ %s : %d ], cookie [ %u ]"
+                        , slot
+                        , address.getHostAddress().getString()
+                        , address.getHostPort()
+                        , static_cast<uint32_t>(cookie));
+
+            mCookieToSlot.setAt(cookie, slot);
+            mSlotToSocket.setAt(slot, hSocket);
+            result = true;
+        }
+    }
+
+    return result;
+}
 
-    mCookieGenerator    = NEService::COOKIE_REMOTE_SERVICE;
+void ServerConnection::freeSharedMemory(uint32_t slot)
+{
+    Lock lock( mSharedLock );
+    for (auto pos = mCookieToSlot.firstPosition(); mCookieToSlot.isValidPosition(pos); pos = mCookieToSlot.nextPosition(pos))
+    {
+        if (mCookieToSlot.valueAtPosition(pos) == slot)
+        {
+            mCookieToSlot.removePosition(pos);
+            break;
+        }
+    }
+
+    mSlotToSocket.removeAt(slot);
+    if (mSharedMemory.isValid())
+    {
+        mSharedMemory.freeSlot(slot);
+    }
+}
+
+SocketAccepted ServerConnection::getClientBySlot(uint32_t slot) const
+{
+    Lock lock( mSharedLock );
+    auto pos = mSlotToSocket.find(slot);
+    return (mSlotToSocket.isValidPosition(pos) ? getClientByHandle(mSlotToSocket.valueAtPosition(pos)) : SocketAccepted());
+}
+
+bool ServerConnection::isSharedMemoryClient(const ITEM_ID & clientCookie) const
+{
+    Lock lock( mSharedLock );
+    return mCookieToSlot.contains(clientCookie);
+}
+
+int ServerConnection::sendSharedMessage(const RemoteMessage & in_message, const ITEM_ID & clientCookie) const
+{
+    int result{ 0 };
+    Lock lock( mSharedLock );
+    auto pos = mCookieToSlot.find(clientCookie);
+    if (mCookieToSlot.isValidPosition(pos))
+    {
+        const uint32_t slot{ mCookieToSlot.valueAtPosition(pos) };
+        result = mSharedMemory.sendMessage(in_message, clientCookie, slot);
+        if (result < 0)
+        {
+            // The ring may contain the part of message, the client should not wait for the rest.
+            mSharedMemory.closeSlot(slot);
+        }
+    }
+
+    return result;
+}
+
+int ServerConnection::sendSharedMessages(RemoteMessageQueue & queue, const ITEM_ID & clientCookie) const
+{
+    int result{ -1 };
+    Lock lock( mSharedLock );
+    auto pos = mCookieToSlot.find(clientCookie);
+    if (mCookieToSlot.isValidPosition(pos))
+    {
+        result = queue.sendShared(mSharedMemory, mCookieToSlot.valueAtPosition(pos));
+    }
+
+    return result;
+}
+
+int ServerConnection::flushSharedMessages(RemoteMessageQueue & queue, const ITEM_ID & clientCookie) const
+{
+    int result{ -1 };
+    Lock lock( mSharedLock );
+    auto pos = mCookieToSlot.find(clientCookie);
+    if (mCookieToSlot.isValidPosition(pos))
+    {
+        const uint32_t slot{ mCookieToSlot.valueAtPosition(pos) };
+        result = queue.flushShared(mSharedMemory, slot);
+        if (result < 0)
+        {
+            mSharedMemory.closeSlot(slot);
+        }
+    }
+
+    return result;
+}
+
+void ServerConnection::_closeSharedMemory(const ITEM_ID & cookie)
+{
+    Lock lock( mSharedLock );
+    auto pos = mCookieToSlot.find(cookie);
+    if (mCookieToSlot.isValidPosition(pos))
+    {
+        // The slot is freed when the client acknowledges or exits.
+        const uint32_t slot{ mCookieToSlot.valueAtPosition(pos) };
+        mSharedMemory.closeSlot(slot);
+        mSlotToSocket.removeAt(slot);
+        mCookieToSlot.removePosition(pos);
+    }
 }
@@ -16,6 +16,7 @@
 
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketPoller.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 #include "areg/trace/GETrace.h"
@@ -25,14 +26,28 @@
 
 
 DEF_TRACE_SCOPE(areg_extend_service_ServerReceiveThread_runDispatcher);
+DEF_TRACE_SCOPE(areg_extend_service_ServerReceiveThread__acceptConnection);
+DEF_TRACE_SCOPE(areg_extend_service_ServerReceiveThread__receiveMessages);
 
-ServerReceiveThread::ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler & remoteService, ServerConnection & connection )
-    : DispatcherThread  ( NEConnection::SERVER_RECEIVE_MESSAGE_THREAD )
+namespace
+{
+    //!< Returns the name of receive thread of the worker.
+    inline String _workerThreadName( uint32_t worker )
+    {
+        String result( NEConnection::SERVER_RECEIVE_MESSAGE_THREAD );
+        return (worker == 0 ? result : result + "_" + String::makeString( worker ));
+    }
+}
+
+ServerReceiveThread::ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler & remoteService, ServerConnection & connection, uint32_t worker /*= 0*/ )
+    : DispatcherThread  ( _workerThreadName( worker ) )
     , mConnectHandler   ( connectHandler )
     , mRemoteService    ( remoteService )
     , mConnection       ( connection )
+    , mWorker           ( worker )
     , mBytesReceive     ( 0 )
     , mSaveDataReceive  ( false )
+    , mDecoders         ( )
 {
 }
 
@@ -43,11 +58,13 @@ bool ServerReceiveThread::runDispatcher(void)
 
     readyForEvents(true);
     int whichEvent{ static_cast<int>(EventDispatcherBase::eEventOrder::EventError) };
-    if ( mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
+    // Only the first worker accepts connections, the others receive messages of own clients.
+    if ( (mWorker != 0) || mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
     {
         IESynchObject* syncObjects[2] = {&mEventExit, &mEventQueue};
         MultiLock multiLock(syncObjects, 2, false);
 
+        SocketPoller::sPollEvent events[SocketPoller::MAX_POLL_EVENTS];
         RemoteMessage msgReceived;
         uint32_t retryCount = 0;
         do 
@@ -56,109 +73,47 @@ bool ServerReceiveThread::runDispatcher(void)
             if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
             {
                 whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
-                NESocket::SocketAddress addrAccepted;
-                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted);
+                int count = mConnection.waitForConnectionEvents(events, SocketPoller::MAX_POLL_EVENTS, mWorker);
 
                 if (mConnection.isValid() == false)
                 {
                     TRACE_WARN("The server socket is not valid anymore, should quit receive thread!");
-                    if (NESocket::isSocketHandleValid(hSocket))
-                    {
-                        NESocket::socketClose(hSocket);
-                    }
-
                     whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
                 }
-                else if (hSocket == NESocket::FailedSocketHandle)
+                else if (count < 0)
                 {
-                    TRACE_WARN("Failed selecting server socket, going to retry [ %d ] times before restart.", (RETRY_COUNT - retryCount - 1));
+                    TRACE_WARN("Failed to wait server socket events, going to retry [ %d ] times before restart.", (RETRY_COUNT - retryCount - 1));
                     if (++retryCount >= RETRY_COUNT)
                     {
                         mConnectHandler.connectionFailure();
                         whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
                     }
                 }
-                else if ( hSocket != NESocket::InvalidSocketHandle )
+                else
                 {
                     retryCount = 0;
-
-                    SocketAccepted clientSocket;
-                    if (mConnection.isConnectionAccepted(hSocket) )
-                    {
-                        clientSocket = mConnection.getClientByHandle( hSocket );
-                        TRACE_DBG("Received connection event of socket [ %u ], client [ %s : %d ]"
-                                            , hSocket
-                                            , clientSocket.getAddress().getHostAddress().getString()
-                                            , clientSocket.getAddress().getHostPort());
-                    }
-                    else
+                    const SOCKETHANDLE hServer = mConnection.getSocketHandle();
+                    const SOCKETHANDLE hLocal  = mConnection.getLocalSocketHandle();
+                    for (int i = 0; i < count; ++ i)
                     {
-                        clientSocket = SocketAccepted(hSocket, addrAccepted);
-                        if ( mConnectHandler.canAcceptConnection(clientSocket)  )
+                        const SocketPoller::sPollEvent & entry = events[i];
+                        if (entry.peSocket == hServer)
                         {
-                            TRACE_DBG("Accepting new connection of socket [ %u ], client [ %s : %d ]"
-                                            , hSocket
-                                            , addrAccepted.getHostAddress().getString()
-                                            , addrAccepted.getHostPort());
-                            
-                            mConnection.acceptConnection(clientSocket);
+                            _acceptConnection(false);
                         }
-                        else if ( clientSocket.isAlive() )
+                        else if ((entry.peSocket == hLocal) && NESocket::isSocketHandleValid(hLocal))
                         {
-                            TRACE_WARN("Rejecting new connection of socket [ %u ], client [ %s : %d ]"
-                                            , hSocket
-                                            , addrAccepted.getHostAddress().getString()
-                                            , addrAccepted.getHostPort());
-                            
-                            mConnection.rejectConnection(clientSocket);
-                            clientSocket.closeSocket();
-                            continue;
+                            _acceptConnection(true);
                         }
-                        else
+                        else if (mConnection.isConnectionAccepted(entry.peSocket))
                         {
-                            TRACE_WARN( "The connection of socket [ %u ] is not alive anymore, client [ %s : %d ], ignore connection."
-                                        , hSocket
-                                        , addrAccepted.getHostAddress( ).getString( )
-                                        , addrAccepted.getHostPort( ) );
-                            mConnection.closeConnection( clientSocket );
-                            continue;
+                            _receiveMessages(entry.peSocket, msgReceived);
                         }
-                    }
-
-#if AREG_LOGS
-                    const NESocket::SocketAddress& addSocket = clientSocket.getAddress();
-#endif // AREG_LOGS
-                    int sizeReceived = mConnection.receiveMessage(msgReceived, clientSocket);
-                    if (sizeReceived > 0 )
-                    {
-                        if (mSaveDataReceive)
+                        else
                         {
-                            mBytesReceive += static_cast<uint32_t>(sizeReceived);
+                            TRACE_DBG("Ignoring event [ %u ] of not accepted socket [ %u ]", entry.peEvents, static_cast<unsigned int>(entry.peSocket));
                         }
-
-                        TRACE_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
-                                    , static_cast<id_type>(msgReceived.getMessageId())
-                                    , static_cast<id_type>(msgReceived.getSource())
-                                    , addSocket.getHostAddress().getString()
-                                    , addSocket.getHostPort());
-
-                        mRemoteService.processReceivedMessage(msgReceived, clientSocket);
                     }
-                    else
-                    {
-                        TRACE_DBG("Failed to receive message from client socket [ %s : %d ], socket [ %u ]. Going to close connection"
-                                        , addSocket.getHostAddress().getString()
-                                        , addSocket.getHostPort()
-                                        , clientSocket.getHandle());
-
-                        mRemoteService.failedReceiveMessage(clientSocket);
-                    }
-
-                    msgReceived.invalidate();
-                }
-                else
-                {
-                    OUTPUT_WARN("Client connection lost. Clean master list on next loop or close server socket!");
                 }
             }
             else
@@ -170,9 +125,101 @@ bool ServerReceiveThread::runDispatcher(void)
         } while (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue));
     }
 
+    mDecoders.clear();
     readyForEvents(false);
     removeAllEvents();
 
     TRACE_DBG("Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString());
     return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
 }
+
+void ServerReceiveThread::_acceptConnection( bool isLocal )
+{
+    TRACE_SCOPE( areg_extend_service_ServerReceiveThread__acceptConnection );
+
+    NESocket::SocketAddress addrAccepted;
+    SOCKETHANDLE hSocket = isLocal ? mConnection.acceptLocalConnection(addrAccepted) : mConnection.acceptNewConnection(addrAccepted);
+    if ( hSocket == NESocket::InvalidSocketHandle )
+    {
+        TRACE_WARN("Failed to accept new connection, ignoring event.");
+        return;
+    }
+
+    // The socket handle might be reused, drop the state of previous connection.
+    mDecoders.removeAt(hSocket);
+    SocketAccepted clientSocket(hSocket, addrAccepted);
+    if ( mConnectHandler.canAcceptConnection(clientSocket) && mConnection.acceptConnection(clientSocket) )
+    {
+        TRACE_DBG("Accepted new connection of socket [ %u ], client [ %s : %d ]"
+                        , hSocket
+                        , addrAccepted.getHostAddress().getString()
+                        , addrAccepted.getHostPort());
+    }
+    else if ( clientSocket.isAlive() )
+    {
+        TRACE_WARN("Rejecting new connection of socket [ %u ], client [ %s : %d ]"
+                        , hSocket
+                        , addrAccepted.getHostAddress().getString()
+                        , addrAccepted.getHostPort());
+
+        mConnection.rejectConnection(clientSocket);
+        clientSocket.closeSocket();
+    }
+    else
+    {
+        TRACE_WARN( "The connection of socket [ %u ] is not alive anymore, client [ %s : %d ], ignore connection."
+                    , hSocket
+                    , addrAccepted.getHostAddress( ).getString( )
+                    , addrAccepted.getHostPort( ) );
+        mConnection.closeConnection( clientSocket );
+    }
+}
+
+void ServerReceiveThread::_receiveMessages( SOCKETHANDLE hSocket, RemoteMessage & msgReceived )
+{
+    TRACE_SCOPE( areg_extend_service_ServerReceiveThread__receiveMessages );
+
+    SocketAccepted clientSocket = mConnection.getClientByHandle( hSocket );
+#if AREG_LOGS
+    const NESocket::SocketAddress& addSocket = clientSocket.getAddress();
+#endif // AREG_LOGS
+
+    // The socket is edge-triggered, read until there is no more data available.
+    // The partially received message remains in the decoder until next event.
+    RemoteMessageDecoder & decoder = mDecoders[hSocket];
+    bool failed{ false };
+    int sizeReceived{ 0 };
+    do
+    {
+        sizeReceived = decoder.readSocket(clientSocket);
+        if ((sizeReceived > 0) && mSaveDataReceive)
+        {
+            mBytesReceive += static_cast<uint32_t>(sizeReceived);
+        }
+
+        while (decoder.nextMessage(msgReceived))
+        {
+            TRACE_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
+                        , static_cast<id_type>(msgReceived.getMessageId())
+                        , static_cast<id_type>(msgReceived.getSource())
+                        , addSocket.getHostAddress().getString()
+                        , addSocket.getHostPort());
+
+            mRemoteService.processReceivedMessage(msgReceived, clientSocket);
+            msgReceived.invalidate();
+        }
+
+        failed = (sizeReceived < 0) || decoder.isFailed();
+    } while ((sizeReceived > 0) && (failed == false));
+
+    if ( failed )
+    {
+        TRACE_DBG("Failed to receive message from client socket [ %s : %d ], socket [ %u ]. Going to close connection"
+                        , addSocket.getHostAddress().getString()
+                        , addSocket.getHostPort()
+                        , clientSocket.getHandle());
+
+        mDecoders.removeAt(hSocket);
+        mRemoteService.failedReceiveMessage(clientSocket);
+    }
+}
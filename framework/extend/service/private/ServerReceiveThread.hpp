@@ -20,6 +20,8 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
 
 #include <atomic>
 
@@ -35,6 +37,9 @@ class ServerConnection;
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The IPC message receiving thread of server socket.
+ *          The server may have several receiving threads (workers). Each worker
+ *          waits for the events and receives messages of the clients it owns.
+ *          The first worker also accepts the connections of new clients.
  **/
 class ServerReceiveThread    : public    DispatcherThread
 {
@@ -50,8 +55,9 @@ public:
      * \param   connectHandler  The instance of server socket connect / disconnect handling interface
      * \param   remoteService   The instance of remote servicing handler
      * \param   connection      The instance of server connection object.
+     * \param   worker          The index of the worker. The worker with index 0 accepts new connections.
      **/
-    ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler& remoteService, ServerConnection & connection );
+    ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker = 0 );
     /**
      * \brief   Destructor
      **/
@@ -93,6 +99,27 @@ protected:
      **/
     virtual bool runDispatcher( void ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Accepts pending connection of the server socket. If connection
+     *          cannot be accepted, the connection is rejected and closed.
+     * \param   isLocal     If true, accepts the connection of the local socket.
+     **/
+    void _acceptConnection( bool isLocal );
+
+    /**
+     * \brief   Receives and processes all complete messages of the accepted socket.
+     *          Since accepted sockets are edge-triggered, the socket is drained
+     *          until there is no more data to read. The reading does not block,
+     *          the partially received message is kept by the decoder of connection.
+     * \param   hSocket     The socket handle of accepted connection.
+     * \param   msgReceived The message object to receive data.
+     **/
+    void _receiveMessages( SOCKETHANDLE hSocket, RemoteMessage & msgReceived );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -109,6 +136,10 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
+    /**
+     * \brief   The index of the worker.
+     **/
+    const uint32_t              mWorker;
     /**
      * \brief   Accumulative value of received data size.
      */
@@ -117,6 +148,10 @@ private:
      * \brief   Flag, indicating whether data calculation is enabled or disabled. By default, it is disabled.
      **/
     bool                        mSaveDataReceive;
+    /**
+     * \brief   The message decoders of accepted connections.
+     **/
+    TEMap<SOCKETHANDLE, RemoteMessageDecoder>   mDecoders;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
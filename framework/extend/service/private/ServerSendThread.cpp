@@ -14,6 +14,7 @@
  ************************************************************************/
 #include "extend/service/private/ServerSendThread.hpp"
 
+#include "areg/appbase/NEApplication.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
 #include "areg/ipc/IERemoteMessageHandler.hpp"
@@ -21,16 +22,117 @@
 #include "extend/service/ServerConnection.hpp"
 
 
+DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread_runDispatcher);
 DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread_processEvent);
+DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread__queueMessage);
+DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread__sendMessages);
+DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread__sendSharedMessage);
+DEF_TRACE_SCOPE(areg_extend_service_ServerSendThread__sendShared);
 
-ServerSendThread::ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection)
-    : DispatcherThread          ( NEConnection::SERVER_SEND_MESSAGE_THREAD )
+namespace
+{
+    //!< Returns the name of send thread of the worker.
+    inline String _workerThreadName( uint32_t worker )
+    {
+        String result( NEConnection::SERVER_SEND_MESSAGE_THREAD );
+        return (worker == 0 ? result : result + "_" + String::makeString( worker ));
+    }
+}
+
+ServerSendThread::ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker /*= 0*/)
+    : DispatcherThread          ( _workerThreadName( worker ) )
     , IESendMessageEventConsumer( )
     , mRemoteService            ( remoteService )
     , mConnection               ( connection )
+    , mWorker                   ( worker )
     , mBytesSend                ( 0 )
     , mSaveDataSend             ( false )
+    , mSendQueues               ( )
+    , mSharedQueues             ( )
+    , mSharedWritable           ( false )
+    , mWaitingSockets           ( )
+    , mWritePoller              ( )
+    , mQueueLimit               ( NEApplication::DEFAULT_SEND_QUEUE_SIZE )
+    , mQueueOverflow            ( eQueueOverflow::OverflowDropClient )
+{
+}
+
+void ServerSendThread::triggerExit( void )
+{
+    DispatcherThread::triggerExit( );
+    mWritePoller.interrupt( );
+}
+
+void ServerSendThread::notifySharedWritable( void )
 {
+    mSharedWritable.store( true );
+    mWritePoller.interrupt( );
+}
+
+bool ServerSendThread::runDispatcher( void )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSendThread_runDispatcher );
+
+    if ( mWritePoller.create( ) == false )
+    {
+        TRACE_WARN( "Failed to create the poller of writable sockets, the messages are sent in blocking mode" );
+    }
+
+    readyForEvents( true );
+
+    IESynchObject * syncObjects[2] = { &mEventExit, &mEventQueue };
+    MultiLock multiLock( syncObjects, 2, false );
+    SocketPoller::sPollEvent events[SocketPoller::MAX_POLL_EVENTS];
+    int whichEvent{ static_cast<int>(EventDispatcherBase::eEventOrder::EventError) };
+    uint32_t countEvents{ 0u };
+
+    do
+    {
+        // Queue the burst of messages and send them at once, but do not delay sending for too long.
+        const bool hasPending{ (mSendQueues.isEmpty( ) == false) || (mSharedQueues.isEmpty( ) == false) };
+        if ( hasPending && (countEvents >= SEND_BATCH_EVENTS) )
+        {
+            whichEvent = MultiLock::LOCK_INDEX_TIMEOUT;
+        }
+        else
+        {
+            whichEvent = multiLock.lock( hasPending ? NECommon::DO_NOT_WAIT : NECommon::WAIT_INFINITE, false );
+        }
+
+        if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            _sendQueuedMessages( events, countEvents >= SEND_BATCH_EVENTS ? NECommon::DO_NOT_WAIT : SEND_WAIT_TIMEOUT );
+            countEvents = 0u;
+            whichEvent  = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue);
+        }
+        else if ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) )
+        {
+            Event * eventElem = pickEvent( );
+            if ( isExitEvent( eventElem ) )
+            {
+                whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
+            }
+            else if ( eventElem != nullptr )
+            {
+                ++ countEvents;
+                if ( prepareDispatchEvent( eventElem ) )
+                {
+                    dispatchEvent( *eventElem );
+                }
+
+                postDispatchEvent( eventElem );
+            }
+        }
+
+    } while ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) );
+
+    _removeAllQueues( );
+    readyForEvents( false );
+    removeAllEvents( );
+    mWritePoller.release( );
+
+    TRACE_DBG( "Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString( ) );
+    return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
 }
 
 void ServerSendThread::readyForEvents( bool isReady )
@@ -44,8 +146,8 @@ void ServerSendThread::readyForEvents( bool isReady )
     {
         DispatcherThread::readyForEvents( false );
         SendMessageEvent::removeListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this) );
-        mConnection.closeAllConnections( );
-        mConnection.disableSend( );
+        // The other workers may still send messages to own clients, close only the connections of this worker.
+        mConnection.closeWorkerConnections( mWorker );
     }
 }
 
@@ -60,7 +162,7 @@ void ServerSendThread::processEvent( const SendMessageEventData & data )
         const ITEM_ID & target{ msgSend.getTarget() };
         SocketAccepted client{ mConnection.getClientByCookie(target) };
 
-        TRACE_DBG("Sending message [ %s ] (ID = [ %u ]) to client [ %s : %d ] of socket [ %u ]. The message sent from source [ %u ] to target [ %u ]"
+        TRACE_DBG("Queueing message [ %s ] (ID = [ %u ]) to client [ %s : %d ] of socket [ %u ]. The message sent from source [ %u ] to target [ %u ]"
                     , NEService::getString(static_cast<NEService::eFuncIdRange>(msgSend.getMessageId()))
                     , static_cast<unsigned int>(msgSend.getMessageId())
                     , client.getAddress().getHostAddress().getString()
@@ -69,36 +171,414 @@ void ServerSendThread::processEvent( const SendMessageEventData & data )
                     , static_cast<unsigned int>(msgSend.getSource())
                     , static_cast<unsigned int>(msgSend.getTarget()));
 
-        int sentBytes = 0;
-        if ((client.isAlive() == false) || ((sentBytes = mConnection.sendMessage(msgSend, client)) <= 0))
+        if (client.isAlive() == false)
         {
-            TRACE_WARN("Failed to send message [ %u ] to target [ %u ], client is [ %s ]"
+            TRACE_WARN("Failed to send message [ %u ] to target [ %u ], client is [ DEAD ]"
                         , msgSend.getMessageId()
-                        , static_cast<unsigned int>(msgSend.getTarget())
-                        , client.isAlive() ? "ALIVE" : "DEAD");
+                        , static_cast<unsigned int>(msgSend.getTarget()));
 
+            _removeQueue(target, client.getHandle());
+            mSharedQueues.removeAt(target);
             mRemoteService.failedSendMessage(msgSend, client);
         }
-        else
+        else if (_sendSharedMessage(msgSend, target, client, false) == false)
         {
-            if (mSaveDataSend)
+            _queueMessage(msgSend, target, client, false);
+        }
+    }
+    else if (data.isMulticastMessage())
+    {
+        const RemoteMessage & msgSend = data.getRemoteMessage( );
+        ASSERT( msgSend.isValid( ) );
+
+        for (const ITEM_ID & target : data.getTargets().getData())
+        {
+            SocketAccepted client{ mConnection.getClientByCookie(target) };
+            if (client.isAlive())
             {
-                mBytesSend += sentBytes;
+                if (_sendSharedMessage(msgSend, target, client, true) == false)
+                {
+                    _queueMessage(msgSend, target, client, true);
+                }
             }
+            else
+            {
+                TRACE_WARN("Failed to send message [ %u ] to target [ %u ], client is [ DEAD ]"
+                            , msgSend.getMessageId()
+                            , static_cast<unsigned int>(target));
 
-            TRACE_DBG("Succeeded to send message [ %u ] to target [ %p ]", msgSend.getMessageId(), static_cast<id_type>(msgSend.getTarget()));
+                _removeQueue(target, client.getHandle());
+                mSharedQueues.removeAt(target);
+                mRemoteService.failedSendMessage(msgSend, client);
+            }
         }
     }
     else if (data.isExitThreadMessage() )
     {
         TRACE_DBG("Going to quite send message thread");
-        mConnection.closeAllConnections( );
-        mConnection.closeSocket( );
+        // The server socket is closed by the service when all workers complete.
+        _flushAllQueues( );
+        mConnection.closeWorkerConnections( mWorker );
         triggerExit( );
     }
 }
 
 bool ServerSendThread::postEvent(Event & eventElem)
 {
-    return (RUNTIME_CAST(&eventElem, SendMessageEvent) != nullptr) && EventDispatcher::postEvent(eventElem);
+    bool result{ (RUNTIME_CAST(&eventElem, SendMessageEvent) != nullptr) && EventDispatcher::postEvent(eventElem) };
+    if ( result )
+    {
+        // wake up if waiting for writable sockets.
+        mWritePoller.interrupt( );
+    }
+
+    return result;
+}
+
+void ServerSendThread::_queueMessage( const RemoteMessage & msgSend, const ITEM_ID & target, const SocketAccepted & client, bool isShared )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSendThread__queueMessage );
+
+    const ITEM_ID & cookie{ target };
+    const SOCKETHANDLE hSocket{ client.getHandle( ) };
+    RemoteMessageQueue & queue = mSendQueues[cookie];
+    if ( isShared )
+    {
+        queue.pushShared( msgSend, target );
+    }
+    else
+    {
+        queue.pushMessage( msgSend );
+    }
+
+    auto pos = mWaitingSockets.find( hSocket );
+    if ( mWaitingSockets.isValidPosition( pos ) && (mWaitingSockets.valueAtPosition( pos ) != cookie) )
+    {
+        // The socket handle is reused by new connection, the previous client is disconnected.
+        _removeQueue( mWaitingSockets.valueAtPosition( pos ), hSocket );
+        pos = mWaitingSockets.invalidPosition( );
+    }
+
+    if ( mWaitingSockets.isValidPosition( pos ) == false )
+    {
+        // The socket is reported writable on next wait, so that the burst of messages is sent at once.
+        if ( mWritePoller.addSocket( hSocket, static_cast<uint32_t>(SocketPoller::ePollEvent::PollWrite), false ) )
+        {
+            mWaitingSockets.setAt( hSocket, cookie );
+        }
+        else
+        {
+            // There is no poller, send in blocking mode.
+            _flushMessages( cookie, client );
+            return;
+        }
+    }
+
+    if ( (mQueueLimit != 0u) && (queue.getQueuedBytes( ) > mQueueLimit) )
+    {
+        TRACE_WARN( "The queued data [ %u ] bytes of client [ %s : %d ] exceeds the limit [ %u ] bytes, the client is [ %s ]"
+                    , queue.getQueuedBytes( )
+                    , client.getAddress( ).getHostAddress( ).getString( )
+                    , client.getAddress( ).getHostPort( )
+                    , mQueueLimit
+                    , mQueueOverflow == eQueueOverflow::OverflowDropClient ? "DROPPED" : "BLOCKED" );
+
+        if ( mQueueOverflow == eQueueOverflow::OverflowBlockSend )
+        {
+            _flushMessages( cookie, client );
+        }
+        else
+        {
+            RemoteMessage msgFailed{ queue.firstMessage( ) };
+            _removeQueue( cookie, hSocket );
+            mRemoteService.failedSendMessage( msgFailed, const_cast<SocketAccepted &>(client) );
+        }
+    }
+}
+
+bool ServerSendThread::_sendSharedMessage( const RemoteMessage & msgSend, const ITEM_ID & target, const SocketAccepted & client, bool isShared )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSendThread__sendSharedMessage );
+
+    // The queue of a client remains until it is sent, even if the slot is freed meanwhile, then the sending fails.
+    const bool isQueued{ mSharedQueues.contains( target ) };
+    const bool result{ isQueued || mConnection.isSharedMemoryClient( target ) };
+    if ( result == false )
+    {
+        return false;   // the client is not bound with shared memory, send via socket.
+    }
+
+    if ( isQueued == false )
+    {
+        // The client reads the socket before the shared memory, the messages queued before binding are sent first.
+        _flushMessages( target, client );
+    }
+
+    RemoteMessageQueue & queue = mSharedQueues[target];
+    if ( isShared )
+    {
+        queue.pushShared( msgSend, target );
+    }
+    else
+    {
+        queue.pushMessage( msgSend );
+    }
+
+    if ( mWritePoller.isValid( ) == false )
+    {
+        // There is no poller to wake up when the client reads data, send in blocking mode.
+        _flushShared( target, client );
+    }
+    else if ( _sendShared( target, queue ) )
+    {
+        auto pos = mSharedQueues.find( target );
+        if ( mSharedQueues.isValidPosition( pos ) && (mQueueLimit != 0u) && (mSharedQueues.valueAtPosition( pos ).getQueuedBytes( ) > mQueueLimit) )
+        {
+            RemoteMessageQueue & pending = mSharedQueues.valueAtPosition( pos );
+            TRACE_WARN( "The data [ %u ] bytes queued to shared memory of client [ %s : %d ] exceeds the limit [ %u ] bytes, the client is [ %s ]"
+                        , pending.getQueuedBytes( )
+                        , client.getAddress( ).getHostAddress( ).getString( )
+                        , client.getAddress( ).getHostPort( )
+                        , mQueueLimit
+                        , mQueueOverflow == eQueueOverflow::OverflowDropClient ? "DROPPED" : "BLOCKED" );
+
+            if ( mQueueOverflow == eQueueOverflow::OverflowBlockSend )
+            {
+                _flushShared( target, client );
+            }
+            else
+            {
+                RemoteMessage msgFailed{ pending.firstMessage( ) };
+                mSharedQueues.removePosition( pos );
+                mRemoteService.failedSendMessage( msgFailed, const_cast<SocketAccepted &>(client) );
+            }
+        }
+    }
+
+    return result;
+}
+
+void ServerSendThread::_sendSharedQueues( void )
+{
+    for ( auto pos = mSharedQueues.firstPosition( ); mSharedQueues.isValidPosition( pos ); )
+    {
+        const ITEM_ID cookie{ mSharedQueues.keyAtPosition( pos ) };
+        RemoteMessageQueue & queue = mSharedQueues.valueAtPosition( pos );
+        pos = mSharedQueues.nextPosition( pos );
+        _sendShared( cookie, queue );
+    }
+}
+
+bool ServerSendThread::_sendShared( const ITEM_ID & cookie, RemoteMessageQueue & queue )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSendThread__sendShared );
+
+    int sentBytes = mConnection.sendSharedMessages( queue, cookie );
+    if ( sentBytes < 0 )
+    {
+        SocketAccepted client{ mConnection.getClientByCookie( cookie ) };
+        TRACE_WARN( "Failed to send [ %u ] messages to target [ %u ] via shared memory, client is [ %s ]"
+                    , queue.getSize( )
+                    , static_cast<unsigned int>(cookie)
+                    , client.isAlive( ) ? "ALIVE" : "DEAD" );
+
+        RemoteMessage msgFailed{ queue.firstMessage( ) };
+        mSharedQueues.removeAt( cookie );
+        mRemoteService.failedSendMessage( msgFailed, client );
+        return false;
+    }
+
+    if ( mSaveDataSend )
+    {
+        mBytesSend += static_cast<uint32_t>(sentBytes);
+    }
+
+    TRACE_DBG( "Sent [ %d ] bytes to target [ %p ] via shared memory, remain [ %u ] messages", sentBytes, static_cast<id_type>(cookie), queue.getSize( ) );
+    if ( queue.isEmpty( ) )
+    {
+        mSharedQueues.removeAt( cookie );
+    }
+
+    return true;
+}
+
+void ServerSendThread::_flushShared( const ITEM_ID & cookie, const SocketAccepted & client )
+{
+    auto pos = mSharedQueues.find( cookie );
+    if ( mSharedQueues.isValidPosition( pos ) )
+    {
+        RemoteMessageQueue & queue = mSharedQueues.valueAtPosition( pos );
+        RemoteMessage msgFailed{ queue.firstMessage( ) };
+        int sentBytes = mConnection.flushSharedMessages( queue, cookie );
+        mSharedQueues.removePosition( pos );
+
+        if ( sentBytes < 0 )
+        {
+            mRemoteService.failedSendMessage( msgFailed, const_cast<SocketAccepted &>(client) );
+        }
+        else if ( mSaveDataSend )
+        {
+            mBytesSend += static_cast<uint32_t>(sentBytes);
+        }
+    }
+}
+
+void ServerSendThread::_sendQueuedMessages( SocketPoller::sPollEvent * events, unsigned int msTimeout )
+{
+    int count = mWritePoller.waitEvents( events, SocketPoller::MAX_POLL_EVENTS, msTimeout );
+    if ( mSharedWritable.exchange( false ) )
+    {
+        _sendSharedQueues( );
+    }
+
+    for ( int i = 0; i < count; ++ i )
+    {
+        auto pos = mWaitingSockets.find( events[i].peSocket );
+        if ( mWaitingSockets.isValidPosition( pos ) )
+        {
+            const ITEM_ID cookie{ mWaitingSockets.valueAtPosition( pos ) };
+            auto posQueue = mSendQueues.find( cookie );
+            if ( mSendQueues.isValidPosition( posQueue ) )
+            {
+                _sendMessages( cookie, mSendQueues.valueAtPosition( posQueue ) );
+            }
+            else
+            {
+                _removeQueue( cookie, events[i].peSocket );
+            }
+        }
+    }
+
+    if ( count < 0 )
+    {
+        // Some sockets could be closed, remove the queues of disconnected clients.
+        for ( auto pos = mSendQueues.firstPosition( ); mSendQueues.isValidPosition( pos ); )
+        {
+            const ITEM_ID cookie{ mSendQueues.keyAtPosition( pos ) };
+            pos = mSendQueues.nextPosition( pos );
+            if ( mConnection.getClientByCookie( cookie ).isValid( ) == false )
+            {
+                _removeQueue( cookie, NESocket::InvalidSocketHandle );
+            }
+        }
+    }
+}
+
+bool ServerSendThread::_sendMessages( const ITEM_ID & cookie, RemoteMessageQueue & queue )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSendThread__sendMessages );
+
+    SocketAccepted client{ mConnection.getClientByCookie( cookie ) };
+    int sentBytes = client.isAlive( ) ? queue.sendMessages( client ) : -1;
+    if ( sentBytes < 0 )
+    {
+        TRACE_WARN( "Failed to send [ %u ] messages to target [ %u ], client is [ %s ]"
+                    , queue.getSize( )
+                    , static_cast<unsigned int>(cookie)
+                    , client.isAlive( ) ? "ALIVE" : "DEAD" );
+
+        RemoteMessage msgFailed{ queue.firstMessage( ) };
+        _removeQueue( cookie, client.getHandle( ) );
+        mRemoteService.failedSendMessage( msgFailed, client );
+        return false;
+    }
+
+    if ( mSaveDataSend )
+    {
+        mBytesSend += static_cast<uint32_t>(sentBytes);
+    }
+
+    TRACE_DBG( "Sent [ %d ] bytes to target [ %p ], remain [ %u ] messages", sentBytes, static_cast<id_type>(cookie), queue.getSize( ) );
+    if ( queue.isEmpty( ) )
+    {
+        _removeQueue( cookie, client.getHandle( ) );
+    }
+
+    return true;
+}
+
+void ServerSendThread::_flushMessages( const ITEM_ID & cookie, const SocketAccepted & client )
+{
+    auto pos = mSendQueues.find( cookie );
+    if ( mSendQueues.isValidPosition( pos ) )
+    {
+        RemoteMessageQueue & queue = mSendQueues.valueAtPosition( pos );
+        RemoteMessage msgFailed{ queue.firstMessage( ) };
+        int sentBytes = queue.flushMessages( client );
+        _removeQueue( cookie, client.getHandle( ) );
+
+        if ( sentBytes < 0 )
+        {
+            mRemoteService.failedSendMessage( msgFailed, const_cast<SocketAccepted &>(client) );
+        }
+        else if ( mSaveDataSend )
+        {
+            mBytesSend += static_cast<uint32_t>(sentBytes);
+        }
+    }
+}
+
+void ServerSendThread::_removeQueue( const ITEM_ID & cookie, SOCKETHANDLE hSocket )
+{
+    auto pos = mWaitingSockets.find( hSocket );
+    if ( (mWaitingSockets.isValidPosition( pos ) == false) || (mWaitingSockets.valueAtPosition( pos ) != cookie) )
+    {
+        // The socket of the client is unknown, search by the cookie.
+        for ( pos = mWaitingSockets.firstPosition( ); mWaitingSockets.isValidPosition( pos ); pos = mWaitingSockets.nextPosition( pos ) )
+        {
+            if ( mWaitingSockets.valueAtPosition( pos ) == cookie )
+                break;
+        }
+    }
+
+    if ( mWaitingSockets.isValidPosition( pos ) )
+    {
+        mWritePoller.removeSocket( mWaitingSockets.keyAtPosition( pos ) );
+        mWaitingSockets.removePosition( pos );
+    }
+
+    mSendQueues.removeAt( cookie );
+}
+
+void ServerSendThread::_flushAllQueues( void )
+{
+    while ( mSharedQueues.isEmpty( ) == false )
+    {
+        const ITEM_ID cookie{ mSharedQueues.keyAtPosition( mSharedQueues.firstPosition( ) ) };
+        SocketAccepted client{ mConnection.getClientByCookie( cookie ) };
+        if ( client.isAlive( ) )
+        {
+            _flushShared( cookie, client );
+        }
+        else
+        {
+            mSharedQueues.removeAt( cookie );
+        }
+    }
+
+    while ( mSendQueues.isEmpty( ) == false )
+    {
+        const ITEM_ID cookie{ mSendQueues.keyAtPosition( mSendQueues.firstPosition( ) ) };
+        SocketAccepted client{ mConnection.getClientByCookie( cookie ) };
+        if ( client.isAlive( ) )
+        {
+            _flushMessages( cookie, client );
+        }
+        else
+        {
+            _removeQueue( cookie, client.getHandle( ) );
+        }
+    }
+}
+
+void ServerSendThread::_removeAllQueues( void )
+{
+    for ( auto pos = mWaitingSockets.firstPosition( ); mWaitingSockets.isValidPosition( pos ); pos = mWaitingSockets.nextPosition( pos ) )
+    {
+        mWritePoller.removeSocket( mWaitingSockets.keyAtPosition( pos ) );
+    }
+
+    mWaitingSockets.clear( );
+    mSendQueues.clear( );
+    mSharedQueues.clear( );
 }
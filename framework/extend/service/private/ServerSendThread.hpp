@@ -19,7 +19,10 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/SocketPoller.hpp"
+#include "areg/base/TEMap.hpp"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/ipc/RemoteMessageQueue.hpp"
 #include "areg/ipc/SendMessageEvent.hpp"
 
 #include <atomic>
@@ -29,16 +32,52 @@
  ************************************************************************/
 class IERemoteMessageHandler;
 class ServerConnection;
+class SocketAccepted;
 
 //////////////////////////////////////////////////////////////////////////
 // ServerSendThread class declaration.
 //////////////////////////////////////////////////////////////////////////
 /**
- * \brief   The IPC message sender thread
+ * \brief   The IPC message sender thread. Every accepted connection has
+ *          own queue of outgoing messages. The queued messages are sent without
+ *          blocking, several messages at once, and the rest is sent when the
+ *          socket is writable again. So that a slow client does not block
+ *          sending messages to other clients. The server may have several
+ *          sending threads (workers), each sends messages to the clients it owns.
+ *          The messages to the clients bound with the shared memory are queued
+ *          as well, only the data, which fits the ring of the slot, is written and
+ *          the rest is written when the shared memory thread notifies that the
+ *          client has read data.
  **/
 class ServerSendThread  : public    DispatcherThread
                         , public    IESendMessageEventConsumer
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   ServerSendThread::eQueueOverflow
+     *          Defines the action when the queued data of a client exceeds the limit.
+     **/
+    typedef enum class E_QueueOverflow
+    {
+          OverflowDropClient    //!< Close the connection of slow client.
+        , OverflowBlockSend     //!< Block and send all queued data of the client.
+    } eQueueOverflow;
+
+private:
+    /**
+     * \brief   The maximum number of messages to queue before sending data.
+     **/
+    static constexpr uint32_t   SEND_BATCH_EVENTS   { 64 };
+
+    /**
+     * \brief   The timeout to wait for writable sockets. The wait is interrupted
+     *          when a new message is queued or the thread exits.
+     **/
+    static constexpr unsigned int   SEND_WAIT_TIMEOUT   { NECommon::WAIT_INFINITE };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -47,8 +86,10 @@ public:
      * \brief   Initializes connection servicing handler and server connection objects.
      * \param   remoteService   The instance of remote servicing handle to set.
      * \param   connection      The instance of server socket connection object.
+     * \param   worker          The index of the worker, which owns the connections of clients.
+     *                          Used as well to make the name of the thread unique.
      **/
-    ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection );
+    ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker = 0 );
 
     /**
      * \brief   Destructor
@@ -77,11 +118,44 @@ public:
      **/
     inline bool isCalculateDataEnabled(void) const;
 
+    /**
+     * \brief   Sets the limit in bytes of data queued to send to a single client
+     *          and the action when the limit is exceeded.
+     * \param   queueLimit  The limit of queued data in bytes. Zero means there is no limit.
+     * \param   overflow    The action when the queued data exceeds the limit.
+     **/
+    inline void setSendQueueLimit( uint32_t queueLimit, ServerSendThread::eQueueOverflow overflow = ServerSendThread::eQueueOverflow::OverflowDropClient );
+
+    /**
+     * \brief   Called by the shared memory thread when a client has read data from the ring
+     *          the worker waits to write, or a slot is freed. Wakes up the worker to continue
+     *          sending the queued messages via shared memory. The call is thread safe.
+     **/
+    void notifySharedWritable( void );
+
+/************************************************************************/
+// Thread overrides
+/************************************************************************/
+
+    /**
+     * \brief   Sets exit event in the queue and interrupts waiting for writable sockets.
+     **/
+    virtual void triggerExit( void ) override;
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
 /************************************************************************/
 
+    /**
+     * \brief	Triggered when dispatcher starts running.
+     *          In this function runs main dispatching loop.
+     *          The events are dispatched and queued messages are sent
+     *          when the sockets are writable.
+     * \return	Returns true if Exit Event is signaled.
+     **/
+    virtual bool runDispatcher( void ) override;
+
     /**
      * \brief   Call to enable or disable event dispatching threads to receive events.
      *          Override if need to make event dispatching preparation job.
@@ -117,6 +191,93 @@ private:
      **/
     virtual void processEvent( const SendMessageEventData & data ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Queues the message to send to the client. If the queued data exceeds the limit,
+     *          either closes the client connection or blocks until the data is sent.
+     * \param   msgSend     The message to send.
+     * \param   target      The cookie of the client, which is the target of the message.
+     * \param   client      The accepted client socket, which is the target of the message.
+     * \param   isShared    If true, the message is shared with other targets and is not modified.
+     **/
+    void _queueMessage( const RemoteMessage & msgSend, const ITEM_ID & target, const SocketAccepted & client, bool isShared );
+
+    /**
+     * \brief   Queues and sends the message via shared memory without blocking, if the client is bound
+     *          with the slot of shared memory. The messages queued to send via socket are sent first
+     *          to keep the order of messages. If the queued data exceeds the limit, either closes
+     *          the client connection or blocks until the data is sent.
+     * \param   msgSend     The message to send.
+     * \param   target      The cookie of the client, which is the target of the message.
+     * \param   client      The accepted client socket, which is the target of the message.
+     * \param   isShared    If true, the message is shared with other targets and is not modified.
+     * \return  Returns true if the message is processed. Returns false if the message should be sent via socket.
+     **/
+    bool _sendSharedMessage( const RemoteMessage & msgSend, const ITEM_ID & target, const SocketAccepted & client, bool isShared );
+
+    /**
+     * \brief   Sends the queued messages of all clients bound with the shared memory without blocking.
+     **/
+    void _sendSharedQueues( void );
+
+    /**
+     * \brief   Sends the queued messages of the client via shared memory without blocking.
+     * \param   cookie      The cookie of the client.
+     * \param   queue       The queue of messages of the client.
+     * \return  Returns true if succeeded. Returns false if failed and the queue is removed.
+     **/
+    bool _sendShared( const ITEM_ID & cookie, RemoteMessageQueue & queue );
+
+    /**
+     * \brief   Sends all messages queued to the client via shared memory in blocking mode and removes the queue.
+     * \param   cookie      The cookie of the client.
+     * \param   client      The accepted client socket.
+     **/
+    void _flushShared( const ITEM_ID & cookie, const SocketAccepted & client );
+
+    /**
+     * \brief   Waits for writable sockets and sends the queued messages.
+     * \param   events      The list of events to use to wait for writable sockets.
+     * \param   msTimeout   The timeout in milliseconds to wait for writable sockets.
+     **/
+    void _sendQueuedMessages( SocketPoller::sPollEvent * events, unsigned int msTimeout );
+
+    /**
+     * \brief   Sends the queued messages of the client without blocking.
+     * \param   cookie      The cookie of the client.
+     * \param   queue       The queue of messages of the client.
+     * \return  Returns true if succeeded. Returns false if failed and the queue is removed.
+     **/
+    bool _sendMessages( const ITEM_ID & cookie, RemoteMessageQueue & queue );
+
+    /**
+     * \brief   Sends all queued messages of the client in blocking mode and removes the queue.
+     * \param   cookie      The cookie of the client.
+     * \param   client      The accepted client socket.
+     **/
+    void _flushMessages( const ITEM_ID & cookie, const SocketAccepted & client );
+
+    /**
+     * \brief   Removes the queue of the client and stops waiting for writable socket.
+     * \param   cookie      The cookie of the client.
+     * \param   hSocket     The socket handle of the client, if known.
+     **/
+    void _removeQueue( const ITEM_ID & cookie, SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Removes the queues of all clients.
+     **/
+    void _removeAllQueues( void );
+
+    /**
+     * \brief   Sends all queued messages of all clients in blocking mode and removes the queues.
+     *          Called before the worker closes the connections it owns.
+     **/
+    void _flushAllQueues( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -129,6 +290,10 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
+    /**
+     * \brief   The index of the worker, which owns the connections of the clients to send messages.
+     **/
+    const uint32_t              mWorker;
     /**
      * \brief   Accumulative value of sent data size.
      **/
@@ -137,6 +302,36 @@ private:
      * \brief   Flag, indicating whether should calculate send data size or not. By default it does not compute.
      **/
     bool                        mSaveDataSend;
+    /**
+     * \brief   The queues of messages to send, where the keys are the client cookies.
+     *          Only the queues, which have messages to send, are in the map.
+     **/
+    TEMap<ITEM_ID, RemoteMessageQueue>  mSendQueues;
+    /**
+     * \brief   The queues of messages to send via shared memory, where the keys are the client cookies.
+     *          Only the queues, which have messages to send, are in the map.
+     **/
+    TEMap<ITEM_ID, RemoteMessageQueue>  mSharedQueues;
+    /**
+     * \brief   The flag, indicating that the clients have read data from the rings of shared memory.
+     **/
+    std::atomic_bool                    mSharedWritable;
+    /**
+     * \brief   The client cookies, where the keys are the sockets waiting to be writable.
+     **/
+    TEMap<SOCKETHANDLE, ITEM_ID>        mWaitingSockets;
+    /**
+     * \brief   The poller to wait for writable sockets.
+     **/
+    SocketPoller                        mWritePoller;
+    /**
+     * \brief   The limit in bytes of data queued to send to a single client. Zero means no limit.
+     **/
+    uint32_t                            mQueueLimit;
+    /**
+     * \brief   The action when the queued data of a client exceeds the limit.
+     **/
+    eQueueOverflow                      mQueueOverflow;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -169,4 +364,10 @@ inline bool ServerSendThread::isCalculateDataEnabled(void) const
     return mSaveDataSend;
 }
 
+inline void ServerSendThread::setSendQueueLimit( uint32_t queueLimit, ServerSendThread::eQueueOverflow overflow /*= ServerSendThread::eQueueOverflow::OverflowDropClient*/ )
+{
+    mQueueLimit     = queueLimit;
+    mQueueOverflow  = overflow;
+}
+
 #endif  // AREG_EXTEND_SERVICE_PRIVATE_SERVERSENDTHREAD_HPP
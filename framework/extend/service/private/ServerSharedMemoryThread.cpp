@@ -0,0 +1,214 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        extend/service/private/ServerSharedMemoryThread.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Service connectivity server thread to bind
+ *              the slots of the shared memory and receive messages.
+ ************************************************************************/
+#include "extend/service/private/ServerSharedMemoryThread.hpp"
+
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/private/NEConnection.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
+#include "areg/ipc/IERemoteMessageHandler.hpp"
+#include "areg/trace/GETrace.h"
+
+#include "extend/service/ServerConnection.hpp"
+#include "extend/service/private/ServerSendThread.hpp"
+
+
+DEF_TRACE_SCOPE(areg_extend_service_ServerSharedMemoryThread_runDispatcher);
+DEF_TRACE_SCOPE(areg_extend_service_ServerSharedMemoryThread__receiveMessages);
+
+ServerSharedMemoryThread::ServerSharedMemoryThread( IERemoteMessageHandler & remoteService, ServerConnection & connection, const DataRateHelper::SendThreads & sendWorkers )
+    : DispatcherThread  ( NEConnection::SERVER_SHARED_MEMORY_THREAD )
+    , mRemoteService    ( remoteService )
+    , mConnection       ( connection )
+    , mSendWorkers      ( sendWorkers )
+    , mDecoders         ( )
+{
+}
+
+void ServerSharedMemoryThread::triggerExit( void )
+{
+    DispatcherThread::triggerExit( );
+    mConnection.getSharedMemory( ).interrupt( );
+}
+
+bool ServerSharedMemoryThread::runDispatcher( void )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSharedMemoryThread_runDispatcher );
+    TRACE_DBG( "Starting dispatcher [ %s ]", getName( ).getString( ) );
+
+    readyForEvents( true );
+
+    SharedMemoryServer & sharedMemory{ mConnection.getSharedMemory( ) };
+    IESynchObject * syncObjects[2] = { &mEventExit, &mEventQueue };
+    MultiLock multiLock( syncObjects, 2, false );
+    RemoteMessage msgReceived;
+    int whichEvent{ static_cast<int>(EventDispatcherBase::eEventOrder::EventError) };
+    bool checkProcess{ false };
+
+    do
+    {
+        whichEvent = multiLock.lock( NECommon::DO_NOT_WAIT, false );
+        if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
+        {
+            whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
+
+            // The doorbell is taken before checking the slots, so that no change is missed.
+            const uint32_t doorbell{ sharedMemory.getDoorbell( ) };
+            const bool pending{ _processSlots( msgReceived, checkProcess ) };
+
+            uint32_t spin{ 0u };
+            while ( (++ spin < NESharedMemory::SPIN_COUNT) && (sharedMemory.getDoorbell( ) == doorbell) )
+                ;
+
+            sharedMemory.waitEvents( doorbell, pending ? BIND_RETRY_TIMEOUT : NESharedMemory::WAIT_SLICE );
+            // If nothing happened, check whether the processes of clients are still alive.
+            checkProcess = (sharedMemory.getDoorbell( ) == doorbell);
+        }
+        else
+        {
+            Event * eventElem = whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) ? pickEvent( ) : nullptr;
+            whichEvent = isExitEvent( eventElem ) ? static_cast<int>(EventDispatcherBase::eEventOrder::EventExit) : whichEvent;
+        }
+
+    } while ( whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) );
+
+    mDecoders.clear( );
+    readyForEvents( false );
+    removeAllEvents( );
+
+    TRACE_DBG( "Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString( ) );
+    return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
+}
+
+bool ServerSharedMemoryThread::_processSlots( RemoteMessage & msgReceived, bool checkProcess )
+{
+    SharedMemoryServer & sharedMemory{ mConnection.getSharedMemory( ) };
+    NESocket::SocketAddress address;
+    bool result{ false };
+
+    for ( uint32_t slot = 0; slot < NESharedMemory::SLOT_COUNT; ++ slot )
+    {
+        switch ( sharedMemory.getSlotState( slot ) )
+        {
+        case NESharedMemory::eSlotState::SlotClaimed:
+            if ( mConnection.bindSharedMemory( slot ) == false )
+            {
+                if ( checkProcess && sharedMemory.getClaimedAddress( slot, address ) && (sharedMemory.isSlotProcessAlive( slot ) == false) )
+                {
+                    _freeSlot( slot );
+                }
+                else
+                {
+                    // The connection of the client might be not accepted yet.
+                    result = true;
+                }
+            }
+            break;
+
+        case NESharedMemory::eSlotState::SlotBound:
+            if ( checkProcess && (sharedMemory.isSlotProcessAlive( slot ) == false) )
+            {
+                // The socket of exited client is closed as well, the connection is closed by the receive thread.
+                _freeSlot( slot );
+            }
+            else
+            {
+                _receiveMessages( slot, msgReceived );
+                _resumeSending( slot );
+            }
+            break;
+
+        case NESharedMemory::eSlotState::SlotServerClosed:
+            if ( checkProcess && (sharedMemory.isSlotProcessAlive( slot ) == false) )
+            {
+                _freeSlot( slot );
+            }
+            break;
+
+        case NESharedMemory::eSlotState::SlotClientClosed:
+            _freeSlot( slot );
+            break;
+
+        case NESharedMemory::eSlotState::SlotFree:
+        default:
+            break;
+        }
+    }
+
+    return result;
+}
+
+void ServerSharedMemoryThread::_receiveMessages( uint32_t slot, RemoteMessage & msgReceived )
+{
+    TRACE_SCOPE( areg_extend_service_ServerSharedMemoryThread__receiveMessages );
+
+    SharedMemoryServer & sharedMemory{ mConnection.getSharedMemory( ) };
+    SocketAccepted clientSocket{ mConnection.getClientBySlot( slot ) };
+    RemoteMessageDecoder & decoder = mDecoders[slot];
+    bool failed{ false };
+    int sizeReceived{ 0 };
+
+    do
+    {
+        sizeReceived = sharedMemory.readSlot( slot, decoder );
+        while ( decoder.nextMessage( msgReceived ) )
+        {
+            TRACE_DBG( "Received message [ %p ] from source [ %p ] via shared memory slot [ %u ]"
+                        , static_cast<id_type>(msgReceived.getMessageId( ))
+                        , static_cast<id_type>(msgReceived.getSource( ))
+                        , slot );
+
+            mRemoteService.processReceivedMessage( msgReceived, clientSocket );
+            msgReceived.invalidate( );
+        }
+
+        failed = (sizeReceived < 0) || decoder.isFailed( );
+    } while ( (sizeReceived > 0) && (failed == false) );
+
+    if ( failed )
+    {
+        TRACE_WARN( "Failed to receive message via shared memory slot [ %u ], socket [ %u ]. Going to close connection"
+                        , slot
+                        , static_cast<uint32_t>(clientSocket.getHandle( )) );
+
+        mDecoders.removeAt( slot );
+        mRemoteService.failedReceiveMessage( clientSocket );
+    }
+}
+
+void ServerSharedMemoryThread::_resumeSending( uint32_t slot )
+{
+    if ( mConnection.getSharedMemory( ).checkWritable( slot ) )
+    {
+        SocketAccepted clientSocket{ mConnection.getClientBySlot( slot ) };
+        if ( clientSocket.isValid( ) )
+        {
+            mSendWorkers[mConnection.getWorker( mConnection.getCookie( clientSocket ) )]->notifySharedWritable( );
+        }
+    }
+}
+
+void ServerSharedMemoryThread::_freeSlot( uint32_t slot )
+{
+    mDecoders.removeAt( slot );
+    mConnection.freeSharedMemory( slot );
+
+    // The slot is not bound with the client anymore, the worker cannot be found by the slot.
+    for ( ServerSendThread * worker : mSendWorkers.getData( ) )
+    {
+        worker->notifySharedWritable( );
+    }
+}
@@ -0,0 +1,150 @@
+#ifndef AREG_EXTEND_SERVICE_PRIVATE_SERVERSHAREDMEMORYTHREAD_HPP
+#define AREG_EXTEND_SERVICE_PRIVATE_SERVERSHAREDMEMORYTHREAD_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        extend/service/private/ServerSharedMemoryThread.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Service connectivity server thread to bind
+ *              the slots of the shared memory and receive messages.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/base/TEMap.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+#include "extend/service/DataRateHelper.hpp"
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class IERemoteMessageHandler;
+class ServerConnection;
+
+//////////////////////////////////////////////////////////////////////////
+// ServerSharedMemoryThread class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The thread of the server, which binds the slots of the shared memory
+ *          claimed by the clients with the accepted connections, receives messages
+ *          sent via shared memory and frees the slots of disconnected clients.
+ *          The thread sleeps on the doorbell of the shared memory and wakes up
+ *          the send workers, which wait until the clients read the sent data.
+ **/
+class ServerSharedMemoryThread  : public    DispatcherThread
+{
+    //!< The timeout in milliseconds to retry binding the claimed slot, if the connection is not accepted yet.
+    static constexpr unsigned int   BIND_RETRY_TIMEOUT  { 10u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the remote servicing handler and the connection objects.
+     * \param   remoteService   The instance of remote servicing handler
+     * \param   connection      The instance of server connection object.
+     * \param   sendWorkers     The send threads of all workers, which are created once.
+     **/
+    ServerSharedMemoryThread( IERemoteMessageHandler & remoteService, ServerConnection & connection, const DataRateHelper::SendThreads & sendWorkers );
+    /**
+     * \brief   Destructor
+     **/
+    virtual ~ServerSharedMemoryThread( void ) = default;
+
+/************************************************************************/
+// Actions and attributes.
+/************************************************************************/
+public:
+    /**
+     * \brief   Sets exit event in the queue and wakes up the thread waiting on the doorbell.
+     **/
+    virtual void triggerExit( void ) override;
+
+protected:
+/************************************************************************/
+// DispatcherThread overrides
+/************************************************************************/
+
+    /**
+     * \brief	Triggered when dispatcher starts running.
+     *          In this function runs main dispatching loop.
+     *          Events are picked and dispatched here.
+     *          Override if logic should be changed.
+     * \return	Returns true if Exit Event is signaled.
+     **/
+    virtual bool runDispatcher( void ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Checks the states of all slots, binds the claimed slots, receives
+     *          messages of bound slots and frees the slots of disconnected clients.
+     * \param   msgReceived     The message object to receive data.
+     * \param   checkProcess    If true, the slots of exited client processes are freed.
+     * \return  Returns true if there are claimed slots, which are not bound yet.
+     **/
+    bool _processSlots( RemoteMessage & msgReceived, bool checkProcess );
+
+    /**
+     * \brief   Receives and processes all complete messages of the bound slot.
+     *          The partially received message remains in the decoder of the slot.
+     * \param   slot        The index of the bound slot.
+     * \param   msgReceived The message object to receive data.
+     **/
+    void _receiveMessages( uint32_t slot, RemoteMessage & msgReceived );
+
+    /**
+     * \brief   Wakes up the send worker of the client, if it waits for free space in the ring of the slot.
+     * \param   slot    The index of the bound slot.
+     **/
+    void _resumeSending( uint32_t slot );
+
+    /**
+     * \brief   Frees the slot and the decoder of the slot. The send workers are woken up
+     *          to drop the messages, which wait to be sent via the freed slot.
+     **/
+    void _freeSlot( uint32_t slot );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The instance of remote service message handler.
+     **/
+    IERemoteMessageHandler &    mRemoteService;
+    /**
+     * \brief   The instance of server connection object
+     **/
+    ServerConnection &          mConnection;
+    /**
+     * \brief   The send threads of all workers.
+     **/
+    const DataRateHelper::SendThreads & mSendWorkers;
+    /**
+     * \brief   The message decoders of bound slots.
+     **/
+    TEMap<uint32_t, RemoteMessageDecoder>   mDecoders;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    ServerSharedMemoryThread( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( ServerSharedMemoryThread );
+};
+
+#endif  // AREG_EXTEND_SERVICE_PRIVATE_SERVERSHAREDMEMORYTHREAD_HPP
@@ -18,10 +18,13 @@
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/ipc/ConnectionConfiguration.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
 #include "areg/trace/GETrace.h"
 
 #include "extend/service/NESystemService.hpp"
 
+#include <thread>
+
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_connectServiceHost);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_reconnectServiceHost);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_disconnectServiceHost);
@@ -36,6 +39,7 @@ DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_onServiceExit);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_startConnection);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_restartConnection);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_stopConnection);
+DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_createWorkers);
 
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_failedSendMessage);
 DEF_TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_failedReceiveMessage);
@@ -63,7 +67,10 @@ ServiceCommunicatonBase::ServiceCommunicatonBase( const ITEM_ID & serviceId
     , mTimerConnect     ( static_cast<IETimerConsumer &>(mTimerConsumer), NEConnection::SERVER_CONNECT_TIMER_NAME.data( ) )
     , mThreadSend       ( static_cast<IERemoteMessageHandler&>(self()), mServerConnection )
     , mThreadReceive    ( static_cast<IEServiceConnectionHandler&>(self()), static_cast<IERemoteMessageHandler&>(self()), mServerConnection )
-    , mDataRateHelper   ( mThreadSend, mThreadReceive, NESystemService::DEFAULT_VERBOSE )
+    , mSendWorkers      ( )
+    , mReceiveWorkers   ( )
+    , mThreadShared     ( static_cast<IERemoteMessageHandler&>(self()), mServerConnection, mSendWorkers )
+    , mDataRateHelper   ( mSendWorkers, mReceiveWorkers, NESystemService::DEFAULT_VERBOSE )
     , mWhiteList        ( )
     , mBlackList        ( )
     , mEventConsumer    ( self() )
@@ -72,6 +79,26 @@ ServiceCommunicatonBase::ServiceCommunicatonBase( const ITEM_ID & serviceId
     , mEventSendStop    ( false, false )
     , mLock             ( )
 {
+    mSendWorkers.add( &mThreadSend );
+    mReceiveWorkers.add( &mThreadReceive );
+    mDataRateHelper.setVerbose( NESystemService::DEFAULT_VERBOSE );
+}
+
+ServiceCommunicatonBase::~ServiceCommunicatonBase( void )
+{
+    // The first worker is not allocated.
+    for ( uint32_t i = 1; i < mSendWorkers.getSize( ); ++ i )
+    {
+        delete mSendWorkers[i];
+    }
+
+    for ( uint32_t i = 1; i < mReceiveWorkers.getSize( ); ++ i )
+    {
+        delete mReceiveWorkers[i];
+    }
+
+    mSendWorkers.clear( );
+    mReceiveWorkers.clear( );
 }
 
 void ServiceCommunicatonBase::addInstance(const ITEM_ID & cookie, const NEService::sServiceConnectedInstance & instance)
@@ -104,6 +131,13 @@ bool ServiceCommunicatonBase::setupServiceConnectionData(NERemoteService::eRemot
             {
                 String address{ config.getConnectionAddress() };
                 unsigned short port{ config.getConnectionPort() };
+                createWorkers(config.getConnectionWorkers());
+                for (ServerSendThread * thread : mSendWorkers.getData())
+                {
+                    thread->setSendQueueLimit(config.getConnectionQueue());
+                }
+
+                mServerConnection.setSocketProfile(config.getSocketProfile());
                 result = mServerConnection.setAddress(address, port);
             }
         }
@@ -302,10 +336,19 @@ bool ServiceCommunicatonBase::startConnection(void)
     if ( mServerConnection.createSocket() )
     {
         TRACE_DBG("Created socket [ %d ], going to create send-receive threads", static_cast<uint32_t>(mServerConnection.getSocketHandle()));
+        if ( startLocalSocket( ) )
+        {
+            TRACE_DBG( "Created local socket [ %d ], the clients on the same host can connect via local socket.", static_cast<uint32_t>(mServerConnection.getLocalSocketHandle( )) );
+        }
+
         if ( startSendThread( ) && startReceiveThread( ) )
         {
             result = true;
             TRACE_DBG( "The threads are created. Ready to send-receive messages." );
+            if ( startSharedMemory( ) )
+            {
+                TRACE_DBG( "The clients on the same host can send-receive messages via shared memory." );
+            }
         }
         else
         {
@@ -343,29 +386,158 @@ void ServiceCommunicatonBase::stopConnection(void)
     TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_stopConnection);
     TRACE_WARN("Stopping remote servicing connection");
 
-    mThreadReceive.triggerExit();
+    for ( ServerReceiveThread * thread : mReceiveWorkers.getData( ) )
+    {
+        thread->triggerExit( );
+    }
 
     disconnectServices( );
     disconnectService( Event::eEventPriority::EventPriorityNormal );
 
     // Wait without triggering exit.
-    mThreadSend.completionWait( NECommon::WAIT_INFINITE );
+    for ( ServerSendThread * thread : mSendWorkers.getData( ) )
+    {
+        thread->completionWait( NECommon::WAIT_INFINITE );
+    }
+
     mServerConnection.closeSocket( );
     // Trigger exit and clean resources.
-    mThreadSend.shutdownThread( NECommon::WAIT_INFINITE );
-    mThreadReceive.shutdownThread( NECommon::WAIT_INFINITE );
+    for ( ServerSendThread * thread : mSendWorkers.getData( ) )
+    {
+        thread->shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    for ( ServerReceiveThread * thread : mReceiveWorkers.getData( ) )
+    {
+        thread->shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    stopSharedMemory( );
 }
 
 bool ServiceCommunicatonBase::startSendThread( void )
 {
-    return mThreadSend.createThread( NECommon::WAIT_INFINITE ) && 
-           mThreadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    bool result{ true };
+    for ( uint32_t i = 0; result && (i < mSendWorkers.getSize( )); ++ i )
+    {
+        ServerSendThread * thread = mSendWorkers[i];
+        result = thread->createThread( NECommon::WAIT_INFINITE ) && thread->waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    }
+
+    return result;
 }
 
 bool ServiceCommunicatonBase::startReceiveThread( void )
 {
-    return mThreadReceive.createThread( NECommon::WAIT_INFINITE ) &&
-           mThreadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    bool result{ true };
+    for ( uint32_t i = 0; result && (i < mReceiveWorkers.getSize( )); ++ i )
+    {
+        ServerReceiveThread * thread = mReceiveWorkers[i];
+        result = thread->createThread( NECommon::WAIT_INFINITE ) && thread->waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    }
+
+    return result;
+}
+
+void ServiceCommunicatonBase::createWorkers( uint32_t workers )
+{
+    TRACE_SCOPE(areg_extend_service_ServiceCommunicatonBase_createWorkers);
+
+    Lock lock( mLock );
+    if ( workers == 0 )
+    {
+        workers = static_cast<uint32_t>(std::thread::hardware_concurrency( ));
+    }
+
+    // The workers are created once, the data rate helper may query them at any time.
+    if ( (mSendWorkers.getSize( ) == 1) && mServerConnection.setWorkerCount( workers ) )
+    {
+        const uint32_t count{ mServerConnection.getWorkerCount( ) };
+        for ( uint32_t i = 1; i < count; ++ i )
+        {
+            mSendWorkers.add( DEBUG_NEW ServerSendThread( static_cast<IERemoteMessageHandler &>(self( )), mServerConnection, i ) );
+            mReceiveWorkers.add( DEBUG_NEW ServerReceiveThread( static_cast<IEServiceConnectionHandler &>(self( )), static_cast<IERemoteMessageHandler &>(self( )), mServerConnection, i ) );
+        }
+
+        mDataRateHelper.setVerbose( mDataRateHelper.isVerbose( ) );
+        TRACE_DBG( "The service [ %s ] sends and receives messages of clients in [ %u ] workers", getName( ).getString( ), count );
+    }
+}
+
+bool ServiceCommunicatonBase::sendMessage( const RemoteMessage & data, const TEArrayList<ITEM_ID> & targets, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
+{
+    // the checksum does not depend on the target, calculate it once before sharing the message.
+    data.bufferCompletionFix( );
+
+    bool result{ true };
+    const uint32_t count{ mSendWorkers.getSize( ) };
+    if ( count == 1 )
+    {
+        result = _postSendEvent( SendMessageEventData( data, targets ), mThreadSend, eventPrio );
+    }
+    else
+    {
+        // The message is shared, each worker sends it to the targets it owns.
+        TEArrayList<ITEM_ID> workerTargets[ServerConnectionBase::MAXIMUM_WORKERS];
+        for ( const ITEM_ID & target : targets.getData( ) )
+        {
+            workerTargets[mServerConnection.getWorker( target )].add( target );
+        }
+
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            if ( workerTargets[i].isEmpty( ) == false )
+            {
+                result = _postSendEvent( SendMessageEventData( data, workerTargets[i] ), *mSendWorkers[i], eventPrio ) && result;
+            }
+        }
+    }
+
+    return result;
+}
+
+bool ServiceCommunicatonBase::startLocalSocket( void )
+{
+    bool result{ false };
+    if ( (mConnectTypes & static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectUds)) != 0 )
+    {
+        ConnectionConfiguration config( mService, NERemoteService::eConnectionTypes::ConnectUds );
+        if ( config.isConnectionTypeEnabled( ) )
+        {
+            result = mServerConnection.createLocalSocket( config.getConnectionAddress( ) );
+        }
+    }
+
+    return result;
+}
+
+bool ServiceCommunicatonBase::startSharedMemory( void )
+{
+    bool result{ false };
+    if ( (mConnectTypes & static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectSM)) != 0 )
+    {
+        ConnectionConfiguration config( mService, NERemoteService::eConnectionTypes::ConnectSM );
+        if ( config.isConnectionTypeEnabled( ) )
+        {
+            String segment{ NESharedMemory::getSegmentName( config.getRemoteServiceName( ), mServerConnection.getAddress( ).getHostPort( ) ) };
+            result = mServerConnection.createSharedMemory( segment )          &&
+                     mThreadShared.createThread( NECommon::WAIT_INFINITE )    &&
+                     mThreadShared.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+
+            if ( result == false )
+            {
+                mServerConnection.releaseSharedMemory( );
+            }
+        }
+    }
+
+    return result;
+}
+
+void ServiceCommunicatonBase::stopSharedMemory( void )
+{
+    mThreadShared.shutdownThread( NECommon::WAIT_INFINITE );
+    mServerConnection.releaseSharedMemory( );
 }
 
 void ServiceCommunicatonBase::failedSendMessage(const RemoteMessage & msgFailed, Socket & whichTarget )
@@ -22,6 +22,9 @@ LoggerMessageProcessor::LoggerMessageProcessor(LoggerServerService & loggerServi
     : mLoggerService    ( loggerService )
     , mListSaveConfig   ( )
     , mPendingSave      ( NEService::COOKIE_UNKNOWN )
+    , mLogNames         ( )
+    , mFilters          ( )
+    , mScopeNames       ( )
 {
 }
 
@@ -41,6 +44,14 @@ void LoggerMessageProcessor::queryConnectedInstances(const RemoteMessage & msgRe
             if (instance.ciSource == NEService::eMessageSource::MessageSourceObserver)
             {
                 notifyConnectedInstances(mLoggerService.getInstances(), source);
+
+                // the log sources send the names of threads and modules once, the observer receives them from the logger.
+                TEArrayList<RemoteMessage> listNames;
+                mLogNames.createNamesMessages(source, listNames);
+                for (const auto& msgNames : listNames.getData())
+                {
+                    mLoggerService.sendMessage(msgNames);
+                }
             }
         }
     }
@@ -79,11 +90,8 @@ void LoggerMessageProcessor::notifyConnectedInstances(const NEService::MapInstan
 
         if (target == NEService::COOKIE_ANY)
         {
-            for (const auto& observer : observers.getData())
-            {
-                RemoteMessage msg{ msgInstances.clone(NEService::COOKIE_LOGGER, observer.first) };
-                mLoggerService.sendMessage(msg);
-            }
+            msgInstances.setSource(NEService::COOKIE_LOGGER);
+            mLoggerService.sendMessage(msgInstances, _getObserverTargets());
         }
         else
         {
@@ -107,11 +115,8 @@ void LoggerMessageProcessor::notifyDisconnectedInstances(const TEArrayList<ITEM_
         msgInstances << listIds;
         if (target == NEService::COOKIE_ANY)
         {
-            for (const auto& observer : observers.getData())
-            {
-                RemoteMessage msg{ msgInstances.clone(NEService::COOKIE_LOGGER, observer.first) };
-                mLoggerService.sendMessage(msg);
-            }
+            msgInstances.setSource(NEService::COOKIE_LOGGER);
+            mLoggerService.sendMessage(msgInstances, _getObserverTargets());
         }
         else
         {
@@ -122,7 +127,7 @@ void LoggerMessageProcessor::notifyDisconnectedInstances(const TEArrayList<ITEM_
     }
 }
 
-void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived) const
+void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogRegisterScopes));
     msgReceived.moveToBegin();
@@ -135,6 +140,7 @@ void LoggerMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgR
     msgStatus.format(fmt, static_cast<uint32_t>(msgReceived.getSource()), scopeCount);
 
     Logger::printStatus(msgStatus);
+    _registerScopeNames(msgReceived);
     _forwardMessageToObservers(msgReceived);
 }
 
@@ -181,6 +187,7 @@ void LoggerMessageProcessor::saveLogSourceConfiguration(const RemoteMessage & ms
 void LoggerMessageProcessor::logSourceScopesUpadated(const RemoteMessage& msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogScopesUpdated));
+    _registerScopeNames(msgReceived);
     _forwardMessageToObservers(msgReceived);
 }
 
@@ -190,6 +197,60 @@ void LoggerMessageProcessor::logSourceConfigurationSaved(const RemoteMessage& ms
     processNextSaveConfig();
 }
 
+void LoggerMessageProcessor::setObserverFilter(const RemoteMessage& msgReceived)
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogFilter));
+
+    const ITEM_ID& source{ msgReceived.getSource() };
+    const auto& observers{ mLoggerService.getObservers() };
+    if (observers.contains(source) == false)
+        return;
+
+    NETrace::sLogFilter logFilter;
+    msgReceived.moveToBegin();
+    msgReceived >> logFilter;
+
+    bool anyPrio{ (logFilter.lfPriority == NETrace::eLogPriority::PrioInvalid) || (logFilter.lfPriority >= NETrace::eLogPriority::PrioDebug) };
+    if (logFilter.lfSources.isEmpty() && logFilter.lfScopes.isEmpty() && logFilter.lfScopeGroups.isEmpty() && anyPrio && (logFilter.lfMsgTypes == 0u))
+    {
+        // the filter passes every message, the observer receives the messages as they are.
+        mFilters.removeAt(source);
+    }
+    else
+    {
+        sObserverFilter& filter{ mFilters[source] };
+        filter.ofSources.clear();
+        filter.ofScopes.clear();
+        filter.ofGroups = logFilter.lfScopeGroups;
+        // all priorities starting from the highest up to the lowest set in the filter.
+        filter.ofPrioMask   = anyPrio ? static_cast<uint32_t>(~0u) : (static_cast<uint32_t>(logFilter.lfPriority) << 1u) - 1u;
+        filter.ofTypeMask   = logFilter.lfMsgTypes != 0u ? logFilter.lfMsgTypes : static_cast<uint32_t>(~0u);
+        filter.ofAnySource  = logFilter.lfSources.isEmpty();
+        filter.ofAnyScope   = logFilter.lfScopes.isEmpty() && logFilter.lfScopeGroups.isEmpty();
+
+        for (const auto& cookie : logFilter.lfSources.getData())
+        {
+            filter.ofSources.setAt(cookie, true);
+        }
+
+        for (const auto& scopeId : logFilter.lfScopes.getData())
+        {
+            filter.ofScopes.setAt(scopeId, true);
+        }
+
+        for (const auto& group : filter.ofGroups.getData())
+        {
+            for (const auto& scope : mScopeNames.getData())
+            {
+                if (_isGroupMatch(group, scope.second))
+                {
+                    filter.ofScopes.setAt(scope.first, true);
+                }
+            }
+        }
+    }
+}
+
 void LoggerMessageProcessor::processNextSaveConfig(void)
 {
     mLoggerService.mSaveTimer.stopTimer();
@@ -205,17 +266,50 @@ void LoggerMessageProcessor::processNextSaveConfig(void)
 
 void LoggerMessageProcessor::clientDisconnected(const ITEM_ID& cookie)
 {
+    if (cookie == NEService::COOKIE_ANY)
+    {
+        mLogNames.removeAll();
+        mFilters.clear();
+    }
+    else
+    {
+        mLogNames.removeSource(cookie);
+        mFilters.removeAt(cookie);
+    }
+
     if ((cookie > NEService::COOKIE_ANY) && (mPendingSave == cookie))
     {
         processNextSaveConfig();
     }
 }
 
-void LoggerMessageProcessor::logMessage(const RemoteMessage & msgReceived) const
+void LoggerMessageProcessor::logMessage(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage));
-    ASSERT(NETrace::eLogDataType::LogDataRemote == reinterpret_cast<const NETrace::sLogMessage *>(msgReceived.getBuffer())->logDataType);
-    _forwardMessageToObservers(msgReceived);
+
+    if (mFilters.isEmpty() || (msgReceived.getTarget() != NEService::COOKIE_LOGGER))
+    {
+        NETrace::sLogMessage logMessage{};
+        uint32_t position{ 0u };
+        bool isForwarded{ false };
+
+        // the message may contain a batch of records, it is forwarded to the observers as it is.
+        while (mLogNames.decodeMessage(msgReceived, position, logMessage))
+        {
+            ASSERT(NETrace::eLogDataType::LogDataRemote == logMessage.logDataType);
+            if (isForwarded == false)
+            {
+                isForwarded = true;
+                _forwardMessageToObservers(msgReceived);
+            }
+
+            NETrace::logAnyMessageLocal(logMessage);
+        }
+    }
+    else
+    {
+        _logFilteredMessage(msgReceived);
+    }
 }
 
 bool LoggerMessageProcessor::isLogSource(NEService::eMessageSource msgSource)
@@ -249,14 +343,17 @@ inline void LoggerMessageProcessor::_forwardMessageToLogSources(const RemoteMess
         }
         else if (target == NEService::COOKIE_ANY)
         {
+            TEArrayList<ITEM_ID> targets;
             for (const auto& instance : instances.getData())
             {
                 if (isLogSource(instance.second.ciSource))
                 {
-                    RemoteMessage msg{ msgReceived.clone(source, instance.first) };
-                    mLoggerService.sendMessage(msg);
+                    targets.add(instance.first);
                 }
             }
+
+            // the data of the message is shared by all targets.
+            mLoggerService.sendMessage(msgReceived, targets);
         }
     }
 }
@@ -281,12 +378,164 @@ inline void LoggerMessageProcessor::_forwardMessageToObservers(const RemoteMessa
         }
         else if (target == NEService::COOKIE_ANY)
         {
-            for (const auto& observer : observers.getData())
+            // the data of the message is shared by all observers.
+            mLoggerService.sendMessage(msgReceived, _getObserverTargets());
+        }
+    }
+}
+
+inline TEArrayList<ITEM_ID> LoggerMessageProcessor::_getObserverTargets(void) const
+{
+    const auto& observers = mLoggerService.getObservers();
+    TEArrayList<ITEM_ID> result(observers.getSize());
+    for (const auto& observer : observers.getData())
+    {
+        ASSERT(isLogObserver(observer.second.ciSource));
+        result.add(observer.first);
+    }
+
+    return result;
+}
+
+void LoggerMessageProcessor::_logFilteredMessage(const RemoteMessage& msgReceived)
+{
+    const NEService::MapInstances& instances = mLoggerService.getInstances();
+    auto srcPos = instances.find(msgReceived.getSource());
+    bool isBatch{ NETrace::isLogBatch(msgReceived) };
+
+    // the observers without filter share the data of the received message.
+    TEArrayList<ITEM_ID> targets;
+    TEArrayList<sFilteredBatch> batches;
+    if (instances.isValidPosition(srcPos) && isLogSource(instances.valueAtPosition(srcPos).ciSource))
+    {
+        const auto& observers = mLoggerService.getObservers();
+        for (const auto& observer : observers.getData())
+        {
+            auto pos = mFilters.find(observer.first);
+            if (mFilters.isValidPosition(pos))
+            {
+                sFilteredBatch entry;
+                entry.fbTarget = observer.first;
+                entry.fbFilter = &mFilters.valueAtPosition(pos);
+                if (isBatch)
+                {
+                    entry.fbBatch = NETrace::createLogBatch(msgReceived.getSource(), msgReceived.getSizeUsed());
+                }
+
+                batches.add(entry);
+            }
+            else
+            {
+                targets.add(observer.first);
+            }
+        }
+    }
+
+    NETrace::sLogMessage logMessage{};
+    unsigned char flags{ NETrace::CompactNoNames };
+    uint32_t position{ 0u };
+    uint32_t begin{ 0u };
+    bool hasMessages{ false };
+
+    while (mLogNames.decodeRecord(msgReceived, position, logMessage, flags))
+    {
+        ASSERT(NETrace::eLogDataType::LogDataRemote == logMessage.logDataType);
+        bool hasMessage{ (flags & NETrace::CompactNamesOnly) == 0 };
+        for (uint32_t i = 0; i < batches.getSize(); ++ i)
+        {
+            sFilteredBatch& entry{ batches[i] };
+            if (isBatch)
+            {
+                // the records of the batch are copied without decoding and encoding.
+                // the names are sent once, the observer receives them even if the record does not match.
+                if ((hasMessage == false) || _isFilterMatch(*entry.fbFilter, logMessage))
+                {
+                    entry.fbCount += NETrace::appendLogBatch(entry.fbBatch, msgReceived, begin, position) ? 1u : 0u;
+                }
+                else if ((flags & NETrace::CompactAllNames) != 0)
+                {
+                    entry.fbCount += NETrace::appendLogBatchNames(entry.fbBatch, logMessage, flags) ? 1u : 0u;
+                }
+            }
+            else if (hasMessage && _isFilterMatch(*entry.fbFilter, logMessage))
             {
-                ASSERT(isLogObserver(observer.second.ciSource));
-                RemoteMessage msg{ msgReceived.clone(source, observer.first) };
-                mLoggerService.sendMessage(msg);
+                // the single record is shared as it is.
+                targets.add(entry.fbTarget);
             }
+            else if (hasMessage && ((flags & NETrace::CompactAllNames) != 0))
+            {
+                entry.fbBatch = NETrace::createCompactLogNames(msgReceived.getSource(), entry.fbTarget, logMessage.logThreadId, logMessage.logThread, logMessage.logModule);
+                entry.fbCount = 1u;
+            }
+        }
+
+        if (hasMessage)
+        {
+            hasMessages = true;
+            NETrace::logAnyMessageLocal(logMessage);
         }
+
+        begin = position;
     }
+
+    if (hasMessages && (targets.isEmpty() == false))
+    {
+        mLoggerService.sendMessage(msgReceived, targets);
+    }
+
+    for (uint32_t i = 0; i < batches.getSize(); ++ i)
+    {
+        sFilteredBatch& entry{ batches[i] };
+        if (entry.fbCount != 0u)
+        {
+            entry.fbBatch.setTarget(entry.fbTarget);
+            mLoggerService.sendMessage(entry.fbBatch);
+        }
+    }
+}
+
+void LoggerMessageProcessor::_registerScopeNames(const RemoteMessage& msgReceived)
+{
+    uint32_t scopeCount{ 0 };
+    msgReceived.moveToBegin();
+    msgReceived >> scopeCount;
+
+    NETrace::sScopeInfo scope;
+    for (uint32_t i = 0; (i < scopeCount) && (msgReceived.isEndOfBuffer() == false); ++ i)
+    {
+        msgReceived >> scope;
+        if ((scope.scopeId == NETrace::TRACE_SCOPE_ID_NONE) || mScopeNames.contains(scope.scopeId))
+            continue;
+
+        for (auto pos = mFilters.firstPosition(); mFilters.isValidPosition(pos); pos = mFilters.nextPosition(pos))
+        {
+            sObserverFilter& filter{ mFilters.valueAtPosition(pos) };
+            for (const auto& group : filter.ofGroups.getData())
+            {
+                if (_isGroupMatch(group, scope.scopeName))
+                {
+                    filter.ofScopes.setAt(scope.scopeId, true);
+                    break;
+                }
+            }
+        }
+
+        mScopeNames.setAt(scope.scopeId, scope.scopeName);
+    }
+
+    msgReceived.moveToBegin();
+}
+
+inline bool LoggerMessageProcessor::_isFilterMatch(const sObserverFilter& filter, const NETrace::sLogMessage& logMessage)
+{
+    return (((filter.ofTypeMask & static_cast<uint32_t>(logMessage.logMsgType)) != 0u)       &&
+            ((filter.ofPrioMask & static_cast<uint32_t>(logMessage.logMessagePrio)) != 0u)   &&
+            (filter.ofAnySource || filter.ofSources.contains(logMessage.logCookie))          &&
+            (filter.ofAnyScope  || filter.ofScopes.contains(logMessage.logScopeId)));
+}
+
+inline bool LoggerMessageProcessor::_isGroupMatch(const String& group, const String& scopeName)
+{
+    // the scope group ends with '*' and matches any scope name with the same prefix.
+    return (group.endsWith("*") ? scopeName.startsWith(group.getString(), true, static_cast<NEString::CharCount>(group.getLength() - 1)) : (group == scopeName));
 }
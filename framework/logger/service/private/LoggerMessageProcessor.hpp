@@ -22,6 +22,8 @@
 
 #include "areg/component/NEService.hpp"
 #include "areg/base/TEArrayList.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/trace/LogSourceNames.hpp"
 #include "extend/service/ServiceCommunicatonBase.hpp"
 
 /************************************************************************
@@ -39,6 +41,51 @@ class RemoteMessage;
  **/
 class LoggerMessageProcessor
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   LoggerMessageProcessor::sObserverFilter
+     *          The precompiled index of the filter of log messages set by the log observer.
+     *          The priorities and message types are bit masks, the sources and scopes are
+     *          hash sets. The scope groups are resolved to the IDs of the scopes, which
+     *          names are registered by log sources.
+     **/
+    struct sObserverFilter
+    {
+        //!< The cookies of the log sources to forward messages.
+        TEHashMap<ITEM_ID, bool>    ofSources;
+        //!< The IDs of the scopes to forward messages, including resolved scope groups.
+        TEHashMap<uint32_t, bool>   ofScopes;
+        //!< The names or prefixes of scope names, which end with '*'.
+        TEArrayList<String>         ofGroups;
+        //!< The bit mask of the message priorities to forward.
+        uint32_t                    ofPrioMask{ 0u };
+        //!< The bit mask of the message types to forward.
+        uint32_t                    ofTypeMask{ 0u };
+        //!< Flag, indicating whether messages of any log source are forwarded.
+        bool                        ofAnySource{ true };
+        //!< Flag, indicating whether messages of any scope are forwarded.
+        bool                        ofAnyScope{ true };
+    };
+
+    /**
+     * \brief   LoggerMessageProcessor::sFilteredBatch
+     *          The batch of log records, which match the filter of the log observer.
+     **/
+    struct sFilteredBatch
+    {
+        //!< The cookie of the log observer.
+        ITEM_ID                 fbTarget{ NEService::COOKIE_UNKNOWN };
+        //!< The filter of the log observer.
+        const sObserverFilter * fbFilter{ nullptr };
+        //!< The batch of log records to forward.
+        RemoteMessage           fbBatch;
+        //!< The number of log records with messages in the batch.
+        uint32_t                fbCount{ 0u };
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -91,7 +138,7 @@ public:
      *          The message is forwarded to the all connected observers to register scopes.
      * \param   msgReceived     The message to process.
      **/
-    void registerScopesAtObserver(const RemoteMessage & msgReceived) const;
+    void registerScopesAtObserver(const RemoteMessage & msgReceived);
 
     /**
      * \brief   Called when a connected instance of observer requests to update scopes
@@ -121,9 +168,11 @@ public:
 
     /**
      * \brief   Called to forward the log message to the observer application.
+     *          The message is forwarded as it is received, and it is decoded
+     *          to output in the logs of the logger.
      * \param   msgReceived     The message to process.
      **/
-    void logMessage(const RemoteMessage& msgReceived) const;
+    void logMessage(const RemoteMessage& msgReceived);
 
     /**
      * \brief   Called when the connected instance of log source updates the scope priorities.
@@ -142,6 +191,14 @@ public:
      **/
     void logSourceConfigurationSaved(const RemoteMessage& msgReceived);
 
+    /**
+     * \brief   Called when the connected instance of log observer sets the filter of log messages.
+     *          The logger forwards to the log observer only the log messages, which match the filter.
+     *          The empty filter removes the filter of the log observer.
+     * \param   msgReceived     The message to process.
+     **/
+    void setObserverFilter(const RemoteMessage& msgReceived);
+
     /**
      * \brief   Called to process the next log source application in the queue to save configuration.
      **/
@@ -150,6 +207,7 @@ public:
     /**
      * \brief   Called when an instance of a log source is disconnected.
      * \param   cookie      The ID of disconnected application.
+     *                      If NEService::COOKIE_ANY, all instances are disconnected.
      **/
     void clientDisconnected(const ITEM_ID& cookie);
 
@@ -189,6 +247,37 @@ private:
      * \param   msgReceived     The remote message received from a client.
      **/
     inline void _forwardMessageToObservers(const RemoteMessage& msgReceived) const;
+
+    /**
+     * \brief   Returns the list of cookies of connected log observers.
+     **/
+    inline TEArrayList<ITEM_ID> _getObserverTargets(void) const;
+
+    /**
+     * \brief   Decodes, logs and forwards the log records to the observers considering the filters.
+     *          The observers without filter receive the message as it is. The observers with
+     *          filter receive the batch of matching records and the names of the skipped records.
+     * \param   msgReceived     The message with the log records received from a log source.
+     **/
+    void _logFilteredMessage(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Saves the names and IDs of the scopes contained in the message and adds the IDs
+     *          of the scopes, which match the scope groups, to the filters of the observers.
+     * \param   msgReceived     The message with the list of scopes sent by a log source.
+     **/
+    void _registerScopeNames(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Returns true if the log message matches the filter of the log observer.
+     **/
+    inline static bool _isFilterMatch(const sObserverFilter& filter, const NETrace::sLogMessage& logMessage);
+
+    /**
+     * \brief   Returns true if the scope name matches the name or the prefix of the scope group.
+     **/
+    inline static bool _isGroupMatch(const String& group, const String& scopeName);
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -202,6 +291,15 @@ private:
     //!< The ID of an application pending to save the configuration.
     ITEM_ID                 mPendingSave;
 
+    //!< The names of threads and modules of connected log sources.
+    LogSourceNames          mLogNames;
+
+    //!< The filters of log messages, where the key is the cookie of the log observer.
+    TEHashMap<ITEM_ID, sObserverFilter> mFilters;
+
+    //!< The names of registered scopes, where the key is the ID of the scope.
+    TEHashMap<uint32_t, String>         mScopeNames;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -34,7 +34,7 @@ DEF_TRACE_SCOPE(logger_service_LoggerServerService_failedReceiveMessage);
 LoggerServerService::LoggerServerService( void )
     : ServiceCommunicatonBase   ( NEService::COOKIE_LOGGER
                                 , NERemoteService::eRemoteServices::ServiceLogger
-                                , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip)
+                                , static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectSM) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectUds)
                                 , NEConnection::SERVER_DISPATCH_MESSAGE_THREAD
                                 , ServiceCommunicatonBase::eConnectionBehavior::DefaultAccept )
     , IETimerConsumer           ( )
@@ -122,6 +122,7 @@ void LoggerServerService::removeAllInstances(void)
         String::formatString(logMsgClose.logMessage, NETrace::LOG_MESSAGE_IZE, "Disconnecting and removing [ %u ] instances.", mInstanceMap.getSize());
         NETrace::logAnyMessageLocal(logMsgClose);
         ServiceCommunicatonBase::removeAllInstances();
+        mLoggerProcessor.clientDisconnected(NEService::COOKIE_ANY);
 
         if (listIds.isEmpty() == false)
         {
@@ -205,7 +206,10 @@ void LoggerServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
 
     case NEService::eFuncIdRange::ServiceLogMessage:
         mLoggerProcessor.logMessage(msgReceived);
-        NETrace::logMessage(msgReceived);
+        break;
+
+    case NEService::eFuncIdRange::ServiceLogFilter:
+        mLoggerProcessor.setObserverFilter(msgReceived);
         break;
 
     case NEService::eFuncIdRange::SystemServiceConnect:
@@ -131,6 +131,29 @@ struct sLogScope
     char        lsName[LENGTH_SCOPE];
 };
 
+/**
+ * \brief   The structure of the filter of log messages. The logger service forwards to the
+ *          log observer only the messages, which match the filter.
+ **/
+struct sLogFilter
+{
+    /* The list of cookie IDs of log sources to receive messages. If null or empty, receives messages of all sources. */
+    const ITEM_ID*      lfSources;
+    /* The number of entries in the list of log sources. */
+    uint32_t            lfSourceCount;
+    /* The list of scopes or scope groups to receive messages. If null or empty, receives messages of all scopes.
+       If the ID of the scope is not 0, the scope is filtered by ID. Otherwise, it is filtered by name,
+       where the scope group should end with '*'. The priority of the scope is ignored. */
+    const sLogScope*    lfScopes;
+    /* The number of entries in the list of scopes. */
+    uint32_t            lfScopeCount;
+    /* The lowest priority of the messages to receive, for example PrioWarning receives warning, error and fatal error messages.
+       If PrioInvalid or PrioDebug, receives messages of all priorities. */
+    uint32_t            lfPriority;
+    /* The bitwise combination of eLogType values of messages to receive. If 0, receives messages of all types. */
+    uint32_t            lfMsgTypes;
+};
+
 /**
  * \brief   The structure of the logging message.
  **/
@@ -261,6 +284,16 @@ typedef void (*FuncLogMessage)(const sLogMessage * /*logMessage*/);
  **/
 typedef void (*FuncLogMessageEx)(const unsigned char* /*logBuffer*/, uint32_t /*size*/);
 
+/**
+ * \brief   The callback of the event triggered when receive messages to log.
+ *          The messages are queued and delivered in batches in a separate thread,
+ *          either when the batch is full or when the maximum latency expires.
+ *          The callback, the batch size and the latency are set by logObserverSetMessageBatchCallback().
+ * \param   logMessages The pointer to the list of messages to log.
+ * \param   count       The number of messages in the list.
+ **/
+typedef void (*FuncLogMessageBatch)(const sLogMessage * /*logMessages*/, uint32_t /*count*/);
+
 /**
  * \brief   The structure of the callbacks / events to set when send or receive messages.
  **/
@@ -396,6 +429,20 @@ LOGOBSERVER_API bool logObserverConfigLoggerAddress(char * addrBuffer, uint32_t
  **/
 LOGOBSERVER_API unsigned short logObserverConfigLoggerPort();
 
+/**
+ * \brief   Sets the callback to deliver the received messages to log in batches, the maximum number of messages
+ *          to deliver in a single call of the callback and the maximum time in milliseconds the received messages
+ *          wait to be delivered. By default, the batch contains up to 256 messages and the latency is 50 milliseconds.
+ *          If the callback is set and not null, the 'evtLogMessage' and 'evtLogMessageEx' callbacks of
+ *          'sObserverEvents' structure are ignored. Set the callback null to receive messages one by one.
+ *          The callback is reset when the log observer is released.
+ * \param   callback    The callback to deliver messages in batches. If null, the messages are not delivered in batches.
+ * \param   maxMessages The maximum number of messages in a batch. If 0, the default value is set.
+ * \param   maxLatency  The maximum time in milliseconds the messages wait in the queue. If 0, the default value is set.
+ * \return  Returns true if the log observer is initialized and the values are set. Otherwise, returns false.
+ **/
+LOGOBSERVER_API bool logObserverSetMessageBatchCallback(FuncLogMessageBatch callback, uint32_t maxMessages, uint32_t maxLatency);
+
 /**
  * \brief   Call to request the list of connected instances.
  *          The callback of FuncLogInstances type is triggered when receive the list of connected instances.
@@ -435,5 +482,15 @@ LOGOBSERVER_API bool logObserverRequestChangeScopePrio(ITEM_ID target, const sLo
  **/
 LOGOBSERVER_API bool logObserverRequestSaveConfig(ITEM_ID target);
 
+/**
+ * \brief   Call to set the filter of log messages at the logger service, so that the log observer receives
+ *          only the messages that match the filter. The new filter replaces the previous one.
+ *          The filter is reset when the log observer disconnects.
+ * \param   filter  The filter of log messages. If null, the filter is removed and the log observer
+ *                  receives all messages.
+ * \return  Returns true if processed with success. Otherwise, returns false.
+ **/
+LOGOBSERVER_API bool logObserverRequestFilter(const sLogFilter* filter);
+
 #endif  // AREG_LOGOBSERVER_LIB_LOGOBSERVERAPI_H
 
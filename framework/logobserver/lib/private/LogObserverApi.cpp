@@ -168,6 +168,7 @@ LOGOBSERVER_API_IMPL void logObserverRelease()
     {
         LoggerClient& client = LoggerClient::getInstance();
         client.setCallbacks(nullptr);
+        client.setMessageBatch(nullptr, 0u, 0u);
         client.stopLoggerClient();
         Application::releaseApplication();
         _setCallbacks(theObserver.losEvents, nullptr);
@@ -269,6 +270,19 @@ LOGOBSERVER_API_IMPL unsigned short logObserverConfigLoggerPort()
     return result;
 }
 
+LOGOBSERVER_API_IMPL bool logObserverSetMessageBatchCallback(FuncLogMessageBatch callback, uint32_t maxMessages, uint32_t maxLatency)
+{
+    Lock lock(theObserver.losLock);
+    bool result{ false };
+    if (_isInitialized(theObserver.losState))
+    {
+        LoggerClient::getInstance().setMessageBatch(callback, maxMessages, maxLatency);
+        result = true;
+    }
+
+    return result;
+}
+
 LOGOBSERVER_API_IMPL bool logObserverRequestInstances()
 {
     bool result{ false };
@@ -322,3 +336,39 @@ LOGOBSERVER_API_IMPL bool logObserverRequestSaveConfig(ITEM_ID target /* = ID_IG
 
     return result;
 }
+
+LOGOBSERVER_API_IMPL bool logObserverRequestFilter(const sLogFilter* filter)
+{
+    bool result{ false };
+    Lock lock(theObserver.losLock);
+    if (_isInitialized(theObserver.losState))
+    {
+        NETrace::sLogFilter logFilter;
+        if (filter != nullptr)
+        {
+            for (uint32_t i = 0; (filter->lfSources != nullptr) && (i < filter->lfSourceCount); ++i)
+            {
+                logFilter.lfSources.add(filter->lfSources[i]);
+            }
+
+            for (uint32_t i = 0; (filter->lfScopes != nullptr) && (i < filter->lfScopeCount); ++i)
+            {
+                if (filter->lfScopes[i].lsId != 0u)
+                {
+                    logFilter.lfScopes.add(filter->lfScopes[i].lsId);
+                }
+                else
+                {
+                    logFilter.lfScopeGroups.add(String(filter->lfScopes[i].lsName));
+                }
+            }
+
+            logFilter.lfPriority = static_cast<NETrace::eLogPriority>(filter->lfPriority);
+            logFilter.lfMsgTypes = filter->lfMsgTypes;
+        }
+
+        result = LoggerClient::getInstance().requestLogFilter(logFilter);
+    }
+
+    return result;
+}
@@ -49,7 +49,10 @@ LoggerClient::LoggerClient(void)
     , mMessageProcessor          ( self() )
     , mIsPaused                  ( false )
     , mInstances                 ( )
+    , mLogNames                  ( )
     , mLogDatabase               ( )
+    , mMessageQueue              ( )
+    , mBatchCallback             ( nullptr )
 {
 }
 
@@ -72,6 +75,7 @@ bool LoggerClient::startLoggerClient(const String & address /*= String::EmptyStr
         }
     }
 
+    mMessageQueue.startDelivery();
     return connectServiceHost();
 }
 
@@ -84,6 +88,7 @@ void LoggerClient::stopLoggerClient(void)
     } while (false);
 
     disconnectServiceHost();
+    mMessageQueue.stopDelivery();
 }
 
 void LoggerClient::setCallbacks(const sObserverEvents* callbacks)
@@ -199,12 +204,34 @@ bool LoggerClient::requestSaveConfiguration(const ITEM_ID& target /*= NEService:
     return result;
 }
 
+bool LoggerClient::requestLogFilter(const NETrace::sLogFilter& logFilter)
+{
+    bool result{ false };
+    Lock lock(mLock);
+    if (mChannel.getCookie() != NEService::COOKIE_UNKNOWN)
+    {
+        result = sendMessage(NETrace::messageLogFilter(mChannel.getCookie(), LoggerClient::TargetID, logFilter));
+    }
+
+    return result;
+}
+
+void LoggerClient::setMessageBatch(FuncLogMessageBatch callback, uint32_t maxMessages, uint32_t maxLatency)
+{
+    Lock lock(mLock);
+    mBatchCallback = callback;
+    mMessageQueue.setCallback(callback);
+    mMessageQueue.setLimits(maxMessages, maxLatency);
+}
+
 bool LoggerClient::openLoggingDatabase(const char* dbPath /*= nullptr*/)
 {
     String filePath (dbPath);
+    LogConfiguration config;
+    mLogDatabase.setPartitioning(config.getDatabasePartitionTime(), config.getDatabasePartitionSize());
+    mLogDatabase.setRetention(config.getDatabaseRetention());
     if (filePath.isEmpty())
     {
-        LogConfiguration config;
         if (config.isDatabaseLoggingEnabled() && (config.getDatabaseName() == NETrace::LOGDB_NAME_SQLITE3))
         {
             mLogDatabase.setDatabaseLoggingEnabled(true);
@@ -337,6 +364,7 @@ void LoggerClient::disconnectServiceHost(void)
         }
 
         mInstances.clear();
+        mLogNames.removeAll();
 
         ServiceClientConnectionBase::disconnectServiceHost();
         completionWait(NECommon::WAIT_INFINITE);
@@ -428,6 +456,7 @@ void LoggerClient::lostRemoteServiceChannel(const Channel& channel)
         }
 
         mInstances.clear();
+        mLogNames.removeAll();
     } while (false);
 
     if (evtStart != nullptr)
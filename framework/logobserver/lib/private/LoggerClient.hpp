@@ -27,10 +27,12 @@
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 #include "areg/persist/IEConfigurationListener.hpp"
 
+#include "areg/trace/LogSourceNames.hpp"
 #include "areg/trace/NETrace.hpp"
 #include "extend/db/LogSqliteDatabase.hpp"
 
 #include "logobserver/lib/private/ObserverMessageProcessor.hpp"
+#include "logobserver/lib/private/ObserverMessageQueue.hpp"
 
 /************************************************************************
  * Dependencies
@@ -199,6 +201,26 @@ public:
      **/
     bool requestSaveConfiguration(const ITEM_ID & target = NEService::COOKIE_ANY);
 
+    /**
+     * \brief   Generates and sends the message to set the filter of log messages at the logger service.
+     *          The logger service forwards only the log messages, which match the filter.
+     *          The new filter replaces the previous one.
+     * \param   logFilter   The filter of log messages to set.
+     * \return  Returns true if processed the request with success. Otherwise, returns false.
+     **/
+    bool requestLogFilter(const NETrace::sLogFilter & logFilter);
+
+    /**
+     * \brief   Sets the callback to deliver log messages in batches, the maximum number of messages
+     *          delivered in a single call of the callback and the maximum time in milliseconds
+     *          the messages wait in the queue. If a value is 0, it sets the default value.
+     * \param   callback    The callback to deliver messages in batches. If nullptr, the messages
+     *                      are delivered one by one by the callbacks of sObserverEvents structure.
+     * \param   maxMessages The maximum number of messages in a batch.
+     * \param   maxLatency  The maximum time in milliseconds the messages wait in the queue.
+     **/
+    void setMessageBatch(FuncLogMessageBatch callback, uint32_t maxMessages, uint32_t maxLatency);
+
     /**
      * \brief   Creates of opens the database for the logging. If specified path is null or empty,
      *          if uses the location specified in the configuration file.
@@ -383,11 +405,27 @@ private:
      **/
     NEService::MapInstances     mInstances;
 
+    /**
+     * \brief   The names of threads and modules of connected instances.
+     **/
+    LogSourceNames              mLogNames;
+
     /**
      * \brief   The logging database engine.
      **/
     LogSqliteDatabase           mLogDatabase;
 
+    /**
+     * \brief   The queue to deliver log messages in batches.
+     **/
+    ObserverMessageQueue        mMessageQueue;
+
+    /**
+     * \brief   The callback to deliver log messages in batches. If nullptr, the messages
+     *          are delivered by the callbacks of sObserverEvents structure.
+     **/
+    FuncLogMessageBatch         mBatchCallback;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 
 ObserverMessageProcessor::ObserverMessageProcessor(LoggerClient& loggerClient)
     : mLoggerClient (loggerClient)
+    , mLogMessages  ( )
 {
 }
 
@@ -106,6 +107,7 @@ void ObserverMessageProcessor::notifyConnectedClients(const RemoteMessage& msgRe
                     msgReceived >> listDisconnect[i];
                     const ITEM_ID& cookie{ listDisconnect[i] };
 
+                    mLoggerClient.mLogNames.removeSource(cookie);
                     if (mLoggerClient.mInstances.removeAt(cookie))
                     {
                         mLoggerClient.mLogDatabase.logInstanceDisconnected(cookie, now);
@@ -228,56 +230,111 @@ void ObserverMessageProcessor::notifyLogUpdateScopes(const RemoteMessage& msgRec
 }
 
 void ObserverMessageProcessor::notifyLogMessage(const RemoteMessage& msgReceived)
+{
+    bool isBatch{ false };
+    do
+    {
+        Lock lock(mLoggerClient.mLock);
+        isBatch = (mLoggerClient.mBatchCallback != nullptr);
+    } while (false);
+
+    if (isBatch)
+    {
+        _queueLogMessages(msgReceived);
+    }
+    else
+    {
+        _notifyLogMessages(msgReceived);
+    }
+}
+
+void ObserverMessageProcessor::_notifyLogMessages(const RemoteMessage& msgReceived)
 {
     FuncLogMessage evtMessage{ nullptr };
     FuncLogMessageEx evtMessageEx{ nullptr };
     sLogMessage msgLog{ };
-    const unsigned char* logBuffer{ nullptr };
-    unsigned int size{ 0 };
+    NETrace::sLogMessage msgRemote{ };
     DateTime now{ DateTime::getNow() };
+    uint32_t position{ 0u };
+    bool hasRecord{ true };
 
-    do
+    // the message may contain a batch of records, every record is notified separately.
+    while (hasRecord)
     {
-        Lock lock(mLoggerClient.mLock);
-        const NETrace::sLogMessage* msgRemote = reinterpret_cast<const NETrace::sLogMessage*>(msgReceived.getBuffer());
-        ASSERT(msgRemote != nullptr);
-        mLoggerClient.mLogDatabase.logMessage(*msgRemote, now);
-        mLoggerClient.mLogDatabase.commit(true);
+        evtMessage = nullptr;
+        evtMessageEx = nullptr;
 
-        if (mLoggerClient.mCallbacks != nullptr)
+        do
         {
-            if (mLoggerClient.mCallbacks->evtLogMessage != nullptr)
-            {
-                evtMessage = mLoggerClient.mCallbacks->evtLogMessage;
-
-                msgLog.msgType      = static_cast<eLogType>(msgRemote->logMsgType);
-                msgLog.msgPriority  = static_cast<eLogPriority>(msgRemote->logMessagePrio);
-                msgLog.msgSource    = static_cast<unsigned long long>(msgRemote->logSource);
-                msgLog.msgCookie    = static_cast<unsigned long long>(msgRemote->logCookie);
-                msgLog.msgModuleId  = static_cast<unsigned long long>(msgRemote->logModuleId);
-                msgLog.msgThreadId  = static_cast<unsigned long long>(msgRemote->logThreadId);
-                msgLog.msgTimestamp = static_cast<unsigned long long>(msgRemote->logTimestamp);
-                msgLog.msgScopeId   = static_cast<unsigned int>(msgRemote->logScopeId);
-
-                NEString::copyString(msgLog.msgLogText, LENGTH_MESSAGE, msgRemote->logMessage, msgRemote->logMessageLen);
-                NEString::copyString(msgLog.msgThread, LENGTH_NAME, msgRemote->logThread, msgRemote->logThreadLen);
-                NEString::copyString(msgLog.msgModule, LENGTH_NAME, msgRemote->logModule, msgRemote->logModuleLen);
-            }
-            else if (mLoggerClient.mCallbacks->evtLogMessageEx != nullptr)
+            Lock lock(mLoggerClient.mLock);
+            hasRecord = mLoggerClient.mLogNames.decodeMessage(msgReceived, position, msgRemote);
+            if (hasRecord == false)
+                break;
+
+            // the database writes the messages in its own thread and commits them in groups.
+            mLoggerClient.mLogDatabase.logMessage(msgRemote, now);
+
+            if (mLoggerClient.mCallbacks != nullptr)
             {
-                evtMessageEx = mLoggerClient.mCallbacks->evtLogMessageEx;
-                logBuffer = msgReceived.getBuffer();
-                size = msgReceived.getSizeUsed();
+                if (mLoggerClient.mCallbacks->evtLogMessage != nullptr)
+                {
+                    evtMessage = mLoggerClient.mCallbacks->evtLogMessage;
+
+                    _convertLogMessage(msgRemote, msgLog);
+                }
+                else if (mLoggerClient.mCallbacks->evtLogMessageEx != nullptr)
+                {
+                    // the callback receives the decoded structure NETrace::sLogMessage
+                    evtMessageEx = mLoggerClient.mCallbacks->evtLogMessageEx;
+                }
             }
-        }
-    } while (false);
+        } while (false);
 
-    if (evtMessage != nullptr)
-    {
-        evtMessage(&msgLog);
+        if (evtMessage != nullptr)
+        {
+            evtMessage(&msgLog);
+        }
+        else if (evtMessageEx != nullptr)
+        {
+            evtMessageEx(reinterpret_cast<const unsigned char *>(&msgRemote), static_cast<uint32_t>(sizeof(NETrace::sLogMessage)));
+        }
     }
-    else if (evtMessageEx != nullptr)
+}
+
+void ObserverMessageProcessor::_queueLogMessages(const RemoteMessage& msgReceived)
+{
+    NETrace::sLogMessage msgRemote{ };
+    DateTime now{ DateTime::getNow() };
+    uint32_t position{ 0u };
+
+    do
     {
-        evtMessageEx(logBuffer, size);
-    }
+        Lock lock(mLoggerClient.mLock);
+        mLogMessages.clear();
+        while (mLoggerClient.mLogNames.decodeMessage(msgReceived, position, msgRemote))
+        {
+            mLoggerClient.mLogDatabase.logMessage(msgRemote, now);
+            mLogMessages.add(sLogMessage{});
+            _convertLogMessage(msgRemote, mLogMessages[mLogMessages.getSize() - 1u]);
+        }
+    } while (false);
+
+    // queuing may wait while the queue is full, it is done without holding the client lock.
+    mLoggerClient.mMessageQueue.pushMessages(mLogMessages);
+}
+
+inline void ObserverMessageProcessor::_convertLogMessage(const NETrace::sLogMessage& msgRemote, sLogMessage& msgLog)
+{
+    msgLog.msgType      = static_cast<eLogType>(msgRemote.logMsgType);
+    msgLog.msgPriority  = static_cast<eLogPriority>(msgRemote.logMessagePrio);
+    msgLog.msgSource    = static_cast<unsigned long long>(msgRemote.logSource);
+    msgLog.msgCookie    = static_cast<unsigned long long>(msgRemote.logCookie);
+    msgLog.msgModuleId  = static_cast<unsigned long long>(msgRemote.logModuleId);
+    msgLog.msgThreadId  = static_cast<unsigned long long>(msgRemote.logThreadId);
+    msgLog.msgTimestamp = static_cast<unsigned long long>(msgRemote.logTimestamp);
+    msgLog.msgScopeId   = static_cast<unsigned int>(msgRemote.logScopeId);
+
+    NEString::copyString(msgLog.msgLogText, LENGTH_MESSAGE, msgRemote.logMessage, msgRemote.logMessageLen);
+    NEString::copyString(msgLog.msgThread, LENGTH_NAME, msgRemote.logThread, msgRemote.logThreadLen);
+    NEString::copyString(msgLog.msgModule, LENGTH_NAME, msgRemote.logModule, msgRemote.logModuleLen);
 }
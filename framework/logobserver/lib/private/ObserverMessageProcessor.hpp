@@ -20,6 +20,9 @@
   * Include files.
   ************************************************************************/
 #include "logobserver/lib/LogObserverSwitches.h"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/trace/NETrace.hpp"
+#include "logobserver/lib/LogObserverApi.h"
 
 /************************************************************************
  * Dependencies
@@ -82,12 +85,35 @@ public:
      **/
     void notifyLogMessage(const RemoteMessage& msgReceived);
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Decodes the log records and triggers the callback per record.
+     * \param   msgReceived     The buffer with the log message.
+     **/
+    void _notifyLogMessages(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Decodes the log records and adds them to the queue to deliver in batches.
+     * \param   msgReceived     The buffer with the log message.
+     **/
+    void _queueLogMessages(const RemoteMessage& msgReceived);
+
+    /**
+     * \brief   Converts the decoded log message to the structure of the log observer API.
+     **/
+    inline static void _convertLogMessage(const NETrace::sLogMessage& msgRemote, sLogMessage& msgLog);
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden members.
 //////////////////////////////////////////////////////////////////////////
 private:
     LoggerClient &  mLoggerClient;  //!< The object of the observer client.
 
+    TEArrayList<sLogMessage>    mLogMessages;   //!< The decoded log messages to add to the queue.
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
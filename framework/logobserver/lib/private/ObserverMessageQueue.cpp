@@ -0,0 +1,181 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logobserver/lib/private/ObserverMessageQueue.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Observer library API.
+ *              The queue to deliver log messages in batches.
+ ************************************************************************/
+
+#include "logobserver/lib/private/ObserverMessageQueue.hpp"
+
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////
+// ObserverMessageQueue class implementation
+//////////////////////////////////////////////////////////////////////////
+
+ObserverMessageQueue::ObserverMessageQueue( void )
+    : IEThreadConsumer  ( )
+    , mDeliveryThread   ( static_cast<IEThreadConsumer &>(self()), DELIVERY_THREAD_NAME )
+    , mQueueLock        ( false )
+    , mQueueEvent       ( true, true )
+    , mSpaceEvent       ( true, true )
+    , mDeliveryQuit     ( false )
+    , mDeliveryRuns     ( false )
+    , mCallback         ( nullptr )
+    , mBatchSize        ( DEFAULT_BATCH_SIZE )
+    , mLatency          ( DEFAULT_LATENCY )
+    , mQueue            ( )
+    , mDelivering       ( )
+{
+}
+
+ObserverMessageQueue::~ObserverMessageQueue( void )
+{
+    stopDelivery( );
+}
+
+void ObserverMessageQueue::startDelivery( void )
+{
+    if ( mDeliveryRuns == false )
+    {
+        mDeliveryQuit = false;
+        mDeliveryRuns = mDeliveryThread.createThread( NECommon::WAIT_INFINITE );
+    }
+}
+
+void ObserverMessageQueue::stopDelivery( void )
+{
+    if ( mDeliveryRuns )
+    {
+        mDeliveryRuns = false;
+        mDeliveryQuit = true;
+        mQueueEvent.setEvent( );
+        mDeliveryThread.shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    _deliverQueued( );
+    mSpaceEvent.setEvent( );
+}
+
+void ObserverMessageQueue::setCallback( FuncLogMessageBatch callback )
+{
+    Lock lock( mQueueLock );
+    mCallback = callback;
+    if ( mCallback == nullptr )
+    {
+        mQueue.clear( );
+    }
+}
+
+void ObserverMessageQueue::setLimits( uint32_t maxMessages, uint32_t maxLatency )
+{
+    Lock lock( mQueueLock );
+    mBatchSize  = maxMessages != 0u ? maxMessages : DEFAULT_BATCH_SIZE;
+    mLatency    = maxLatency  != 0u ? maxLatency  : DEFAULT_LATENCY;
+}
+
+void ObserverMessageQueue::pushMessages( const TEArrayList<sLogMessage> & messages )
+{
+    FuncLogMessageBatch callback{ nullptr };
+    bool isQueued{ messages.isEmpty( ) };
+    bool doSignal{ false };
+    uint32_t latency{ DEFAULT_LATENCY };
+
+    while ( isQueued == false )
+    {
+        do
+        {
+            Lock lock( mQueueLock );
+            latency = mLatency;
+            if ( mDeliveryRuns == false )
+            {
+                // no delivery thread, the messages are delivered in the calling thread.
+                callback = mCallback;
+                isQueued = true;
+            }
+            else if ( mQueue.getSize( ) < mBatchSize * QUEUE_BATCHES )
+            {
+                bool wasEmpty{ mQueue.isEmpty( ) };
+                mQueue.append( messages );
+                isQueued = true;
+                doSignal = wasEmpty || (mQueue.getSize( ) >= mBatchSize);
+            }
+        } while ( false );
+
+        if ( isQueued == false )
+        {
+            // the queue is full, wait until the delivery thread takes the messages.
+            mQueueEvent.setEvent( );
+            mSpaceEvent.lock( latency );
+        }
+    }
+
+    if ( doSignal )
+    {
+        mQueueEvent.setEvent( );
+    }
+    else if ( callback != nullptr )
+    {
+        callback( messages.getData( ).data( ), messages.getSize( ) );
+    }
+}
+
+void ObserverMessageQueue::onThreadRuns( void )
+{
+    while ( mDeliveryQuit == false )
+    {
+        // waits for the first message, then collects messages until the batch is full or the latency expires.
+        mQueueEvent.lock( NECommon::WAIT_INFINITE );
+
+        bool isFull{ false };
+        uint32_t latency{ DEFAULT_LATENCY };
+        do
+        {
+            Lock lock( mQueueLock );
+            isFull  = mQueue.getSize( ) >= mBatchSize;
+            latency = mLatency;
+        } while ( false );
+
+        if ( (isFull == false) && (mDeliveryQuit == false) )
+        {
+            mQueueEvent.lock( latency );
+        }
+
+        _deliverQueued( );
+    }
+}
+
+void ObserverMessageQueue::_deliverQueued( void )
+{
+    FuncLogMessageBatch callback{ nullptr };
+    uint32_t batchSize{ DEFAULT_BATCH_SIZE };
+
+    do
+    {
+        Lock lock( mQueueLock );
+        std::swap( mQueue, mDelivering );
+        callback  = mCallback;
+        batchSize = mBatchSize;
+    } while ( false );
+
+    mSpaceEvent.setEvent( );
+
+    // the callback is triggered without holding any lock.
+    const sLogMessage * messages{ mDelivering.getData( ).data( ) };
+    const uint32_t count{ mDelivering.getSize( ) };
+    for ( uint32_t i = 0; (callback != nullptr) && (i < count); i += batchSize )
+    {
+        callback( messages + i, MACRO_MIN( batchSize, count - i ) );
+    }
+
+    mDelivering.clear( );
+}
@@ -0,0 +1,202 @@
+#ifndef AREG_LOGOBSERVER_LIB_PRIVATE_OBSERVERMESSAGEQUEUE_HPP
+#define AREG_LOGOBSERVER_LIB_PRIVATE_OBSERVERMESSAGEQUEUE_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logobserver/lib/private/ObserverMessageQueue.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Observer library API.
+ *              The queue to deliver log messages in batches.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "logobserver/lib/LogObserverSwitches.h"
+#include "areg/base/IEThreadConsumer.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/Thread.hpp"
+
+#include "logobserver/lib/LogObserverApi.h"
+
+#include <atomic>
+#include <string_view>
+
+//////////////////////////////////////////////////////////////////////////
+// ObserverMessageQueue class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The bounded queue of the log messages to deliver to the log observer
+ *          by the callback of the FuncLogMessageBatch type. The messages are delivered
+ *          in the own thread, so that the slow callback does not block receiving
+ *          messages from the logger service. The messages are delivered when the queue
+ *          contains the maximum number of messages of a batch or when the maximum latency
+ *          expires after the first message is queued. If the queue is full, the thread
+ *          that queues messages waits until the messages are delivered.
+ **/
+class ObserverMessageQueue   : private IEThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   ObserverMessageQueue::DEFAULT_BATCH_SIZE
+     *          The default maximum number of messages delivered in a single call.
+     **/
+    static constexpr uint32_t           DEFAULT_BATCH_SIZE      { 256 };
+
+    /**
+     * \brief   ObserverMessageQueue::DEFAULT_LATENCY
+     *          The default maximum time in milliseconds the messages stay in the queue.
+     **/
+    static constexpr uint32_t           DEFAULT_LATENCY         { 50 };
+
+    /**
+     * \brief   ObserverMessageQueue::QUEUE_BATCHES
+     *          The capacity of the queue as a number of batches.
+     **/
+    static constexpr uint32_t           QUEUE_BATCHES           { 16 };
+
+    /**
+     * \brief   ObserverMessageQueue::DELIVERY_THREAD_NAME
+     *          The name of the thread to deliver log messages.
+     **/
+    static constexpr std::string_view   DELIVERY_THREAD_NAME    { "_AREG_LOG_OBSERVER_DELIVERY_" };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    ObserverMessageQueue( void );
+    virtual ~ObserverMessageQueue( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Starts the thread to deliver log messages. Does nothing if the thread already runs.
+     **/
+    void startDelivery( void );
+
+    /**
+     * \brief   Stops the thread to deliver log messages and delivers the remaining queued messages.
+     **/
+    void stopDelivery( void );
+
+    /**
+     * \brief   Sets the callback to deliver the log messages. If the callback is nullptr,
+     *          the queued messages are dropped.
+     * \param   callback    The callback to deliver messages.
+     **/
+    void setCallback( FuncLogMessageBatch callback );
+
+    /**
+     * \brief   Sets the maximum number of messages in a batch and the maximum latency
+     *          in milliseconds. If a value is 0, it sets the default value.
+     * \param   maxMessages The maximum number of messages in a batch.
+     * \param   maxLatency  The maximum time in milliseconds the messages wait in the queue.
+     **/
+    void setLimits( uint32_t maxMessages, uint32_t maxLatency );
+
+    /**
+     * \brief   Adds the log messages to the queue. If the queue is full, the calling
+     *          thread waits until the delivery thread takes the queued messages.
+     * \param   messages    The list of messages to add.
+     **/
+    void pushMessages( const TEArrayList<sLogMessage> & messages );
+
+    /**
+     * \brief   Returns true if the thread to deliver messages runs.
+     **/
+    inline bool isRunning( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// IEThreadConsumer interface overrides.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Waits for the messages in the queue and delivers them.
+     **/
+    virtual void onThreadRuns( void ) override;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Takes the queued messages and delivers them by calling the callback
+     *          once per batch of maximum size.
+     **/
+    void _deliverQueued( void );
+
+    inline ObserverMessageQueue & self( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The thread to deliver log messages.
+    Thread                  mDeliveryThread;
+
+    //!< The lock to synchronize the access to the queue.
+    ResourceLock            mQueueLock;
+
+    //!< The event signaled when the first message is queued or the batch is full.
+    SynchEvent              mQueueEvent;
+
+    //!< The event signaled when the delivery thread takes the queued messages.
+    SynchEvent              mSpaceEvent;
+
+    //!< Flag, indicating whether the delivery thread should exit.
+    std::atomic_bool        mDeliveryQuit;
+
+    //!< Flag, indicating whether the delivery thread runs.
+    std::atomic_bool        mDeliveryRuns;
+
+    //!< The callback to deliver messages.
+    FuncLogMessageBatch     mCallback;
+
+    //!< The maximum number of messages in a batch.
+    uint32_t                mBatchSize;
+
+    //!< The maximum time in milliseconds the messages wait in the queue.
+    uint32_t                mLatency;
+
+    //!< The queued messages.
+    TEArrayList<sLogMessage>    mQueue;
+
+    //!< The messages taken from the queue to deliver.
+    TEArrayList<sLogMessage>    mDelivering;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( ObserverMessageQueue );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ObserverMessageQueue inline methods.
+//////////////////////////////////////////////////////////////////////////
+
+inline bool ObserverMessageQueue::isRunning( void ) const
+{
+    return mDeliveryRuns;
+}
+
+inline ObserverMessageQueue & ObserverMessageQueue::self( void )
+{
+    return (*this);
+}
+
+#endif  // AREG_LOGOBSERVER_LIB_PRIVATE_OBSERVERMESSAGEQUEUE_HPP
@@ -20,12 +20,17 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 
+#include "areg/base/NESocket.hpp"
+#include "areg/base/TEMap.hpp"
 #include "areg/ipc/IEServiceRegisterConsumer.hpp"
 #include "areg/ipc/IEServiceRegisterProvider.hpp"
 #include "extend/service/ServiceCommunicatonBase.hpp"
 
 #include "mcrouter/service/private/ServiceRegistry.hpp"
 
+#include <random>
+#include <utility>
+
 //////////////////////////////////////////////////////////////////////////
 // RouterServerService class declaration
 //////////////////////////////////////////////////////////////////////////
@@ -217,12 +222,49 @@ private:
      **/
     inline RouterServerService & self( void );
 
+    /**
+     * \brief   Sends to the service consumer the endpoint of direct connection with
+     *          the service provider, if the provider announced the endpoint. Before,
+     *          announces the consumer to the service provider, so that the provider
+     *          accepts the direct connection only of the announced consumer.
+     *          Both processes receive the same secret of the pair.
+     * \param   provider    The cookie of the service provider process.
+     * \param   consumer    The cookie of the service consumer process to send the endpoint.
+     **/
+    void _sendDirectEndpoint( const ITEM_ID & provider, const ITEM_ID & consumer );
+
+    /**
+     * \brief   Returns the secret of the direct connection of the service provider and consumer.
+     *          The secret is generated once for the pair and is valid until one of processes disconnects.
+     **/
+    uint64_t _getDirectSecret( const ITEM_ID & provider, const ITEM_ID & consumer );
+
+    /**
+     * \brief   Returns the IP-address of the host of the process as seen by the target process.
+     *          If the process connected via loopback address and the target did not, returns
+     *          the address of the routing service in the network of the target.
+     * \param   cookie  The cookie of the process to return the address.
+     * \param   target  The cookie of the process to send the address.
+     **/
+    String _getDirectAddress( const ITEM_ID & cookie, const ITEM_ID & target ) const;
+
+    /**
+     * \brief   Removes the endpoint and the secrets of the direct connections of disconnected process.
+     **/
+    void _removeDirectPeer( const ITEM_ID & cookie );
+
 //////////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////////
 private:
     ServiceRegistry mServiceRegistry;   //!< The service registry map to track stub-proxy connections
 
+    TEMap<ITEM_ID, NESocket::SocketAddress> mDirectEndpoints;   //!< The endpoints of direct connections announced by the service providers
+
+    TEMap<std::pair<ITEM_ID, ITEM_ID>, uint64_t> mDirectSecrets; //!< The secrets of direct connections, where the keys are the cookies of provider and consumer
+
+    std::random_device  mRandomDevice;  //!< The source of random numbers to generate the secrets of direct connections
+
 //////////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////////
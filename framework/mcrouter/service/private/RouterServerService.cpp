@@ -37,11 +37,14 @@ DEF_TRACE_SCOPE(mcrouter_service_RouterServerService_onServiceMessageSend);
 //////////////////////////////////////////////////////////////////////////
 
 RouterServerService::RouterServerService( void )
-    : ServiceCommunicatonBase   ( NEService::COOKIE_ROUTER, NERemoteService::eRemoteServices::ServiceRouter, static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip), NEConnection::SERVER_DISPATCH_MESSAGE_THREAD, ServiceCommunicatonBase::eConnectionBehavior::DefaultAccept )
+    : ServiceCommunicatonBase   ( NEService::COOKIE_ROUTER, NERemoteService::eRemoteServices::ServiceRouter, static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectTcpip) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectSM) | static_cast<uint32_t>(NERemoteService::eConnectionTypes::ConnectUds), NEConnection::SERVER_DISPATCH_MESSAGE_THREAD, ServiceCommunicatonBase::eConnectionBehavior::DefaultAccept )
     , IEServiceRegisterConsumer ( )
     , IEServiceRegisterProvider ( )
 
     , mServiceRegistry          ( )
+    , mDirectEndpoints          ( )
+    , mDirectSecrets            ( )
+    , mRandomDevice             ( )
 {
 }
 
@@ -143,6 +146,7 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
             msgReceived >> cookie;
             removeInstance(cookie);
             mServerConnection.closeConnection(cookie);
+            _removeDirectPeer(cookie);
 
             TEArrayList<StubAddress>  listStubs;
             TEArrayList<ProxyAddress> listProxies;
@@ -165,6 +169,33 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
         }
         break;
 
+    case NEService::eFuncIdRange::SystemServiceDirectEndpoint:
+        {
+            // The secret is generated by the routing service, ignore the value sent by the process.
+            String address;
+            unsigned short portNr{ NESocket::InvalidPort };
+            uint64_t secret{ 0u };
+            msgReceived >> address;
+            msgReceived >> portNr;
+            msgReceived >> secret;
+            NESocket::SocketAddress endpoint(address, portNr);
+
+            TRACE_DBG("Routing service received direct connection endpoint [ %s : %u ] of source [ %u ]"
+                        , address.getString()
+                        , static_cast<uint32_t>(portNr)
+                        , static_cast<uint32_t>(source));
+
+            if ( endpoint.isValid() )
+            {
+                mDirectEndpoints.setAt(source, endpoint);
+            }
+            else
+            {
+                mDirectEndpoints.removeAt(source);
+            }
+        }
+        break;
+
     case NEService::eFuncIdRange::ServiceLastId:                    // fall through
     case NEService::eFuncIdRange::SystemServiceQueryInstances:      // fall through
     case NEService::eFuncIdRange::SystemServiceConnect:             // fall through
@@ -254,6 +285,8 @@ void RouterServerService::disconnectServices(void)
     }
 
     mServiceRegistry.clear( );
+    mDirectEndpoints.clear( );
+    mDirectSecrets.clear( );
 }
 
 void RouterServerService::extractRemoteServiceAddresses( const ITEM_ID & cookie, TEArrayList<StubAddress> & OUT out_listStubs, TEArrayList<ProxyAddress> & OUT out_lisProxies ) const
@@ -297,6 +330,7 @@ void RouterServerService::registeredRemoteServiceProvider(const StubAddress & st
 
                     if ( sendList.addIfUnique(addrProxy.getSource()) )
                     {
+                        _sendDirectEndpoint(stub.getSource(), addrProxy.getSource());
                         RemoteMessage msgRegisterStub  = NERemoteService::createServiceRegisteredNotification(stub, mServerConnection.getChannelId(), addrProxy.getSource());
                         sendMessage(msgRegisterStub);
 
@@ -365,6 +399,7 @@ void RouterServerService::registeredRemoteServiceConsumer(const ProxyAddress & p
                         , static_cast<uint32_t>(msgRegisterProxy.getSource())
                         , static_cast<uint32_t>(msgRegisterProxy.getTarget()));
 
+            _sendDirectEndpoint(addrStub.getSource(), proxy.getSource());
             RemoteMessage msgRegisterStub  = NERemoteService::createServiceRegisteredNotification(addrStub, mServerConnection.getChannelId(), proxy.getSource());
             sendMessage(msgRegisterStub);
 
@@ -480,6 +515,63 @@ void RouterServerService::unregisteredRemoteServiceConsumer(const ProxyAddress &
     }
 }
 
+void RouterServerService::_sendDirectEndpoint( const ITEM_ID & provider, const ITEM_ID & consumer )
+{
+    // The endpoint is sent before the service registration notification,
+    // so that the consumer can establish direct connection as early as possible.
+    TEMap<ITEM_ID, NESocket::SocketAddress>::MAPPOS pos = mDirectEndpoints.find(provider);
+    const String address{ _getDirectAddress(consumer, provider) };
+    if ( mDirectEndpoints.isValidPosition(pos) && (address.isEmpty() == false) )
+    {
+        // The provider is announced first, so that it does not reject the connection of consumer.
+        const uint64_t secret{ _getDirectSecret(provider, consumer) };
+        const NESocket::SocketAddress & endpoint = mDirectEndpoints.valueAtPosition(pos);
+        sendMessage( NERemoteService::createDirectEndpoint(address, NESocket::InvalidPort, secret, consumer, provider) );
+        sendMessage( NERemoteService::createDirectEndpoint(endpoint.getHostAddress(), endpoint.getHostPort(), secret, provider, consumer) );
+    }
+}
+
+uint64_t RouterServerService::_getDirectSecret( const ITEM_ID & provider, const ITEM_ID & consumer )
+{
+    const std::pair<ITEM_ID, ITEM_ID> key{ provider, consumer };
+    TEMap<std::pair<ITEM_ID, ITEM_ID>, uint64_t>::MAPPOS pos = mDirectSecrets.find(key);
+    uint64_t result{ mDirectSecrets.isValidPosition(pos) ? mDirectSecrets.valueAtPosition(pos) : 0u };
+    while ( result == 0u )
+    {
+        result = (static_cast<uint64_t>(mRandomDevice()) << 32) | static_cast<uint64_t>(mRandomDevice());
+        mDirectSecrets.setAt(key, result);
+    }
+
+    return result;
+}
+
+String RouterServerService::_getDirectAddress( const ITEM_ID & cookie, const ITEM_ID & target ) const
+{
+    const SocketAccepted client{ mServerConnection.getClientByCookie(cookie) };
+    const SocketAccepted peer{ mServerConnection.getClientByCookie(target) };
+    String result{ client.isValid() ? client.getAddress().getHostAddress() : String() };
+    if ( (result == NESocket::LocalAddress) && peer.isValid() && (peer.getAddress().getHostAddress() != NESocket::LocalAddress) )
+    {
+        // The process runs on the same host as the routing service, it connects to the target via the network of the target.
+        NESocket::SocketAddress local;
+        result = local.resolveLocalSocket(peer.getHandle()) ? local.getHostAddress() : result;
+    }
+
+    return result;
+}
+
+void RouterServerService::_removeDirectPeer( const ITEM_ID & cookie )
+{
+    mDirectEndpoints.removeAt(cookie);
+
+    TEMap<std::pair<ITEM_ID, ITEM_ID>, uint64_t>::MAPPOS pos = mDirectSecrets.firstPosition();
+    while ( mDirectSecrets.isValidPosition(pos) )
+    {
+        const std::pair<ITEM_ID, ITEM_ID> & key = mDirectSecrets.keyAtPosition(pos);
+        pos = (key.first == cookie) || (key.second == cookie) ? mDirectSecrets.removePosition(pos) : mDirectSecrets.nextPosition(pos);
+    }
+}
+
 void RouterServerService::connectedRemoteServiceChannel(const Channel & /* channel */)
 {
 
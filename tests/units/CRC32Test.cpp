@@ -0,0 +1,120 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/CRC32Test.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of CRC32 calculation.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/trace/NETrace.hpp"
+
+#include <string_view>
+
+namespace
+{
+    /**
+     * \brief   The reference byte-wise CRC32 calculation without lookup tables.
+     **/
+    unsigned int _crc32Reference( const unsigned char * data, int size )
+    {
+        unsigned int crc{ 0xFFFFFFFFu };
+        for ( int i = 0; i < size; ++ i )
+        {
+            crc ^= data[i];
+            for ( int bit = 0; bit < 8; ++ bit )
+            {
+                crc = (crc >> 1) ^ (NEMath::CRC32_POLYNOMIAL & (0u - (crc & 1u)));
+            }
+        }
+
+        return ~crc;
+    }
+
+    //!< The name of the scope to check the compile time scope ID.
+    constexpr std::string_view  SCOPE_NAME  { "areg_unit_tests_CRC32Test_ConstexprEqualsScopeId" };
+    //!< The scope ID calculated at compile time.
+    constexpr unsigned int      SCOPE_ID    { NEMath::crc32Constexpr( SCOPE_NAME.data( ) ) };
+}
+
+/**
+ * \brief   Checks the CRC32 of the known check values.
+ **/
+TEST( CRC32Test, KnownValues )
+{
+    constexpr char check[]  { "123456789" };
+    constexpr char fox[]    { "The quick brown fox jumps over the lazy dog" };
+
+    EXPECT_EQ( NEMath::crc32Calculate( check ), 0xCBF43926u );
+    EXPECT_EQ( NEMath::crc32Calculate( reinterpret_cast<const unsigned char *>(check), 9 ), 0xCBF43926u );
+    EXPECT_EQ( NEMath::crc32Calculate( fox ), 0x414FA339u );
+    EXPECT_EQ( NEMath::crc32Calculate( "a" ), 0xE8B7BE43u );
+    EXPECT_EQ( NEMath::crc32Calculate( reinterpret_cast<const unsigned char *>(fox), 0 ), 0u );
+}
+
+/**
+ * \brief   Compares the table based CRC32 with the byte-wise reference
+ *          on buffers of any length starting at any alignment.
+ **/
+TEST( CRC32Test, UnalignedAndOddLength )
+{
+    constexpr int MAX_LENGTH{ 300 };
+    constexpr int MAX_OFFSET{ 8 };
+    unsigned char buffer[MAX_LENGTH + MAX_OFFSET];
+    unsigned int seed{ 0x12345678u };
+    for ( unsigned char & ch : buffer )
+    {
+        seed = seed * 1103515245u + 12345u;
+        ch = static_cast<unsigned char>(seed >> 16);
+    }
+
+    for ( int offset = 0; offset < MAX_OFFSET; ++ offset )
+    {
+        for ( int length = 0; length <= MAX_LENGTH; ++ length )
+        {
+            const unsigned char * data = buffer + offset;
+            ASSERT_EQ( NEMath::crc32Calculate( data, length ), _crc32Reference( data, length ) ) << "offset " << offset << ", length " << length;
+        }
+    }
+}
+
+/**
+ * \brief   The CRC32 calculated in several steps is equal to the CRC32 of whole buffer.
+ **/
+TEST( CRC32Test, CalculateInSteps )
+{
+    constexpr char fox[]    { "The quick brown fox jumps over the lazy dog" };
+    const unsigned char * data = reinterpret_cast<const unsigned char *>(fox);
+    const int length{ static_cast<int>(sizeof(fox) - 1) };
+
+    for ( int split = 0; split <= length; ++ split )
+    {
+        unsigned int crc = NEMath::crc32Init( );
+        crc = NEMath::crc32Start( crc, data, split );
+        crc = NEMath::crc32Start( crc, data + split, length - split );
+        ASSERT_EQ( NEMath::crc32Finish( crc ), 0x414FA339u );
+    }
+}
+
+/**
+ * \brief   The CRC32 calculated at compile time is equal to the CRC32 calculated
+ *          at run time and to the scope ID used by the logging.
+ **/
+TEST( CRC32Test, ConstexprEqualsScopeId )
+{
+    static_assert( NEMath::crc32Constexpr( "123456789" ) == 0xCBF43926u, "Invalid compile time CRC32" );
+
+    EXPECT_EQ( SCOPE_ID, NEMath::crc32Calculate( SCOPE_NAME.data( ) ) );
+    EXPECT_EQ( SCOPE_ID, NETrace::makeScopeId( SCOPE_NAME.data( ) ) );
+    EXPECT_EQ( NEMath::crc32Constexpr( "" ), NEMath::crc32Calculate( "" ) );
+}
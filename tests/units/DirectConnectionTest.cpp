@@ -0,0 +1,156 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/DirectConnectionTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of accepting and binding
+ *              direct connections of service processes.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/private/DirectConnection.hpp"
+
+namespace
+{
+    //!< The loopback address to listen direct connections.
+    constexpr char      LOOPBACK_ADDRESS[]  { "127.0.0.1" };
+    //!< The first port to listen direct connections.
+    constexpr unsigned short FIRST_PORT     { 18583u };
+    //!< The cookie of the process of service provider.
+    constexpr ITEM_ID   PROVIDER_COOKIE     { NEService::COOKIE_REMOTE_SERVICE + 10u };
+    //!< The cookie of the process of service consumer.
+    constexpr ITEM_ID   CONSUMER_COOKIE     { NEService::COOKIE_REMOTE_SERVICE + 20u };
+    //!< The secret of the pair of processes.
+    constexpr uint64_t  PAIR_SECRET         { 0x0123456789ABCDEFu };
+
+    /**
+     * \brief   The provider and consumer processes listening direct connections.
+     **/
+    class DirectConnectionTest : public ::testing::Test
+    {
+    protected:
+        virtual void SetUp( void ) override
+        {
+            ASSERT_TRUE( mProvider.createSocket( LOOPBACK_ADDRESS, FIRST_PORT ) );
+            ASSERT_TRUE( mConsumer.createSocket( LOOPBACK_ADDRESS, FIRST_PORT ) );
+            mProvider.setCookie( PROVIDER_COOKIE );
+            mConsumer.setCookie( CONSUMER_COOKIE );
+        }
+
+        virtual void TearDown( void ) override
+        {
+            mConsumer.closeSocket( );
+            mProvider.closeSocket( );
+        }
+
+        /**
+         * \brief   The consumer connects to the provider and introduces itself with specified secret.
+         *          Returns true if the provider accepted the connection.
+         **/
+        bool connect( const ITEM_ID & cookie, uint64_t secret )
+        {
+            mConsumer.closePeers( );
+            mConsumer.setCookie( cookie );
+            mConsumer.queuePeer( PROVIDER_COOKIE, mProvider.getAddress( ), secret );
+            mConsumer.connectPeers( );
+
+            SocketPoller::sPollEvent events[SocketPoller::MAX_POLL_EVENTS];
+            return (mProvider.waitForConnectionEvents( events, SocketPoller::MAX_POLL_EVENTS ) == 1) &&
+                   (events[0].peSocket == mProvider.getSocketHandle( )) &&
+                   mProvider.acceptPeer( );
+        }
+
+        /**
+         * \brief   Receives the introduction of the consumer by the provider and binds the connection.
+         *          Returns true if the provider bound the connection with the cookie of consumer.
+         **/
+        bool introduce( const ITEM_ID & cookie )
+        {
+            SocketPoller::sPollEvent events[SocketPoller::MAX_POLL_EVENTS];
+            if ( mProvider.waitForConnectionEvents( events, SocketPoller::MAX_POLL_EVENTS ) != 1 )
+                return false;
+
+            const SOCKETHANDLE hSocket{ events[0].peSocket };
+            const SocketAccepted peer{ mProvider.getPeerByHandle( hSocket ) };
+            RemoteMessage msgIntroduce;
+            if ( (peer.isValid( ) == false) || (mProvider.receiveMessage( msgIntroduce, peer ) <= 0) )
+                return false;
+
+            const bool result{ mProvider.bindPeer( hSocket, msgIntroduce ) };
+            if ( result == false )
+            {
+                mProvider.closePeer( hSocket );
+            }
+
+            return result && mProvider.isPeerConnected( cookie ) && (mProvider.getPeerCookie( hSocket ) == cookie);
+        }
+
+    protected:
+        DirectConnection    mProvider;
+        DirectConnection    mConsumer;
+    };
+}
+
+/**
+ * \brief   The connection is rejected if the routing service did not announce any consumer.
+ **/
+TEST_F( DirectConnectionTest, RejectsNotAnnouncedHost )
+{
+    ASSERT_FALSE( connect( CONSUMER_COOKIE, PAIR_SECRET ) );
+
+    mProvider.announcePeer( CONSUMER_COOKIE, "192.0.2.1", PAIR_SECRET );
+    ASSERT_FALSE( connect( CONSUMER_COOKIE, PAIR_SECRET ) );
+    ASSERT_FALSE( mProvider.isPeerConnected( CONSUMER_COOKIE ) );
+}
+
+/**
+ * \brief   The announced consumer with the announced secret is bound.
+ **/
+TEST_F( DirectConnectionTest, BindsAnnouncedPeer )
+{
+    mProvider.announcePeer( CONSUMER_COOKIE, LOOPBACK_ADDRESS, PAIR_SECRET );
+    ASSERT_TRUE( connect( CONSUMER_COOKIE, PAIR_SECRET ) );
+    ASSERT_TRUE( introduce( CONSUMER_COOKIE ) );
+    ASSERT_TRUE( mConsumer.isPeerConnected( PROVIDER_COOKIE ) );
+}
+
+/**
+ * \brief   The introduction with wrong secret, or of not announced cookie is rejected,
+ *          so that another process cannot take the cookie of announced consumer.
+ **/
+TEST_F( DirectConnectionTest, RejectsWrongSecretAndCookie )
+{
+    mProvider.announcePeer( CONSUMER_COOKIE, LOOPBACK_ADDRESS, PAIR_SECRET );
+
+    ASSERT_TRUE( connect( CONSUMER_COOKIE, PAIR_SECRET + 1u ) );
+    ASSERT_FALSE( introduce( CONSUMER_COOKIE ) );
+    ASSERT_FALSE( mProvider.isPeerConnected( CONSUMER_COOKIE ) );
+
+    ASSERT_TRUE( connect( CONSUMER_COOKIE + 1u, PAIR_SECRET ) );
+    ASSERT_FALSE( introduce( CONSUMER_COOKIE + 1u ) );
+    ASSERT_FALSE( mProvider.isPeerConnected( CONSUMER_COOKIE + 1u ) );
+
+    // the announced consumer still can connect.
+    ASSERT_TRUE( connect( CONSUMER_COOKIE, PAIR_SECRET ) );
+    ASSERT_TRUE( introduce( CONSUMER_COOKIE ) );
+}
+
+/**
+ * \brief   The announced peers are dropped when the connection with routing service is lost.
+ **/
+TEST_F( DirectConnectionTest, ClosePeersDropsAnnouncedPeers )
+{
+    mProvider.announcePeer( CONSUMER_COOKIE, LOOPBACK_ADDRESS, PAIR_SECRET );
+    mProvider.closePeers( );
+    ASSERT_FALSE( connect( CONSUMER_COOKIE, PAIR_SECRET ) );
+}
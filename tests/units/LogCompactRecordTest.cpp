@@ -0,0 +1,214 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogCompactRecordTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of compact remote log records.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/trace/NETrace.hpp"
+
+#include <limits>
+#include <string_view>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The text of the log messages.
+    constexpr std::string_view  LOG_TEXT    { "The compact log record test message." };
+
+    //!< The values at the boundaries of the variable length encoding.
+    constexpr uint64_t  VARINT_VALUES[]
+    {
+          0u
+        , 127u
+        , 128u
+        , 0xFFFFFFFFu
+        , std::numeric_limits<uint64_t>::max( )
+    };
+
+    /**
+     * \brief   Creates the log message with all numeric fields set to the specified value.
+     **/
+    NETrace::sLogMessage _createLog( uint64_t value )
+    {
+        NETrace::sLogMessage result( NETrace::eLogMessageType::LogMessageText
+                                   , static_cast<unsigned int>(value)
+                                   , NETrace::eLogPriority::PrioWarning
+                                   , LOG_TEXT.data( )
+                                   , static_cast<unsigned int>(LOG_TEXT.length( )) );
+        result.logSource    = static_cast<ITEM_ID>(value);
+        result.logTarget    = static_cast<ITEM_ID>(value);
+        result.logModuleId  = static_cast<ITEM_ID>(value);
+        result.logThreadId  = static_cast<ITEM_ID>(value);
+        result.logTimestamp = static_cast<TIME64>(value);
+        return result;
+    }
+
+    /**
+     * \brief   Compares the fields of the sent and decoded log messages.
+     **/
+    void _compare( const NETrace::sLogMessage & expected, const NETrace::sLogMessage & actual )
+    {
+        ASSERT_EQ( expected.logMsgType, actual.logMsgType );
+        ASSERT_EQ( expected.logMessagePrio, actual.logMessagePrio );
+        ASSERT_EQ( expected.logSource, actual.logSource );
+        ASSERT_EQ( expected.logTarget, actual.logTarget );
+        ASSERT_EQ( expected.logModuleId, actual.logModuleId );
+        ASSERT_EQ( expected.logThreadId, actual.logThreadId );
+        ASSERT_EQ( expected.logTimestamp, actual.logTimestamp );
+        ASSERT_EQ( expected.logScopeId, actual.logScopeId );
+        ASSERT_EQ( expected.logMessageLen, actual.logMessageLen );
+        ASSERT_EQ( std::string_view( expected.logMessage, expected.logMessageLen ), std::string_view( actual.logMessage, actual.logMessageLen ) );
+    }
+
+    /**
+     * \brief   Returns the message containing the first bytes of the data of the source message.
+     **/
+    RemoteMessage _truncate( const RemoteMessage & msgSource, uint32_t length )
+    {
+        RemoteMessage result;
+        result.initMessage( msgSource.getRemoteMessage( )->rbHeader, length );
+        result.write( msgSource.getBuffer( ), length );
+        result.setSizeUsed( length );
+        return result;
+    }
+}
+
+/**
+ * \brief   The numeric fields at the boundaries of the variable length encoding
+ *          are decoded with the same values.
+ **/
+TEST( LogCompactRecordTest, VarintBoundaries )
+{
+    constexpr ITEM_ID cookie{ 1234u };
+    for ( uint64_t value : VARINT_VALUES )
+    {
+        const NETrace::sLogMessage logMessage{ _createLog( value ) };
+        RemoteMessage msgLog{ NETrace::createCompactLogMessage( logMessage, cookie, NETrace::CompactNoNames ) };
+        ASSERT_TRUE( msgLog.isValid( ) );
+
+        NETrace::sLogMessage decoded;
+        unsigned char flags{ NETrace::CompactAllNames };
+        ASSERT_TRUE( NETrace::readLogMessage( msgLog, decoded, flags ) ) << "value " << value;
+        ASSERT_EQ( flags, NETrace::CompactNoNames );
+        ASSERT_EQ( decoded.logCookie, cookie );
+        _compare( logMessage, decoded );
+    }
+}
+
+/**
+ * \brief   The names of the thread and the module are decoded if they are in the record.
+ **/
+TEST( LogCompactRecordTest, RecordWithNames )
+{
+    RemoteMessage msgNames{ NETrace::createCompactLogNames( 1u, 2u, 3u, String( "test_thread" ), String( "test_module" ) ) };
+
+    NETrace::sLogMessage decoded;
+    unsigned char flags{ NETrace::CompactNoNames };
+    ASSERT_TRUE( NETrace::readLogMessage( msgNames, decoded, flags ) );
+    ASSERT_EQ( flags, NETrace::CompactNamesOnly | NETrace::CompactAllNames );
+    ASSERT_EQ( decoded.logThreadId, 3u );
+    ASSERT_EQ( std::string_view( decoded.logThread, decoded.logThreadLen ), "test_thread" );
+    ASSERT_EQ( std::string_view( decoded.logModule, decoded.logModuleLen ), "test_module" );
+}
+
+/**
+ * \brief   The records of the batch are decoded one by one in the same order.
+ **/
+TEST( LogCompactRecordTest, BatchRoundTrip )
+{
+    RemoteMessage msgBatch{ NETrace::createLogBatch( 1u, 1024u ) };
+    for ( uint64_t value : VARINT_VALUES )
+    {
+        ASSERT_TRUE( NETrace::appendLogBatch( msgBatch, _createLog( value ), NETrace::CompactNoNames ) );
+    }
+
+    uint32_t position{ 0u };
+    for ( uint64_t value : VARINT_VALUES )
+    {
+        NETrace::sLogMessage decoded;
+        unsigned char flags{ NETrace::CompactNoNames };
+        ASSERT_TRUE( NETrace::readLogMessage( msgBatch, position, decoded, flags ) );
+        _compare( _createLog( value ), decoded );
+    }
+
+    NETrace::sLogMessage decoded;
+    unsigned char flags{ NETrace::CompactNoNames };
+    ASSERT_FALSE( NETrace::readLogMessage( msgBatch, position, decoded, flags ) );
+    ASSERT_EQ( position, msgBatch.getSizeUsed( ) );
+}
+
+/**
+ * \brief   Every truncated record is rejected, and so are the records
+ *          with unknown version and with the text longer than the record.
+ **/
+TEST( LogCompactRecordTest, MalformedRecords )
+{
+    const NETrace::sLogMessage logMessage{ _createLog( std::numeric_limits<uint64_t>::max( ) ) };
+    RemoteMessage msgLog{ NETrace::createCompactLogMessage( logMessage, 1u, NETrace::CompactNoNames ) };
+    const uint32_t size{ msgLog.getSizeUsed( ) };
+
+    NETrace::sLogMessage decoded;
+    unsigned char flags{ NETrace::CompactNoNames };
+    for ( uint32_t length = 1u; length < size; ++ length )
+    {
+        ASSERT_FALSE( NETrace::readLogMessage( _truncate( msgLog, length ), decoded, flags ) ) << "length " << length;
+    }
+
+    // unknown version.
+    RemoteMessage msgVersion{ _truncate( msgLog, size ) };
+    msgVersion.getBuffer( )[1] = static_cast<unsigned char>(NETrace::LOG_COMPACT_VERSION + 1u);
+    ASSERT_FALSE( NETrace::readLogMessage( msgVersion, decoded, flags ) );
+
+    // the length of the text is bigger than the rest of the record.
+    RemoteMessage msgText{ _truncate( msgLog, size ) };
+    msgText.getBuffer( )[size - LOG_TEXT.length( ) - 1u] = static_cast<unsigned char>(LOG_TEXT.length( ) + 1u);
+    ASSERT_FALSE( NETrace::readLogMessage( msgText, decoded, flags ) );
+
+    // the batch with the record longer than the message.
+    RemoteMessage msgBatch{ NETrace::createLogBatch( 1u, 256u ) };
+    ASSERT_TRUE( NETrace::appendLogBatch( msgBatch, logMessage, NETrace::CompactNoNames ) );
+    RemoteMessage msgShort{ _truncate( msgBatch, msgBatch.getSizeUsed( ) - 1u ) };
+    uint32_t position{ 0u };
+    ASSERT_FALSE( NETrace::readLogMessage( msgShort, position, decoded, flags ) );
+    ASSERT_EQ( position, msgShort.getSizeUsed( ) );
+}
+
+/**
+ * \brief   The structure sent by the earlier versions is decoded with the names.
+ **/
+TEST( LogCompactRecordTest, StructureRecordDecodes )
+{
+    NETrace::sLogMessage logMessage{ _createLog( 0x12345678u ) };
+    RemoteMessage msgLog{ NETrace::createLogMessage( logMessage, NETrace::eLogDataType::LogDataRemote, 77u ) };
+    ASSERT_TRUE( msgLog.isValid( ) );
+
+    const NETrace::sLogMessage & sent{ *reinterpret_cast<const NETrace::sLogMessage *>(msgLog.getBuffer( )) };
+    NETrace::sLogMessage decoded;
+    unsigned char flags{ NETrace::CompactNoNames };
+    ASSERT_TRUE( NETrace::readLogMessage( msgLog, decoded, flags ) );
+    ASSERT_EQ( flags, NETrace::CompactAllNames );
+    ASSERT_EQ( decoded.logCookie, 77u );
+    _compare( logMessage, decoded );
+    ASSERT_EQ( std::string_view( decoded.logThread, decoded.logThreadLen ), std::string_view( sent.logThread, sent.logThreadLen ) );
+    ASSERT_EQ( std::string_view( decoded.logModule, decoded.logModuleLen ), std::string_view( sent.logModule, sent.logModuleLen ) );
+
+    uint32_t position{ 0u };
+    ASSERT_TRUE( NETrace::readLogMessage( msgLog, position, decoded, flags ) );
+    _compare( logMessage, decoded );
+}
+
+#endif  // AREG_LOGS
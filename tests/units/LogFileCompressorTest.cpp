@@ -0,0 +1,320 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogFileCompressorTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of gzip compression of log files.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/File.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/trace/private/LogFileCompressor.hpp"
+
+#include <string>
+#include <vector>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The path of the file to compress.
+    constexpr char  SOURCE_FILE[]       { "./compress_log_areg.log" };
+    //!< The path of the compressed file.
+    constexpr char  TARGET_FILE[]       { "./compress_log_areg.log.gz" };
+
+    //!< The base lengths of the length codes 257 - 285.
+    constexpr unsigned int  LENGTH_BASE[]   { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    //!< The number of extra bits of the length codes 257 - 285.
+    constexpr unsigned int  LENGTH_EXTRA[]  { 0, 0, 0, 0, 0, 0, 0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3,  4,  4,  4,   4,   5,   5,   5,   5,   0 };
+    //!< The base distances of the distance codes 0 - 29.
+    constexpr unsigned int  DIST_BASE[]     { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    //!< The number of extra bits of the distance codes 0 - 29.
+    constexpr unsigned int  DIST_EXTRA[]    { 0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,   6,   6,   7,   7,   8,   8,    9,    9,   10,   10,   11,   11,   12,    12,    13,    13 };
+
+    /**
+     * \brief   The reference decoder of gzip data, which contains stored blocks
+     *          and the blocks with fixed Huffman codes as described in RFC 1951 and RFC 1952.
+     *          The dynamic Huffman codes are not used by the compressor and are rejected.
+     **/
+    class GzipReader
+    {
+    public:
+        explicit GzipReader( const std::vector<unsigned char> & data )
+            : mData     ( data )
+            , mPos      ( 0u )
+            , mBits     ( 0u )
+            , mCount    ( 0u )
+            , mFailed   ( false )
+        {
+        }
+
+        /**
+         * \brief   Decodes the gzip data. Returns false if the data is malformed,
+         *          or the CRC32 or the size in the trailer do not match.
+         **/
+        bool inflate( std::vector<unsigned char> & out_data )
+        {
+            out_data.clear( );
+            if ( (mData.size( ) < 18u) || (mData[0] != 0x1Fu) || (mData[1] != 0x8Bu) || (mData[2] != 0x08u) || (mData[3] != 0x00u) )
+                return false;
+
+            mPos = 10u;
+            bool last{ false };
+            while ( (last == false) && (mFailed == false) )
+            {
+                last = _bits( 1u ) != 0u;
+                switch ( _bits( 2u ) )
+                {
+                case 0u:
+                    _stored( out_data );
+                    break;
+
+                case 1u:
+                    _fixed( out_data );
+                    break;
+
+                default:
+                    mFailed = true;
+                    break;
+                }
+            }
+
+            if ( mFailed || (mPos + 8u != mData.size( )) )
+                return false;
+
+            const unsigned int crc{ _uint32( ) };
+            const unsigned int size{ _uint32( ) };
+            return (crc == NEMath::crc32Calculate( out_data.data( ), static_cast<int>(out_data.size( )) )) && (size == static_cast<unsigned int>(out_data.size( )));
+        }
+
+    private:
+        //!< Returns the bits starting from the least significant bit of the byte.
+        unsigned int _bits( unsigned int count )
+        {
+            while ( mCount < count )
+            {
+                if ( mPos >= mData.size( ) )
+                {
+                    mFailed = true;
+                    return 0u;
+                }
+
+                mBits  |= static_cast<unsigned int>(mData[mPos ++]) << mCount;
+                mCount += 8u;
+            }
+
+            const unsigned int result{ mBits & ((1u << count) - 1u) };
+            mBits  >>= count;
+            mCount  -= count;
+            return result;
+        }
+
+        //!< Returns the Huffman code, which is packed starting from the most significant bit.
+        unsigned int _code( unsigned int length )
+        {
+            unsigned int result{ 0u };
+            for ( unsigned int i = 0; i < length; ++ i )
+            {
+                result = (result << 1) | _bits( 1u );
+            }
+
+            return result;
+        }
+
+        //!< Decodes the literal or length symbol of fixed Huffman code.
+        unsigned int _symbol( void )
+        {
+            unsigned int code{ _code( 7u ) };
+            if ( code <= 0x17u )
+                return 256u + code;
+
+            code = (code << 1) | _bits( 1u );
+            if ( (code >= 0x30u) && (code <= 0xBFu) )
+                return code - 0x30u;
+            else if ( (code >= 0xC0u) && (code <= 0xC7u) )
+                return 280u + (code - 0xC0u);
+
+            code = (code << 1) | _bits( 1u );
+            return 144u + (code - 0x190u);
+        }
+
+        //!< Decodes the stored block.
+        void _stored( std::vector<unsigned char> & out_data )
+        {
+            mBits  = 0u;
+            mCount = 0u;
+            if ( mPos + 4u > mData.size( ) )
+            {
+                mFailed = true;
+                return;
+            }
+
+            const unsigned int length{ static_cast<unsigned int>(mData[mPos]) | (static_cast<unsigned int>(mData[mPos + 1u]) << 8) };
+            const unsigned int check{ static_cast<unsigned int>(mData[mPos + 2u]) | (static_cast<unsigned int>(mData[mPos + 3u]) << 8) };
+            mPos += 4u;
+            if ( ((length ^ 0xFFFFu) != check) || (mPos + length > mData.size( )) )
+            {
+                mFailed = true;
+                return;
+            }
+
+            out_data.insert( out_data.end( ), mData.begin( ) + mPos, mData.begin( ) + mPos + length );
+            mPos += length;
+        }
+
+        //!< Decodes the block of fixed Huffman codes.
+        void _fixed( std::vector<unsigned char> & out_data )
+        {
+            while ( mFailed == false )
+            {
+                const unsigned int symbol{ _symbol( ) };
+                if ( symbol < 256u )
+                {
+                    out_data.push_back( static_cast<unsigned char>(symbol) );
+                }
+                else if ( symbol == 256u )
+                {
+                    break;
+                }
+                else if ( symbol - 257u < MACRO_ARRAYLEN( LENGTH_BASE ) )
+                {
+                    const unsigned int lenCode{ symbol - 257u };
+                    const unsigned int length{ LENGTH_BASE[lenCode] + _bits( LENGTH_EXTRA[lenCode] ) };
+                    const unsigned int distCode{ _code( 5u ) };
+                    if ( distCode >= MACRO_ARRAYLEN( DIST_BASE ) )
+                    {
+                        mFailed = true;
+                        break;
+                    }
+
+                    const unsigned int distance{ DIST_BASE[distCode] + _bits( DIST_EXTRA[distCode] ) };
+                    if ( distance > out_data.size( ) )
+                    {
+                        mFailed = true;
+                        break;
+                    }
+
+                    for ( unsigned int i = 0; i < length; ++ i )
+                    {
+                        out_data.push_back( out_data[out_data.size( ) - distance] );
+                    }
+                }
+                else
+                {
+                    mFailed = true;
+                }
+            }
+
+            // the trailer starts at the byte boundary.
+            mBits  = 0u;
+            mCount = 0u;
+        }
+
+        //!< Reads 32-bit value in little-endian byte order.
+        unsigned int _uint32( void )
+        {
+            unsigned int result{ 0u };
+            for ( unsigned int i = 0; i < 4u; ++ i )
+            {
+                result |= static_cast<unsigned int>(mData[mPos ++]) << (8u * i);
+            }
+
+            return result;
+        }
+
+    private:
+        const std::vector<unsigned char> &  mData;
+        size_t                              mPos;
+        unsigned int                        mBits;
+        unsigned int                        mCount;
+        bool                                mFailed;
+    };
+
+    /**
+     * \brief   Writes the data in the file, compresses it and decodes the compressed file.
+     *          Returns the size of the compressed file.
+     **/
+    size_t _compressAndCheck( const std::vector<unsigned char> & source )
+    {
+        File srcFile;
+        EXPECT_TRUE( srcFile.open( SOURCE_FILE, File::FO_MODE_WRITE | File::FO_MODE_BINARY | File::FO_MODE_CREATE ) );
+        EXPECT_EQ( srcFile.write( source.data( ), static_cast<unsigned int>(source.size( )) ), static_cast<unsigned int>(source.size( )) );
+        srcFile.close( );
+
+        EXPECT_TRUE( LogFileCompressor::compress( SOURCE_FILE, TARGET_FILE ) );
+
+        File dstFile;
+        EXPECT_TRUE( dstFile.open( TARGET_FILE, File::FO_MODE_READ | File::FO_MODE_BINARY | File::FO_MODE_EXIST ) );
+        std::vector<unsigned char> compressed( dstFile.getLength( ) );
+        EXPECT_EQ( dstFile.read( compressed.data( ), static_cast<unsigned int>(compressed.size( )) ), static_cast<unsigned int>(compressed.size( )) );
+        dstFile.close( );
+
+        File::deleteFile( SOURCE_FILE );
+        File::deleteFile( TARGET_FILE );
+
+        std::vector<unsigned char> decoded;
+        GzipReader reader( compressed );
+        EXPECT_TRUE( reader.inflate( decoded ) );
+        EXPECT_TRUE( decoded == source );
+        return compressed.size( );
+    }
+}
+
+/**
+ * \brief   The empty file is compressed to the gzip file without data.
+ **/
+TEST( LogFileCompressorTest, EmptyFile )
+{
+    _compressAndCheck( std::vector<unsigned char>( ) );
+}
+
+/**
+ * \brief   The log file with repeated lines is decoded the same and is compressed
+ *          several times. The file is larger than the sliding window, so that the window slides.
+ **/
+TEST( LogFileCompressorTest, RepeatedLogLines )
+{
+    std::vector<unsigned char> source;
+    for ( unsigned int i = 0; source.size( ) < 300u * 1024u; ++ i )
+    {
+        const std::string line{ "2023-10-17 12:00:00.000: [ 1234  main_thread.areg_module: Scope ( areg_test_scope ) ]: The log message number "
+                                + std::to_string( i ) + "\n" };
+        source.insert( source.end( ), line.begin( ), line.end( ) );
+    }
+
+    const size_t compressed{ _compressAndCheck( source ) };
+    ASSERT_LT( compressed * 4u, source.size( ) );
+}
+
+/**
+ * \brief   The random bytes and the longest matches at the maximum distance are decoded the same.
+ **/
+TEST( LogFileCompressorTest, RandomAndLongMatches )
+{
+    std::vector<unsigned char> source;
+    unsigned int seed{ 0x12345678u };
+    for ( unsigned int i = 0; i < 40u * 1024u; ++ i )
+    {
+        seed = seed * 1103515245u + 12345u;
+        source.push_back( static_cast<unsigned char>(seed >> 16) );
+    }
+
+    // repeat the random data, so that the matches are found at the distance of the whole window.
+    source.insert( source.end( ), source.begin( ) + 8u * 1024u, source.end( ) );
+    source.insert( source.end( ), 1000u, static_cast<unsigned char>('a') );
+    source.push_back( static_cast<unsigned char>('b') );
+
+    _compressAndCheck( source );
+}
+
+#endif  // AREG_LOGS
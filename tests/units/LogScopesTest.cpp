@@ -13,6 +13,7 @@
 #include "areg/appbase/NEApplication.hpp"
 #include "areg/base/Thread.hpp"
 
+#include <memory>
 #include <string_view>
 
 namespace
@@ -442,3 +443,50 @@ TEST( LogScopeTest, ScopePriorityGroupping )
     TRACER_STOP_LOGGING( );
     ASSERT_FALSE( IS_TRACE_STARTED() );
 }
+
+/**
+ * \brief   This test logs the messages, which format is a string literal, a local array
+ *          and an array member. Only the string literal is not copied, the arrays are
+ *          overwritten before the logging thread formats the messages.
+ **/
+DEF_TRACE_SCOPE( areg_unit_tests_LogScopeTest_DeferredFormats );
+TEST( LogScopeTest, DeferredFormats )
+{
+#if AREG_LOGS
+    static_assert( TraceMessage::isLiteralFormat( "\"The literal %d\", value" ), "The string literal format is not recognized" );
+    static_assert( TraceMessage::isLiteralFormat( "format, value" ) == false, "The array format is recognized as literal" );
+    static_assert( TraceMessage::isLiteralFormat( "FORMAT_MACRO" ) == false, "The macro format is recognized as literal" );
+#endif  // AREG_LOGS
+
+    struct sFormat
+    {
+        const char  sfFormat[32];
+    };
+
+    Application::setWorkingDirectory( nullptr );
+    ASSERT_TRUE( TRACER_START_LOGGING(DEFAULT_CONFIG_FILE.data()) || !AREG_LOGS );
+
+    do
+    {
+        TRACE_SCOPE( areg_unit_tests_LogScopeTest_DeferredFormats );
+        char format[ ]{ "The format of local array %d, [ %s ]" };
+        char message[ ]{ "The local array without arguments" };
+        TRACE_DBG( format, 1, "string" );
+        TRACE_INFO( message );
+        for ( char & ch : format )
+        {
+            ch = '%';
+        }
+
+        message[0] = '%';
+
+        std::unique_ptr<sFormat> member{ new sFormat{ "The format of member %u" } };
+        TRACE_WARN( member->sfFormat, 2u );
+        member.reset( );
+
+        TRACE_ERR( "The format of literal %d, [ %s ]", 3, "string" );
+    } while ( false );
+
+    TRACER_STOP_LOGGING( );
+    ASSERT_FALSE( IS_TRACE_STARTED() );
+}
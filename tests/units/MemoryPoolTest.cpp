@@ -0,0 +1,71 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/MemoryPoolTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of memory pool.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/MemoryPool.hpp"
+#include "areg/base/NEMemory.hpp"
+
+#include <thread>
+#include <vector>
+
+/**
+ * \brief   The blocks are aligned and can be used for the whole requested size.
+ **/
+TEST( MemoryPoolTest, AllocateAndRelease )
+{
+    std::vector<void *> blocks;
+    for ( size_t size : { 1u, 48u, 100u, 1000u, 4080u, 5000u } )
+    {
+        unsigned char * block = reinterpret_cast<unsigned char *>(MemoryPool::allocate( size ));
+        ASSERT_NE( block, nullptr );
+        ASSERT_EQ( reinterpret_cast<uintptr_t>(block) % 16u, 0u );
+        NEMemory::memSet( block, static_cast<uint32_t>(size), static_cast<unsigned char>(size) );
+        blocks.push_back( block );
+    }
+
+    for ( void * block : blocks )
+    {
+        MemoryPool::release( block );
+    }
+}
+
+/**
+ * \brief   The thread, which only releases blocks allocated by another thread,
+ *          moves the cached blocks to the depot when it exits.
+ **/
+TEST( MemoryPoolTest, ReleasingThreadReturnsCacheOnExit )
+{
+    constexpr uint32_t BLOCK_COUNT{ 10u };
+    void * blocks[BLOCK_COUNT];
+    for ( void *& block : blocks )
+    {
+        block = MemoryPool::allocate( 64u );
+    }
+
+    const MemoryPool::sPoolStatistics before{ MemoryPool::getStatistics( ) };
+    std::thread consumer( [&blocks]( )
+        {
+            for ( void * block : blocks )
+            {
+                MemoryPool::release( block );
+            }
+        } );
+
+    consumer.join( );
+    const MemoryPool::sPoolStatistics after{ MemoryPool::getStatistics( ) };
+    ASSERT_GT( after.psBatchReleased, before.psBatchReleased );
+}
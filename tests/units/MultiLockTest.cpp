@@ -0,0 +1,132 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/MultiLockTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of waiting for all synchronization
+ *              objects with multi-lock.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The number of threads of each kind competing for the objects. The semaphore has twice more competitors.
+    constexpr int           THREAD_COUNT    { 4 };
+    //!< The number of times each thread locks the objects.
+    constexpr int           LOCK_COUNT      { 20000 };
+    //!< The timeout in milliseconds to lock the objects, the expiration means deadlock.
+    constexpr unsigned int  LOCK_TIMEOUT    { 10000u };
+
+    /**
+     * \brief   The objects shared by the competing threads and
+     *          the counters of threads that own the objects.
+     **/
+    struct SharedObjects
+    {
+        Mutex               soMutex     { false };
+        Semaphore           soSemaphore { 1, 1 };
+        std::atomic_int     soMutexOwners       { 0 };
+        std::atomic_int     soSemaphoreOwners   { 0 };
+        std::atomic_int     soFailures          { 0 };
+    };
+
+    /**
+     * \brief   Marks the object as owned by the calling thread and checks that there is no other owner.
+     **/
+    void _own( std::atomic_int & owners, std::atomic_int & failures )
+    {
+        if ( owners.fetch_add( 1 ) != 0 )
+        {
+            ++ failures;
+        }
+    }
+
+    /**
+     * \brief   Locks both objects at once, checks the ownership and unlocks.
+     **/
+    void _lockAll( SharedObjects & shared )
+    {
+        for ( int i = 0; i < LOCK_COUNT; ++ i )
+        {
+            IESynchObject * objects[] { &shared.soMutex, &shared.soSemaphore };
+            MultiLock multiLock( objects, 2, false );
+            if ( multiLock.lock( LOCK_TIMEOUT, true ) != MultiLock::LOCK_INDEX_ALL )
+            {
+                ++ shared.soFailures;
+                break;
+            }
+
+            _own( shared.soMutexOwners, shared.soFailures );
+            _own( shared.soSemaphoreOwners, shared.soFailures );
+            -- shared.soSemaphoreOwners;
+            -- shared.soMutexOwners;
+            multiLock.unlock( );
+        }
+    }
+
+    /**
+     * \brief   Locks the single object, checks the ownership and unlocks.
+     **/
+    void _lockOne( IESynchObject & object, std::atomic_int & owners, std::atomic_int & failures )
+    {
+        for ( int i = 0; i < LOCK_COUNT; ++ i )
+        {
+            if ( object.lock( LOCK_TIMEOUT ) == false )
+            {
+                ++ failures;
+                break;
+            }
+
+            _own( owners, failures );
+            -- owners;
+            object.unlock( );
+        }
+    }
+}
+
+/**
+ * \brief   The threads waiting for the mutex and the semaphore at once compete with
+ *          the threads waiting for one of them. The waiting for all should take
+ *          both objects atomically, so that no object has two owners and no thread
+ *          is blocked because another thread owns only one of the objects.
+ **/
+TEST( MultiLockTest, WaitAllMutexAndSemaphore )
+{
+    SharedObjects shared;
+    std::vector<std::thread> threads;
+    for ( int i = 0; i < THREAD_COUNT; ++ i )
+    {
+        threads.emplace_back( _lockAll, std::ref( shared ) );
+        threads.emplace_back( _lockOne, std::ref( shared.soMutex ), std::ref( shared.soMutexOwners ), std::ref( shared.soFailures ) );
+        threads.emplace_back( _lockOne, std::ref( shared.soSemaphore ), std::ref( shared.soSemaphoreOwners ), std::ref( shared.soFailures ) );
+        threads.emplace_back( _lockOne, std::ref( shared.soSemaphore ), std::ref( shared.soSemaphoreOwners ), std::ref( shared.soFailures ) );
+    }
+
+    for ( std::thread & thread : threads )
+    {
+        thread.join( );
+    }
+
+    EXPECT_EQ( shared.soFailures.load( ), 0 );
+
+    // Both objects are released.
+    IESynchObject * objects[] { &shared.soMutex, &shared.soSemaphore };
+    MultiLock multiLock( objects, 2, false );
+    EXPECT_EQ( multiLock.lock( NECommon::DO_NOT_WAIT, true ), MultiLock::LOCK_INDEX_ALL );
+    multiLock.unlock( );
+}
@@ -0,0 +1,205 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/RemoteMessageDecoderTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of incremental remote message decoder.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+
+#include <vector>
+
+namespace
+{
+    //!< The size of the ring buffer, which is small enough to wrap around on every message.
+    constexpr uint32_t  SMALL_BUFFER_SIZE   { static_cast<uint32_t>(sizeof(NEMemory::sRemoteMessageHeader)) + 13u };
+
+    /**
+     * \brief   Creates the message with the payload of specified size.
+     **/
+    RemoteMessage _createMessage( const ITEM_ID & source, const ITEM_ID & target, uint32_t payload )
+    {
+        RemoteMessage msg{ NERemoteService::createConnectNotify( source, target ) };
+        for ( uint32_t i = 0; i < payload; ++ i )
+        {
+            const unsigned char ch{ static_cast<unsigned char>((i * 7u + payload) & 0xFFu) };
+            msg.write( &ch, 1u );
+        }
+
+        return msg;
+    }
+
+    /**
+     * \brief   Appends the message to the stream of bytes in the same way as it is sent via socket.
+     **/
+    void _serialize( const RemoteMessage & msg, std::vector<unsigned char> & out_stream )
+    {
+        msg.bufferCompletionFix( );
+        const NEMemory::sRemoteMessageHeader & header = msg.getRemoteMessage( )->rbHeader;
+        const unsigned char * hdr = reinterpret_cast<const unsigned char *>(&header);
+        out_stream.insert( out_stream.end( ), hdr, hdr + sizeof(NEMemory::sRemoteMessageHeader) );
+        if ( header.rbhBufHeader.biUsed != 0u )
+        {
+            out_stream.insert( out_stream.end( ), msg.getBuffer( ), msg.getBuffer( ) + header.rbhBufHeader.biLength );
+        }
+    }
+
+    /**
+     * \brief   Passes the data to the decoder and collects all complete messages.
+     *          Returns false if the decoder failed.
+     **/
+    bool _decode( RemoteMessageDecoder & decoder, const unsigned char * data, uint32_t length, std::vector<RemoteMessage> & out_messages )
+    {
+        uint32_t consumed{ 0u };
+        bool result{ true };
+        while ( result && (consumed < length) )
+        {
+            int written = decoder.writeData( data + consumed, length - consumed );
+            result = written >= 0;
+            consumed += result ? static_cast<uint32_t>(written) : 0u;
+
+            RemoteMessage msg;
+            while ( decoder.nextMessage( msg ) )
+            {
+                out_messages.push_back( msg );
+            }
+
+            result = result && (decoder.isFailed( ) == false);
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Compares the header fields and the data of sent and decoded messages.
+     **/
+    void _compare( const std::vector<RemoteMessage> & sent, const std::vector<RemoteMessage> & decoded )
+    {
+        ASSERT_EQ( sent.size( ), decoded.size( ) );
+        for ( size_t i = 0; i < sent.size( ); ++ i )
+        {
+            const RemoteMessage & expected = sent[i];
+            const RemoteMessage & actual = decoded[i];
+            ASSERT_EQ( expected.getMessageId( ), actual.getMessageId( ) );
+            ASSERT_EQ( expected.getSource( ), actual.getSource( ) );
+            ASSERT_EQ( expected.getTarget( ), actual.getTarget( ) );
+            ASSERT_EQ( expected.getChecksum( ), actual.getChecksum( ) );
+            ASSERT_EQ( expected.getSizeUsed( ), actual.getSizeUsed( ) );
+            ASSERT_TRUE( NEMemory::memEqual( expected.getBuffer( ), actual.getBuffer( ), expected.getSizeUsed( ) ) );
+        }
+    }
+
+    /**
+     * \brief   Creates the list of messages with different payload sizes and the stream of their bytes.
+     **/
+    std::vector<RemoteMessage> _createMessages( std::vector<unsigned char> & out_stream, const std::vector<uint32_t> & payloads )
+    {
+        std::vector<RemoteMessage> result;
+        ITEM_ID source{ NEService::COOKIE_REMOTE_SERVICE };
+        for ( uint32_t payload : payloads )
+        {
+            result.push_back( _createMessage( source, source + 1u, payload ) );
+            _serialize( result.back( ), out_stream );
+            ++ source;
+        }
+
+        return result;
+    }
+}
+
+/**
+ * \brief   Several complete messages are received by one read.
+ **/
+TEST( RemoteMessageDecoderTest, SeveralMessagesInOneRead )
+{
+    std::vector<unsigned char> stream;
+    std::vector<RemoteMessage> sent{ _createMessages( stream, { 0u, 1u, 100u, 5000u, 3u } ) };
+
+    RemoteMessageDecoder decoder( static_cast<uint32_t>(stream.size( )) );
+    ASSERT_EQ( decoder.writeData( stream.data( ), static_cast<uint32_t>(stream.size( )) ), static_cast<int>(stream.size( )) );
+
+    std::vector<RemoteMessage> decoded;
+    RemoteMessage msg;
+    while ( decoder.nextMessage( msg ) )
+    {
+        decoded.push_back( msg );
+    }
+
+    ASSERT_FALSE( decoder.isFailed( ) );
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, decoded );
+}
+
+/**
+ * \brief   The stream of messages is received in two reads split at every byte boundary.
+ *          The ring buffer is smaller than the messages, so that the data wraps around.
+ **/
+TEST( RemoteMessageDecoderTest, MessagesSplitAtEveryByte )
+{
+    std::vector<unsigned char> stream;
+    std::vector<RemoteMessage> sent{ _createMessages( stream, { 0u, 17u, 300u } ) };
+    const uint32_t length{ static_cast<uint32_t>(stream.size( )) };
+
+    for ( uint32_t split = 1u; split < length; ++ split )
+    {
+        for ( uint32_t bufferSize : { SMALL_BUFFER_SIZE, RemoteMessageDecoder::DEFAULT_BUFFER_SIZE } )
+        {
+            RemoteMessageDecoder decoder( bufferSize );
+            std::vector<RemoteMessage> decoded;
+            ASSERT_TRUE( _decode( decoder, stream.data( ), split, decoded ) );
+            ASSERT_TRUE( _decode( decoder, stream.data( ) + split, length - split, decoded ) );
+            ASSERT_FALSE( decoder.hasPartialMessage( ) );
+            _compare( sent, decoded );
+        }
+    }
+}
+
+/**
+ * \brief   The messages are received byte by byte.
+ **/
+TEST( RemoteMessageDecoderTest, MessagesByteByByte )
+{
+    std::vector<unsigned char> stream;
+    std::vector<RemoteMessage> sent{ _createMessages( stream, { 2000u, 0u, 64u } ) };
+
+    RemoteMessageDecoder decoder( SMALL_BUFFER_SIZE );
+    std::vector<RemoteMessage> decoded;
+    for ( unsigned char ch : stream )
+    {
+        ASSERT_TRUE( _decode( decoder, &ch, 1u, decoded ) );
+    }
+
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, decoded );
+}
+
+/**
+ * \brief   The corrupted message fails the decoder, the messages before it are decoded.
+ **/
+TEST( RemoteMessageDecoderTest, CorruptedMessageFails )
+{
+    std::vector<unsigned char> stream;
+    std::vector<RemoteMessage> sent{ _createMessages( stream, { 10u, 10u } ) };
+    // corrupt the first byte of data of the last message.
+    stream[stream.size( ) - sent.back( ).getRemoteMessage( )->rbHeader.rbhBufHeader.biLength] ^= 0xFFu;
+    sent.pop_back( );
+
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> decoded;
+    ASSERT_FALSE( _decode( decoder, stream.data( ), static_cast<uint32_t>(stream.size( )), decoded ) );
+    ASSERT_TRUE( decoder.isFailed( ) );
+    _compare( sent, decoded );
+}
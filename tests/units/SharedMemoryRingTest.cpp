@@ -0,0 +1,343 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SharedMemoryRingTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of ring buffers of the shared memory.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/RemoteMessageDecoder.hpp"
+#include "areg/ipc/SharedMemoryServer.hpp"
+#include "areg/ipc/private/NESharedMemory.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The timeout in milliseconds to wait for the ring in the test.
+    constexpr unsigned int  WAIT_TIMEOUT    { 100u };
+
+    /**
+     * \brief   Creates the messages with different payload sizes and the stream of their bytes.
+     *          The size of the stream is bigger than the ring, so that the data wraps around.
+     **/
+    std::vector<RemoteMessage> _createMessages( std::vector<unsigned char> & out_stream, uint32_t count )
+    {
+        std::vector<RemoteMessage> result;
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            result.push_back( NERemoteService::createConnectNotify( NEService::COOKIE_REMOTE_SERVICE + i, NEService::COOKIE_ROUTER ) );
+            RemoteMessage & msg = result.back( );
+            const uint32_t payload{ (i * 997u) % 20000u };
+            for ( uint32_t j = 0; j < payload; ++ j )
+            {
+                const unsigned char ch{ static_cast<unsigned char>((i + j) & 0xFFu) };
+                msg.write( &ch, 1u );
+            }
+
+            msg.bufferCompletionFix( );
+            const NEMemory::sRemoteMessageHeader & header = msg.getRemoteMessage( )->rbHeader;
+            const unsigned char * hdr = reinterpret_cast<const unsigned char *>(&header);
+            out_stream.insert( out_stream.end( ), hdr, hdr + sizeof(NEMemory::sRemoteMessageHeader) );
+            if ( header.rbhBufHeader.biUsed != 0u )
+            {
+                out_stream.insert( out_stream.end( ), msg.getBuffer( ), msg.getBuffer( ) + header.rbhBufHeader.biLength );
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Moves the data of the ring into the decoder and collects all complete messages.
+     *          Returns false if the decoder failed.
+     **/
+    bool _read( NESharedMemory::sRingBuffer & ring, const unsigned char * data, RemoteMessageDecoder & decoder, std::vector<RemoteMessage> & out_messages )
+    {
+        bool result{ true };
+        while ( result && NESharedMemory::hasData( ring ) )
+        {
+            result = NESharedMemory::readRing( ring, data, decoder ) >= 0;
+            RemoteMessage msg;
+            while ( decoder.nextMessage( msg ) )
+            {
+                out_messages.push_back( msg );
+            }
+        }
+
+        NESharedMemory::notifyWriter( ring );
+        return result;
+    }
+
+    /**
+     * \brief   Compares the header fields and the data of sent and received messages.
+     **/
+    void _compare( const std::vector<RemoteMessage> & sent, const std::vector<RemoteMessage> & received )
+    {
+        ASSERT_EQ( sent.size( ), received.size( ) );
+        for ( size_t i = 0; i < sent.size( ); ++ i )
+        {
+            ASSERT_EQ( sent[i].getMessageId( ), received[i].getMessageId( ) );
+            ASSERT_EQ( sent[i].getSource( ), received[i].getSource( ) );
+            ASSERT_EQ( sent[i].getSizeUsed( ), received[i].getSizeUsed( ) );
+            ASSERT_TRUE( NEMemory::memEqual( sent[i].getBuffer( ), received[i].getBuffer( ), sent[i].getSizeUsed( ) ) );
+        }
+    }
+}
+
+/**
+ * \brief   The messages written in the ring are read in the same thread.
+ *          The writer stops when the ring is full and continues after the reader.
+ **/
+TEST( SharedMemoryRingTest, RoundTripInOneThread )
+{
+    std::vector<unsigned char> stream;
+    const std::vector<RemoteMessage> sent{ _createMessages( stream, 100u ) };
+    ASSERT_GT( stream.size( ), 2u * NESharedMemory::RING_SIZE );
+
+    std::unique_ptr<NESharedMemory::sRingBuffer> ring{ new NESharedMemory::sRingBuffer };
+    std::vector<unsigned char> data( NESharedMemory::RING_SIZE );
+    NESharedMemory::resetRing( *ring );
+
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> received;
+    uint32_t written{ 0u };
+    while ( written < static_cast<uint32_t>(stream.size( )) )
+    {
+        const uint32_t length{ static_cast<uint32_t>(stream.size( )) - written };
+        const uint32_t result{ NESharedMemory::writeRing( *ring, data.data( ), stream.data( ) + written, length ) };
+        ASSERT_LE( result, NESharedMemory::RING_SIZE );
+        written += result;
+        ASSERT_TRUE( _read( *ring, data.data( ), decoder, received ) );
+    }
+
+    ASSERT_FALSE( NESharedMemory::hasData( *ring ) );
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, received );
+}
+
+/**
+ * \brief   The writer and reader run in different threads and wait on the ring
+ *          when it is full or empty.
+ **/
+TEST( SharedMemoryRingTest, RoundTripBetweenThreads )
+{
+    std::vector<unsigned char> stream;
+    const std::vector<RemoteMessage> sent{ _createMessages( stream, 300u ) };
+
+    std::unique_ptr<NESharedMemory::sRingBuffer> ring{ new NESharedMemory::sRingBuffer };
+    std::vector<unsigned char> data( NESharedMemory::RING_SIZE );
+    NESharedMemory::resetRing( *ring );
+
+    std::thread producer( [&ring, &data, &stream]( )
+        {
+            uint32_t written{ 0u };
+            while ( written < static_cast<uint32_t>(stream.size( )) )
+            {
+                const uint32_t length{ static_cast<uint32_t>(stream.size( )) - written };
+                const uint32_t result{ NESharedMemory::writeRing( *ring, data.data( ), stream.data( ) + written, length ) };
+                written += result;
+                if ( result != 0u )
+                {
+                    NESharedMemory::notifyReader( *ring );
+                }
+                else
+                {
+                    NESharedMemory::waitWritable( *ring, WAIT_TIMEOUT );
+                }
+            }
+        } );
+
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> received;
+    bool result{ true };
+    while ( result && (received.size( ) < sent.size( )) )
+    {
+        if ( NESharedMemory::waitReadable( *ring, WAIT_TIMEOUT ) )
+        {
+            result = _read( *ring, data.data( ), decoder, received );
+        }
+    }
+
+    producer.join( );
+    ASSERT_TRUE( result );
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, received );
+}
+
+/**
+ * \brief   The writer, which does not sleep, writes only what fits the ring and requests
+ *          the notification. The reader reports the waiting writer after reading data,
+ *          so that the writer continues the partially written message.
+ **/
+TEST( SharedMemoryRingTest, NonBlockingWriterIsNotified )
+{
+    std::vector<unsigned char> stream;
+    const std::vector<RemoteMessage> sent{ _createMessages( stream, 100u ) };
+
+    std::unique_ptr<NESharedMemory::sRingBuffer> ring{ new NESharedMemory::sRingBuffer };
+    std::vector<unsigned char> data( NESharedMemory::RING_SIZE );
+    NESharedMemory::resetRing( *ring );
+    ASSERT_FALSE( NESharedMemory::notifyWriter( *ring ) );
+
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> received;
+    uint32_t written{ 0u };
+    while ( written < static_cast<uint32_t>(stream.size( )) )
+    {
+        const uint32_t length{ static_cast<uint32_t>(stream.size( )) - written };
+        written += NESharedMemory::writeRing( *ring, data.data( ), stream.data( ) + written, length );
+        if ( written < static_cast<uint32_t>(stream.size( )) )
+        {
+            ASSERT_FALSE( NESharedMemory::hasSpace( *ring ) );
+            ASSERT_TRUE( NESharedMemory::requestWritable( *ring ) );
+            ASSERT_TRUE( _read( *ring, data.data( ), decoder, received ) );
+            ASSERT_TRUE( NESharedMemory::notifyWriter( *ring ) );
+            ASSERT_TRUE( NESharedMemory::hasSpace( *ring ) );
+            ring->rbWriterWaits.store( 0u );
+        }
+    }
+
+    ASSERT_TRUE( _read( *ring, data.data( ), decoder, received ) );
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, received );
+}
+
+/**
+ * \brief   The ring with the head or the tail moved out of range by the other process
+ *          is neither read nor written.
+ **/
+TEST( SharedMemoryRingTest, RejectsCorruptedRing )
+{
+    std::unique_ptr<NESharedMemory::sRingBuffer> ring{ new NESharedMemory::sRingBuffer };
+    std::vector<unsigned char> data( NESharedMemory::RING_SIZE );
+    NESharedMemory::resetRing( *ring );
+    ASSERT_TRUE( NESharedMemory::isRingValid( *ring ) );
+
+    RemoteMessageDecoder decoder;
+    ring->rbHead.store( NESharedMemory::RING_SIZE + 1u );
+    ASSERT_FALSE( NESharedMemory::isRingValid( *ring ) );
+    ASSERT_LT( NESharedMemory::readRing( *ring, data.data( ), decoder ), 0 );
+    ASSERT_EQ( ring->rbTail.load( ), 0u );
+
+    const unsigned char buffer[16]{ };
+    ring->rbHead.store( 0u );
+    ring->rbTail.store( 1u );
+    ASSERT_FALSE( NESharedMemory::isRingValid( *ring ) );
+    ASSERT_EQ( NESharedMemory::writeRing( *ring, data.data( ), buffer, sizeof( buffer ) ), 0u );
+    ASSERT_EQ( ring->rbHead.load( ), 0u );
+}
+
+/**
+ * \brief   The data written in the ring of the created segment is read
+ *          via the second mapping of the same segment.
+ **/
+TEST( SharedMemoryRingTest, RoundTripViaSegment )
+{
+    if ( NESharedMemory::isSupported( ) == false )
+        return;
+
+    const String name{ NESharedMemory::getSegmentName( "unit_test", 1u ) };
+    void * created = NESharedMemory::createSegment( name, NESharedMemory::SEGMENT_SIZE );
+    ASSERT_NE( created, nullptr );
+    void * opened = NESharedMemory::openSegment( name, NESharedMemory::SEGMENT_SIZE );
+    NESharedMemory::deleteSegment( name );
+    ASSERT_NE( opened, nullptr );
+
+    NESharedMemory::sSegmentHeader & server = *reinterpret_cast<NESharedMemory::sSegmentHeader *>(created);
+    NESharedMemory::sSegmentHeader & client = *reinterpret_cast<NESharedMemory::sSegmentHeader *>(opened);
+    constexpr uint32_t slot{ NESharedMemory::SLOT_COUNT - 1u };
+
+    std::vector<unsigned char> stream;
+    const std::vector<RemoteMessage> sent{ _createMessages( stream, 10u ) };
+    ASSERT_LT( stream.size( ), NESharedMemory::RING_SIZE );
+
+    NESharedMemory::sRingBuffer & ringClient = client.shSlots[slot].slClientRing;
+    const uint32_t length{ static_cast<uint32_t>(stream.size( )) };
+    ASSERT_EQ( NESharedMemory::writeRing( ringClient, NESharedMemory::getRingData( client, slot, true ), stream.data( ), length ), length );
+
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> received;
+    NESharedMemory::sRingBuffer & ringServer = server.shSlots[slot].slClientRing;
+    ASSERT_TRUE( NESharedMemory::hasData( ringServer ) );
+    ASSERT_FALSE( NESharedMemory::hasData( server.shSlots[slot].slServerRing ) );
+    ASSERT_TRUE( _read( ringServer, NESharedMemory::getRingData( server, slot, true ), decoder, received ) );
+    ASSERT_FALSE( NESharedMemory::hasData( ringClient ) );
+
+    NESharedMemory::closeSegment( opened, NESharedMemory::SEGMENT_SIZE );
+    NESharedMemory::closeSegment( created, NESharedMemory::SEGMENT_SIZE );
+    _compare( sent, received );
+}
+
+/**
+ * \brief   The server writes in the ring of the bound slot only the data, which fits,
+ *          and does not block. The sending is resumed after the client reads data,
+ *          and fails when the slot is closed.
+ **/
+TEST( SharedMemoryRingTest, ServerWritesOnlyWhatFits )
+{
+    if ( NESharedMemory::isSupported( ) == false )
+        return;
+
+    const String name{ NESharedMemory::getSegmentName( "unit_test", 2u ) };
+    SharedMemoryServer server;
+    ASSERT_TRUE( server.createSegment( name ) );
+    void * opened = NESharedMemory::openSegment( name, NESharedMemory::SEGMENT_SIZE );
+    ASSERT_NE( opened, nullptr );
+
+    NESharedMemory::sSegmentHeader & client = *reinterpret_cast<NESharedMemory::sSegmentHeader *>(opened);
+    constexpr uint32_t slot{ 0u };
+    client.shSlots[slot].slProcess.store( static_cast<uint32_t>(Process::getInstance( ).getId( )) );
+    client.shSlots[slot].slState.store( static_cast<uint32_t>(NESharedMemory::eSlotState::SlotBound) );
+
+    std::vector<unsigned char> stream;
+    const std::vector<RemoteMessage> sent{ _createMessages( stream, 100u ) };
+    ASSERT_GT( stream.size( ), NESharedMemory::RING_SIZE );
+
+    NESharedMemory::sRingBuffer & ring = client.shSlots[slot].slServerRing;
+    RemoteMessageDecoder decoder;
+    std::vector<RemoteMessage> received;
+    uint32_t written{ 0u };
+    while ( written < static_cast<uint32_t>(stream.size( )) )
+    {
+        const NESocket::sSendBuffer buffer{ stream.data( ) + written, static_cast<unsigned int>(stream.size( )) - written };
+        const int result{ server.writeAvailable( slot, &buffer, 1 ) };
+        ASSERT_GT( result, 0 );
+        written += static_cast<uint32_t>(result);
+        if ( written < static_cast<uint32_t>(stream.size( )) )
+        {
+            // The ring is full, the next write returns immediately.
+            ASSERT_EQ( server.writeAvailable( slot, &buffer, 1 ), 0 );
+            ASSERT_FALSE( server.checkWritable( slot ) );
+            ASSERT_TRUE( _read( ring, NESharedMemory::getRingData( client, slot, false ), decoder, received ) );
+            ASSERT_TRUE( server.checkWritable( slot ) );
+            ASSERT_FALSE( server.checkWritable( slot ) );
+        }
+    }
+
+    ASSERT_TRUE( _read( ring, NESharedMemory::getRingData( client, slot, false ), decoder, received ) );
+    ASSERT_FALSE( decoder.hasPartialMessage( ) );
+    _compare( sent, received );
+
+    server.closeSlot( slot );
+    const NESocket::sSendBuffer buffer{ stream.data( ), 1u };
+    ASSERT_LT( server.writeAvailable( slot, &buffer, 1 ), 0 );
+
+    NESharedMemory::closeSegment( opened, NESharedMemory::SEGMENT_SIZE );
+    server.releaseSegment( );
+}
@@ -0,0 +1,303 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SocketLoopbackTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of sending data and remote messages
+ *              via loopback TCP/IP connection.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketClient.hpp"
+#include "areg/base/SocketServer.hpp"
+#include "areg/ipc/NERemoteService.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#ifdef WINDOWS
+    #include <WinSock2.h>
+#else   // WINDOWS
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+#endif  // WINDOWS
+
+namespace
+{
+    //!< The loopback address to connect.
+    constexpr char              LOOPBACK_ADDRESS[]  { "127.0.0.1" };
+    //!< The first port number to try to listen the connection.
+    constexpr unsigned short    FIRST_PORT          { 18481u };
+    //!< The number of ports to try to listen the connection.
+    constexpr unsigned short    PORT_COUNT          { 100u };
+    //!< The number of round trips of the ping-pong messages.
+    constexpr unsigned int      PING_PONG_COUNT     { 2000u };
+
+    /**
+     * \brief   Gives access to the methods to send and receive remote messages.
+     **/
+    class LoopbackConnection : public SocketConnectionBase
+    {
+    public:
+        LoopbackConnection( void ) = default;
+        virtual ~LoopbackConnection( void ) = default;
+
+        using SocketConnectionBase::sendMessage;
+        using SocketConnectionBase::receiveMessage;
+    };
+
+    /**
+     * \brief   Creates the server socket listening on the loopback address,
+     *          connects the client and accepts the connection.
+     **/
+    bool _connect( SocketServer & server, SocketClient & client, SocketAccepted & accepted )
+    {
+        bool result{ false };
+        for ( unsigned short port = FIRST_PORT; (result == false) && (port < FIRST_PORT + PORT_COUNT); ++ port )
+        {
+            result = server.createSocket( LOOPBACK_ADDRESS, port ) && server.listenConnection( 1 );
+            if ( result )
+            {
+                result = client.createSocket( LOOPBACK_ADDRESS, port );
+            }
+        }
+
+        if ( result )
+        {
+            NESocket::SocketAddress address;
+            SOCKETHANDLE hSocket = server.acceptConnection( address );
+            accepted = SocketAccepted( hSocket, address );
+            result = accepted.isValid( );
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Returns the integer value of the socket option.
+     **/
+    int _getOption( const Socket & socket, int level, int name )
+    {
+        int value{ 0 };
+#ifdef WINDOWS
+        int length{ static_cast<int>(sizeof(int)) };
+#else   // WINDOWS
+        socklen_t length{ static_cast<socklen_t>(sizeof(int)) };
+#endif  // WINDOWS
+        return (::getsockopt( socket.getHandle( ), level, name, reinterpret_cast<char *>(&value), &length ) == 0 ? value : -1);
+    }
+
+    /**
+     * \brief   Creates the message with the payload of specified size.
+     **/
+    RemoteMessage _createMessage( const ITEM_ID & source, uint32_t payload )
+    {
+        std::vector<unsigned char> data( payload );
+        for ( uint32_t i = 0; i < payload; ++ i )
+        {
+            data[i] = static_cast<unsigned char>((i * 13u + payload) & 0xFFu);
+        }
+
+        RemoteMessage msg{ NERemoteService::createConnectNotify( source, NEService::COOKIE_ROUTER ) };
+        msg.write( data.data( ), payload );
+        return msg;
+    }
+
+    /**
+     * \brief   Compares the header fields and the data of sent and received messages.
+     **/
+    void _compare( const RemoteMessage & expected, const RemoteMessage & actual )
+    {
+        ASSERT_TRUE( actual.isValid( ) );
+        ASSERT_EQ( expected.getMessageId( ), actual.getMessageId( ) );
+        ASSERT_EQ( expected.getSource( ), actual.getSource( ) );
+        ASSERT_EQ( expected.getTarget( ), actual.getTarget( ) );
+        ASSERT_EQ( expected.getSizeUsed( ), actual.getSizeUsed( ) );
+        ASSERT_TRUE( NEMemory::memEqual( expected.getBuffer( ), actual.getBuffer( ), expected.getSizeUsed( ) ) );
+    }
+}
+
+/**
+ * \brief   The list of buffers is sent by the gather write and is received
+ *          in the same order. The large buffer does not fit the socket buffers,
+ *          so that the sending resumes after partial writes.
+ **/
+TEST( SocketLoopbackTest, GatherWriteSendsAllBuffers )
+{
+    SocketServer server;
+    SocketClient client;
+    SocketAccepted accepted;
+    ASSERT_TRUE( _connect( server, client, accepted ) );
+
+    std::vector<unsigned char> small( 7u, static_cast<unsigned char>(0xA5u) );
+    std::vector<unsigned char> large( 4u * 1024u * 1024u + 3u );
+    for ( size_t i = 0; i < large.size( ); ++ i )
+    {
+        large[i] = static_cast<unsigned char>((i * 31u) >> 3);
+    }
+
+    const NESocket::sSendBuffer buffers[]
+    {
+          { small.data( ), static_cast<unsigned int>(small.size( )) }
+        , { large.data( ), 0u }
+        , { large.data( ), static_cast<unsigned int>(large.size( )) }
+        , { small.data( ), 1u }
+    };
+
+    std::vector<unsigned char> expected;
+    for ( const NESocket::sSendBuffer & buffer : buffers )
+    {
+        expected.insert( expected.end( ), buffer.sbData, buffer.sbData + buffer.sbLength );
+    }
+
+    std::vector<unsigned char> received( expected.size( ) );
+    int receivedBytes{ 0 };
+    std::thread receiver( [&accepted, &received, &receivedBytes]( )
+        {
+            receivedBytes = accepted.receiveData( received.data( ), static_cast<int>(received.size( )) );
+        } );
+
+    const int sent{ client.sendBuffers( buffers, static_cast<int>(MACRO_ARRAYLEN( buffers )) ) };
+    receiver.join( );
+
+    ASSERT_EQ( sent, static_cast<int>(expected.size( )) );
+    ASSERT_EQ( receivedBytes, static_cast<int>(expected.size( )) );
+    ASSERT_TRUE( received == expected );
+}
+
+/**
+ * \brief   The remote messages sent with the header and the data by one call
+ *          are received the same.
+ **/
+TEST( SocketLoopbackTest, SendAndReceiveMessages )
+{
+    SocketServer server;
+    SocketClient client;
+    SocketAccepted accepted;
+    ASSERT_TRUE( _connect( server, client, accepted ) );
+
+    std::vector<RemoteMessage> messages;
+    for ( uint32_t payload : { 0u, 1u, 100u, 1024u * 1024u, 5u } )
+    {
+        messages.push_back( _createMessage( NEService::COOKIE_REMOTE_SERVICE + payload, payload ) );
+    }
+
+    LoopbackConnection connection;
+    std::vector<int> sent;
+    std::thread sender( [&connection, &client, &messages, &sent]( )
+        {
+            for ( const RemoteMessage & msg : messages )
+            {
+                sent.push_back( connection.sendMessage( msg, client ) );
+            }
+        } );
+
+    std::vector<RemoteMessage> received;
+    for ( size_t i = 0; i < messages.size( ); ++ i )
+    {
+        RemoteMessage msg;
+        if ( connection.receiveMessage( msg, accepted ) <= 0 )
+            break;
+
+        received.push_back( msg );
+    }
+
+    client.closeSocket( );
+    sender.join( );
+    ASSERT_EQ( sent.size( ), messages.size( ) );
+    ASSERT_EQ( received.size( ), messages.size( ) );
+    for ( size_t i = 0; i < messages.size( ); ++ i )
+    {
+        ASSERT_GT( sent[i], 0 );
+        _compare( messages[i], received[i] );
+    }
+}
+
+/**
+ * \brief   The options of the profile are set on the connected and accepted sockets,
+ *          the cached sizes of packets are updated.
+ **/
+TEST( SocketLoopbackTest, ApplyProfile )
+{
+    SocketServer server;
+    SocketClient client;
+    SocketAccepted accepted;
+    ASSERT_TRUE( _connect( server, client, accepted ) );
+
+    ASSERT_FALSE( SocketAccepted( ).applyProfile( NESocket::DefaultSocketProfile ) );
+
+    constexpr NESocket::sSocketProfile disabled{ false, false, 0u, 0u };
+    ASSERT_TRUE( client.applyProfile( disabled ) );
+    ASSERT_EQ( _getOption( client, IPPROTO_TCP, TCP_NODELAY ), 0 );
+    ASSERT_EQ( _getOption( client, SOL_SOCKET, SO_KEEPALIVE ), 0 );
+
+    for ( const Socket * socket : { static_cast<const Socket *>(&client), static_cast<const Socket *>(&accepted) } )
+    {
+        constexpr NESocket::sSocketProfile profile{ true, true, 64u * 1024u, 0u };
+        ASSERT_TRUE( socket->applyProfile( profile ) );
+        ASSERT_NE( _getOption( *socket, IPPROTO_TCP, TCP_NODELAY ), 0 );
+        ASSERT_NE( _getOption( *socket, SOL_SOCKET, SO_KEEPALIVE ), 0 );
+        ASSERT_GE( socket->getSendPacketSize( ), profile.spBufferSize );
+        ASSERT_GE( socket->getRecvPacketSize( ), profile.spBufferSize );
+        ASSERT_EQ( socket->getSendPacketSize( ), static_cast<unsigned int>(_getOption( *socket, SOL_SOCKET, SO_SNDBUF )) );
+        ASSERT_EQ( socket->getRecvPacketSize( ), static_cast<unsigned int>(_getOption( *socket, SOL_SOCKET, SO_RCVBUF )) );
+    }
+}
+
+/**
+ * \brief   The small message is sent back and forth with the default socket profile.
+ *          Prints the average round trip time.
+ **/
+TEST( SocketLoopbackTest, PingPongLatency )
+{
+    SocketServer server;
+    SocketClient client;
+    SocketAccepted accepted;
+    ASSERT_TRUE( _connect( server, client, accepted ) );
+    ASSERT_TRUE( client.applyProfile( NESocket::DefaultSocketProfile ) );
+    ASSERT_TRUE( accepted.applyProfile( NESocket::DefaultSocketProfile ) );
+
+    LoopbackConnection connection;
+    std::thread echo( [&connection, &accepted]( )
+        {
+            RemoteMessage msg;
+            for ( unsigned int i = 0; (i < PING_PONG_COUNT) && (connection.receiveMessage( msg, accepted ) > 0); ++ i )
+            {
+                connection.sendMessage( msg, accepted );
+            }
+        } );
+
+    const RemoteMessage ping{ _createMessage( NEService::COOKIE_REMOTE_SERVICE, 64u ) };
+    const auto start{ std::chrono::steady_clock::now( ) };
+    unsigned int count{ 0u };
+    for ( ; count < PING_PONG_COUNT; ++ count )
+    {
+        RemoteMessage pong;
+        if ( (connection.sendMessage( ping, client ) <= 0) || (connection.receiveMessage( pong, client ) <= 0) )
+            break;
+    }
+
+    const auto duration{ std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now( ) - start) };
+    client.closeSocket( );
+    echo.join( );
+
+    ASSERT_EQ( count, PING_PONG_COUNT );
+    std::cout << "Ping-pong of " << count << " messages, average round trip "
+              << (duration.count( ) / static_cast<long long>(count)) / 1000 << " us" << std::endl;
+}
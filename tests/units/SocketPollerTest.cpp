@@ -0,0 +1,110 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SocketPollerTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Google test of waiting and interrupting
+ *              the socket poller.
+ ************************************************************************/
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SocketClient.hpp"
+#include "areg/base/SocketPoller.hpp"
+#include "areg/base/SocketServer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //!< The loopback address to listen the connection.
+    constexpr char              LOOPBACK_ADDRESS[]  { "127.0.0.1" };
+    //!< The first port number to try to listen the connection.
+    constexpr unsigned short    FIRST_PORT          { 18683u };
+    //!< The number of ports to try to listen the connection.
+    constexpr unsigned short    PORT_COUNT          { 100u };
+    //!< The time in milliseconds to make sure the waiting thread is blocked.
+    constexpr unsigned int      BLOCK_TIMEOUT       { 50u };
+    //!< The timeout in milliseconds to wait for the socket event.
+    constexpr unsigned int      EVENT_TIMEOUT       { 500u };
+    //!< The maximum number of wake-ups to wait for the socket event.
+    constexpr int               MAX_WAKEUPS         { 10 };
+
+    /**
+     * \brief   Creates the server socket listening on the loopback address.
+     **/
+    bool _listen( SocketServer & server )
+    {
+        bool result{ false };
+        for ( unsigned short port = FIRST_PORT; (result == false) && (port < FIRST_PORT + PORT_COUNT); ++ port )
+        {
+            result = server.createSocket( LOOPBACK_ADDRESS, port ) && server.listenConnection( 1 );
+        }
+
+        return result;
+    }
+}
+
+/**
+ * \brief   The poller without sockets blocks until it is interrupted.
+ **/
+TEST( SocketPollerTest, EmptyPollerWaitsForInterrupt )
+{
+    SocketPoller poller;
+    ASSERT_TRUE( poller.create( ) );
+
+    std::atomic_bool finished{ false };
+    int result{ -1 };
+    std::thread waiter( [&]( ) {
+        SocketPoller::sPollEvent events[ SocketPoller::MAX_POLL_EVENTS ];
+        result = poller.waitEvents( events, SocketPoller::MAX_POLL_EVENTS, NECommon::WAIT_INFINITE );
+        finished = true;
+        } );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( BLOCK_TIMEOUT ) );
+    EXPECT_FALSE( finished );
+    poller.interrupt( );
+    waiter.join( );
+    EXPECT_EQ( result, 0 );
+}
+
+/**
+ * \brief   The socket added while other thread waits for events is reported.
+ **/
+TEST( SocketPollerTest, ReportsSocketAddedWhileWaiting )
+{
+    SocketServer server;
+    SocketClient client;
+    ASSERT_TRUE( _listen( server ) );
+
+    SocketPoller poller;
+    ASSERT_TRUE( poller.create( ) );
+
+    SOCKETHANDLE reported{ NESocket::InvalidSocketHandle };
+    std::thread waiter( [&]( ) {
+        SocketPoller::sPollEvent events[ SocketPoller::MAX_POLL_EVENTS ];
+        for ( int i = 0; (i < MAX_WAKEUPS) && (reported == NESocket::InvalidSocketHandle); ++ i )
+        {
+            if ( poller.waitEvents( events, SocketPoller::MAX_POLL_EVENTS, EVENT_TIMEOUT ) > 0 )
+            {
+                reported = events[ 0 ].peSocket;
+            }
+        }
+        } );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( BLOCK_TIMEOUT ) );
+    EXPECT_TRUE( poller.addSocket( server.getHandle( ), static_cast<uint32_t>(SocketPoller::ePollEvent::PollRead), false ) );
+    EXPECT_TRUE( client.createSocket( server.getAddress( ).getHostAddress( ).getString( ), server.getAddress( ).getHostPort( ) ) );
+    waiter.join( );
+    EXPECT_EQ( reported, server.getHandle( ) );
+}